@@ -9,10 +9,26 @@
 #include "audio_core/common.h"
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "common/microprofile.h"
+#include "common/thread.h"
 #include "core/core.h"
 #include "core/hle/kernel/writable_event.h"
 #include "core/memory.h"
 
+#ifdef ARCHITECTURE_x86_64
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+
+#ifdef _MSC_VER
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+MICROPROFILE_DEFINE(AudioRenderer_Mix, "Audio", "Queue Mixed Buffer", MP_RGB(70, 140, 200));
+MICROPROFILE_DEFINE(AudioRenderer_Update, "Audio", "Renderer Update", MP_RGB(70, 140, 200));
+
 namespace AudioCore {
 
 constexpr u32 STREAM_SAMPLE_RATE{48000};
@@ -43,6 +59,17 @@ public:
     void RefreshBuffer(Core::Memory::Memory& memory, const VoiceChannelHolder& voice_resources);
 
 private:
+    /// Decoded PCM of the most recently decoded ADPCM wave buffer. Re-triggered SFX refresh the
+    /// same buffer with identical predictor state every time, so they only decode once.
+    struct DecodeCache {
+        u64 buffer_addr{};
+        u64 buffer_sz{};
+        Codec::ADPCMState start_state{};
+        Codec::ADPCMState end_state{};
+        Codec::ADPCM_Coeff coeffs{};
+        std::vector<s16> samples;
+    };
+
     bool is_in_use{};
     bool is_refresh_pending{};
     std::size_t wave_index{};
@@ -50,6 +77,7 @@ private:
     Codec::ADPCMState adpcm_state{};
     InterpolationState interp_state{};
     std::vector<s16> samples;
+    DecodeCache decode_cache{};
     VoiceOutStatus out_status{};
     VoiceInfo info{};
 };
@@ -91,9 +119,18 @@ AudioRenderer::AudioRenderer(Core::Timing::CoreTiming& core_timing, Core::Memory
     QueueMixedBuffer(0);
     QueueMixedBuffer(1);
     QueueMixedBuffer(2);
+
+    update_thread = std::thread(&AudioRenderer::UpdateThreadFunc, this);
 }
 
-AudioRenderer::~AudioRenderer() = default;
+AudioRenderer::~AudioRenderer() {
+    {
+        std::lock_guard lock{state_mutex};
+        shutdown_requested = true;
+    }
+    update_cv.notify_one();
+    update_thread.join();
+}
 
 u32 AudioRenderer::GetSampleRate() const {
     return worker_params.sample_rate;
@@ -112,11 +149,15 @@ Stream::State AudioRenderer::GetStreamState() const {
 }
 
 ResultVal<std::vector<u8>> AudioRenderer::UpdateAudioRenderer(const std::vector<u8>& input_params) {
+    MICROPROFILE_SCOPE(AudioRenderer_Update);
+
     // Copy UpdateDataHeader struct
     UpdateDataHeader config{};
     std::memcpy(&config, input_params.data(), sizeof(UpdateDataHeader));
     u32 memory_pool_count = worker_params.effect_count + (worker_params.voice_count * 4);
 
+    std::unique_lock lock{state_mutex};
+
     if (!behavior_info.UpdateInput(input_params, sizeof(UpdateDataHeader))) {
         LOG_ERROR(Audio, "Failed to update behavior info input parameters");
         return Audren::ERR_INVALID_PARAMETERS;
@@ -128,28 +169,6 @@ ResultVal<std::vector<u8>> AudioRenderer::UpdateAudioRenderer(const std::vector<
                 input_params.data() + sizeof(UpdateDataHeader) + config.behavior_size,
                 memory_pool_count * sizeof(MemoryPoolInfo));
 
-    // Copy voice resources
-    const std::size_t voice_resource_offset{sizeof(UpdateDataHeader) + config.behavior_size +
-                                            config.memory_pools_size};
-    std::memcpy(voice_resources.data(), input_params.data() + voice_resource_offset,
-                sizeof(VoiceResourceInformation) * voice_resources.size());
-
-    // Copy VoiceInfo structs
-    std::size_t voice_offset{sizeof(UpdateDataHeader) + config.behavior_size +
-                             config.memory_pools_size + config.voice_resource_size};
-    for (auto& voice : voices) {
-        std::memcpy(&voice.GetInfo(), input_params.data() + voice_offset, sizeof(VoiceInfo));
-        voice_offset += sizeof(VoiceInfo);
-    }
-
-    std::size_t effect_offset{sizeof(UpdateDataHeader) + config.behavior_size +
-                              config.memory_pools_size + config.voice_resource_size +
-                              config.voices_size};
-    for (auto& effect : effects) {
-        std::memcpy(&effect.GetInfo(), input_params.data() + effect_offset, sizeof(EffectInStatus));
-        effect_offset += sizeof(EffectInStatus);
-    }
-
     // Update memory pool state
     std::vector<MemoryPoolEntry> memory_pool(memory_pool_count);
     for (std::size_t index = 0; index < memory_pool.size(); ++index) {
@@ -160,23 +179,9 @@ ResultVal<std::vector<u8>> AudioRenderer::UpdateAudioRenderer(const std::vector<
         }
     }
 
-    // Update voices
-    for (auto& voice : voices) {
-        voice.UpdateState();
-        if (!voice.GetInfo().is_in_use) {
-            continue;
-        }
-        if (voice.GetInfo().is_new) {
-            voice.SetWaveIndex(voice.GetInfo().wave_buffer_head);
-        }
-    }
-
-    for (auto& effect : effects) {
-        effect.UpdateState(memory);
-    }
-
-    // Release previous buffers and queue next ones for playback
-    ReleaseAndQueueBuffers();
+    // The voice/effect portion of the blob is applied by the update thread; the reply below is
+    // built from whatever state the last mix produced, so the guest gets its answer without
+    // waiting for the mix.
 
     // Copy output header
     UpdateDataHeader response_data{worker_params};
@@ -231,9 +236,86 @@ ResultVal<std::vector<u8>> AudioRenderer::UpdateAudioRenderer(const std::vector<
                     sizeof(RendererInfo));
     }
 
+    // Hand the blob to the update thread. A previous blob that has not been applied yet is
+    // superseded; the guest always wants the latest parameters.
+    pending_update = input_params;
+    lock.unlock();
+    update_cv.notify_one();
+
     return MakeResult(output_params);
 }
 
+void AudioRenderer::ApplyPendingUpdate(const std::vector<u8>& input_params) {
+    UpdateDataHeader config{};
+    std::memcpy(&config, input_params.data(), sizeof(UpdateDataHeader));
+
+    // Copy voice resources
+    const std::size_t voice_resource_offset{sizeof(UpdateDataHeader) + config.behavior_size +
+                                            config.memory_pools_size};
+    std::memcpy(voice_resources.data(), input_params.data() + voice_resource_offset,
+                sizeof(VoiceResourceInformation) * voice_resources.size());
+
+    // Copy VoiceInfo structs
+    std::size_t voice_offset{sizeof(UpdateDataHeader) + config.behavior_size +
+                             config.memory_pools_size + config.voice_resource_size};
+    for (auto& voice : voices) {
+        std::memcpy(&voice.GetInfo(), input_params.data() + voice_offset, sizeof(VoiceInfo));
+        voice_offset += sizeof(VoiceInfo);
+    }
+
+    std::size_t effect_offset{sizeof(UpdateDataHeader) + config.behavior_size +
+                              config.memory_pools_size + config.voice_resource_size +
+                              config.voices_size};
+    for (auto& effect : effects) {
+        std::memcpy(&effect.GetInfo(), input_params.data() + effect_offset, sizeof(EffectInStatus));
+        effect_offset += sizeof(EffectInStatus);
+    }
+
+    // Update voices and resolve the slots the mix loop has to visit. Unused slots stay out of
+    // the active lists until the next parameter update brings them back.
+    active_voices.clear();
+    for (std::size_t index = 0; index < voices.size(); ++index) {
+        auto& voice = voices[index];
+        voice.UpdateState();
+        if (!voice.GetInfo().is_in_use) {
+            continue;
+        }
+        if (voice.GetInfo().is_new) {
+            voice.SetWaveIndex(voice.GetInfo().wave_buffer_head);
+        }
+        active_voices.push_back(index);
+    }
+
+    active_effects.clear();
+    for (std::size_t index = 0; index < effects.size(); ++index) {
+        auto& effect = effects[index];
+        if (effect.GetInfo().type == Effect::None && !effect.GetInfo().is_new) {
+            // Empty slot with nothing to acknowledge; UpdateState would be a no-op.
+            continue;
+        }
+        effect.UpdateState(memory);
+        active_effects.push_back(index);
+    }
+}
+
+void AudioRenderer::UpdateThreadFunc() {
+    Common::SetCurrentThreadRole(Common::ThreadRole::Audio, "yuzu:AudioUpdate");
+
+    std::unique_lock lock{state_mutex};
+    while (true) {
+        update_cv.wait(lock, [this] { return shutdown_requested || !pending_update.empty(); });
+        if (shutdown_requested) {
+            return;
+        }
+        applying_update.swap(pending_update);
+        pending_update.clear();
+        ApplyPendingUpdate(applying_update);
+
+        // Release previous buffers and queue next ones for playback
+        ReleaseAndQueueBuffers();
+    }
+}
+
 void AudioRenderer::VoiceState::SetWaveIndex(std::size_t index) {
     wave_index = index & 3;
     is_refresh_pending = true;
@@ -295,24 +377,48 @@ void AudioRenderer::VoiceState::RefreshBuffer(Core::Memory::Memory& memory,
                                               const VoiceChannelHolder& voice_resources) {
     const auto wave_buffer_address = info.wave_buffer[wave_index].buffer_addr;
     const auto wave_buffer_size = info.wave_buffer[wave_index].buffer_sz;
-    std::vector<s16> new_samples(wave_buffer_size / sizeof(s16));
-    memory.ReadBlock(wave_buffer_address, new_samples.data(), wave_buffer_size);
+    std::vector<s16> new_samples;
 
     switch (static_cast<Codec::PcmFormat>(info.sample_format)) {
     case Codec::PcmFormat::Int16: {
         // PCM16 is played as-is
+        new_samples.resize(wave_buffer_size / sizeof(s16));
+        memory.ReadBlock(wave_buffer_address, new_samples.data(), wave_buffer_size);
         break;
     }
     case Codec::PcmFormat::Adpcm: {
         // Decode ADPCM to PCM16
         Codec::ADPCM_Coeff coeffs;
         memory.ReadBlock(info.additional_params_addr, coeffs.data(), sizeof(Codec::ADPCM_Coeff));
-        new_samples = Codec::DecodeADPCM(reinterpret_cast<u8*>(new_samples.data()),
-                                         new_samples.size() * sizeof(s16), coeffs, adpcm_state);
+
+        if (decode_cache.buffer_addr == wave_buffer_address &&
+            decode_cache.buffer_sz == wave_buffer_size &&
+            decode_cache.start_state.yn1 == adpcm_state.yn1 &&
+            decode_cache.start_state.yn2 == adpcm_state.yn2 && decode_cache.coeffs == coeffs) {
+            // Same buffer, same predictor state and same coefficients as the previous decode;
+            // the output is identical, so skip the guest memory read and the decode.
+            new_samples = decode_cache.samples;
+            adpcm_state = decode_cache.end_state;
+            break;
+        }
+
+        decode_cache.buffer_addr = wave_buffer_address;
+        decode_cache.buffer_sz = wave_buffer_size;
+        decode_cache.start_state = adpcm_state;
+        decode_cache.coeffs = coeffs;
+
+        std::vector<u8> adpcm_data(wave_buffer_size);
+        memory.ReadBlock(wave_buffer_address, adpcm_data.data(), wave_buffer_size);
+        new_samples = Codec::DecodeADPCM(adpcm_data.data(), adpcm_data.size(), coeffs, adpcm_state);
+
+        decode_cache.end_state = adpcm_state;
+        decode_cache.samples = new_samples;
         break;
     }
     default:
         UNIMPLEMENTED_MSG("Unimplemented sample_format={}", info.sample_format);
+        new_samples.resize(wave_buffer_size / sizeof(s16));
+        memory.ReadBlock(wave_buffer_address, new_samples.data(), wave_buffer_size);
         break;
     }
 
@@ -425,11 +531,81 @@ static constexpr s16 ClampToS16(s32 value) {
     return static_cast<s16>(std::clamp(value, -32768, 32767));
 }
 
+#ifdef ARCHITECTURE_x86_64
+/// Accumulates gain-scaled samples into the mix buffer eight at a time, saturating to s16 like
+/// ClampToS16. Truncating float conversions are used to match the scalar path exactly.
+static std::size_t MixSamplesSse2(s16* buffer, const s16* samples, std::size_t count,
+                                  float volume) {
+    const __m128 gain = _mm_set1_ps(volume);
+    const std::size_t aligned_count = count & ~std::size_t{7};
+    for (std::size_t i = 0; i < aligned_count; i += 8) {
+        const __m128i in16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+        const __m128i in_lo = _mm_srai_epi32(_mm_unpacklo_epi16(in16, in16), 16);
+        const __m128i in_hi = _mm_srai_epi32(_mm_unpackhi_epi16(in16, in16), 16);
+        const __m128i scaled_lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(in_lo), gain));
+        const __m128i scaled_hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(in_hi), gain));
+        const __m128i buf16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i));
+        const __m128i buf_lo = _mm_srai_epi32(_mm_unpacklo_epi16(buf16, buf16), 16);
+        const __m128i buf_hi = _mm_srai_epi32(_mm_unpackhi_epi16(buf16, buf16), 16);
+        const __m128i sum_lo = _mm_add_epi32(buf_lo, scaled_lo);
+        const __m128i sum_hi = _mm_add_epi32(buf_hi, scaled_hi);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer + i),
+                         _mm_packs_epi32(sum_lo, sum_hi));
+    }
+    return aligned_count;
+}
+
+/// 16-wide variant of MixSamplesSse2 for hosts with AVX2.
+TARGET_AVX2 static std::size_t MixSamplesAvx2(s16* buffer, const s16* samples, std::size_t count,
+                                              float volume) {
+    const __m256 gain = _mm256_set1_ps(volume);
+    const std::size_t aligned_count = count & ~std::size_t{15};
+    for (std::size_t i = 0; i < aligned_count; i += 16) {
+        const __m256i in_lo = _mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i)));
+        const __m256i in_hi = _mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i + 8)));
+        const __m256i scaled_lo =
+            _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(in_lo), gain));
+        const __m256i scaled_hi =
+            _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(in_hi), gain));
+        const __m256i buf_lo = _mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i)));
+        const __m256i buf_hi = _mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i + 8)));
+        const __m256i sum_lo = _mm256_add_epi32(buf_lo, scaled_lo);
+        const __m256i sum_hi = _mm256_add_epi32(buf_hi, scaled_hi);
+        // packs works lane-wise, so restore sample order afterwards
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(sum_lo, sum_hi),
+                                                        _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(buffer + i), packed);
+    }
+    return aligned_count;
+}
+#endif
+
+/// Mixes samples into buffer with a constant gain, saturating to the s16 range.
+static void MixSamples(s16* buffer, const s16* samples, std::size_t count, float volume) {
+    std::size_t index = 0;
+#ifdef ARCHITECTURE_x86_64
+    static const bool has_avx2 = Common::GetCPUCaps().avx2;
+    index = has_avx2 ? MixSamplesAvx2(buffer, samples, count, volume)
+                     : MixSamplesSse2(buffer, samples, count, volume);
+#endif
+    for (; index < count; ++index) {
+        const s32 buffer_sample{buffer[index]};
+        buffer[index] = ClampToS16(buffer_sample + static_cast<s32>(samples[index] * volume));
+    }
+}
+
 void AudioRenderer::QueueMixedBuffer(Buffer::Tag tag) {
+    MICROPROFILE_SCOPE(AudioRenderer_Mix);
+
     constexpr std::size_t BUFFER_SIZE{512};
     std::vector<s16> buffer(BUFFER_SIZE * stream->GetNumChannels());
 
-    for (auto& voice : voices) {
+    for (const std::size_t voice_index : active_voices) {
+        auto& voice = voices[voice_index];
         if (!voice.IsPlaying()) {
             continue;
         }
@@ -451,11 +627,9 @@ void AudioRenderer::QueueMixedBuffer(Buffer::Tag tag) {
 
             samples_remaining -= samples.size() / stream->GetNumChannels();
 
-            for (const auto& sample : samples) {
-                const s32 buffer_sample{buffer[offset]};
-                buffer[offset++] =
-                    ClampToS16(buffer_sample + static_cast<s32>(sample * voice.GetInfo().volume));
-            }
+            MixSamples(buffer.data() + offset, samples.data(), samples.size(),
+                       voice.GetInfo().volume);
+            offset += samples.size();
         }
     }
     audio_out->QueueBuffer(stream, tag, std::move(buffer));
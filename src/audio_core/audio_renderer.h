@@ -5,7 +5,10 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "audio_core/behavior_info.h"
@@ -252,6 +255,12 @@ public:
     Stream::State GetStreamState() const;
 
 private:
+    /// Copies a parameter blob into the voice/effect state. Runs on the update thread.
+    void ApplyPendingUpdate(const std::vector<u8>& input_params);
+
+    /// Applies queued parameter blobs and mixes, off the emulated cores
+    void UpdateThreadFunc();
+
     class EffectState;
     class VoiceState;
     BehaviorInfo behavior_info{};
@@ -261,10 +270,25 @@ private:
     std::vector<VoiceState> voices;
     std::vector<VoiceResourceInformation> voice_resources;
     std::vector<EffectState> effects;
+    /// Indices of the voice/effect slots that are in use, resolved once per parameter update so
+    /// the mix loop does not visit unused slots. Voices may pause themselves mid-frame, so
+    /// active_voices is a superset of the voices that actually produce samples.
+    std::vector<std::size_t> active_voices;
+    std::vector<std::size_t> active_effects;
     std::unique_ptr<AudioOut> audio_out;
     StreamPtr stream;
     Core::Memory::Memory& memory;
     std::size_t elapsed_frame_count{};
+
+    /// Guards voices, effects, behavior info and the stream against the update thread
+    std::mutex state_mutex;
+    std::condition_variable update_cv;
+    /// Double-buffered parameter blob: the handler writes pending_update, the update thread
+    /// swaps it into applying_update
+    std::vector<u8> pending_update;
+    std::vector<u8> applying_update;
+    bool shutdown_requested{};
+    std::thread update_thread;
 };
 
 } // namespace AudioCore
@@ -37,34 +37,31 @@ std::vector<s16> DecodeADPCM(const u8* const data, std::size_t size, const ADPCM
         const int coef1 = coeff[idx * 2 + 0];
         const int coef2 = coeff[idx * 2 + 1];
 
-        // Decodes an audio sample. One nibble produces one sample.
-        const auto decode_sample = [&](const int nibble) -> s16 {
-            const int xn = nibble * scale;
-            // We first transform everything into 11 bit fixed point, perform the second order
-            // digital filter, then transform back.
-            // 0x400 == 0.5 in 11 bit fixed point.
-            // Filter: y[n] = x[n] + 0.5 + c1 * y[n-1] + c2 * y[n-2]
-            int val = ((xn << 11) + 0x400 + coef1 * yn1 + coef2 * yn2) >> 11;
+        // Unpack and scale the whole frame up front. This loop has no cross-sample dependency,
+        // so it vectorizes, unlike the filter below.
+        std::array<int, SAMPLES_PER_FRAME> xn;
+        const u8* const frame_data = data + framei * FRAME_LEN + 1;
+        for (std::size_t i = 0; i < SAMPLES_PER_FRAME / 2; ++i) {
+            const int byte = frame_data[i];
+            xn[i * 2 + 0] = SIGNED_NIBBLES[byte >> 4] * scale;
+            xn[i * 2 + 1] = SIGNED_NIBBLES[byte & 0xF] * scale;
+        }
+
+        // The second order feedback keeps the filter serial: y[n] needs the clamped y[n-1].
+        // We first transform everything into 11 bit fixed point, perform the filter, then
+        // transform back.
+        // 0x400 == 0.5 in 11 bit fixed point.
+        // Filter: y[n] = x[n] + 0.5 + c1 * y[n-1] + c2 * y[n-2]
+        const std::size_t outputi = framei * SAMPLES_PER_FRAME;
+        const std::size_t frame_samples = std::min(SAMPLES_PER_FRAME, sample_count - outputi);
+        for (std::size_t i = 0; i < frame_samples; ++i) {
+            int val = ((xn[i] << 11) + 0x400 + coef1 * yn1 + coef2 * yn2) >> 11;
             // Clamp to output range.
             val = std::clamp<s32>(val, -32768, 32767);
             // Advance output feedback.
             yn2 = yn1;
             yn1 = val;
-            return static_cast<s16>(val);
-        };
-
-        std::size_t outputi = framei * SAMPLES_PER_FRAME;
-        std::size_t datai = framei * FRAME_LEN + 1;
-        for (std::size_t i = 0; i < SAMPLES_PER_FRAME && outputi < sample_count; i += 2) {
-            const s16 sample1 = decode_sample(SIGNED_NIBBLES[data[datai] >> 4]);
-            ret[outputi] = sample1;
-            outputi++;
-
-            const s16 sample2 = decode_sample(SIGNED_NIBBLES[data[datai] & 0xF]);
-            ret[outputi] = sample2;
-            outputi++;
-
-            datai++;
+            ret[outputi + i] = static_cast<s16>(val);
         }
     }
 
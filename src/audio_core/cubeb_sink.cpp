@@ -4,6 +4,8 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cmath>
 #include <cstring>
 #include "audio_core/cubeb_sink.h"
 #include "audio_core/stream.h"
@@ -21,10 +23,10 @@ namespace AudioCore {
 
 class CubebSinkStream final : public SinkStream {
 public:
-    CubebSinkStream(cubeb* ctx, u32 sample_rate, u32 num_channels_, cubeb_devid output_device,
+    CubebSinkStream(cubeb* ctx, u32 sample_rate_, u32 num_channels_, cubeb_devid output_device,
                     const std::string& name)
-        : ctx{ctx}, num_channels{std::min(num_channels_, 2u)}, time_stretch{sample_rate,
-                                                                            num_channels} {
+        : ctx{ctx}, sample_rate{sample_rate_}, num_channels{std::min(num_channels_, 2u)},
+          time_stretch{sample_rate_, num_channels} {
 
         cubeb_stream_params params{};
         params.rate = sample_rate;
@@ -61,6 +63,13 @@ public:
         }
 
         cubeb_stream_destroy(stream_backend);
+
+        if (dropped_samples > 0 || padded_frames > 0) {
+            LOG_INFO(Audio_Sink,
+                     "Stream shut down with {} dropped samples (overruns) and {} padded frames "
+                     "(underruns)",
+                     dropped_samples.load(), padded_frames.load());
+        }
     }
 
     void EnqueueSamples(u32 source_num_channels, const std::vector<s16>& samples) override {
@@ -68,29 +77,43 @@ public:
             // Downsample 6 channels to 2
             ASSERT_MSG(source_num_channels == 6, "Channel count must be 6");
 
-            std::vector<s16> buf;
-            buf.reserve(samples.size() * num_channels / source_num_channels);
-            for (std::size_t i = 0; i < samples.size(); i += source_num_channels) {
-                // Downmixing implementation taken from the ATSC standard
-                const s16 left{samples[i + 0]};
-                const s16 right{samples[i + 1]};
-                const s16 center{samples[i + 2]};
-                const s16 surround_left{samples[i + 4]};
-                const s16 surround_right{samples[i + 5]};
-                // Not used in the ATSC reference implementation
-                [[maybe_unused]] const s16 low_frequency_effects { samples[i + 3] };
-
-                constexpr s32 clev{707}; // center mixing level coefficient
-                constexpr s32 slev{707}; // surround mixing level coefficient
-
-                buf.push_back(left + (clev * center / 1000) + (slev * surround_left / 1000));
-                buf.push_back(right + (clev * center / 1000) + (slev * surround_right / 1000));
+            // Downmix directly into slices reserved from the ring instead of staging the mixed
+            // frames in a temporary buffer and copying them through Push.
+            const std::size_t frame_count = samples.size() / source_num_channels;
+            std::size_t frame = 0;
+            while (frame < frame_count) {
+                const auto slice = queue.Reserve((frame_count - frame) * 2);
+                const std::size_t slice_frames = slice.slot_count / 2;
+                if (slice_frames == 0) {
+                    break;
+                }
+                s16* out = slice.data;
+                for (std::size_t f = 0; f < slice_frames; ++f, ++frame) {
+                    const std::size_t i = frame * source_num_channels;
+                    // Downmixing implementation taken from the ATSC standard
+                    const s16 left{samples[i + 0]};
+                    const s16 right{samples[i + 1]};
+                    const s16 center{samples[i + 2]};
+                    const s16 surround_left{samples[i + 4]};
+                    const s16 surround_right{samples[i + 5]};
+                    // Not used in the ATSC reference implementation
+                    [[maybe_unused]] const s16 low_frequency_effects { samples[i + 3] };
+
+                    constexpr s32 clev{707}; // center mixing level coefficient
+                    constexpr s32 slev{707}; // surround mixing level coefficient
+
+                    out[f * 2 + 0] = static_cast<s16>(left + (clev * center / 1000) +
+                                                      (slev * surround_left / 1000));
+                    out[f * 2 + 1] = static_cast<s16>(right + (clev * center / 1000) +
+                                                      (slev * surround_right / 1000));
+                }
+                queue.Commit(slice_frames * 2);
             }
-            queue.Push(buf);
+            dropped_samples += (frame_count - frame) * 2;
             return;
         }
 
-        queue.Push(samples);
+        dropped_samples += samples.size() - queue.Push(samples);
     }
 
     std::size_t SamplesInQueue(u32 channel_count) const override {
@@ -109,10 +132,30 @@ public:
     }
 
 private:
+    /// Tracks the callback cadence and retargets the buffered-audio level from its jitter.
+    /// Runs on the cubeb callback thread.
+    void UpdateTargetLatency(long num_frames) {
+        const auto now = std::chrono::steady_clock::now();
+        if (last_callback_time.time_since_epoch().count() != 0) {
+            const double interval = std::chrono::duration<double>(now - last_callback_time).count();
+            // Exponential moving averages of the callback interval and its absolute deviation
+            constexpr double gain = 0.05;
+            smoothed_interval += gain * (interval - smoothed_interval);
+            smoothed_jitter += gain * (std::abs(interval - smoothed_interval) - smoothed_jitter);
+        }
+        last_callback_time = now;
+
+        // Keep one callback worth of audio plus three deviations of slack in flight
+        const double callback_seconds = static_cast<double>(num_frames) / sample_rate;
+        time_stretch.SetTargetLatency(callback_seconds + smoothed_interval +
+                                      3.0 * smoothed_jitter);
+    }
+
     std::vector<std::string> device_list;
 
     cubeb* ctx{};
     cubeb_stream* stream_backend{};
+    u32 sample_rate{};
     u32 num_channels{};
 
     Common::RingBuffer<s16, 0x10000> queue;
@@ -120,6 +163,16 @@ private:
     std::atomic<bool> should_flush{};
     TimeStretcher time_stretch;
 
+    /// Samples EnqueueSamples could not fit into the ring (overruns)
+    std::atomic<u64> dropped_samples{};
+    /// Frames the callback had to pad with the last frame (underruns)
+    std::atomic<u64> padded_frames{};
+
+    // Callback jitter tracking; only touched from the cubeb callback thread
+    std::chrono::steady_clock::time_point last_callback_time{};
+    double smoothed_interval{};
+    double smoothed_jitter{};
+
     static long DataCallback(cubeb_stream* stream, void* user_data, const void* input_buffer,
                              void* output_buffer, long num_frames);
     static void StateCallback(cubeb_stream* stream, void* user_data, cubeb_state state);
@@ -193,6 +246,8 @@ long CubebSinkStream::DataCallback(cubeb_stream* stream, void* user_data, const
     const std::size_t samples_to_write = num_channels * num_frames;
     std::size_t samples_written;
 
+    impl->UpdateTargetLatency(num_frames);
+
     if (Settings::values.enable_audio_stretching) {
         const std::vector<s16> in{impl->queue.Pop()};
         const std::size_t num_in{in.size() / num_channels};
@@ -215,6 +270,9 @@ long CubebSinkStream::DataCallback(cubeb_stream* stream, void* user_data, const
     }
 
     // Fill the rest of the frames with last_frame
+    if (samples_written < samples_to_write) {
+        impl->padded_frames += (samples_to_write - samples_written) / num_channels;
+    }
     for (std::size_t i = samples_written; i < samples_to_write; i += num_channels) {
         std::memcpy(buffer + i * sizeof(s16), &impl->last_frame[0], num_channels * sizeof(s16));
     }
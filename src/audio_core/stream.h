@@ -4,9 +4,13 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 #include <queue>
 
@@ -45,6 +49,7 @@ public:
 
     Stream(Core::Timing::CoreTiming& core_timing, u32 sample_rate, Format format,
            ReleaseCallback&& release_callback, SinkStream& sink_stream, std::string&& name_);
+    ~Stream();
 
     /// Plays the audio stream
     void Play();
@@ -101,6 +106,13 @@ private:
     /// Gets the number of core cycles when the specified buffer will be released
     s64 GetBufferReleaseNSHostTiming(const Buffer& buffer) const;
 
+    /// Arms the host-clock release timer for the active buffer
+    void ScheduleHostRelease(s64 release_ns);
+
+    /// Waits out buffer deadlines on the host clock, keeping the per-buffer releases out of the
+    /// core timing event heap
+    void ReleaseThreadFunc();
+
     u32 sample_rate;                  ///< Sample rate of the stream
     Format format;                    ///< Format of the stream
     float game_volume = 1.0f;         ///< The volume the game currently has set
@@ -114,6 +126,13 @@ private:
     SinkStream& sink_stream;                ///< Output sink for the stream
     Core::Timing::CoreTiming& core_timing;  ///< Core timing instance.
     std::string name;                       ///< Name of the stream, must be unique
+
+    std::mutex release_mutex;     ///< Guards the host release timer state
+    std::condition_variable release_cv;
+    std::chrono::steady_clock::time_point release_time{}; ///< Deadline of the armed release
+    bool release_pending{};       ///< Whether a release is armed on the host timer
+    bool stopping{};              ///< Tells the release thread to shut down
+    std::thread release_thread;   ///< Host-clock release thread, only used under host timing
 };
 
 using StreamPtr = std::shared_ptr<Stream>;
@@ -10,6 +10,10 @@
 
 namespace AudioCore {
 
+namespace {
+constexpr double MaxLatency = 0.25; // seconds
+} // Anonymous namespace
+
 TimeStretcher::TimeStretcher(u32 sample_rate, u32 channel_count) : m_sample_rate{sample_rate} {
     m_sound_touch.setChannels(channel_count);
     m_sound_touch.setSampleRate(sample_rate);
@@ -25,6 +29,10 @@ void TimeStretcher::Flush() {
     m_sound_touch.flush();
 }
 
+void TimeStretcher::SetTargetLatency(double latency_seconds) {
+    m_target_fullness = std::clamp(latency_seconds / MaxLatency, 0.1, 0.9);
+}
+
 std::size_t TimeStretcher::Process(const s16* in, std::size_t num_in, s16* out,
                                    std::size_t num_out) {
     const double time_delta = static_cast<double>(num_out) / m_sample_rate; // seconds
@@ -32,19 +40,19 @@ std::size_t TimeStretcher::Process(const s16* in, std::size_t num_in, s16* out,
     // We were given actual_samples number of samples, and num_samples were requested from us.
     double current_ratio = static_cast<double>(num_in) / static_cast<double>(num_out);
 
-    const double max_latency = 0.25; // seconds
-    const double max_backlog = m_sample_rate * max_latency;
+    const double max_backlog = m_sample_rate * MaxLatency;
     const double backlog_fullness = m_sound_touch.numSamples() / max_backlog;
     if (backlog_fullness > 4.0) {
         // Too many samples in backlog: Don't push anymore on
         num_in = 0;
     }
 
-    // We ideally want the backlog to be about 50% full.
-    // This gives some headroom both ways to prevent underflow and overflow.
-    // We tweak current_ratio to encourage this.
+    // We ideally want the backlog sitting at the target fullness (50% by default, shifted by
+    // the sink according to its callback jitter). This gives headroom both ways to prevent
+    // underflow and overflow. We tweak current_ratio to encourage this.
     constexpr double tweak_time_scale = 0.05; // seconds
-    const double tweak_correction = (backlog_fullness - 0.5) * (time_delta / tweak_time_scale);
+    const double tweak_correction =
+        (backlog_fullness - m_target_fullness) * (time_delta / tweak_time_scale);
     current_ratio *= std::pow(1.0 + 2.0 * tweak_correction, tweak_correction < 0 ? 3.0 : 1.0);
 
     // This low-pass filter smoothes out variance in the calculated stretch ratio.
@@ -25,10 +25,15 @@ public:
 
     void Flush();
 
+    /// Sets the amount of buffered audio the backlog controller steers toward, in seconds.
+    /// Jittery sink callbacks want more audio in flight; steady ones can run closer to the wire.
+    void SetTargetLatency(double latency_seconds);
+
 private:
     u32 m_sample_rate;
     soundtouch::SoundTouch m_sound_touch;
     double m_stretch_ratio = 1.0;
+    double m_target_fullness = 0.5;
 };
 
 } // namespace AudioCore
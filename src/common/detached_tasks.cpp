@@ -5,6 +5,7 @@
 #include <thread>
 #include "common/assert.h"
 #include "common/detached_tasks.h"
+#include "common/logging/log.h"
 
 namespace Common {
 
@@ -15,25 +16,29 @@ DetachedTasks::DetachedTasks() {
     instance = this;
 }
 
-void DetachedTasks::WaitForAllTasks() {
-    std::unique_lock lock{mutex};
-    cv.wait(lock, [this]() { return count == 0; });
+void DetachedTasks::WaitForAllTasks(std::chrono::milliseconds timeout) {
+    std::unique_lock lock{state->mutex};
+    if (!state->cv.wait_for(lock, timeout, [this] { return state->count == 0; })) {
+        LOG_WARNING(Common, "Abandoning {} detached task(s) still running after {} ms",
+                    state->count, timeout.count());
+    }
 }
 
 DetachedTasks::~DetachedTasks() {
-    std::unique_lock lock{mutex};
-    ASSERT(count == 0);
     instance = nullptr;
 }
 
 void DetachedTasks::AddTask(std::function<void()> task) {
-    std::unique_lock lock{instance->mutex};
-    ++instance->count;
-    std::thread([task{std::move(task)}]() {
+    auto state = instance->state;
+    {
+        std::unique_lock lock{state->mutex};
+        ++state->count;
+    }
+    std::thread([state, task{std::move(task)}]() {
         task();
-        std::unique_lock lock{instance->mutex};
-        --instance->count;
-        std::notify_all_at_thread_exit(instance->cv, std::move(lock));
+        std::unique_lock lock{state->mutex};
+        --state->count;
+        state->cv.notify_all();
     })
         .detach();
 }
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
 #include <functional>
+#include <memory>
+#include <mutex>
 
 namespace Common {
 
@@ -25,16 +28,29 @@ class DetachedTasks {
 public:
     DetachedTasks();
     ~DetachedTasks();
-    void WaitForAllTasks();
+
+    /**
+     * Waits for all detached tasks to finish, up to the given time budget. Tasks still running
+     * when the budget expires (e.g. a telemetry post stuck on an unreachable network) are
+     * abandoned; they share ownership of the task bookkeeping and finish on their own without
+     * extending program teardown.
+     */
+    void WaitForAllTasks(std::chrono::milliseconds timeout = std::chrono::seconds{5});
 
     static void AddTask(std::function<void()> task);
 
 private:
+    /// Bookkeeping shared with the task threads, so an abandoned task never touches state that
+    /// has already been destroyed along with this object.
+    struct State {
+        std::condition_variable cv;
+        std::mutex mutex;
+        int count = 0;
+    };
+
     static DetachedTasks* instance;
 
-    std::condition_variable cv;
-    std::mutex mutex;
-    int count = 0;
+    std::shared_ptr<State> state = std::make_shared<State>();
 };
 
 } // namespace Common
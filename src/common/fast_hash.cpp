@@ -0,0 +1,100 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+// Based on wyhash by Wang Yi, released into the public domain.
+
+#include <cstring>
+
+#include "common/fast_hash.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Common {
+
+namespace {
+
+constexpr u64 SECRET0 = 0xa0761d6478bd642full;
+constexpr u64 SECRET1 = 0xe7037ed1a0b428dbull;
+constexpr u64 SECRET2 = 0x8ebc6af09c88c6e3ull;
+constexpr u64 SECRET3 = 0x589965cc75374cc3ull;
+
+/// Folds a full 64x64->128 bit multiplication into 64 bits. This is the mixing primitive the
+/// whole hash is built on; modern compilers lower it to two instructions.
+u64 Mix(u64 a, u64 b) {
+#ifdef _MSC_VER
+    u64 high;
+    const u64 low = _umul128(a, b, &high);
+    return low ^ high;
+#else
+    const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    return static_cast<u64>(product) ^ static_cast<u64>(product >> 64);
+#endif
+}
+
+u64 Read64(const u8* data) {
+    u64 value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+u64 Read32(const u8* data) {
+    u32 value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+/// Reads one to three bytes spread over the input so short keys still touch every byte.
+u64 ReadSmall(const u8* data, std::size_t size) {
+    return (u64{data[0]} << 16) | (u64{data[size >> 1]} << 8) | data[size - 1];
+}
+
+} // Anonymous namespace
+
+u64 FastHash64(const void* data, std::size_t size, u64 seed) {
+    const u8* p = static_cast<const u8*>(data);
+    seed ^= Mix(seed ^ SECRET0, SECRET1);
+
+    u64 a;
+    u64 b;
+    if (size <= 16) {
+        if (size >= 4) {
+            a = (Read32(p) << 32) | Read32(p + ((size >> 3) << 2));
+            b = (Read32(p + size - 4) << 32) | Read32(p + size - 4 - ((size >> 3) << 2));
+        } else if (size > 0) {
+            a = ReadSmall(p, size);
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        std::size_t remaining = size;
+        if (remaining > 48) {
+            // Three independent lanes keep the multipliers pipelined on bulk data.
+            u64 seed1 = seed;
+            u64 seed2 = seed;
+            do {
+                seed = Mix(Read64(p) ^ SECRET1, Read64(p + 8) ^ seed);
+                seed1 = Mix(Read64(p + 16) ^ SECRET2, Read64(p + 24) ^ seed1);
+                seed2 = Mix(Read64(p + 32) ^ SECRET3, Read64(p + 40) ^ seed2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (remaining > 16) {
+            seed = Mix(Read64(p) ^ SECRET1, Read64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        a = Read64(p + remaining - 16);
+        b = Read64(p + remaining - 8);
+    }
+
+    return Mix(SECRET1 ^ size, Mix(a ^ SECRET1, b ^ seed));
+}
+
+} // namespace Common
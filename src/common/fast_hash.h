@@ -0,0 +1,27 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Computes a fast 64-bit hash over the specified block of data. This is a wyhash-style hash that
+ * is considerably faster than CityHash64 on both short keys and bulk data, at comparable quality.
+ *
+ * The output is not stable across yuzu versions and must never be stored on disk; use CityHash64
+ * for anything persistent.
+ *
+ * @param data Block of data to compute the hash over
+ * @param size Length of data (in bytes) to compute the hash over
+ * @param seed Optional seed, e.g. a previous hash when combining multiple blocks
+ * @returns 64-bit hash value that was computed over the data block
+ */
+u64 FastHash64(const void* data, std::size_t size, u64 seed = 0);
+
+} // namespace Common
@@ -7,6 +7,10 @@
 #if defined(_WIN32) || defined(WIN32)
 #include <windows.h>
 #else
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <sys/mman.h>
 #include <boost/context/detail/fcontext.hpp>
 #endif
 
@@ -24,7 +28,7 @@ struct Fiber::FiberImpl {
 void Fiber::Start() {
     ASSERT(previous_fiber != nullptr);
     previous_fiber->guard.unlock();
-    previous_fiber.reset();
+    previous_fiber = nullptr;
     entry_point(start_parameter);
     UNREACHABLE();
 }
@@ -95,11 +99,11 @@ void Fiber::YieldTo(std::shared_ptr<Fiber>& from, std::shared_ptr<Fiber>& to) {
     ASSERT_MSG(from != nullptr, "Yielding fiber is null!");
     ASSERT_MSG(to != nullptr, "Next fiber is null!");
     to->guard.lock();
-    to->previous_fiber = from;
+    to->previous_fiber = from.get();
     SwitchToFiber(to->impl->handle);
     ASSERT(from->previous_fiber != nullptr);
     from->previous_fiber->guard.unlock();
-    from->previous_fiber.reset();
+    from->previous_fiber = nullptr;
 }
 
 std::shared_ptr<Fiber> Fiber::ThreadToFiber() {
@@ -112,20 +116,66 @@ std::shared_ptr<Fiber> Fiber::ThreadToFiber() {
 
 #else
 
+namespace {
+
+/**
+ * Pool of fiber stacks shared by every fiber in the process. Thread-spawn-heavy titles create
+ * thousands of short-lived fibers; recycling the stacks avoids hammering the allocator, and
+ * released stacks are decommitted so an idle pool holds address space rather than memory.
+ */
+class StackPool {
+public:
+    u8* Acquire() {
+        {
+            std::scoped_lock lock{guard};
+            if (!free_stacks.empty()) {
+                u8* const stack = free_stacks.back();
+                free_stacks.pop_back();
+                return stack;
+            }
+        }
+        void* const stack = mmap(nullptr, default_stack_size, PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        ASSERT_MSG(stack != MAP_FAILED, "Failed to allocate fiber stack");
+        return static_cast<u8*>(stack);
+    }
+
+    void Release(u8* stack) {
+        if (stack == nullptr) {
+            return;
+        }
+        // Keep the address range for reuse, but return the pages to the system.
+        madvise(stack, default_stack_size, MADV_DONTNEED);
+        std::scoped_lock lock{guard};
+        free_stacks.push_back(stack);
+    }
+
+private:
+    SpinLock guard;
+    std::vector<u8*> free_stacks;
+};
+
+StackPool& GetStackPool() {
+    static StackPool pool;
+    return pool;
+}
+
+} // Anonymous namespace
+
 struct Fiber::FiberImpl {
-    alignas(64) std::array<u8, default_stack_size> stack;
-    alignas(64) std::array<u8, default_stack_size> rewind_stack;
-    u8* stack_limit;
-    u8* rewind_stack_limit;
-    boost::context::detail::fcontext_t context;
-    boost::context::detail::fcontext_t rewind_context;
+    u8* stack = nullptr;
+    u8* rewind_stack = nullptr;
+    u8* stack_limit = nullptr;
+    u8* rewind_stack_limit = nullptr;
+    boost::context::detail::fcontext_t context{};
+    boost::context::detail::fcontext_t rewind_context{};
 };
 
 void Fiber::Start(boost::context::detail::transfer_t& transfer) {
     ASSERT(previous_fiber != nullptr);
     previous_fiber->impl->context = transfer.fctx;
     previous_fiber->guard.unlock();
-    previous_fiber.reset();
+    previous_fiber = nullptr;
     entry_point(start_parameter);
     UNREACHABLE();
 }
@@ -134,9 +184,8 @@ void Fiber::OnRewind([[maybe_unused]] boost::context::detail::transfer_t& transf
     ASSERT(impl->context != nullptr);
     impl->context = impl->rewind_context;
     impl->rewind_context = nullptr;
-    u8* tmp = impl->stack_limit;
-    impl->stack_limit = impl->rewind_stack_limit;
-    impl->rewind_stack_limit = tmp;
+    std::swap(impl->stack, impl->rewind_stack);
+    std::swap(impl->stack_limit, impl->rewind_stack_limit);
     rewind_point(rewind_parameter);
     UNREACHABLE();
 }
@@ -154,11 +203,11 @@ void Fiber::RewindStartFunc(boost::context::detail::transfer_t transfer) {
 Fiber::Fiber(std::function<void(void*)>&& entry_point_func, void* start_parameter)
     : entry_point{std::move(entry_point_func)}, start_parameter{start_parameter} {
     impl = std::make_unique<FiberImpl>();
-    impl->stack_limit = impl->stack.data();
-    impl->rewind_stack_limit = impl->rewind_stack.data();
+    impl->stack = GetStackPool().Acquire();
+    impl->stack_limit = impl->stack;
     u8* stack_base = impl->stack_limit + default_stack_size;
     impl->context =
-        boost::context::detail::make_fcontext(stack_base, impl->stack.size(), FiberStartFunc);
+        boost::context::detail::make_fcontext(stack_base, default_stack_size, FiberStartFunc);
 }
 
 void Fiber::SetRewindPoint(std::function<void(void*)>&& rewind_func, void* start_parameter) {
@@ -178,6 +227,8 @@ Fiber::~Fiber() {
     if (locked) {
         guard.unlock();
     }
+    GetStackPool().Release(impl->rewind_stack);
+    GetStackPool().Release(impl->stack);
 }
 
 void Fiber::Exit() {
@@ -193,9 +244,14 @@ void Fiber::Exit() {
 void Fiber::Rewind() {
     ASSERT(rewind_point);
     ASSERT(impl->rewind_context == nullptr);
+    if (impl->rewind_stack == nullptr) {
+        // The rewind stack is only needed by fibers that actually rewind; take it lazily.
+        impl->rewind_stack = GetStackPool().Acquire();
+        impl->rewind_stack_limit = impl->rewind_stack;
+    }
     u8* stack_base = impl->rewind_stack_limit + default_stack_size;
     impl->rewind_context =
-        boost::context::detail::make_fcontext(stack_base, impl->stack.size(), RewindStartFunc);
+        boost::context::detail::make_fcontext(stack_base, default_stack_size, RewindStartFunc);
     boost::context::detail::jump_fcontext(impl->rewind_context, this);
 }
 
@@ -203,12 +259,13 @@ void Fiber::YieldTo(std::shared_ptr<Fiber>& from, std::shared_ptr<Fiber>& to) {
     ASSERT_MSG(from != nullptr, "Yielding fiber is null!");
     ASSERT_MSG(to != nullptr, "Next fiber is null!");
     to->guard.lock();
-    to->previous_fiber = from;
+    to->previous_fiber = from.get();
     auto transfer = boost::context::detail::jump_fcontext(to->impl->context, to.get());
-    ASSERT(from->previous_fiber != nullptr);
-    from->previous_fiber->impl->context = transfer.fctx;
-    from->previous_fiber->guard.unlock();
-    from->previous_fiber.reset();
+    Fiber* const previous_fiber = from->previous_fiber;
+    ASSERT(previous_fiber != nullptr);
+    previous_fiber->impl->context = transfer.fctx;
+    previous_fiber->guard.unlock();
+    from->previous_fiber = nullptr;
 }
 
 std::shared_ptr<Fiber> Fiber::ThreadToFiber() {
@@ -83,7 +83,10 @@ private:
     std::function<void(void*)> rewind_point;
     void* rewind_parameter{};
     void* start_parameter{};
-    std::shared_ptr<Fiber> previous_fiber;
+    /// Fiber that yielded into this one. Held as a raw pointer: it is only dereferenced between
+    /// the context switch and the unlock of its guard, while the caller's shared_ptr to the
+    /// previous fiber is still alive on its suspended stack.
+    Fiber* previous_fiber = nullptr;
     std::unique_ptr<FiberImpl> impl;
     bool is_thread_fiber{};
     bool released{};
@@ -55,6 +55,9 @@ bool IsDirectory(const std::string& filename);
 // Returns the size of filename (64bit)
 u64 GetSize(const std::string& filename);
 
+// Returns the last modification time of filename in seconds since the epoch, or 0 on failure
+u64 GetModificationTime(const std::string& filename);
+
 // Overloaded GetSize, accepts file descriptor
 u64 GetSize(const int fd);
 
@@ -10,6 +10,7 @@
 #include <boost/functional/hash.hpp>
 #include "common/cityhash.h"
 #include "common/common_types.h"
+#include "common/fast_hash.h"
 
 namespace Common {
 
@@ -35,6 +36,18 @@ static inline u64 ComputeStructHash64(const T& data) {
     return ComputeHash64(&data, sizeof(data));
 }
 
+/**
+ * Computes a fast 64-bit hash of a struct, with the same padding requirements as
+ * ComputeStructHash64. Prefer this on hot paths; the result is not stable across versions and
+ * must never be stored on disk.
+ */
+template <typename T>
+static inline u64 ComputeStructFastHash64(const T& data) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Type passed to ComputeStructFastHash64 must be trivially copyable");
+    return FastHash64(&data, sizeof(data));
+}
+
 struct PairHash {
     template <class T1, class T2>
     std::size_t operator()(const std::pair<T1, T2>& pair) const noexcept {
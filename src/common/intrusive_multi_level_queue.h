@@ -0,0 +1,252 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+
+#include "common/bit_util.h"
+#include "common/common_types.h"
+
+namespace Common {
+
+/// Doubly-linked node embedded in the elements of an IntrusiveMultiLevelQueue.
+template <typename T>
+struct IntrusiveMultiLevelQueueLink {
+    T* prev = nullptr;
+    T* next = nullptr;
+};
+
+/**
+ * An IntrusiveMultiLevelQueue is a variant of MultiLevelQueue that stores its links inside the
+ * queued elements instead of allocating std::list nodes. Elements are pointers to objects that
+ * expose `IntrusiveMultiLevelQueueLink<T>& GetMultiLevelQueueLink(std::size_t slot)`; the slot
+ * index set through SetLinkSlot lets the same object sit in several queues at once, each queue
+ * using its own pair of links. Occupied priorities are tracked in a single 64-bit word, so
+ * finding the highest set priority is one CountTrailingZeroes64 and add/remove never allocate,
+ * touching only the element's links and the neighbouring elements.
+ */
+template <typename T, std::size_t Depth>
+class IntrusiveMultiLevelQueue {
+    static_assert(Depth <= 64, "Priorities must fit in a single occupancy word");
+
+public:
+    using Link = IntrusiveMultiLevelQueueLink<T>;
+
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T* const*;
+        using reference = T*;
+
+        iterator() = default;
+
+        friend bool operator==(const iterator& lhs, const iterator& rhs) {
+            return lhs.current == rhs.current;
+        }
+
+        friend bool operator!=(const iterator& lhs, const iterator& rhs) {
+            return !operator==(lhs, rhs);
+        }
+
+        T* operator*() const {
+            return current;
+        }
+
+        iterator& operator++() {
+            if (current == nullptr) {
+                return *this;
+            }
+            current = queue->LinkOf(current).next;
+            if (current == nullptr) {
+                AdvancePriority();
+            }
+            return *this;
+        }
+
+        iterator operator++(int) {
+            const iterator v{*this};
+            ++(*this);
+            return v;
+        }
+
+    private:
+        friend class IntrusiveMultiLevelQueue;
+
+        explicit iterator(const IntrusiveMultiLevelQueue& queue, T* current, u32 current_priority)
+            : queue{&queue}, current{current}, current_priority{current_priority} {}
+
+        void AdvancePriority() {
+            u64 prios = queue->used_priorities;
+            prios &= ~((1ULL << (current_priority + 1)) - 1);
+            if (prios != 0) {
+                current_priority = static_cast<u32>(CountTrailingZeroes64(prios));
+                current = queue->levels[current_priority].head;
+            }
+        }
+
+        const IntrusiveMultiLevelQueue* queue = nullptr;
+        T* current = nullptr;
+        u32 current_priority = 0;
+    };
+
+    IntrusiveMultiLevelQueue() = default;
+
+    /// Selects which of the element's link slots this queue threads its lists through.
+    void SetLinkSlot(std::size_t slot) {
+        link_slot = slot;
+    }
+
+    void add(T* element, u32 priority, bool send_back = true) {
+        Level& level = levels[priority];
+        Link& link = LinkOf(element);
+        if (send_back) {
+            link.prev = level.tail;
+            link.next = nullptr;
+            if (level.tail != nullptr) {
+                LinkOf(level.tail).next = element;
+            } else {
+                level.head = element;
+            }
+            level.tail = element;
+        } else {
+            link.prev = nullptr;
+            link.next = level.head;
+            if (level.head != nullptr) {
+                LinkOf(level.head).prev = element;
+            } else {
+                level.tail = element;
+            }
+            level.head = element;
+        }
+        used_priorities |= 1ULL << priority;
+    }
+
+    void remove(T* element, u32 priority) {
+        Level& level = levels[priority];
+        Link& link = LinkOf(element);
+        if (link.prev == nullptr && link.next == nullptr && level.head != element) {
+            // Not queued here; kept tolerant to match MultiLevelQueue::remove.
+            return;
+        }
+        if (link.prev != nullptr) {
+            LinkOf(link.prev).next = link.next;
+        } else {
+            level.head = link.next;
+        }
+        if (link.next != nullptr) {
+            LinkOf(link.next).prev = link.prev;
+        } else {
+            level.tail = link.prev;
+        }
+        link.prev = nullptr;
+        link.next = nullptr;
+        if (level.head == nullptr) {
+            used_priorities &= ~(1ULL << priority);
+        }
+    }
+
+    /// Rotates the first n elements of the given priority to the back, one at a time.
+    void yield(u32 priority, std::size_t n = 1) {
+        Level& level = levels[priority];
+        for (std::size_t i = 0; i < n; ++i) {
+            if (level.head == level.tail) {
+                return;
+            }
+            T* const element = level.head;
+            remove(element, priority);
+            add(element, priority);
+        }
+    }
+
+    std::size_t depth() const {
+        return Depth;
+    }
+
+    std::size_t size(u32 priority) const {
+        std::size_t count = 0;
+        for (T* it = levels[priority].head; it != nullptr; it = LinkOf(it).next) {
+            ++count;
+        }
+        return count;
+    }
+
+    std::size_t size() const {
+        u64 priorities = used_priorities;
+        std::size_t count = 0;
+        while (priorities != 0) {
+            const u64 current_priority = CountTrailingZeroes64(priorities);
+            count += size(static_cast<u32>(current_priority));
+            priorities &= ~(1ULL << current_priority);
+        }
+        return count;
+    }
+
+    bool empty() const {
+        return used_priorities == 0;
+    }
+
+    bool empty(u32 priority) const {
+        return (used_priorities & (1ULL << priority)) == 0;
+    }
+
+    u32 highest_priority_set(u32 max_priority = 0) const {
+        const u64 priorities =
+            max_priority == 0 ? used_priorities : (used_priorities & ~((1ULL << max_priority) - 1));
+        return priorities == 0 ? Depth : static_cast<u32>(CountTrailingZeroes64(priorities));
+    }
+
+    /// Returns the first element at or below the given priority, or nullptr if there is none.
+    T* front(u32 max_priority = 0) const {
+        const u32 priority = highest_priority_set(max_priority);
+        return priority == Depth ? nullptr : levels[priority].head;
+    }
+
+    iterator begin() const {
+        const u32 priority = highest_priority_set();
+        return priority == Depth ? end() : iterator{*this, levels[priority].head, priority};
+    }
+
+    iterator end() const {
+        return iterator{};
+    }
+
+    void clear() {
+        u64 priorities = used_priorities;
+        while (priorities != 0) {
+            const u64 priority = CountTrailingZeroes64(priorities);
+            Level& level = levels[priority];
+            for (T* it = level.head; it != nullptr;) {
+                Link& link = LinkOf(it);
+                it = link.next;
+                link.prev = nullptr;
+                link.next = nullptr;
+            }
+            level.head = nullptr;
+            level.tail = nullptr;
+            priorities &= ~(1ULL << priority);
+        }
+        used_priorities = 0;
+    }
+
+private:
+    struct Level {
+        T* head = nullptr;
+        T* tail = nullptr;
+    };
+
+    Link& LinkOf(T* element) const {
+        return element->GetMultiLevelQueueLink(link_slot);
+    }
+
+    std::array<Level, Depth> levels{};
+    u64 used_priorities = 0;
+    std::size_t link_slot = 0;
+};
+
+} // namespace Common
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <climits>
@@ -149,17 +150,62 @@ void ColorConsoleBackend::Write(const Entry& entry) {
 FileBackend::FileBackend(const std::string& filename)
     : file(filename, "w", _SH_DENYWR), bytes_written(0) {}
 
+FileBackend::~FileBackend() {
+    FlushBuffer();
+}
+
 void FileBackend::Write(const Entry& entry) {
     // prevent logs from going over the maximum size (in case its spamming and the user doesn't
     // know)
     constexpr std::size_t MAX_BYTES_WRITTEN = 50 * 1024L * 1024L;
+    constexpr std::size_t BUFFER_FLUSH_THRESHOLD = 4096;
     if (!file.IsOpen() || bytes_written > MAX_BYTES_WRITTEN) {
         return;
     }
-    bytes_written += file.WriteString(FormatLogMessage(entry).append(1, '\n'));
-    if (entry.log_level >= Level::Error) {
-        file.Flush();
+    // The backend thread is the only writer, so one reused buffer serves every entry.
+    thread_local fmt::memory_buffer format_buffer;
+    format_buffer.resize(0);
+    FormatLogMessage(entry, format_buffer);
+    format_buffer.push_back('\n');
+    buffer.append(format_buffer.data(), format_buffer.size());
+
+    // Batch lines into larger writes, but push errors out immediately so they cannot be lost to
+    // a crash.
+    if (buffer.size() >= BUFFER_FLUSH_THRESHOLD || entry.log_level >= Level::Error) {
+        FlushBuffer();
+        if (entry.log_level >= Level::Error) {
+            file.Flush();
+        }
+    }
+}
+
+void FileBackend::FlushBuffer() {
+    if (buffer.empty()) {
+        return;
+    }
+    bytes_written += file.WriteString(buffer);
+    buffer.clear();
+}
+
+void RingBackend::Write(const Entry& entry) {
+    std::lock_guard lock{ring_mutex};
+    ring[next_index] = entry;
+    next_index = (next_index + 1) % ring.size();
+    if (next_index == 0) {
+        wrapped = true;
+    }
+}
+
+std::vector<Entry> RingBackend::Snapshot() {
+    std::lock_guard lock{ring_mutex};
+    std::vector<Entry> out;
+    const std::size_t count = wrapped ? ring.size() : next_index;
+    out.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t index = wrapped ? (next_index + i) % ring.size() : i;
+        out[i] = ring[index];
     }
+    return out;
 }
 
 void DebuggerBackend::Write(const Entry& entry) {
@@ -259,42 +305,44 @@ void DebuggerBackend::Write(const Entry& entry) {
     CLS(Crypto)                                                                                    \
     CLS(WebService)
 
-// GetClassName is a macro defined by Windows.h, grrr...
-const char* GetLogClassName(Class log_class) {
-    switch (log_class) {
-#define CLS(x)                                                                                     \
-    case Class::x:                                                                                 \
-        return #x;
-#define SUB(x, y)                                                                                  \
-    case Class::x##_##y:                                                                           \
-        return #x "." #y;
-        ALL_LOG_CLASSES()
+namespace {
+
+/// Class names, preformatted at compile time and indexed directly by the enum value.
+constexpr auto MakeClassNameTable() {
+    std::array<const char*, static_cast<std::size_t>(Class::Count)> table{};
+#define CLS(x) table[static_cast<std::size_t>(Class::x)] = #x;
+#define SUB(x, y) table[static_cast<std::size_t>(Class::x##_##y)] = #x "." #y;
+    ALL_LOG_CLASSES()
 #undef CLS
 #undef SUB
-    case Class::Count:
-        break;
+    return table;
+}
+
+constexpr auto class_name_table = MakeClassNameTable();
+
+constexpr std::array<const char*, static_cast<std::size_t>(Level::Count)> level_name_table{
+    "Trace", "Debug", "Info", "Warning", "Error", "Critical",
+};
+
+} // Anonymous namespace
+
+// GetClassName is a macro defined by Windows.h, grrr...
+const char* GetLogClassName(Class log_class) {
+    const auto index = static_cast<std::size_t>(log_class);
+    if (index >= class_name_table.size()) {
+        UNREACHABLE();
+        return "Invalid";
     }
-    UNREACHABLE();
-    return "Invalid";
+    return class_name_table[index];
 }
 
 const char* GetLevelName(Level log_level) {
-#define LVL(x)                                                                                     \
-    case Level::x:                                                                                 \
-        return #x
-    switch (log_level) {
-        LVL(Trace);
-        LVL(Debug);
-        LVL(Info);
-        LVL(Warning);
-        LVL(Error);
-        LVL(Critical);
-    case Level::Count:
-        break;
+    const auto index = static_cast<std::size_t>(log_level);
+    if (index >= level_name_table.size()) {
+        UNREACHABLE();
+        return "Invalid";
     }
-#undef LVL
-    UNREACHABLE();
-    return "Invalid";
+    return level_name_table[index];
 }
 
 void SetGlobalFilter(const Filter& filter) {
@@ -314,7 +362,7 @@ Backend* GetBackend(std::string_view backend_name) {
 }
 
 void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
-                       unsigned int line_num, const char* function, const char* format,
+                       unsigned int line_num, const char* function, fmt::string_view format,
                        const fmt::format_args& args) {
     auto& instance = Impl::Instance();
     const auto& filter = instance.GetGlobalFilter();
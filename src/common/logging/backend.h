@@ -5,8 +5,10 @@
 
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <vector>
 #include "common/file_util.h"
 #include "common/logging/filter.h"
 #include "common/logging/log.h"
@@ -88,6 +90,7 @@ public:
 class FileBackend : public Backend {
 public:
     explicit FileBackend(const std::string& filename);
+    ~FileBackend() override;
 
     static const char* Name() {
         return "file";
@@ -100,10 +103,43 @@ public:
     void Write(const Entry& entry) override;
 
 private:
+    /// Writes any buffered lines out to the file.
+    void FlushBuffer();
+
     FileUtil::IOFile file;
+    std::string buffer;
     std::size_t bytes_written;
 };
 
+/**
+ * Flight recorder backend that keeps the last N entries in memory. Nothing is formatted or
+ * written anywhere until the buffer is snapshotted, so the steady-state cost is one entry copy
+ * per message on the logging thread.
+ */
+class RingBackend : public Backend {
+public:
+    static const char* Name() {
+        return "ring";
+    }
+
+    const char* GetName() const override {
+        return Name();
+    }
+
+    void Write(const Entry& entry) override;
+
+    /// Returns the recorded entries, oldest first.
+    std::vector<Entry> Snapshot();
+
+private:
+    static constexpr std::size_t RING_SIZE = 1024;
+
+    std::mutex ring_mutex;
+    std::vector<Entry> ring{RING_SIZE};
+    std::size_t next_index = 0;
+    bool wrapped = false;
+};
+
 /**
  * Backend that writes to Visual Studio's output window
  */
@@ -136,38 +136,47 @@ enum class Class : ClassType {
 
 /// Logs a message to the global logger, using fmt
 void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
-                       unsigned int line_num, const char* function, const char* format,
+                       unsigned int line_num, const char* function, fmt::string_view format,
                        const fmt::format_args& args);
 
-template <typename... Args>
+template <typename FormatString, typename... Args>
 void FmtLogMessage(Class log_class, Level log_level, const char* filename, unsigned int line_num,
-                   const char* function, const char* format, const Args&... args) {
+                   const char* function, const FormatString& format, const Args&... args) {
+    // make_args_checked rejects format strings whose replacement fields do not match the
+    // argument list at compile time when the format is a FMT_STRING compile-time string, as
+    // every LOG_ macro below passes.
     FmtLogMessageImpl(log_class, log_level, filename, line_num, function, format,
-                      fmt::make_format_args(args...));
+                      fmt::make_args_checked<Args...>(format, args...));
 }
 
 } // namespace Log
 
 #ifdef _DEBUG
-#define LOG_TRACE(log_class, ...)                                                                  \
+#define LOG_TRACE(log_class, format, ...)                                                          \
     ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Trace,                             \
-                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, __VA_ARGS__)
+                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, FMT_STRING(format),  \
+                         ##__VA_ARGS__)
 #else
-#define LOG_TRACE(log_class, fmt, ...) (void(0))
+#define LOG_TRACE(log_class, format, ...) (void(0))
 #endif
 
-#define LOG_DEBUG(log_class, ...)                                                                  \
+#define LOG_DEBUG(log_class, format, ...)                                                          \
     ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Debug,                             \
-                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, __VA_ARGS__)
-#define LOG_INFO(log_class, ...)                                                                   \
+                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, FMT_STRING(format),  \
+                         ##__VA_ARGS__)
+#define LOG_INFO(log_class, format, ...)                                                           \
     ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Info,                              \
-                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, __VA_ARGS__)
-#define LOG_WARNING(log_class, ...)                                                                \
+                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, FMT_STRING(format),  \
+                         ##__VA_ARGS__)
+#define LOG_WARNING(log_class, format, ...)                                                        \
     ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Warning,                           \
-                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, __VA_ARGS__)
-#define LOG_ERROR(log_class, ...)                                                                  \
+                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, FMT_STRING(format),  \
+                         ##__VA_ARGS__)
+#define LOG_ERROR(log_class, format, ...)                                                          \
     ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Error,                             \
-                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, __VA_ARGS__)
-#define LOG_CRITICAL(log_class, ...)                                                               \
+                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, FMT_STRING(format),  \
+                         ##__VA_ARGS__)
+#define LOG_CRITICAL(log_class, format, ...)                                                       \
     ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Critical,                          \
-                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, __VA_ARGS__)
+                         ::Log::TrimSourcePath(__FILE__), __LINE__, __func__, FMT_STRING(format),  \
+                         ##__VA_ARGS__)
@@ -4,6 +4,7 @@
 
 #include <array>
 #include <cstdio>
+#include <iterator>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -19,20 +20,32 @@
 namespace Log {
 
 std::string FormatLogMessage(const Entry& entry) {
-    unsigned int time_seconds = static_cast<unsigned int>(entry.timestamp.count() / 1000000);
-    unsigned int time_fractional = static_cast<unsigned int>(entry.timestamp.count() % 1000000);
+    fmt::memory_buffer out;
+    FormatLogMessage(entry, out);
+    return fmt::to_string(out);
+}
+
+void FormatLogMessage(const Entry& entry, fmt::memory_buffer& out) {
+    const unsigned int time_seconds = static_cast<unsigned int>(entry.timestamp.count() / 1000000);
+    const unsigned int time_fractional =
+        static_cast<unsigned int>(entry.timestamp.count() % 1000000);
 
     const char* class_name = GetLogClassName(entry.log_class);
     const char* level_name = GetLevelName(entry.log_level);
 
-    return fmt::format("[{:4d}.{:06d}] {} <{}> {}:{}:{}: {}", time_seconds, time_fractional,
-                       class_name, level_name, entry.filename, entry.function, entry.line_num,
-                       entry.message);
+    fmt::format_to(std::back_inserter(out), FMT_STRING("[{:4d}.{:06d}] {} <{}> {}:{}:{}: {}"),
+                   time_seconds, time_fractional, class_name, level_name, entry.filename,
+                   entry.function, entry.line_num, entry.message);
 }
 
 void PrintMessage(const Entry& entry) {
-    const auto str = FormatLogMessage(entry).append(1, '\n');
-    fputs(str.c_str(), stderr);
+    // Formats the envelope and message into one reused buffer and writes it out in a single
+    // call, instead of going through a std::string per entry.
+    thread_local fmt::memory_buffer buffer;
+    buffer.resize(0);
+    FormatLogMessage(entry, buffer);
+    buffer.push_back('\n');
+    std::fwrite(buffer.data(), 1, buffer.size(), stderr);
 }
 
 void PrintColoredMessage(const Entry& entry) {
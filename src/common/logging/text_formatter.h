@@ -7,12 +7,17 @@
 #include <cstddef>
 #include <string>
 
+#include <fmt/format.h>
+
 namespace Log {
 
 struct Entry;
 
 /// Formats a log entry into the provided text buffer.
 std::string FormatLogMessage(const Entry& entry);
+/// Formats a log entry onto the end of the given buffer in a single pass, without constructing
+/// an intermediate std::string.
+void FormatLogMessage(const Entry& entry, fmt::memory_buffer& out);
 /// Formats and prints a log entry to stderr.
 void PrintMessage(const Entry& entry);
 /// Prints the same message as `PrintMessage`, but colored according to the severity level.
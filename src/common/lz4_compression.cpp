@@ -73,4 +73,13 @@ std::vector<u8> DecompressDataLZ4(const std::vector<u8>& compressed,
     return uncompressed;
 }
 
+bool DecompressDataLZ4(const std::vector<u8>& compressed, u8* uncompressed,
+                       std::size_t uncompressed_size) {
+    const int size_check = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed.data()),
+                                               reinterpret_cast<char*>(uncompressed),
+                                               static_cast<int>(compressed.size()),
+                                               static_cast<int>(uncompressed_size));
+    return static_cast<int>(uncompressed_size) == size_check;
+}
+
 } // namespace Common::Compression
@@ -54,4 +54,17 @@ std::vector<u8> CompressDataLZ4HCMax(const u8* source, std::size_t source_size);
  */
 std::vector<u8> DecompressDataLZ4(const std::vector<u8>& compressed, std::size_t uncompressed_size);
 
+/**
+ * Decompresses a source memory region with LZ4 directly into a caller-provided buffer, avoiding
+ * the allocation and copy of an intermediate vector.
+ *
+ * @param compressed the compressed source memory region.
+ * @param uncompressed the destination buffer. Must hold at least uncompressed_size bytes.
+ * @param uncompressed_size the size in bytes of the uncompressed data.
+ *
+ * @return whether decompression succeeded.
+ */
+bool DecompressDataLZ4(const std::vector<u8>& compressed, u8* uncompressed,
+                       std::size_t uncompressed_size);
+
 } // namespace Common::Compression
\ No newline at end of file
@@ -0,0 +1,197 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace Common {
+
+/// How a consumer waits when the queue is empty.
+enum class QueueWaitStrategy {
+    /// Spin briefly, then park on a condition variable until a producer signals.
+    SpinThenPark,
+    /// Never park; burn the core until an element arrives. Only for dedicated threads that can
+    /// not afford wakeup latency.
+    Spin,
+};
+
+/**
+ * Bounded lock-free multi-producer multi-consumer queue after Dmitry Vyukov's array-based design.
+ * Each slot carries a sequence number that tells both sides whether the slot is theirs, so
+ * producers and consumers only contend on their own index, and no allocations happen after
+ * construction. The enqueue and dequeue indices live on separate cache lines to avoid false
+ * sharing.
+ *
+ * Capacity must be a power of two.
+ */
+template <typename T, std::size_t Capacity>
+class MPMCQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    explicit MPMCQueue(QueueWaitStrategy wait_strategy = QueueWaitStrategy::SpinThenPark)
+        : strategy{wait_strategy} {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    /// Returns an approximation of the number of queued elements.
+    std::size_t Size() const {
+        const std::size_t dequeue = dequeue_pos.load(std::memory_order_acquire);
+        const std::size_t enqueue = enqueue_pos.load(std::memory_order_acquire);
+        return enqueue > dequeue ? enqueue - dequeue : 0;
+    }
+
+    bool Empty() const {
+        return Size() == 0;
+    }
+
+    /// Attempts to push an element. Returns false when the queue is full.
+    template <typename Arg>
+    bool TryPush(Arg&& value) {
+        std::size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots[pos & POSITION_MASK];
+            const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto difference =
+                static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (difference == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                // The slot still holds an element the consumers have not taken yet.
+                return false;
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        slot->data = std::forward<Arg>(value);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        WakeConsumers();
+        return true;
+    }
+
+    /// Pushes an element, yielding until a slot frees up when the queue is full.
+    template <typename Arg>
+    void Push(Arg&& value) {
+        while (!TryPush(std::forward<Arg>(value))) {
+            std::this_thread::yield();
+        }
+    }
+
+    /// Attempts to pop an element. Returns false when the queue is empty.
+    bool TryPop(T& value) {
+        std::size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots[pos & POSITION_MASK];
+            const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto difference =
+                static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (difference == 0) {
+                if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(slot->data);
+        slot->sequence.store(pos + Capacity, std::memory_order_release);
+        return true;
+    }
+
+    /// Drains up to max_count elements into out without waiting. Returns the number popped.
+    std::size_t PopBatch(T* out, std::size_t max_count) {
+        std::size_t count = 0;
+        while (count < max_count && TryPop(out[count])) {
+            ++count;
+        }
+        return count;
+    }
+
+    /// Pops one element, waiting with the configured strategy while the queue is empty.
+    T PopWait() {
+        T value;
+        while (!TryPop(value)) {
+            WaitForData();
+        }
+        return value;
+    }
+
+    /// Drains up to max_count elements into out, waiting until at least one is available, so a
+    /// burst of work costs the consumer a single synchronization episode.
+    std::size_t PopBatchWait(T* out, std::size_t max_count) {
+        std::size_t count;
+        while ((count = PopBatch(out, max_count)) == 0) {
+            WaitForData();
+        }
+        return count;
+    }
+
+private:
+    /// Assumed size of a destructive interference cache line.
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+    static constexpr std::size_t POSITION_MASK = Capacity - 1;
+
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        T data;
+    };
+
+    void WaitForData() {
+        // Spin first; commands usually arrive in bursts and parking between two elements of the
+        // same burst costs a whole wakeup.
+        for (int i = 0; i < 128; ++i) {
+            if (!Empty()) {
+                return;
+            }
+            std::this_thread::yield();
+        }
+        if (strategy == QueueWaitStrategy::Spin) {
+            return;
+        }
+        std::unique_lock lock{wake_mutex};
+        ++waiting_consumers;
+        // Pairs with the fence in WakeConsumers: either the producer sees the waiter count and
+        // notifies under the mutex, or this thread sees the element in the predicate.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        wake_cv.wait(lock, [this] { return !Empty(); });
+        --waiting_consumers;
+    }
+
+    void WakeConsumers() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting_consumers.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+        std::lock_guard lock{wake_mutex};
+        wake_cv.notify_all();
+    }
+
+    std::array<Slot, Capacity> slots;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> enqueue_pos{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> dequeue_pos{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<int> waiting_consumers{0};
+    std::mutex wake_mutex;
+    std::condition_variable wake_cv;
+    const QueueWaitStrategy strategy;
+};
+
+} // namespace Common
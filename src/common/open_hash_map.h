@@ -0,0 +1,140 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/// Open-addressing hash map with linear probing, intended for hot lookup paths where the node
+/// allocations and pointer chasing of std::unordered_map show up in profiles. Erased slots leave
+/// tombstones that are dropped on the next rehash.
+/// @tparam Key   Key type, must be equality comparable and default constructible
+/// @tparam T     Mapped type, must be default constructible and move assignable
+/// @tparam Hash  Hash functor for Key
+template <typename Key, typename T, typename Hash = std::hash<Key>>
+class OpenHashMap {
+public:
+    /// @param expected_entries  Number of entries to size the table for up front
+    explicit OpenHashMap(std::size_t expected_entries = 16) {
+        std::size_t slots = 16;
+        // Keep the load factor below 50% for the expected population
+        while (slots < expected_entries * 2) {
+            slots *= 2;
+        }
+        states.resize(slots, State::Free);
+        entries.resize(slots);
+    }
+
+    /// @returns Pointer to the mapped value, or nullptr when the key is not present
+    T* Find(const Key& key) {
+        const std::size_t index = FindIndex(key);
+        return index != NO_INDEX ? &entries[index].second : nullptr;
+    }
+
+    const T* Find(const Key& key) const {
+        const std::size_t index = FindIndex(key);
+        return index != NO_INDEX ? &entries[index].second : nullptr;
+    }
+
+    /// Returns the value mapped to the key, default constructing it when not present.
+    T& operator[](const Key& key) {
+        if (T* const value = Find(key)) {
+            return *value;
+        }
+        if ((num_occupied + num_tombstones + 1) * 4 >= states.size() * 3) {
+            Rehash(states.size() * 2);
+        }
+        std::size_t index = SlotFor(key);
+        while (states[index] == State::Occupied) {
+            index = (index + 1) & (states.size() - 1);
+        }
+        if (states[index] == State::Tombstone) {
+            --num_tombstones;
+        }
+        states[index] = State::Occupied;
+        ++num_occupied;
+        entries[index].first = key;
+        entries[index].second = T{};
+        return entries[index].second;
+    }
+
+    /// @returns True when an entry was erased
+    bool Erase(const Key& key) {
+        const std::size_t index = FindIndex(key);
+        if (index == NO_INDEX) {
+            return false;
+        }
+        states[index] = State::Tombstone;
+        entries[index] = {};
+        --num_occupied;
+        ++num_tombstones;
+        return true;
+    }
+
+    std::size_t Size() const {
+        return num_occupied;
+    }
+
+    bool Empty() const {
+        return num_occupied == 0;
+    }
+
+private:
+    enum class State : u8 {
+        Free,
+        Occupied,
+        Tombstone,
+    };
+
+    static constexpr std::size_t NO_INDEX = ~std::size_t(0);
+
+    /// Spreads the low entropy of pointer-like keys over the table mask.
+    std::size_t SlotFor(const Key& key) const {
+        const u64 mixed = static_cast<u64>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<std::size_t>(mixed >> 32) & (states.size() - 1);
+    }
+
+    std::size_t FindIndex(const Key& key) const {
+        std::size_t index = SlotFor(key);
+        while (states[index] != State::Free) {
+            if (states[index] == State::Occupied && entries[index].first == key) {
+                return index;
+            }
+            index = (index + 1) & (states.size() - 1);
+        }
+        return NO_INDEX;
+    }
+
+    void Rehash(std::size_t new_slots) {
+        std::vector<State> old_states = std::move(states);
+        std::vector<std::pair<Key, T>> old_entries = std::move(entries);
+        states.assign(new_slots, State::Free);
+        // clear+resize instead of assign so move-only mapped types (e.g. RAII handles) work
+        entries.clear();
+        entries.resize(new_slots);
+        num_occupied = 0;
+        num_tombstones = 0;
+        for (std::size_t i = 0; i < old_states.size(); ++i) {
+            if (old_states[i] != State::Occupied) {
+                continue;
+            }
+            (*this)[old_entries[i].first] = std::move(old_entries[i].second);
+        }
+    }
+
+    std::vector<State> states;
+    std::vector<std::pair<Key, T>> entries;
+    std::size_t num_occupied = 0;
+    std::size_t num_tombstones = 0;
+};
+
+} // namespace Common
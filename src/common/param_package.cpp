@@ -72,7 +72,7 @@ std::string ParamPackage::Serialize() const {
     return result;
 }
 
-std::string ParamPackage::Get(const std::string& key, const std::string& default_value) const {
+std::string ParamPackage::Get(std::string_view key, const std::string& default_value) const {
     auto pair = data.find(key);
     if (pair == data.end()) {
         LOG_DEBUG(Common, "key '{}' not found", key);
@@ -82,7 +82,7 @@ std::string ParamPackage::Get(const std::string& key, const std::string& default
     return pair->second;
 }
 
-int ParamPackage::Get(const std::string& key, int default_value) const {
+int ParamPackage::Get(std::string_view key, int default_value) const {
     auto pair = data.find(key);
     if (pair == data.end()) {
         LOG_DEBUG(Common, "key '{}' not found", key);
@@ -97,7 +97,7 @@ int ParamPackage::Get(const std::string& key, int default_value) const {
     }
 }
 
-float ParamPackage::Get(const std::string& key, float default_value) const {
+float ParamPackage::Get(std::string_view key, float default_value) const {
     auto pair = data.find(key);
     if (pair == data.end()) {
         LOG_DEBUG(Common, "key {} not found", key);
@@ -112,24 +112,27 @@ float ParamPackage::Get(const std::string& key, float default_value) const {
     }
 }
 
-void ParamPackage::Set(const std::string& key, std::string value) {
-    data.insert_or_assign(key, std::move(value));
+void ParamPackage::Set(std::string_view key, std::string value) {
+    data.insert_or_assign(std::string{key}, std::move(value));
 }
 
-void ParamPackage::Set(const std::string& key, int value) {
-    data.insert_or_assign(key, std::to_string(value));
+void ParamPackage::Set(std::string_view key, int value) {
+    data.insert_or_assign(std::string{key}, std::to_string(value));
 }
 
-void ParamPackage::Set(const std::string& key, float value) {
-    data.insert_or_assign(key, std::to_string(value));
+void ParamPackage::Set(std::string_view key, float value) {
+    data.insert_or_assign(std::string{key}, std::to_string(value));
 }
 
-bool ParamPackage::Has(const std::string& key) const {
+bool ParamPackage::Has(std::string_view key) const {
     return data.find(key) != data.end();
 }
 
-void ParamPackage::Erase(const std::string& key) {
-    data.erase(key);
+void ParamPackage::Erase(std::string_view key) {
+    const auto it = data.find(key);
+    if (it != data.end()) {
+        data.erase(it);
+    }
 }
 
 void ParamPackage::Clear() {
@@ -5,15 +5,18 @@
 #pragma once
 
 #include <initializer_list>
+#include <map>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 
 namespace Common {
 
 /// A string-based key-value container supporting serializing to and deserializing from a string
 class ParamPackage {
 public:
-    using DataType = std::unordered_map<std::string, std::string>;
+    /// Ordered with a transparent comparator so lookups with string literals do not construct
+    /// temporary std::strings.
+    using DataType = std::map<std::string, std::string, std::less<>>;
 
     ParamPackage() = default;
     explicit ParamPackage(const std::string& serialized);
@@ -25,14 +28,14 @@ public:
     ParamPackage& operator=(ParamPackage&& other) = default;
 
     std::string Serialize() const;
-    std::string Get(const std::string& key, const std::string& default_value) const;
-    int Get(const std::string& key, int default_value) const;
-    float Get(const std::string& key, float default_value) const;
-    void Set(const std::string& key, std::string value);
-    void Set(const std::string& key, int value);
-    void Set(const std::string& key, float value);
-    bool Has(const std::string& key) const;
-    void Erase(const std::string& key);
+    std::string Get(std::string_view key, const std::string& default_value) const;
+    int Get(std::string_view key, int default_value) const;
+    float Get(std::string_view key, float default_value) const;
+    void Set(std::string_view key, std::string value);
+    void Set(std::string_view key, int value);
+    void Set(std::string_view key, float value);
+    bool Has(std::string_view key) const;
+    void Erase(std::string_view key);
     void Clear();
 
 private:
@@ -60,6 +60,33 @@ public:
         return Push(input.data(), input.size());
     }
 
+    /// A contiguous run of writable slots handed out by Reserve
+    struct Slice {
+        T* data;                ///< First element of the first reserved slot
+        std::size_t slot_count; ///< Number of contiguous slots reserved
+    };
+
+    /// Reserves a contiguous run of writable slots so the producer can write elements in place
+    /// instead of staging them and copying through Push. The run may be shorter than requested
+    /// when the buffer is nearly full or the write position is close to the wrap-around point;
+    /// call Reserve again after committing to continue past the wrap.
+    /// @param slot_count  Maximum number of slots wanted
+    /// @returns A slice of at most `slot_count` contiguous writable slots
+    Slice Reserve(std::size_t slot_count) {
+        const std::size_t write_index = m_write_index.load();
+        const std::size_t slots_free = capacity + m_read_index.load() - write_index;
+        const std::size_t pos = write_index % capacity;
+        const std::size_t reserve_count = std::min({slot_count, slots_free, capacity - pos});
+        return {m_data.data() + pos * granularity, reserve_count};
+    }
+
+    /// Publishes slots written into a slice obtained from Reserve, making them visible to the
+    /// consumer. Must not exceed the slot count of the reserved slice.
+    /// @param slot_count  Number of slots that were produced
+    void Commit(std::size_t slot_count) {
+        m_write_index.store(m_write_index.load() + slot_count);
+    }
+
     /// Pops slots from the ring buffer
     /// @param output     Where to store the popped slots
     /// @param max_slots  Maximum number of slots to pop
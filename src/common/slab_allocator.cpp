@@ -0,0 +1,56 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <new>
+
+#include "common/alignment.h"
+#include "common/slab_allocator.h"
+
+namespace Common::impl {
+
+namespace {
+constexpr std::size_t cache_line_size = 64;
+} // Anonymous namespace
+
+SlabPool::SlabPool(std::size_t entry_size, std::size_t entry_align)
+    : stride{Common::AlignUp(std::max(entry_size, sizeof(Node)),
+                             std::max(entry_align, alignof(Node)))},
+      slab_align{std::max(entry_align, cache_line_size)} {}
+
+SlabPool::~SlabPool() {
+    for (void* slab : slabs) {
+        ::operator delete(slab, std::align_val_t{slab_align});
+    }
+}
+
+void* SlabPool::Allocate() {
+    std::lock_guard guard{lock};
+    if (free_list == nullptr) {
+        AllocateSlab();
+    }
+    Node* const node = free_list;
+    free_list = node->next;
+    return node;
+}
+
+void SlabPool::Free(void* entry) {
+    std::lock_guard guard{lock};
+    Node* const node = new (entry) Node;
+    node->next = free_list;
+    free_list = node;
+}
+
+void SlabPool::AllocateSlab() {
+    u8* const slab =
+        static_cast<u8*>(::operator new(stride * entries_per_slab, std::align_val_t{slab_align}));
+    slabs.push_back(slab);
+    for (std::size_t i = 0; i < entries_per_slab; ++i) {
+        Node* const node = new (slab + i * stride) Node;
+        node->next = free_list;
+        free_list = node;
+    }
+}
+
+} // namespace Common::impl
@@ -0,0 +1,102 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/spin_lock.h"
+
+namespace Common {
+
+namespace impl {
+
+/// Freelist of fixed-size entries backed by cache-line-aligned slabs. Slabs are retained for
+/// the lifetime of the pool so recycled entries never touch the system allocator.
+class SlabPool final : NonCopyable {
+public:
+    explicit SlabPool(std::size_t entry_size, std::size_t entry_align);
+    ~SlabPool();
+
+    void* Allocate();
+
+    void Free(void* entry);
+
+private:
+    struct Node {
+        Node* next{};
+    };
+
+    static constexpr std::size_t entries_per_slab = 64;
+
+    void AllocateSlab();
+
+    SpinLock lock;
+    Node* free_list{};
+    std::vector<void*> slabs;
+    const std::size_t stride;
+    const std::size_t slab_align;
+};
+
+} // namespace impl
+
+/**
+ * Standard allocator that services single-object allocations from a typed slab pool, for use
+ * with std::allocate_shared on frequently churned types. The pool is per instantiated type and
+ * lives for the duration of the process.
+ */
+template <typename T>
+class SlabAllocator {
+public:
+    using value_type = T;
+
+    SlabAllocator() = default;
+
+    template <typename U>
+    SlabAllocator(const SlabAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        if (n != 1) {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T*>(Pool().Allocate());
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept {
+        if (n != 1) {
+            ::operator delete(ptr);
+            return;
+        }
+        Pool().Free(ptr);
+    }
+
+    template <typename U>
+    bool operator==(const SlabAllocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const SlabAllocator<U>&) const noexcept {
+        return false;
+    }
+
+private:
+    static impl::SlabPool& Pool() {
+        // Deliberately leaked so objects released during static destruction can still return
+        // their entries safely.
+        static impl::SlabPool* pool = new impl::SlabPool(sizeof(T), alignof(T));
+        return *pool;
+    }
+};
+
+/// Allocates a shared_ptr whose object and control block live together in a typed slab.
+template <typename T, typename... Args>
+std::shared_ptr<T> MakeSlabShared(Args&&... args) {
+    return std::allocate_shared<T>(SlabAllocator<T>{}, std::forward<Args>(args)...);
+}
+
+} // namespace Common
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include "common/microprofile.h"
 #include "common/spin_lock.h"
 
 #if _MSC_VER
@@ -30,25 +31,53 @@ void ThreadPause() {
 #endif
 }
 
+/// Total pause instructions issued before a waiter gives up spinning and parks.
+constexpr int SpinLimit = 1024;
+
 } // Anonymous namespace
 
+MICROPROFILE_DEFINE(Common_SpinLockPark, "Common", "SpinLock Park", MP_RGB(255, 64, 64));
+
 namespace Common {
 
 void SpinLock::lock() {
-    while (lck.test_and_set(std::memory_order_acquire)) {
-        ThreadPause();
+    u32 expected = 0;
+    if (lck.compare_exchange_strong(expected, 1, std::memory_order_acquire)) {
+        return;
+    }
+
+    // Spin with exponential backoff; most holders release within a few hundred cycles.
+    for (int pause_count = 1; pause_count <= SpinLimit; pause_count *= 2) {
+        for (int i = 0; i < pause_count; ++i) {
+            ThreadPause();
+        }
+        expected = 0;
+        if (lck.compare_exchange_weak(expected, 1, std::memory_order_acquire)) {
+            return;
+        }
+    }
+
+    // The holder is taking long enough that it has likely been preempted; park instead of
+    // monopolizing a core. The scope makes contended call stacks visible in the profiler.
+    MICROPROFILE_SCOPE(Common_SpinLockPark);
+    while (lck.exchange(2, std::memory_order_acquire) != 0) {
+        std::unique_lock sleep_guard{sleep_mutex};
+        sleep_cv.wait(sleep_guard, [this] { return lck.load(std::memory_order_relaxed) == 0; });
     }
 }
 
 void SpinLock::unlock() {
-    lck.clear(std::memory_order_release);
+    if (lck.exchange(0, std::memory_order_release) == 2) {
+        // Hold the sleep mutex while notifying so the wakeup cannot slip in between a parking
+        // thread's predicate check and its wait.
+        std::scoped_lock sleep_guard{sleep_mutex};
+        sleep_cv.notify_all();
+    }
 }
 
 bool SpinLock::try_lock() {
-    if (lck.test_and_set(std::memory_order_acquire)) {
-        return false;
-    }
-    return true;
+    u32 expected = 0;
+    return lck.compare_exchange_strong(expected, 1, std::memory_order_acquire);
 }
 
 } // namespace Common
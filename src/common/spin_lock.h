@@ -5,13 +5,20 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "common/common_types.h"
 
 namespace Common {
 
 /**
  * SpinLock class
- * a lock similar to mutex that forces a thread to spin wait instead calling the
- * supervisor. Should be used on short sequences of code.
+ * a lock similar to mutex that spin waits instead of calling the supervisor, making it suitable
+ * for short sequences of code. Unlike a pure spin lock, a thread that keeps losing the lock backs
+ * off exponentially and eventually parks, so a preempted holder does not burn a whole core on the
+ * waiters' side. Unlike std::mutex, the lock may be released from a different thread than the one
+ * that acquired it, which the fiber code relies on.
  */
 class SpinLock {
 public:
@@ -20,7 +27,10 @@ public:
     bool try_lock();
 
 private:
-    std::atomic_flag lck = ATOMIC_FLAG_INIT;
+    /// 0 = unlocked, 1 = locked, 2 = locked with (possibly) parked waiters.
+    std::atomic<u32> lck{0};
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_cv;
 };
 
 } // namespace Common
@@ -0,0 +1,134 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstring>
+
+#include "common/swap.h"
+#include "common/swap_bytes.h"
+
+#ifdef ARCHITECTURE_x86_64
+#include <tmmintrin.h>
+#include "common/x64/cpu_detect.h"
+#endif
+
+namespace Common {
+
+namespace {
+
+void SwapBytes16Scalar(const u8* src, u8* dst, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        u16 value;
+        std::memcpy(&value, src + i * sizeof(u16), sizeof(u16));
+        value = swap16(value);
+        std::memcpy(dst + i * sizeof(u16), &value, sizeof(u16));
+    }
+}
+
+void SwapBytes32Scalar(const u8* src, u8* dst, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        u32 value;
+        std::memcpy(&value, src + i * sizeof(u32), sizeof(u32));
+        value = swap32(value);
+        std::memcpy(dst + i * sizeof(u32), &value, sizeof(u32));
+    }
+}
+
+void SwapBytes64Scalar(const u8* src, u8* dst, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        u64 value;
+        std::memcpy(&value, src + i * sizeof(u64), sizeof(u64));
+        value = swap64(value);
+        std::memcpy(dst + i * sizeof(u64), &value, sizeof(u64));
+    }
+}
+
+#ifdef ARCHITECTURE_x86_64
+
+// SSSE3 is not part of the x86-64 baseline, so these are compiled for it explicitly and only
+// entered after a runtime cpuid check. MSVC allows the intrinsics unconditionally.
+#ifdef _MSC_VER
+#define SSSE3_FUNCTION
+#else
+#define SSSE3_FUNCTION __attribute__((target("ssse3")))
+#endif
+
+SSSE3_FUNCTION void SwapBytes16Ssse3(const u8* src, u8* dst, std::size_t count) {
+    const __m128i shuffle =
+        _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 2),
+                         _mm_shuffle_epi8(value, shuffle));
+    }
+    SwapBytes16Scalar(src + i * 2, dst + i * 2, count - i);
+}
+
+SSSE3_FUNCTION void SwapBytes32Ssse3(const u8* src, u8* dst, std::size_t count) {
+    const __m128i shuffle =
+        _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4),
+                         _mm_shuffle_epi8(value, shuffle));
+    }
+    SwapBytes32Scalar(src + i * 4, dst + i * 4, count - i);
+}
+
+SSSE3_FUNCTION void SwapBytes64Ssse3(const u8* src, u8* dst, std::size_t count) {
+    const __m128i shuffle =
+        _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 8),
+                         _mm_shuffle_epi8(value, shuffle));
+    }
+    SwapBytes64Scalar(src + i * 8, dst + i * 8, count - i);
+}
+
+#undef SSSE3_FUNCTION
+
+#endif // ARCHITECTURE_x86_64
+
+} // Anonymous namespace
+
+void SwapBytes16(const void* src, void* dst, std::size_t count) {
+    const u8* const in = static_cast<const u8*>(src);
+    u8* const out = static_cast<u8*>(dst);
+#ifdef ARCHITECTURE_x86_64
+    if (GetCPUCaps().ssse3) {
+        SwapBytes16Ssse3(in, out, count);
+        return;
+    }
+#endif
+    SwapBytes16Scalar(in, out, count);
+}
+
+void SwapBytes32(const void* src, void* dst, std::size_t count) {
+    const u8* const in = static_cast<const u8*>(src);
+    u8* const out = static_cast<u8*>(dst);
+#ifdef ARCHITECTURE_x86_64
+    if (GetCPUCaps().ssse3) {
+        SwapBytes32Ssse3(in, out, count);
+        return;
+    }
+#endif
+    SwapBytes32Scalar(in, out, count);
+}
+
+void SwapBytes64(const void* src, void* dst, std::size_t count) {
+    const u8* const in = static_cast<const u8*>(src);
+    u8* const out = static_cast<u8*>(dst);
+#ifdef ARCHITECTURE_x86_64
+    if (GetCPUCaps().ssse3) {
+        SwapBytes64Ssse3(in, out, count);
+        return;
+    }
+#endif
+    SwapBytes64Scalar(in, out, count);
+}
+
+} // namespace Common
@@ -0,0 +1,27 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+// Bulk endianness conversion helpers. These byteswap contiguous arrays of fixed-size elements,
+// taking an SSSE3 byte shuffle path when the host CPU supports it. The source and destination
+// ranges have to be equal or non-overlapping. For single values use the swap16/swap32/swap64
+// wrappers from swap.h.
+
+/// Byteswaps count contiguous 16-bit elements from src into dst.
+void SwapBytes16(const void* src, void* dst, std::size_t count);
+
+/// Byteswaps count contiguous 32-bit elements from src into dst.
+void SwapBytes32(const void* src, void* dst, std::size_t count);
+
+/// Byteswaps count contiguous 64-bit elements from src into dst.
+void SwapBytes64(const void* src, void* dst, std::size_t count);
+
+} // namespace Common
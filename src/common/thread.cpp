@@ -2,6 +2,10 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+
 #include "common/thread.h"
 #ifdef __APPLE__
 #include <mach/mach.h>
@@ -124,4 +128,114 @@ void SetCurrentThreadName(const char* name) {
 
 #endif
 
+namespace {
+
+std::atomic<bool> pinning_enabled{false};
+
+/// Minimum host core count where dedicating whole cores to single roles pays off; below this
+/// the OS scheduler does a better job than any static split.
+constexpr unsigned MIN_CORES_FOR_PINNING = 6;
+
+ThreadPriority GetRolePriority(ThreadRole role) {
+    switch (role) {
+    case ThreadRole::Emulation:
+    case ThreadRole::Renderer:
+        return ThreadPriority::High;
+    case ThreadRole::Gpu:
+    case ThreadRole::Audio:
+        return ThreadPriority::VeryHigh;
+    case ThreadRole::Worker:
+        return ThreadPriority::Low;
+    }
+    return ThreadPriority::Normal;
+}
+
+void SetCurrentThreadAffinityMask([[maybe_unused]] u64 mask) {
+#if defined(_WIN32)
+    SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(mask));
+#elif defined(__APPLE__)
+    // macOS offers no strict affinity interface
+#else
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (unsigned core = 0; core < 64; ++core) {
+        if ((mask >> core) & 1) {
+            CPU_SET(core, &set);
+        }
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+}
+
+void PinCurrentThread(ThreadRole role) {
+    const unsigned num_cores = std::min(std::thread::hardware_concurrency(), 64u);
+    if (num_cores < MIN_CORES_FOR_PINNING) {
+        return;
+    }
+
+    // The two highest cores are dedicated, one to GPU work and one to audio plus background
+    // work; the emulated cores spread over the rest and can no longer be co-scheduled with them.
+    const u64 all_cores = (u64(1) << num_cores) - 1;
+    const u64 gpu_core = u64(1) << (num_cores - 2);
+    const u64 service_core = u64(1) << (num_cores - 1);
+
+    switch (role) {
+    case ThreadRole::Emulation:
+        SetCurrentThreadAffinityMask(all_cores & ~(gpu_core | service_core));
+        break;
+    case ThreadRole::Gpu:
+    case ThreadRole::Renderer:
+        SetCurrentThreadAffinityMask(gpu_core);
+        break;
+    case ThreadRole::Audio:
+    case ThreadRole::Worker:
+        SetCurrentThreadAffinityMask(service_core);
+        break;
+    }
+}
+
+} // Anonymous namespace
+
+void SetCurrentThreadRole(ThreadRole role, const char* name) {
+    SetCurrentThreadName(name);
+    SetCurrentThreadPriority(GetRolePriority(role));
+    if (pinning_enabled.load(std::memory_order_relaxed)) {
+        PinCurrentThread(role);
+    }
+}
+
+void EnableThreadPinning(bool enable) {
+    pinning_enabled.store(enable, std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds GetCurrentThreadCpuTime() {
+#if defined(_WIN32)
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (!GetThreadTimes(GetCurrentThread(), &creation_time, &exit_time, &kernel_time,
+                        &user_time)) {
+        return {};
+    }
+    const auto to_ns = [](const FILETIME& time) {
+        const u64 ticks = (static_cast<u64>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+        return std::chrono::nanoseconds{ticks * 100};
+    };
+    return to_ns(kernel_time) + to_ns(user_time);
+#elif defined(__APPLE__)
+    thread_basic_info_data_t info;
+    mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+    if (thread_info(mach_thread_self(), THREAD_BASIC_INFO, reinterpret_cast<thread_info_t>(&info),
+                    &count) != KERN_SUCCESS) {
+        return {};
+    }
+    return std::chrono::seconds{info.user_time.seconds + info.system_time.seconds} +
+           std::chrono::microseconds{info.user_time.microseconds + info.system_time.microseconds};
+#else
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+        return {};
+    }
+    return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+#endif
+}
+
 } // namespace Common
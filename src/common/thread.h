@@ -97,4 +97,31 @@ void SetCurrentThreadPriority(ThreadPriority new_priority);
 
 void SetCurrentThreadName(const char* name);
 
+/// Subsystem a thread belongs to, for the process-wide placement policy
+enum class ThreadRole : u32 {
+    Emulation, ///< Emulated CPU cores
+    Gpu,       ///< GPU command processing
+    Renderer,  ///< Host graphics API submission and presentation
+    Audio,     ///< Audio mixing and output
+    Worker,    ///< Background worker pools
+};
+
+/**
+ * Applies the process-wide placement policy for a subsystem thread: names it, sets the priority
+ * appropriate to its role and, when pinning is enabled and the host has cores to spare,
+ * confines it to the host cores reserved for that role so latency-critical threads stop being
+ * co-scheduled with the emulated cores. Call from the thread itself, right after it starts.
+ */
+void SetCurrentThreadRole(ThreadRole role, const char* name);
+
+/**
+ * Enables or disables pinning of subsystem threads to disjoint host core sets. Only affects
+ * threads that apply their role afterwards; pinning is off by default since it only pays off
+ * when the host has enough cores to dedicate them.
+ */
+void EnableThreadPinning(bool enable);
+
+/// Returns the CPU time consumed so far by the calling thread, for validating placements
+std::chrono::nanoseconds GetCurrentThreadCpuTime();
+
 } // namespace Common
@@ -0,0 +1,81 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+
+#include "common/thread.h"
+#include "common/thread_pool.h"
+
+namespace Common {
+
+ThreadPool::ThreadPool(std::size_t num_workers) {
+    if (num_workers == 0) {
+        num_workers = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    workers.reserve(num_workers);
+    for (std::size_t i = 0; i < num_workers; ++i) {
+        workers.emplace_back(&ThreadPool::RunWorker, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock lock{mutex};
+        stopping = true;
+    }
+    cv.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::ParallelFor(std::size_t count,
+                             const std::function<void(std::size_t, std::size_t)>& work) {
+    if (count == 0) {
+        return;
+    }
+
+    const std::size_t num_chunks = std::min(count, NumWorkers() + 1);
+    const std::size_t chunk_size = (count + num_chunks - 1) / num_chunks;
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_chunks - 1);
+    for (std::size_t chunk = 1; chunk < num_chunks; ++chunk) {
+        const std::size_t begin = chunk * chunk_size;
+        const std::size_t end = std::min(begin + chunk_size, count);
+        futures.emplace_back(Push([&work, begin, end]() { work(begin, end); }));
+    }
+
+    // The caller takes the first chunk rather than sleeping on the futures from the start.
+    work(0, std::min(chunk_size, count));
+
+    for (auto& future : futures) {
+        future.wait();
+    }
+}
+
+ThreadPool& ThreadPool::GetPool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::RunWorker() {
+    SetCurrentThreadRole(ThreadRole::Worker, "yuzu:PoolWorker");
+
+    while (true) {
+        std::function<void()> work;
+        {
+            std::unique_lock lock{mutex};
+            cv.wait(lock, [this]() { return stopping || !work_queue.empty(); });
+            if (work_queue.empty()) {
+                return;
+            }
+            work = std::move(work_queue.front());
+            work_queue.pop();
+        }
+        work();
+    }
+}
+
+} // namespace Common
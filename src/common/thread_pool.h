@@ -0,0 +1,70 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Common {
+
+/**
+ * A shared pool of worker threads for short-lived CPU-bound work. Subsystems that need a burst
+ * of parallelism (module decompression, cache (de)serialization, file scanning) push work here
+ * instead of spawning their own threads, so concurrent bursts share one set of workers sized to
+ * the host instead of oversubscribing it.
+ */
+class ThreadPool {
+public:
+    /// Creates the pool with num_workers threads, or one per host core when zero is passed.
+    explicit ThreadPool(std::size_t num_workers = 0);
+    ~ThreadPool();
+
+    /// Number of worker threads in the pool.
+    std::size_t NumWorkers() const {
+        return workers.size();
+    }
+
+    /// Queues a callable for execution on a worker thread and returns a future for its result.
+    template <typename Func>
+    auto Push(Func func) -> std::future<std::invoke_result_t<Func>> {
+        using Result = std::invoke_result_t<Func>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::move(func));
+        auto future = task->get_future();
+        {
+            std::unique_lock lock{mutex};
+            work_queue.emplace([task]() { (*task)(); });
+        }
+        cv.notify_one();
+        return future;
+    }
+
+    /**
+     * Splits [0, count) into roughly even chunks, runs work(begin, end) for each chunk on the
+     * pool and blocks until all of them finish. The calling thread processes one chunk itself.
+     */
+    void ParallelFor(std::size_t count, const std::function<void(std::size_t, std::size_t)>& work);
+
+    /// The process-wide pool, sized to the host core count.
+    static ThreadPool& GetPool();
+
+private:
+    void RunWorker();
+
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> work_queue;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool stopping = false;
+};
+
+} // namespace Common
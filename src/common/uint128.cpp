@@ -38,6 +38,27 @@ u64 MultiplyAndDivide64(u64 a, u64 b, u64 d) {
 
 #endif
 
+u64 MultiplyHigh(u64 a, u64 b) {
+#ifdef _MSC_VER
+    return __umulh(a, b);
+#else
+    return static_cast<u64>((static_cast<unsigned __int128>(a) * b) >> 64);
+#endif
+}
+
+u64 GetFixedPoint64Factor(u64 numerator, u64 divisor) {
+#ifdef _MSC_VER
+    u64 remainder;
+#if _MSC_VER < 1923
+    return udiv128(numerator, 0, divisor, &remainder);
+#else
+    return _udiv128(numerator, 0, divisor, &remainder);
+#endif
+#else
+    return static_cast<u64>((static_cast<unsigned __int128>(numerator) << 64) / divisor);
+#endif
+}
+
 u128 Multiply64Into128(u64 a, u64 b) {
     u128 result;
 #ifdef _MSC_VER
@@ -12,6 +12,14 @@ namespace Common {
 // This function multiplies 2 u64 values and divides it by a u64 value.
 u64 MultiplyAndDivide64(u64 a, u64 b, u64 d);
 
+// This function multiplies 2 u64 values and returns the high 64 bits of the u128 result.
+u64 MultiplyHigh(u64 a, u64 b);
+
+// This function divides (numerator << 64) by a u64 divisor, producing the quotient in 0.64
+// fixed point for reciprocal multiplication through MultiplyHigh. The numerator must be
+// smaller than the divisor.
+u64 GetFixedPoint64Factor(u64 numerator, u64 divisor);
+
 // This function multiplies 2 u64 values and produces a u128 value;
 u128 Multiply64Into128(u64 a, u64 b);
 
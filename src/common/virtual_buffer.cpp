@@ -2,12 +2,20 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <cstdint>
+#include <cstdio>
+
 #ifdef _WIN32
 #include <windows.h>
 #else
+#include <fcntl.h>
 #include <stdio.h>
+#ifdef __linux__
+#include <linux/falloc.h>
+#endif
 #include <sys/mman.h>
 #include <sys/types.h>
+#include <unistd.h>
 #if defined __APPLE__ || defined __FreeBSD__ || defined __OpenBSD__
 #include <sys/sysctl.h>
 #elif defined __HAIKU__
@@ -22,9 +30,23 @@
 
 namespace Common {
 
+namespace {
+/// Allocations at least this large get the huge page hint; smaller ones cannot use one anyway.
+constexpr std::size_t HugePageThreshold = 2 * 1024 * 1024;
+} // Anonymous namespace
+
 void* AllocateMemoryPages(std::size_t size) {
 #ifdef _WIN32
-    void* base{VirtualAlloc(nullptr, size, MEM_COMMIT, PAGE_READWRITE)};
+    void* base{};
+    const std::size_t large_page_size = GetLargePageMinimum();
+    if (large_page_size != 0 && (size % large_page_size) == 0) {
+        // Requires SeLockMemoryPrivilege; silently falls back when it is not held.
+        base = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+                            PAGE_READWRITE);
+    }
+    if (!base) {
+        base = VirtualAlloc(nullptr, size, MEM_COMMIT, PAGE_READWRITE);
+    }
 #else
     void* base{mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0)};
 
@@ -35,6 +57,10 @@ void* AllocateMemoryPages(std::size_t size) {
 
     ASSERT(base);
 
+    if (size >= HugePageThreshold) {
+        EnableHugePages(base, size);
+    }
+
     return base;
 }
 
@@ -49,4 +75,155 @@ void FreeMemoryPages(void* base, std::size_t size) {
 #endif
 }
 
+BackingFileHandle CreateBackingFile(std::size_t size) {
+#if defined(__linux__)
+    const int fd = memfd_create("yuzu_backing", MFD_CLOEXEC);
+    if (fd < 0) {
+        return InvalidBackingFileHandle;
+    }
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        close(fd);
+        return InvalidBackingFileHandle;
+    }
+    return fd;
+#elif !defined(_WIN32)
+    char name[64];
+    std::snprintf(name, sizeof(name), "/yuzu_backing_%d", static_cast<int>(getpid()));
+    const int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+        return InvalidBackingFileHandle;
+    }
+    shm_unlink(name);
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        close(fd);
+        return InvalidBackingFileHandle;
+    }
+    return fd;
+#else
+    // Aliased mappings on Windows require the VirtualAlloc2/MapViewOfFile3 placeholder API,
+    // which is not wired up yet. Callers fall back to AllocateMemoryPages.
+    return InvalidBackingFileHandle;
+#endif
+}
+
+void CloseBackingFile(BackingFileHandle handle) {
+    if (handle == InvalidBackingFileHandle) {
+        return;
+    }
+#ifndef _WIN32
+    ASSERT(close(handle) == 0);
+#endif
+}
+
+void* MapBackingFile(BackingFileHandle handle, std::size_t offset, std::size_t size) {
+#ifdef _WIN32
+    return nullptr;
+#else
+    void* const base{mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, handle,
+                          static_cast<off_t>(offset))};
+    return base == MAP_FAILED ? nullptr : base;
+#endif
+}
+
+void* ReserveMemoryRegion(std::size_t size) {
+#ifdef _WIN32
+    return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+    void* const base{mmap(nullptr, size, PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0)};
+    return base == MAP_FAILED ? nullptr : base;
+#endif
+}
+
+void FreeMemoryRegion(void* base, std::size_t size) {
+    if (!base) {
+        return;
+    }
+#ifdef _WIN32
+    ASSERT(VirtualFree(base, 0, MEM_RELEASE));
+#else
+    ASSERT(munmap(base, size) == 0);
+#endif
+}
+
+void* MapBackingFileView(void* target, BackingFileHandle handle, std::size_t offset,
+                         std::size_t size) {
+#ifdef _WIN32
+    return nullptr;
+#else
+    void* const base{mmap(target, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, handle,
+                          static_cast<off_t>(offset))};
+    return base == MAP_FAILED ? nullptr : base;
+#endif
+}
+
+void EnableHugePages(void* base, std::size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // Transparent huge pages; nothing to do on failure, 4 KiB pages keep working.
+    madvise(base, size, MADV_HUGEPAGE);
+#endif
+}
+
+std::size_t GetHugePageResidentBytes(const void* base, std::size_t size) {
+#ifdef __linux__
+    // smaps lists one header line per mapping followed by per-mapping counters. Sum the huge
+    // page counters of every mapping that falls inside [base, base + size); aliased views split
+    // the region into multiple mappings.
+    std::FILE* const file = std::fopen("/proc/self/smaps", "r");
+    if (!file) {
+        return 0;
+    }
+    const auto begin = reinterpret_cast<std::uintptr_t>(base);
+    const auto end = begin + size;
+    std::size_t total_kib = 0;
+    bool in_region = false;
+    char line[256];
+    while (std::fgets(line, sizeof(line), file)) {
+        unsigned long long mapping_begin{};
+        unsigned long long mapping_end{};
+        unsigned long long kib{};
+        if (std::sscanf(line, "%llx-%llx", &mapping_begin, &mapping_end) == 2) {
+            in_region = mapping_begin >= begin && mapping_end <= end;
+        } else if (in_region && (std::sscanf(line, "AnonHugePages: %llu kB", &kib) == 1 ||
+                                 std::sscanf(line, "ShmemPmdMapped: %llu kB", &kib) == 1)) {
+            total_kib += kib;
+        }
+    }
+    std::fclose(file);
+    return total_kib * 1024;
+#else
+    return 0;
+#endif
+}
+
+void UnmapBackingFileView(void* base, std::size_t size) {
+#ifdef _WIN32
+    UNIMPLEMENTED();
+#else
+    // Remap as an inaccessible reservation so the region stays contiguous.
+    void* const result{mmap(base, size, PROT_NONE, MAP_ANON | MAP_PRIVATE | MAP_FIXED, -1, 0)};
+    ASSERT(result == base);
+#endif
+}
+
+void DecommitBackingFileRegion([[maybe_unused]] BackingFileHandle handle,
+                               [[maybe_unused]] std::size_t offset,
+                               [[maybe_unused]] std::size_t size) {
+#ifdef __linux__
+    // Punching a hole frees the physical pages while every view keeps its address; nothing to
+    // do on failure, the pages simply stay committed.
+    fallocate(handle, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, static_cast<off_t>(offset),
+              static_cast<off_t>(size));
+#endif
+}
+
+void DecommitMemoryPages(void* base, std::size_t size) {
+#ifdef _WIN32
+    // MEM_RESET lets the OS reclaim the pages under pressure while the region stays committed
+    // and mapped.
+    VirtualAlloc(base, size, MEM_RESET, PAGE_READWRITE);
+#else
+    madvise(base, size, MADV_DONTNEED);
+#endif
+}
+
 } // namespace Common
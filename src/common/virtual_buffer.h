@@ -8,9 +8,74 @@
 
 namespace Common {
 
+#ifdef _WIN32
+using BackingFileHandle = void*;
+constexpr BackingFileHandle InvalidBackingFileHandle = nullptr;
+#else
+using BackingFileHandle = int;
+constexpr BackingFileHandle InvalidBackingFileHandle = -1;
+#endif
+
 void* AllocateMemoryPages(std::size_t size);
 void FreeMemoryPages(void* base, std::size_t size);
 
+/**
+ * Hints the host kernel to back the given region with huge pages, reducing TLB pressure on
+ * large, hot allocations such as guest DRAM. Best effort; the kernel is free to ignore it.
+ */
+void EnableHugePages(void* base, std::size_t size);
+
+/**
+ * Returns how many bytes of the given mapping are currently backed by huge pages, or 0 when the
+ * host does not expose this information.
+ */
+std::size_t GetHugePageResidentBytes(const void* base, std::size_t size);
+
+/**
+ * Creates an anonymous memory backed file of the given size that can be mapped at multiple
+ * host addresses simultaneously.
+ *
+ * @returns A handle to the backing file, or InvalidBackingFileHandle when the host cannot
+ *          provide aliased mappings.
+ */
+BackingFileHandle CreateBackingFile(std::size_t size);
+
+/// Closes a backing file previously created with CreateBackingFile.
+void CloseBackingFile(BackingFileHandle handle);
+
+/// Maps a read/write view of a backing file at an arbitrary host address.
+void* MapBackingFile(BackingFileHandle handle, std::size_t offset, std::size_t size);
+
+/// Reserves a contiguous, inaccessible region of host address space.
+void* ReserveMemoryRegion(std::size_t size);
+
+/// Releases a region previously obtained from ReserveMemoryRegion.
+void FreeMemoryRegion(void* base, std::size_t size);
+
+/**
+ * Maps a read/write view of a backing file over part of a reserved region.
+ *
+ * @param target Page-aligned address inside a region from ReserveMemoryRegion.
+ */
+void* MapBackingFileView(void* target, BackingFileHandle handle, std::size_t offset,
+                         std::size_t size);
+
+/// Replaces a mapped view with an inaccessible reservation again.
+void UnmapBackingFileView(void* base, std::size_t size);
+
+/**
+ * Returns the physical pages backing [offset, offset + size) of a backing file to the host
+ * without changing the file size or any mapped view. The range reads back as zeroes and commits
+ * again on the next write. Best effort; hosts without hole punching keep the pages committed.
+ */
+void DecommitBackingFileRegion(BackingFileHandle handle, std::size_t offset, std::size_t size);
+
+/**
+ * Returns the physical pages backing an anonymous mapping to the host, discarding their
+ * contents. The mapping stays valid and re-commits on the next touch.
+ */
+void DecommitMemoryPages(void* base, std::size_t size);
+
 template <typename T>
 class VirtualBuffer final : NonCopyable {
 public:
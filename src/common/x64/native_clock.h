@@ -6,7 +6,6 @@
 
 #include <optional>
 
-#include "common/spin_lock.h"
 #include "common/wall_clock.h"
 
 namespace Common {
@@ -29,6 +28,16 @@ public:
     void Pause(bool is_paused) override;
 
 private:
+    /// Multiplies ticks by a (numerator / rtsc_frequency) ratio without dividing.
+    struct FixedRatio {
+        u64 whole; ///< Integer part of the ratio
+        u64 frac;  ///< Fractional part of the ratio in 0.64 fixed point
+    };
+
+    static FixedRatio ComputeFixedRatio(u64 numerator, u64 divisor);
+
+    static u64 Scale(u64 ticks, FixedRatio ratio);
+
     u64 GetRTSC();
 
     /// value used to reduce the native clocks accuracy as some apss rely on
@@ -36,10 +45,24 @@ private:
     /// be higher.
     static constexpr u64 inaccuracy_mask = ~(0x400 - 1);
 
-    SpinLock rtsc_serialize{};
-    u64 last_measure{};
-    u64 accumulated_ticks{};
+    /// Last TSC sample and the ticks accumulated so far, packed so both can be swapped with a
+    /// single 128-bit compare and exchange instead of serializing readers behind a lock.
+    union alignas(16) TimePoint {
+        u128 pack{};
+        struct Inner {
+            u64 last_measure;
+            u64 accumulated_ticks;
+        } inner;
+    };
+
+    TimePoint time_point{};
     u64 rtsc_frequency;
+
+    FixedRatio ns_ratio{};
+    FixedRatio us_ratio{};
+    FixedRatio ms_ratio{};
+    FixedRatio clock_ratio{};
+    FixedRatio cpu_ratio{};
 };
 } // namespace X64
 
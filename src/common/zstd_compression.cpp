@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <utility>
 #include <zstd.h>
 
 #include "common/assert.h"
@@ -48,4 +49,72 @@ std::vector<u8> DecompressDataZSTD(const std::vector<u8>& compressed) {
     return decompressed;
 }
 
+ZSTDCompressionContext::ZSTDCompressionContext() : context{ZSTD_createCCtx()} {}
+
+ZSTDCompressionContext::~ZSTDCompressionContext() {
+    ZSTD_freeCCtx(context);
+}
+
+ZSTDCompressionContext::ZSTDCompressionContext(ZSTDCompressionContext&& other) noexcept
+    : context{std::exchange(other.context, nullptr)} {}
+
+ZSTDCompressionContext& ZSTDCompressionContext::operator=(ZSTDCompressionContext&& other) noexcept {
+    ZSTD_freeCCtx(context);
+    context = std::exchange(other.context, nullptr);
+    return *this;
+}
+
+std::vector<u8> ZSTDCompressionContext::Compress(const u8* source, std::size_t source_size,
+                                                 s32 compression_level) {
+    compression_level = std::clamp(compression_level, 1, ZSTD_maxCLevel());
+
+    std::vector<u8> compressed(ZSTD_compressBound(source_size));
+    const std::size_t compressed_size = ZSTD_compressCCtx(
+        context, compressed.data(), compressed.size(), source, source_size, compression_level);
+
+    if (ZSTD_isError(compressed_size)) {
+        // Compression failed
+        return {};
+    }
+
+    compressed.resize(compressed_size);
+
+    return compressed;
+}
+
+std::vector<u8> ZSTDCompressionContext::CompressDefault(const u8* source, std::size_t source_size) {
+    return Compress(source, source_size, ZSTD_CLEVEL_DEFAULT);
+}
+
+ZSTDDecompressionContext::ZSTDDecompressionContext() : context{ZSTD_createDCtx()} {}
+
+ZSTDDecompressionContext::~ZSTDDecompressionContext() {
+    ZSTD_freeDCtx(context);
+}
+
+ZSTDDecompressionContext::ZSTDDecompressionContext(ZSTDDecompressionContext&& other) noexcept
+    : context{std::exchange(other.context, nullptr)} {}
+
+ZSTDDecompressionContext& ZSTDDecompressionContext::operator=(
+    ZSTDDecompressionContext&& other) noexcept {
+    ZSTD_freeDCtx(context);
+    context = std::exchange(other.context, nullptr);
+    return *this;
+}
+
+std::vector<u8> ZSTDDecompressionContext::Decompress(const u8* compressed,
+                                                     std::size_t compressed_size) {
+    const std::size_t decompressed_size = ZSTD_getDecompressedSize(compressed, compressed_size);
+    std::vector<u8> decompressed(decompressed_size);
+
+    const std::size_t uncompressed_result_size = ZSTD_decompressDCtx(
+        context, decompressed.data(), decompressed.size(), compressed, compressed_size);
+
+    if (decompressed_size != uncompressed_result_size || ZSTD_isError(uncompressed_result_size)) {
+        // Decompression failed
+        return {};
+    }
+    return decompressed;
+}
+
 } // namespace Common::Compression
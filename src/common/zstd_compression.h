@@ -8,6 +8,9 @@
 
 #include "common/common_types.h"
 
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+
 namespace Common::Compression {
 
 /**
@@ -41,4 +44,67 @@ std::vector<u8> CompressDataZSTDDefault(const u8* source, std::size_t source_siz
  */
 std::vector<u8> DecompressDataZSTD(const std::vector<u8>& compressed);
 
+/**
+ * Reusable Zstandard compression context. Keeping a context alive across records reuses its
+ * internal workspace instead of allocating and tearing it down on every call, which matters when
+ * compressing many chunks in a row.
+ */
+class ZSTDCompressionContext {
+public:
+    ZSTDCompressionContext();
+    ~ZSTDCompressionContext();
+
+    ZSTDCompressionContext(const ZSTDCompressionContext&) = delete;
+    ZSTDCompressionContext& operator=(const ZSTDCompressionContext&) = delete;
+
+    ZSTDCompressionContext(ZSTDCompressionContext&& other) noexcept;
+    ZSTDCompressionContext& operator=(ZSTDCompressionContext&& other) noexcept;
+
+    /**
+     * Compresses a source memory region with this context's workspace.
+     *
+     * @param source the uncompressed source memory region.
+     * @param source_size the size in bytes of the uncompressed source memory region.
+     * @param compression_level the used compression level. Should be between 1 and 22.
+     *
+     * @return the compressed data, or an empty vector on failure.
+     */
+    std::vector<u8> Compress(const u8* source, std::size_t source_size, s32 compression_level);
+
+    /// Compresses a source memory region with the default compression level.
+    std::vector<u8> CompressDefault(const u8* source, std::size_t source_size);
+
+private:
+    ZSTD_CCtx_s* context{};
+};
+
+/**
+ * Reusable Zstandard decompression context; the decompression counterpart of
+ * ZSTDCompressionContext.
+ */
+class ZSTDDecompressionContext {
+public:
+    ZSTDDecompressionContext();
+    ~ZSTDDecompressionContext();
+
+    ZSTDDecompressionContext(const ZSTDDecompressionContext&) = delete;
+    ZSTDDecompressionContext& operator=(const ZSTDDecompressionContext&) = delete;
+
+    ZSTDDecompressionContext(ZSTDDecompressionContext&& other) noexcept;
+    ZSTDDecompressionContext& operator=(ZSTDDecompressionContext&& other) noexcept;
+
+    /**
+     * Decompresses a compressed memory region with this context's workspace.
+     *
+     * @param compressed the compressed source memory region.
+     * @param compressed_size the size in bytes of the compressed source memory region.
+     *
+     * @return the decompressed data, or an empty vector on failure.
+     */
+    std::vector<u8> Decompress(const u8* compressed, std::size_t compressed_size);
+
+private:
+    ZSTD_DCtx_s* context{};
+};
+
 } // namespace Common::Compression
\ No newline at end of file
@@ -67,6 +67,13 @@ public:
     /// Clear all instruction cache
     virtual void ClearInstructionCache() = 0;
 
+    /**
+     * Invalidates only the cached instructions that intersect the given range, keeping the rest
+     * of the translation cache warm. Falls back to a full clear on backends without range
+     * support.
+     */
+    virtual void InvalidateCacheRange(VAddr addr, std::size_t size) = 0;
+
     /// Notifies CPU emulation that the current page table has changed.
     ///
     /// @param new_page_table                 The new page table.
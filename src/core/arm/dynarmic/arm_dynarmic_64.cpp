@@ -2,10 +2,16 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cinttypes>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include <dynarmic/A64/a64.h>
 #include <dynarmic/A64/config.h>
+#include <fmt/format.h>
+#include "common/common_paths.h"
+#include "common/file_util.h"
 #include "common/logging/log.h"
 #include "common/page_table.h"
 #include "core/arm/cpu_interrupt_handler.h"
@@ -26,6 +32,100 @@ namespace Core {
 
 using Vector = Dynarmic::A64::Vector;
 
+namespace {
+
+/**
+ * Accumulates translated-block entry points across cores and sessions for one title, analogous
+ * to the transferable half of the shader disk cache. Each entry stores the first instruction
+ * word of the block, so stale entries are detected and replaced when a title update moves code.
+ * Dynarmic has no interface to translate a block ahead of execution yet; once it grows one, the
+ * profile read back here is the set to feed it at boot.
+ */
+class BlockProfileStore {
+public:
+    static BlockProfileStore& Instance() {
+        static BlockProfileStore instance;
+        return instance;
+    }
+
+    /// Folds one core's translated blocks into the on-disk profile for the given title
+    void Merge(u64 title_id, const std::unordered_map<u64, u32>& blocks) {
+        if (title_id == 0 || blocks.empty()) {
+            return;
+        }
+        std::lock_guard lock{mutex};
+
+        auto merged = Load(title_id);
+        const std::size_t previous_count = merged.size();
+        for (const auto& [entry, instruction] : blocks) {
+            merged[entry] = instruction;
+        }
+        Save(title_id, merged);
+        LOG_INFO(Core_ARM, "Block profile for {:016X} now covers {} blocks ({} recorded)",
+                 title_id, merged.size(), merged.size() - previous_count);
+    }
+
+private:
+    struct BlockRecord {
+        u64 entry;       ///< Virtual address translation started at
+        u32 instruction; ///< First instruction word of the block when it was translated
+        u32 padding;
+    };
+    static_assert(sizeof(BlockRecord) == 16, "BlockRecord is an on-disk format");
+
+    static std::string GetProfilePath(u64 title_id) {
+        return FileUtil::GetUserPath(FileUtil::UserPath::CacheDir) + DIR_SEP "cpu" DIR_SEP +
+               fmt::format("{:016X}.blocks", title_id);
+    }
+
+    static std::unordered_map<u64, u32> Load(u64 title_id) {
+        std::unordered_map<u64, u32> blocks;
+        FileUtil::IOFile file(GetProfilePath(title_id), "rb");
+        if (!file.IsOpen()) {
+            return blocks;
+        }
+        const std::size_t count = file.GetSize() / sizeof(BlockRecord);
+        std::vector<BlockRecord> records(count);
+        if (file.ReadArray(records.data(), count) != count) {
+            LOG_ERROR(Core_ARM, "Failed to read block profile for {:016X}, discarding it",
+                      title_id);
+            return {};
+        }
+        blocks.reserve(count);
+        for (const BlockRecord& record : records) {
+            blocks.emplace(record.entry, record.instruction);
+        }
+        return blocks;
+    }
+
+    static void Save(u64 title_id, const std::unordered_map<u64, u32>& blocks) {
+        const std::string path = GetProfilePath(title_id);
+        if (!FileUtil::CreateFullPath(path)) {
+            LOG_ERROR(Core_ARM, "Failed to create block profile directory for {}", path);
+            return;
+        }
+
+        std::vector<BlockRecord> records;
+        records.reserve(blocks.size());
+        for (const auto& [entry, instruction] : blocks) {
+            records.push_back({entry, instruction, 0});
+        }
+        std::sort(records.begin(), records.end(),
+                  [](const BlockRecord& lhs, const BlockRecord& rhs) {
+                      return lhs.entry < rhs.entry;
+                  });
+
+        FileUtil::IOFile file(path, "wb");
+        if (!file.IsOpen() || file.WriteArray(records.data(), records.size()) != records.size()) {
+            LOG_ERROR(Core_ARM, "Failed to write block profile to {}", path);
+        }
+    }
+
+    std::mutex mutex;
+};
+
+} // Anonymous namespace
+
 class DynarmicCallbacks64 : public Dynarmic::A64::UserCallbacks {
 public:
     explicit DynarmicCallbacks64(ARM_Dynarmic_64& parent) : parent(parent) {}
@@ -47,6 +147,12 @@ public:
         return {memory.Read64(vaddr), memory.Read64(vaddr + 8)};
     }
 
+    u32 MemoryReadCode(u64 vaddr) override {
+        const u32 instruction = MemoryRead32(vaddr);
+        parent.RecordCodeFetch(vaddr, instruction);
+        return instruction;
+    }
+
     void MemoryWrite8(u64 vaddr, u8 value) override {
         parent.system.Memory().Write8(vaddr, value);
     }
@@ -144,7 +250,7 @@ public:
     u64 GetTicksRemaining() override {
         if (parent.uses_wall_clock) {
             if (!parent.interrupt_handlers[parent.core_index].IsInterrupted()) {
-                return minimum_run_cycles;
+                return Settings::values.cpu_jit_minimum_run_cycles;
             }
             return 0U;
         }
@@ -159,7 +265,6 @@ public:
     std::size_t num_interpreted_instructions = 0;
     u64 tpidrro_el0 = 0;
     u64 tpidr_el0 = 0;
-    static constexpr u64 minimum_run_cycles = 1000U;
 };
 
 std::shared_ptr<Dynarmic::A64::Jit> ARM_Dynarmic_64::MakeJit(Common::PageTable& page_table,
@@ -176,6 +281,10 @@ std::shared_ptr<Dynarmic::A64::Jit> ARM_Dynarmic_64::MakeJit(Common::PageTable&
     config.absolute_offset_page_table = true;
     config.detect_misaligned_access_via_page_table = 16 | 32 | 64 | 128;
     config.only_detect_misalignment_via_page_table_on_page_boundary = true;
+    if (Settings::values.cpu_jit_skip_misalignment_checks) {
+        // Title profile opt-in: skip the page table misalignment checks entirely.
+        config.detect_misaligned_access_via_page_table = 0;
+    }
 
     // Multi-process state
     config.processor_id = core_index;
@@ -189,7 +298,7 @@ std::shared_ptr<Dynarmic::A64::Jit> ARM_Dynarmic_64::MakeJit(Common::PageTable&
     config.cntfrq_el0 = Hardware::CNTFREQ;
 
     // Unpredictable instructions
-    config.define_unpredictable_behaviour = true;
+    config.define_unpredictable_behaviour = !Settings::values.cpu_jit_relax_unpredictable;
 
     // Optimizations
     if (Settings::values.disable_cpu_opt) {
@@ -222,7 +331,24 @@ ARM_Dynarmic_64::ARM_Dynarmic_64(System& system, CPUInterrupts& interrupt_handle
       core_index{core_index}, exclusive_monitor{
                                   dynamic_cast<DynarmicExclusiveMonitor&>(exclusive_monitor)} {}
 
-ARM_Dynarmic_64::~ARM_Dynarmic_64() = default;
+ARM_Dynarmic_64::~ARM_Dynarmic_64() {
+    BlockProfileStore::Instance().Merge(profile_title_id, translated_blocks);
+}
+
+void ARM_Dynarmic_64::RecordCodeFetch(u64 vaddr, u32 instruction) {
+    // The JIT fetches a block's instructions in order, so a non-sequential fetch is the entry
+    // point of a new translation. This only runs while blocks are being translated, never on
+    // the compiled hot path.
+    if (vaddr != last_code_fetch + sizeof(u32)) {
+        if (profile_title_id == 0) {
+            if (const Kernel::Process* process = system.CurrentProcess()) {
+                profile_title_id = process->GetTitleID();
+            }
+        }
+        translated_blocks.emplace(vaddr, instruction);
+    }
+    last_code_fetch = vaddr;
+}
 
 void ARM_Dynarmic_64::SetPC(u64 pc) {
     jit->SetPC(pc);
@@ -309,6 +435,13 @@ void ARM_Dynarmic_64::ClearInstructionCache() {
     jit->ClearCache();
 }
 
+void ARM_Dynarmic_64::InvalidateCacheRange(VAddr addr, std::size_t size) {
+    if (!jit) {
+        return;
+    }
+    jit->InvalidateCacheRange(addr, size);
+}
+
 void ARM_Dynarmic_64::ClearExclusiveState() {
     jit->ClearExclusiveState();
 }
@@ -56,6 +56,7 @@ public:
     void ClearExclusiveState() override;
 
     void ClearInstructionCache() override;
+    void InvalidateCacheRange(VAddr addr, std::size_t size) override;
     void PageTableChanged(Common::PageTable& new_page_table,
                           std::size_t new_address_space_size_in_bits) override;
 
@@ -63,6 +64,10 @@ private:
     std::shared_ptr<Dynarmic::A64::Jit> MakeJit(Common::PageTable& page_table,
                                                 std::size_t address_space_bits) const;
 
+    /// Records a code fetch made by the JIT while it translates. Non-sequential fetches mark
+    /// block entry points, which feed the per-title block profile written at shutdown.
+    void RecordCodeFetch(u64 vaddr, u32 instruction);
+
     using JitCacheKey = std::pair<Common::PageTable*, std::size_t>;
     using JitCacheType =
         std::unordered_map<JitCacheKey, std::shared_ptr<Dynarmic::A64::Jit>, Common::PairHash>;
@@ -75,6 +80,13 @@ private:
 
     std::size_t core_index;
     DynarmicExclusiveMonitor& exclusive_monitor;
+
+    /// First instruction word of every block translated this session, keyed by entry point
+    std::unordered_map<u64, u32> translated_blocks;
+    /// Address of the previous code fetch, used to detect non-sequential (entry) fetches
+    u64 last_code_fetch = 0;
+    /// Title the block profile belongs to, captured on the first recorded fetch
+    u64 profile_title_id = 0;
 };
 
 } // namespace Core
@@ -4,6 +4,7 @@
 
 #include <cinttypes>
 #include <memory>
+#include "common/logging/log.h"
 #include "core/arm/dynarmic/arm_exclusive_monitor.h"
 #include "core/memory.h"
 
@@ -12,7 +13,35 @@ namespace Core {
 DynarmicExclusiveMonitor::DynarmicExclusiveMonitor(Memory::Memory& memory, std::size_t core_count)
     : monitor(core_count), memory{memory} {}
 
-DynarmicExclusiveMonitor::~DynarmicExclusiveMonitor() = default;
+DynarmicExclusiveMonitor::~DynarmicExclusiveMonitor() {
+    u64 total = 0;
+    u64 failed = 0;
+    for (const StripeCounters& stripe : stripe_counters) {
+        total += stripe.total_stores.load(std::memory_order_relaxed);
+        failed += stripe.failed_stores.load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return;
+    }
+    LOG_INFO(Core_ARM, "Exclusive stores: {} total, {} failed", total, failed);
+    for (std::size_t i = 0; i < NUM_STRIPES; ++i) {
+        const u64 stripe_total = stripe_counters[i].total_stores.load(std::memory_order_relaxed);
+        const u64 stripe_failed = stripe_counters[i].failed_stores.load(std::memory_order_relaxed);
+        if (stripe_failed == 0) {
+            continue;
+        }
+        LOG_INFO(Core_ARM, "  stripe {:2}: {} stores, {} failed", i, stripe_total, stripe_failed);
+    }
+}
+
+bool DynarmicExclusiveMonitor::RecordExclusiveResult(VAddr vaddr, bool passed) {
+    StripeCounters& stripe = stripe_counters[StripeIndex(vaddr)];
+    stripe.total_stores.fetch_add(1, std::memory_order_relaxed);
+    if (!passed) {
+        stripe.failed_stores.fetch_add(1, std::memory_order_relaxed);
+    }
+    return passed;
+}
 
 u8 DynarmicExclusiveMonitor::ExclusiveRead8(std::size_t core_index, VAddr addr) {
     return monitor.ReadAndMark<u8>(core_index, addr, [&]() -> u8 { return memory.Read8(addr); });
@@ -44,33 +73,43 @@ void DynarmicExclusiveMonitor::ClearExclusive() {
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite8(std::size_t core_index, VAddr vaddr, u8 value) {
-    return monitor.DoExclusiveOperation<u8>(core_index, vaddr, [&](u8 expected) -> bool {
-        return memory.WriteExclusive8(vaddr, value, expected);
-    });
+    const bool passed =
+        monitor.DoExclusiveOperation<u8>(core_index, vaddr, [&](u8 expected) -> bool {
+            return memory.WriteExclusive8(vaddr, value, expected);
+        });
+    return RecordExclusiveResult(vaddr, passed);
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite16(std::size_t core_index, VAddr vaddr, u16 value) {
-    return monitor.DoExclusiveOperation<u16>(core_index, vaddr, [&](u16 expected) -> bool {
-        return memory.WriteExclusive16(vaddr, value, expected);
-    });
+    const bool passed =
+        monitor.DoExclusiveOperation<u16>(core_index, vaddr, [&](u16 expected) -> bool {
+            return memory.WriteExclusive16(vaddr, value, expected);
+        });
+    return RecordExclusiveResult(vaddr, passed);
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite32(std::size_t core_index, VAddr vaddr, u32 value) {
-    return monitor.DoExclusiveOperation<u32>(core_index, vaddr, [&](u32 expected) -> bool {
-        return memory.WriteExclusive32(vaddr, value, expected);
-    });
+    const bool passed =
+        monitor.DoExclusiveOperation<u32>(core_index, vaddr, [&](u32 expected) -> bool {
+            return memory.WriteExclusive32(vaddr, value, expected);
+        });
+    return RecordExclusiveResult(vaddr, passed);
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite64(std::size_t core_index, VAddr vaddr, u64 value) {
-    return monitor.DoExclusiveOperation<u64>(core_index, vaddr, [&](u64 expected) -> bool {
-        return memory.WriteExclusive64(vaddr, value, expected);
-    });
+    const bool passed =
+        monitor.DoExclusiveOperation<u64>(core_index, vaddr, [&](u64 expected) -> bool {
+            return memory.WriteExclusive64(vaddr, value, expected);
+        });
+    return RecordExclusiveResult(vaddr, passed);
 }
 
 bool DynarmicExclusiveMonitor::ExclusiveWrite128(std::size_t core_index, VAddr vaddr, u128 value) {
-    return monitor.DoExclusiveOperation<u128>(core_index, vaddr, [&](u128 expected) -> bool {
-        return memory.WriteExclusive128(vaddr, value, expected);
-    });
+    const bool passed =
+        monitor.DoExclusiveOperation<u128>(core_index, vaddr, [&](u128 expected) -> bool {
+            return memory.WriteExclusive128(vaddr, value, expected);
+        });
+    return RecordExclusiveResult(vaddr, passed);
 }
 
 } // namespace Core
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 
@@ -41,8 +43,31 @@ public:
 private:
     friend class ARM_Dynarmic_32;
     friend class ARM_Dynarmic_64;
+
+    /// Number of address stripes exclusive store results are accounted to. Must be a power of
+    /// two.
+    static constexpr std::size_t NUM_STRIPES = 16;
+
+    /// Counters for one address stripe, padded to a cache line so cores tallying different
+    /// stripes do not share one.
+    struct alignas(64) StripeCounters {
+        std::atomic<u64> total_stores{0};
+        std::atomic<u64> failed_stores{0};
+    };
+
+    /// Returns the stripe an exclusive address is accounted to. Exclusives are tracked at
+    /// 16-byte granularity, so the low four bits carry no information.
+    static std::size_t StripeIndex(VAddr vaddr) {
+        return static_cast<std::size_t>(vaddr >> 4) % NUM_STRIPES;
+    }
+
+    /// Tallies the outcome of an exclusive store for contention diagnostics.
+    bool RecordExclusiveResult(VAddr vaddr, bool passed);
+
     Dynarmic::ExclusiveMonitor monitor;
     Core::Memory::Memory& memory;
+
+    std::array<StripeCounters, NUM_STRIPES> stripe_counters{};
 };
 
 } // namespace Core
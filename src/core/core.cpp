@@ -210,6 +210,15 @@ struct System::Impl {
             return ResultStatus::ErrorGetLoader;
         }
 
+        // Apply any per-title settings overlay before the system is brought up, so settings that
+        // are only honored at boot (e.g. asynchronous GPU emulation) pick up the overrides too.
+        {
+            u64 overlay_title_id{0};
+            if (app_loader->ReadProgramId(overlay_title_id) == Loader::ResultStatus::Success) {
+                Settings::LoadTitleOverlay(overlay_title_id);
+            }
+        }
+
         ResultStatus init_result{Init(system, emu_window)};
         if (init_result != ResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to initialize system (Error {})!",
@@ -299,6 +308,12 @@ struct System::Impl {
         // Close all CPU/threading state
         cpu_manager.Shutdown();
 
+        // Hand the scheduler counters over before the kernel is torn down so they make it into
+        // the shutdown summary.
+        if (perf_stats) {
+            perf_stats->RecordSchedulerStats(kernel.GlobalScheduler().GetStatistics());
+        }
+
         // Shutdown kernel and core timing
         kernel.Shutdown();
         core_timing.Shutdown();
@@ -434,6 +449,10 @@ void System::InvalidateCpuInstructionCaches() {
     impl->kernel.InvalidateAllInstructionCaches();
 }
 
+void System::InvalidateCpuInstructionCacheRange(VAddr addr, std::size_t size) {
+    impl->kernel.InvalidateCpuInstructionCacheRange(addr, size);
+}
+
 System::ResultStatus System::Load(Frontend::EmuWindow& emu_window, const std::string& filepath) {
     return impl->Load(*this, emu_window, filepath);
 }
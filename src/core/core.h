@@ -161,6 +161,12 @@ public:
      */
     void InvalidateCpuInstructionCaches();
 
+    /**
+     * Invalidate only the CPU instruction cache entries intersecting the given range, for code
+     * patching that knows which addresses were rewritten. Keeps unrelated translated blocks warm.
+     */
+    void InvalidateCpuInstructionCacheRange(VAddr addr, std::size_t size);
+
     /// Shutdown the emulated system.
     void Shutdown();
 
@@ -9,6 +9,7 @@
 
 #include "common/assert.h"
 #include "common/microprofile.h"
+#include "common/slab_allocator.h"
 #include "core/core_timing.h"
 #include "core/core_timing_util.h"
 
@@ -16,27 +17,11 @@ namespace Core::Timing {
 
 constexpr u64 MAX_SLICE_LENGTH = 4000;
 
-std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback&& callback) {
-    return std::make_shared<EventType>(std::move(callback), std::move(name));
+std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback callback,
+                                       std::uintptr_t context) {
+    return Common::MakeSlabShared<EventType>(callback, context, std::move(name));
 }
 
-struct CoreTiming::Event {
-    u64 time;
-    u64 fifo_order;
-    u64 userdata;
-    std::weak_ptr<EventType> type;
-
-    // Sort by time, unless the times are the same, in which case sort by
-    // the order added to the queue
-    friend bool operator>(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) > std::tie(right.time, right.fifo_order);
-    }
-
-    friend bool operator<(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
-    }
-};
-
 CoreTiming::CoreTiming() {
     clock =
         Common::CreateBestMatchingClock(Core::Hardware::BASE_CLOCK_RATE, Core::Hardware::CNTFREQ);
@@ -58,7 +43,7 @@ void CoreTiming::Initialize(std::function<void(void)>&& on_thread_init_) {
     event_fifo_id = 0;
     shutting_down = false;
     ticks = 0;
-    const auto empty_timed_callback = [](u64, s64) {};
+    const auto empty_timed_callback = [](std::uintptr_t, u64, s64) {};
     ev_lost = CreateEvent("_lost_event", empty_timed_callback);
     if (is_multicore) {
         timer_thread = std::make_unique<std::thread>(ThreadEntry, std::ref(*this));
@@ -103,24 +88,38 @@ bool CoreTiming::IsRunning() const {
 }
 
 bool CoreTiming::HasPendingEvents() const {
-    return !(wait_set && event_queue.empty());
+    return !(wait_set && event_queue.empty() && staged_events.Empty());
 }
 
 void CoreTiming::ScheduleEvent(s64 ns_into_future, const std::shared_ptr<EventType>& event_type,
                                u64 userdata) {
-    {
+    const u64 timeout = static_cast<u64>(GetGlobalTimeNs().count() + ns_into_future);
+
+    // Stage the event without taking basic_lock, so scheduling from the emulated cores does
+    // not contend with the timer thread draining the heap.
+    Event evt{timeout, event_fifo_id++, userdata, event_type};
+    if (!staged_events.TryPush(evt)) {
+        // The staging queue is full; drain it into the heap ourselves rather than waiting for
+        // the consumer, which may be this very thread in single core mode.
         std::scoped_lock scope{basic_lock};
-        const u64 timeout = static_cast<u64>(GetGlobalTimeNs().count() + ns_into_future);
-
-        event_queue.emplace_back(Event{timeout, event_fifo_id++, userdata, event_type});
-
+        MergeStagedEvents();
+        event_queue.emplace_back(std::move(evt));
         std::push_heap(event_queue.begin(), event_queue.end(), std::greater<>());
     }
     event.Set();
 }
 
+void CoreTiming::MergeStagedEvents() {
+    Event evt;
+    while (staged_events.TryPop(evt)) {
+        event_queue.emplace_back(std::move(evt));
+        std::push_heap(event_queue.begin(), event_queue.end(), std::greater<>());
+    }
+}
+
 void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type, u64 userdata) {
     std::scoped_lock scope{basic_lock};
+    MergeStagedEvents();
     const auto itr = std::remove_if(event_queue.begin(), event_queue.end(), [&](const Event& e) {
         return e.type.lock().get() == event_type.get() && e.userdata == userdata;
     });
@@ -138,6 +137,10 @@ void CoreTiming::AddTicks(u64 ticks) {
 }
 
 void CoreTiming::Idle() {
+    {
+        std::scoped_lock scope{basic_lock};
+        MergeStagedEvents();
+    }
     if (!event_queue.empty()) {
         const u64 next_event_time = event_queue.front().time;
         const u64 next_ticks = nsToCycles(std::chrono::nanoseconds(next_event_time)) + 10U;
@@ -168,11 +171,15 @@ u64 CoreTiming::GetClockTicks() const {
 }
 
 void CoreTiming::ClearPendingEvents() {
+    Event evt;
+    while (staged_events.TryPop(evt)) {
+    }
     event_queue.clear();
 }
 
 void CoreTiming::RemoveEvent(const std::shared_ptr<EventType>& event_type) {
     basic_lock.lock();
+    MergeStagedEvents();
 
     const auto itr = std::remove_if(event_queue.begin(), event_queue.end(), [&](const Event& e) {
         return e.type.lock().get() == event_type.get();
@@ -189,6 +196,7 @@ void CoreTiming::RemoveEvent(const std::shared_ptr<EventType>& event_type) {
 std::optional<s64> CoreTiming::Advance() {
     std::scoped_lock advance_scope{advance_lock};
     std::scoped_lock basic_scope{basic_lock};
+    MergeStagedEvents();
     global_timer = GetGlobalTimeNs().count();
 
     while (!event_queue.empty() && event_queue.front().time <= global_timer) {
@@ -198,10 +206,11 @@ std::optional<s64> CoreTiming::Advance() {
         basic_lock.unlock();
 
         if (auto event_type{evt.type.lock()}) {
-            event_type->callback(evt.userdata, global_timer - evt.time);
+            event_type->callback(event_type->context, evt.userdata, global_timer - evt.time);
         }
 
         basic_lock.lock();
+        MergeStagedEvents();
         global_timer = GetGlobalTimeNs().count();
     }
 
@@ -6,33 +6,38 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/mpmc_queue.h"
 #include "common/spin_lock.h"
 #include "common/thread.h"
-#include "common/threadsafe_queue.h"
 #include "common/wall_clock.h"
 #include "core/hardware_properties.h"
 
 namespace Core::Timing {
 
-/// A callback that may be scheduled for a particular core timing event.
-using TimedCallback = std::function<void(u64 userdata, s64 cycles_late)>;
+/// A callback that may be scheduled for a particular core timing event. The context value is the
+/// one the event type was created with, typically the owning object.
+using TimedCallback = void (*)(std::uintptr_t context, u64 userdata, s64 cycles_late);
 
 /// Contains the characteristics of a particular event.
 struct EventType {
-    EventType(TimedCallback&& callback, std::string&& name)
-        : callback{std::move(callback)}, name{std::move(name)} {}
+    EventType(TimedCallback callback, std::uintptr_t context, std::string&& name)
+        : callback{callback}, context{context}, name{std::move(name)} {}
 
     /// The event's callback function.
     TimedCallback callback;
+    /// Context value handed back to the callback, so callbacks do not need captures.
+    std::uintptr_t context;
     /// A pointer to the name of the event.
     const std::string name;
 };
@@ -129,11 +134,32 @@ public:
     std::optional<s64> Advance();
 
 private:
-    struct Event;
+    /// Contains one scheduled occurrence of an event.
+    struct Event {
+        u64 time;
+        u64 fifo_order;
+        u64 userdata;
+        // Kept weak so occurrences of an already destroyed event type are skipped instead of
+        // calling through a dangling pointer. Everything else in the node is flat.
+        std::weak_ptr<EventType> type;
+
+        // Sort by time, unless the times are the same, in which case sort by
+        // the order added to the queue
+        friend bool operator>(const Event& left, const Event& right) {
+            return std::tie(left.time, left.fifo_order) > std::tie(right.time, right.fifo_order);
+        }
+
+        friend bool operator<(const Event& left, const Event& right) {
+            return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
+        }
+    };
 
     /// Clear all pending events. This should ONLY be done on exit.
     void ClearPendingEvents();
 
+    /// Moves events staged by ScheduleEvent into the heap. basic_lock must be held.
+    void MergeStagedEvents();
+
     static void ThreadEntry(CoreTiming& instance);
     void ThreadLoop();
 
@@ -148,7 +174,13 @@ private:
     // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't
     // accomodated by the standard adaptor class.
     std::vector<Event> event_queue;
-    u64 event_fifo_id = 0;
+    std::atomic<u64> event_fifo_id = 0;
+
+    // Events scheduled from the emulated cores are staged here without touching the heap, so
+    // that AddTicks-driven scheduling does not contend with the timer thread on basic_lock.
+    // The staged events are merged into the heap by the consuming thread. The queue is bounded
+    // so staging never allocates; overflow falls back to pushing under basic_lock.
+    Common::MPMCQueue<Event, 256> staged_events;
 
     std::shared_ptr<EventType> ev_lost;
     Common::Event event{};
@@ -174,9 +206,11 @@ private:
 ///
 /// @param name     The name of the core timing event to create.
 /// @param callback The callback to execute for the event.
+/// @param context  Context value passed through to the callback, typically the owning object.
 ///
 /// @returns An EventType instance representing the created event.
 ///
-std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback&& callback);
+std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback callback,
+                                       std::uintptr_t context = 0);
 
 } // namespace Core::Timing
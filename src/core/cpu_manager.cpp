@@ -2,7 +2,11 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <chrono>
+#include <thread>
+
 #include "common/fiber.h"
+#include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/thread.h"
 #include "core/arm/exclusive_monitor.h"
@@ -170,6 +174,9 @@ void CpuManager::MultiCorePause(bool paused) {
                 all_not_barrier &=
                     !core_data[core].is_running.load() && core_data[core].initialized.load();
             }
+            if (!all_not_barrier) {
+                std::this_thread::yield();
+            }
         }
         for (std::size_t core = 0; core < Core::Hardware::NUM_CPU_CORES; core++) {
             core_data[core].enter_barrier->Set();
@@ -182,6 +189,9 @@ void CpuManager::MultiCorePause(bool paused) {
                     all_barrier &=
                         core_data[core].is_paused.load() && core_data[core].initialized.load();
                 }
+                if (!all_barrier) {
+                    std::this_thread::yield();
+                }
             }
             for (std::size_t core = 0; core < Core::Hardware::NUM_CPU_CORES; core++) {
                 core_data[core].exit_barrier->Set();
@@ -196,6 +206,9 @@ void CpuManager::MultiCorePause(bool paused) {
                 all_barrier &=
                     core_data[core].is_paused.load() && core_data[core].initialized.load();
             }
+            if (!all_barrier) {
+                std::this_thread::yield();
+            }
         }
         /// Don't release the barrier
     }
@@ -272,8 +285,10 @@ void CpuManager::PreemptSingleCore(bool from_running_enviroment) {
     Kernel::Thread* current_thread = scheduler.GetCurrentThread();
     if (idle_count >= 4 || from_running_enviroment) {
         if (!from_running_enviroment) {
+            // Every core has been seen idle: warp straight to the next scheduled event. The
+            // counter is deliberately not reset here, so the warp repeats on every rotation
+            // until a real thread becomes runnable again (which resets it below).
             system.CoreTiming().Idle();
-            idle_count = 0;
         }
         current_thread->SetPhantomMode(true);
         system.CoreTiming().Advance();
@@ -298,12 +313,18 @@ void CpuManager::SingleCorePause(bool paused) {
         bool all_not_barrier = false;
         while (!all_not_barrier) {
             all_not_barrier = !core_data[0].is_running.load() && core_data[0].initialized.load();
+            if (!all_not_barrier) {
+                std::this_thread::yield();
+            }
         }
         core_data[0].enter_barrier->Set();
         if (paused_state.load()) {
             bool all_barrier = false;
             while (!all_barrier) {
                 all_barrier = core_data[0].is_paused.load() && core_data[0].initialized.load();
+                if (!all_barrier) {
+                    std::this_thread::yield();
+                }
             }
             core_data[0].exit_barrier->Set();
         }
@@ -312,6 +333,9 @@ void CpuManager::SingleCorePause(bool paused) {
         bool all_barrier = false;
         while (!all_barrier) {
             all_barrier = core_data[0].is_paused.load() && core_data[0].initialized.load();
+            if (!all_barrier) {
+                std::this_thread::yield();
+            }
         }
         /// Don't release the barrier
     }
@@ -336,8 +360,7 @@ void CpuManager::RunThread(std::size_t core) {
         name = "yuzu:CPUThread";
     }
     MicroProfileOnThreadCreate(name.c_str());
-    Common::SetCurrentThreadName(name.c_str());
-    Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
+    Common::SetCurrentThreadRole(Common::ThreadRole::Emulation, name.c_str());
     auto& data = core_data[core];
     data.enter_barrier = std::make_unique<Common::Event>();
     data.exit_barrier = std::make_unique<Common::Event>();
@@ -368,6 +391,11 @@ void CpuManager::RunThread(std::size_t core) {
     data.enter_barrier.reset();
     data.exit_barrier.reset();
     data.initialized = false;
+
+    LOG_INFO(Core, "{} used {} ms of CPU time", name,
+             std::chrono::duration_cast<std::chrono::milliseconds>(
+                 Common::GetCurrentThreadCpuTime())
+                 .count());
 }
 
 } // namespace Core
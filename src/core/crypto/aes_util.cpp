@@ -93,6 +93,18 @@ void AESCipher<Key, KeySize>::Transcode(const u8* src, std::size_t size, u8* des
             return;
         }
 
+        if (mbedtls_cipher_get_cipher_mode(context) == MBEDTLS_MODE_CTR) {
+            // CTR is a stream mode, so the whole range can be processed with a single call
+            // instead of one call per 16-byte block.
+            mbedtls_cipher_update(context, src, size, dest, &written);
+            if (written != size) {
+                LOG_WARNING(Crypto, "Not all data was decrypted requested={:016X}, actual={:016X}.",
+                            size, written);
+            }
+            mbedtls_cipher_finish(context, nullptr, nullptr);
+            return;
+        }
+
         for (std::size_t offset = 0; offset < size; offset += block_size) {
             auto length = std::min<std::size_t>(block_size, size - offset);
             mbedtls_cipher_update(context, src + offset, length, dest + offset, &written);
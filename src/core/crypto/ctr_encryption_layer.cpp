@@ -17,6 +17,12 @@ std::size_t CTREncryptionLayer::Read(u8* data, std::size_t length, std::size_t o
     if (length == 0)
         return 0;
 
+    // Small requests are serviced from the decrypted readahead cache; only bulk reads decrypt
+    // straight into the destination.
+    if (length < readahead_size) {
+        return ReadFromCache(data, length, offset);
+    }
+
     const auto sector_offset = offset & 0xF;
     if (sector_offset == 0) {
         UpdateIV(base_offset + offset);
@@ -39,9 +45,36 @@ std::size_t CTREncryptionLayer::Read(u8* data, std::size_t length, std::size_t o
     return read + Read(data + read, length - read, offset + read);
 }
 
+std::size_t CTREncryptionLayer::ReadFromCache(u8* data, std::size_t length,
+                                              std::size_t offset) const {
+    std::size_t read = 0;
+    while (read < length) {
+        const std::size_t current = offset + read;
+        const std::size_t chunk_offset = current & ~(readahead_size - 1);
+        if (chunk_offset != cache_offset) {
+            UpdateIV(base_offset + chunk_offset);
+            read_cache = base->ReadBytes(readahead_size, chunk_offset);
+            cipher.Transcode(read_cache.data(), read_cache.size(), read_cache.data(), Op::Decrypt);
+            cache_offset = chunk_offset;
+        }
+        const std::size_t chunk_pos = current - chunk_offset;
+        if (chunk_pos >= read_cache.size()) {
+            // End of the base file
+            break;
+        }
+        const std::size_t copy_size = std::min(length - read, read_cache.size() - chunk_pos);
+        std::memcpy(data + read, read_cache.data() + chunk_pos, copy_size);
+        read += copy_size;
+    }
+    return read;
+}
+
 void CTREncryptionLayer::SetIV(const std::vector<u8>& iv_) {
     const auto length = std::min(iv_.size(), iv.size());
     iv.assign(iv_.cbegin(), iv_.cbegin() + length);
+
+    // Cached data was decrypted with the previous IV and is no longer valid.
+    cache_offset = std::numeric_limits<std::size_t>::max();
 }
 
 void CTREncryptionLayer::UpdateIV(std::size_t offset) const {
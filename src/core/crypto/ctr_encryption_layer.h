@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <limits>
 #include <vector>
 #include "core/crypto/aes_util.h"
 #include "core/crypto/encryption_layer.h"
@@ -21,13 +22,25 @@ public:
     void SetIV(const std::vector<u8>& iv);
 
 private:
+    /// Size of the decrypted readahead chunks. Must be a power of two multiple of the AES block
+    /// size so chunks stay aligned to cipher sectors.
+    static constexpr std::size_t readahead_size = 0x4000;
+
     std::size_t base_offset;
 
     // Must be mutable as operations modify cipher contexts.
     mutable AESCipher<Key128> cipher;
     mutable std::vector<u8> iv;
 
+    // Decrypted readahead cache. Small reads decrypt a whole aligned chunk once and serve
+    // subsequent requests out of it instead of paying one decryption call each.
+    mutable std::vector<u8> read_cache;
+    mutable std::size_t cache_offset = std::numeric_limits<std::size_t>::max();
+
     void UpdateIV(std::size_t offset) const;
+
+    /// Services a read through the decrypted readahead cache, refilling it chunk by chunk.
+    std::size_t ReadFromCache(u8* data, std::size_t length, std::size_t offset) const;
 };
 
 } // namespace Core::Crypto
@@ -912,6 +912,14 @@ void KeyManager::DeriveBase() {
 }
 
 void KeyManager::DeriveETicket(PartitionDataManager& data) {
+    // The derived outputs are persisted to the autogenerated key files; when both are already
+    // present from an earlier boot there is no need to rescan the ES system module for source
+    // hashes or decrypt PRODINFO again - only the ticket stores need repopulating.
+    if (HasKey(S128KeyType::ETicketRSAKek) && !IsAllZeroArray(eticket_extended_kek)) {
+        PopulateTickets();
+        return;
+    }
+
     // ETicket keys
     const auto es = Core::System::GetInstance().GetContentProvider().GetEntry(
         0x0100000000000033, FileSys::ContentRecordType::Program);
@@ -1006,6 +1014,23 @@ void KeyManager::PopulateTickets() {
 
     for (std::size_t i = 0; i < res.size(); ++i) {
         const auto common = i < idx;
+
+        // Titlekeys derived on an earlier boot are reloaded from title.keys_autogenerated;
+        // keep the ticket without redoing the RSA unwrap in that case
+        const Key128 rid_raw = res[i].GetData().rights_id;
+        if (rid_raw != Key128{}) {
+            u128 known_rights_id;
+            std::memcpy(known_rights_id.data(), rid_raw.data(), rid_raw.size());
+            if (HasKey(S128KeyType::Titlekey, known_rights_id[1], known_rights_id[0])) {
+                if (common) {
+                    common_tickets[known_rights_id] = res[i];
+                } else {
+                    personal_tickets[known_rights_id] = res[i];
+                }
+                continue;
+            }
+        }
+
         const auto pair = ParseTicket(res[i], rsa_key);
         if (!pair)
             continue;
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include "common/alignment.h"
 #include "common/assert.h"
 #include "core/crypto/xts_encryption_layer.h"
 
@@ -18,41 +19,62 @@ std::size_t XTSEncryptionLayer::Read(u8* data, std::size_t length, std::size_t o
     if (length == 0)
         return 0;
 
-    const auto sector_offset = offset & 0x3FFF;
-    if (sector_offset == 0) {
-        if (length % XTS_SECTOR_SIZE == 0) {
-            std::vector<u8> raw = base->ReadBytes(length, offset);
-            cipher.XTSTranscode(raw.data(), raw.size(), data, offset / XTS_SECTOR_SIZE,
-                                XTS_SECTOR_SIZE, Op::Decrypt);
-            return raw.size();
-        }
-        if (length > XTS_SECTOR_SIZE) {
-            const auto rem = length % XTS_SECTOR_SIZE;
-            const auto read = length - rem;
-            return Read(data, read, offset) + Read(data + read, rem, offset + read);
+    // Small requests are serviced from the decrypted readahead cache, which decrypts whole
+    // sector runs ahead of demand so sequential scans do not pay per-sector transcode setup.
+    if (length < readahead_size) {
+        return ReadFromCache(data, length, offset);
+    }
+
+    const std::size_t sector_offset = offset & (XTS_SECTOR_SIZE - 1);
+    if (sector_offset == 0 && length % XTS_SECTOR_SIZE == 0) {
+        // Bulk aligned runs decrypt straight into the destination with a single transcode;
+        // XTSTranscode steps the sector tweak internally.
+        std::vector<u8> raw = base->ReadBytes(length, offset);
+        if (raw.size() < length) {
+            raw.resize(length);
         }
-        std::vector<u8> buffer = base->ReadBytes(XTS_SECTOR_SIZE, offset);
-        if (buffer.size() < XTS_SECTOR_SIZE)
-            buffer.resize(XTS_SECTOR_SIZE);
-        cipher.XTSTranscode(buffer.data(), buffer.size(), buffer.data(), offset / XTS_SECTOR_SIZE,
+        cipher.XTSTranscode(raw.data(), raw.size(), data, offset / XTS_SECTOR_SIZE,
                             XTS_SECTOR_SIZE, Op::Decrypt);
-        std::memcpy(data, buffer.data(), std::min(buffer.size(), length));
-        return std::min(buffer.size(), length);
+        return length;
     }
 
-    // offset does not fall on block boundary (0x4000)
-    std::vector<u8> block = base->ReadBytes(0x4000, offset - sector_offset);
-    if (block.size() < XTS_SECTOR_SIZE)
-        block.resize(XTS_SECTOR_SIZE);
+    // Unaligned bulk read: decrypt the covering sector run through a scratch buffer.
+    const std::size_t aligned_offset = offset - sector_offset;
+    const std::size_t aligned_size = Common::AlignUp(sector_offset + length, XTS_SECTOR_SIZE);
+    std::vector<u8> block = base->ReadBytes(aligned_size, aligned_offset);
+    if (block.size() < aligned_size) {
+        block.resize(aligned_size);
+    }
     cipher.XTSTranscode(block.data(), block.size(), block.data(),
-                        (offset - sector_offset) / XTS_SECTOR_SIZE, XTS_SECTOR_SIZE, Op::Decrypt);
-    const std::size_t read = XTS_SECTOR_SIZE - sector_offset;
+                        aligned_offset / XTS_SECTOR_SIZE, XTS_SECTOR_SIZE, Op::Decrypt);
+    std::memcpy(data, block.data() + sector_offset, length);
+    return length;
+}
 
-    if (length + sector_offset < XTS_SECTOR_SIZE) {
-        std::memcpy(data, block.data() + sector_offset, std::min<u64>(length, read));
-        return std::min<u64>(length, read);
+std::size_t XTSEncryptionLayer::ReadFromCache(u8* data, std::size_t length,
+                                              std::size_t offset) const {
+    std::size_t read = 0;
+    while (read < length) {
+        const std::size_t current = offset + read;
+        const std::size_t chunk_offset = current & ~(readahead_size - 1);
+        if (chunk_offset != cache_offset) {
+            read_cache = base->ReadBytes(readahead_size, chunk_offset);
+            if (read_cache.size() % XTS_SECTOR_SIZE != 0) {
+                read_cache.resize(Common::AlignUp(read_cache.size(), XTS_SECTOR_SIZE));
+            }
+            cipher.XTSTranscode(read_cache.data(), read_cache.size(), read_cache.data(),
+                                chunk_offset / XTS_SECTOR_SIZE, XTS_SECTOR_SIZE, Op::Decrypt);
+            cache_offset = chunk_offset;
+        }
+        const std::size_t chunk_pos = current - chunk_offset;
+        if (chunk_pos >= read_cache.size()) {
+            // End of the base file
+            break;
+        }
+        const std::size_t copy_size = std::min(length - read, read_cache.size() - chunk_pos);
+        std::memcpy(data + read, read_cache.data() + chunk_pos, copy_size);
+        read += copy_size;
     }
-    std::memcpy(data, block.data() + sector_offset, read);
-    return read + Read(data + read, length - read, offset + read);
+    return read;
 }
 } // namespace Core::Crypto
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <limits>
+#include <vector>
 #include "core/crypto/aes_util.h"
 #include "core/crypto/encryption_layer.h"
 #include "core/crypto/key_manager.h"
@@ -18,8 +20,20 @@ public:
     std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
 
 private:
+    /// Size of the decrypted readahead chunks. Must be a power of two multiple of the XTS
+    /// sector size (0x4000) so chunks stay aligned to cipher sectors.
+    static constexpr std::size_t readahead_size = 0x10000;
+
     // Must be mutable as operations modify cipher contexts.
     mutable AESCipher<Key256> cipher;
+
+    // Decrypted readahead cache. Small reads decrypt a whole aligned chunk once and serve
+    // subsequent requests out of it instead of paying one sector transcode each.
+    mutable std::vector<u8> read_cache;
+    mutable std::size_t cache_offset = std::numeric_limits<std::size_t>::max();
+
+    /// Services a read through the decrypted readahead cache, refilling it chunk by chunk.
+    std::size_t ReadFromCache(u8* data, std::size_t length, std::size_t offset) const;
 };
 
 } // namespace Core::Crypto
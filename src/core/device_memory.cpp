@@ -2,14 +2,49 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include "common/logging/log.h"
 #include "core/core.h"
 #include "core/device_memory.h"
 #include "core/memory.h"
 
 namespace Core {
 
-DeviceMemory::DeviceMemory(System& system) : buffer{DramMemoryMap::Size}, system{system} {}
+DeviceMemory::DeviceMemory(System& system) : system{system} {
+    backing_file = Common::CreateBackingFile(DramMemoryMap::Size);
+    if (backing_file != Common::InvalidBackingFileHandle) {
+        base = static_cast<u8*>(Common::MapBackingFile(backing_file, 0, DramMemoryMap::Size));
+    }
+    if (!base) {
+        // Aliased mappings are unavailable on this host, so fastmem arenas cannot be built on
+        // top of DRAM. Fall back to a plain anonymous allocation.
+        Common::CloseBackingFile(backing_file);
+        backing_file = Common::InvalidBackingFileHandle;
+        fallback_buffer.resize(DramMemoryMap::Size);
+        base = fallback_buffer.data();
+    } else {
+        // All of guest DRAM is hot; huge pages cut the host TLB miss rate on guest memory
+        // traffic. The anonymous fallback path already gets the hint from AllocateMemoryPages.
+        Common::EnableHugePages(base, DramMemoryMap::Size);
+    }
+}
 
-DeviceMemory::~DeviceMemory() = default;
+void DeviceMemory::DecommitRegion(PAddr addr, std::size_t size) {
+    if (backing_file != Common::InvalidBackingFileHandle) {
+        Common::DecommitBackingFileRegion(backing_file, addr - DramMemoryMap::Base, size);
+    } else {
+        Common::DecommitMemoryPages(base + (addr - DramMemoryMap::Base), size);
+    }
+}
+
+DeviceMemory::~DeviceMemory() {
+    const std::size_t huge_bytes = Common::GetHugePageResidentBytes(base, DramMemoryMap::Size);
+    if (huge_bytes > 0) {
+        LOG_INFO(HW_Memory, "{} MiB of guest DRAM was backed by huge pages", huge_bytes >> 20);
+    }
+    if (backing_file != Common::InvalidBackingFileHandle) {
+        Common::FreeMemoryRegion(base, DramMemoryMap::Size);
+        Common::CloseBackingFile(backing_file);
+    }
+}
 
 } // namespace Core
@@ -31,20 +31,36 @@ public:
 
     template <typename T>
     PAddr GetPhysicalAddr(const T* ptr) const {
-        return (reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(buffer.data())) +
+        return (reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(base)) +
                DramMemoryMap::Base;
     }
 
     u8* GetPointer(PAddr addr) {
-        return buffer.data() + (addr - DramMemoryMap::Base);
+        return base + (addr - DramMemoryMap::Base);
     }
 
     const u8* GetPointer(PAddr addr) const {
-        return buffer.data() + (addr - DramMemoryMap::Base);
+        return base + (addr - DramMemoryMap::Base);
     }
 
+    /**
+     * Returns a handle to the file backing DRAM, which can be used to create aliased views of
+     * physical memory, or InvalidBackingFileHandle when the host cannot provide one.
+     */
+    Common::BackingFileHandle BackingFile() const {
+        return backing_file;
+    }
+
+    /**
+     * Returns the host pages backing the given physical range to the OS. The range reads back
+     * as zeroes afterwards, so only memory the guest has freed may be decommitted.
+     */
+    void DecommitRegion(PAddr addr, std::size_t size);
+
 private:
-    Common::VirtualBuffer<u8> buffer;
+    Common::BackingFileHandle backing_file{Common::InvalidBackingFileHandle};
+    u8* base{};
+    Common::VirtualBuffer<u8> fallback_buffer;
     Core::System& system;
 };
 
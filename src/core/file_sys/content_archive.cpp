@@ -4,9 +4,13 @@
 
 #include <algorithm>
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <optional>
 #include <utility>
 
+#include <fmt/format.h>
+
 #include "common/logging/log.h"
 #include "core/crypto/aes_util.h"
 #include "core/crypto/ctr_encryption_layer.h"
@@ -118,40 +122,92 @@ static bool IsValidNCA(const NCAHeader& header) {
     return header.magic == Common::MakeMagic('N', 'C', 'A', '3');
 }
 
-NCA::NCA(VirtualFile file_, VirtualFile bktr_base_romfs_, u64 bktr_base_ivfc_offset)
-    : file(std::move(file_)), bktr_base_romfs(std::move(bktr_base_romfs_)) {
+// Process-wide cache of decrypted headers and section tables, keyed by file path and size. The
+// game list and patch probing construct NCAs over the same files many times per session; the
+// header transcode and section table reads only need to happen once per distinct file. Failed
+// parses are not cached, so a failure caused by missing keys is retried once keys are available.
+struct ParsedNCAHeader {
+    NCAHeader header;
+    std::vector<NCASectionHeader> sections;
+    bool encrypted;
+};
+
+static std::mutex nca_header_cache_mutex;
+static std::map<std::string, ParsedNCAHeader> nca_header_cache;
+
+NCA::NCA(VirtualFile file_, VirtualFile bktr_base_romfs_, u64 bktr_base_ivfc_offset_)
+    : file(std::move(file_)), bktr_base_romfs(std::move(bktr_base_romfs_)),
+      bktr_base_ivfc_offset(bktr_base_ivfc_offset_) {
     if (file == nullptr) {
         status = Loader::ResultStatus::ErrorNullFile;
+        sections_realized = true;
         return;
     }
 
-    if (sizeof(NCAHeader) != file->ReadObject(&header)) {
-        LOG_ERROR(Loader, "File reader errored out during header read.");
-        status = Loader::ResultStatus::ErrorBadNCAHeader;
-        return;
+    const std::string cache_key = fmt::format("{}:{:X}", file->GetFullPath(), file->GetSize());
+    bool cached = false;
+    {
+        std::lock_guard lock{nca_header_cache_mutex};
+        const auto it = nca_header_cache.find(cache_key);
+        if (it != nca_header_cache.end()) {
+            header = it->second.header;
+            section_headers = it->second.sections;
+            encrypted = it->second.encrypted;
+            cached = true;
+        }
     }
 
-    if (!HandlePotentialHeaderDecryption()) {
-        return;
+    if (!cached) {
+        if (sizeof(NCAHeader) != file->ReadObject(&header)) {
+            LOG_ERROR(Loader, "File reader errored out during header read.");
+            status = Loader::ResultStatus::ErrorBadNCAHeader;
+            sections_realized = true;
+            return;
+        }
+
+        if (!HandlePotentialHeaderDecryption()) {
+            sections_realized = true;
+            return;
+        }
+
+        section_headers = ReadSectionHeaders();
+
+        std::lock_guard lock{nca_header_cache_mutex};
+        nca_header_cache.emplace(cache_key, ParsedNCAHeader{header, section_headers, encrypted});
     }
 
     has_rights_id = std::any_of(header.rights_id.begin(), header.rights_id.end(),
                                 [](char c) { return c != '\0'; });
 
-    const std::vector<NCASectionHeader> sections = ReadSectionHeaders();
-    is_update = std::any_of(sections.begin(), sections.end(), [](const NCASectionHeader& header) {
-        return header.raw.header.crypto_type == NCASectionCryptoType::BKTR;
-    });
-
-    if (!ReadSections(sections, bktr_base_ivfc_offset)) {
-        return;
-    }
+    is_update = std::any_of(section_headers.begin(), section_headers.end(),
+                            [](const NCASectionHeader& section) {
+                                return section.raw.header.crypto_type == NCASectionCryptoType::BKTR;
+                            });
 
+    // The section filesystems and their decryption layers are built on first access; see
+    // EnsureSections. Section-level failures replace this status when they are realized.
     status = Loader::ResultStatus::Success;
 }
 
 NCA::~NCA() = default;
 
+void NCA::EnsureSections() const {
+    if (sections_realized) {
+        return;
+    }
+    sections_realized = true;
+
+    // Realization mutates the section state behind the const VFS accessors; beyond the deferred
+    // work, the lazy split is not observable to callers.
+    auto* const self = const_cast<NCA*>(this);
+    if (!self->ReadSections(section_headers, bktr_base_ivfc_offset)) {
+        self->section_headers.clear();
+        return;
+    }
+    self->section_headers.clear();
+    self->status = Loader::ResultStatus::Success;
+}
+
 bool NCA::CheckSupportedNCA(const NCAHeader& nca_header) {
     if (nca_header.magic == Common::MakeMagic('N', 'C', 'A', '2')) {
         status = Loader::ResultStatus::ErrorNCA2;
@@ -511,16 +567,19 @@ VirtualFile NCA::Decrypt(const NCASectionHeader& s_header, VirtualFile in, u64 s
 }
 
 Loader::ResultStatus NCA::GetStatus() const {
+    EnsureSections();
     return status;
 }
 
 std::vector<std::shared_ptr<VfsFile>> NCA::GetFiles() const {
+    EnsureSections();
     if (status != Loader::ResultStatus::Success)
         return {};
     return files;
 }
 
 std::vector<std::shared_ptr<VfsDirectory>> NCA::GetSubdirectories() const {
+    EnsureSections();
     if (status != Loader::ResultStatus::Success)
         return {};
     return dirs;
@@ -557,10 +616,12 @@ bool NCA::IsUpdate() const {
 }
 
 VirtualFile NCA::GetRomFS() const {
+    EnsureSections();
     return romfs;
 }
 
 VirtualDir NCA::GetExeFS() const {
+    EnsureSections();
     return exefs;
 }
 
@@ -569,10 +630,12 @@ VirtualFile NCA::GetBaseFile() const {
 }
 
 u64 NCA::GetBaseIVFCOffset() const {
+    EnsureSections();
     return ivfc_offset;
 }
 
 VirtualDir NCA::GetLogoPartition() const {
+    EnsureSections();
     return logo;
 }
 
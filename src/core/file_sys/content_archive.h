@@ -96,12 +96,20 @@ inline bool IsDirectoryLogoPartition(const VirtualDir& pfs) {
 
 // An implementation of VfsDirectory that represents a Nintendo Content Archive (NCA) conatiner.
 // After construction, use GetStatus to determine if the file is valid and ready to be used.
+//
+// Construction only parses the header and section tables (served from a process-wide cache for
+// files that have been opened before); the section filesystems and their decryption layers are
+// realized lazily on first access. The header probes (GetType, GetTitleId, GetRightsId,
+// GetSDKVersion, IsUpdate) never pay for section realization, which matters for callers like the
+// game list that probe hundreds of files.
 class NCA : public ReadOnlyVfsDirectory {
 public:
     explicit NCA(VirtualFile file, VirtualFile bktr_base_romfs = nullptr,
                  u64 bktr_base_ivfc_offset = 0);
     ~NCA() override;
 
+    /// Returns the archive status. Realizes the sections, as section-level failures (missing
+    /// keys, bad BKTR data) are part of the reported status.
     Loader::ResultStatus GetStatus() const;
 
     std::vector<std::shared_ptr<VfsFile>> GetFiles() const override;
@@ -129,6 +137,9 @@ private:
     bool CheckSupportedNCA(const NCAHeader& header);
     bool HandlePotentialHeaderDecryption();
 
+    /// Builds the section filesystems and decryption layers on first use.
+    void EnsureSections() const;
+
     std::vector<NCASectionHeader> ReadSectionHeaders() const;
     bool ReadSections(const std::vector<NCASectionHeader>& sections, u64 bktr_base_ivfc_offset);
     bool ReadRomFSSection(const NCASectionHeader& section, const NCASectionTableEntry& entry,
@@ -148,11 +159,17 @@ private:
     VirtualDir logo = nullptr;
     VirtualFile file;
     VirtualFile bktr_base_romfs;
+    u64 bktr_base_ivfc_offset = 0;
     u64 ivfc_offset = 0;
 
     NCAHeader header{};
     bool has_rights_id{};
 
+    /// Parsed section tables, kept until the sections are realized.
+    std::vector<NCASectionHeader> section_headers;
+    /// Whether the section filesystems have been built yet.
+    mutable bool sections_realized = false;
+
     Loader::ResultStatus status{};
 
     bool encrypted = false;
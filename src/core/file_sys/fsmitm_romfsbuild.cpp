@@ -23,7 +23,9 @@
  */
 
 #include <cstring>
+#include <map>
 #include <string_view>
+#include <utility>
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "core/file_sys/fsmitm_romfsbuild.h"
@@ -126,69 +128,79 @@ static u64 romfs_get_hash_table_count(u64 num_entries) {
     return count;
 }
 
-void RomFSBuildContext::VisitDirectory(VirtualDir root_romfs, VirtualDir ext,
+void RomFSBuildContext::VisitDirectory(VirtualDir dir, VirtualDir ext_dir,
                                        std::shared_ptr<RomFSBuildDirectoryContext> parent) {
-    std::vector<std::shared_ptr<RomFSBuildDirectoryContext>> child_dirs;
-
-    VirtualDir dir;
-
-    if (parent->path_len == 0)
-        dir = root_romfs;
-    else
-        dir = root_romfs->GetDirectoryRelative(parent->path);
+    std::vector<std::pair<std::shared_ptr<RomFSBuildDirectoryContext>, VirtualDir>> child_dirs;
+
+    // Materialize the extension directory's file list once; per-name lookups would re-merge the
+    // layer stack for every .stub/.ips probe.
+    std::map<std::string, VirtualFile, std::less<>> ext_files;
+    if (ext_dir != nullptr) {
+        for (auto& file : ext_dir->GetFiles()) {
+            auto name = file->GetName();
+            ext_files.emplace(std::move(name), std::move(file));
+        }
+    }
 
-    const auto entries = dir->GetEntries();
+    const auto get_ext_file = [&ext_files](const std::string& name) -> VirtualFile {
+        const auto it = ext_files.find(name);
+        return it == ext_files.end() ? nullptr : it->second;
+    };
 
-    for (const auto& kv : entries) {
-        if (kv.second == VfsEntryType::Directory) {
-            const auto child = std::make_shared<RomFSBuildDirectoryContext>();
-            // Set child's path.
-            child->cur_path_ofs = parent->path_len + 1;
-            child->path_len = child->cur_path_ofs + static_cast<u32>(kv.first.size());
-            child->path = parent->path + "/" + kv.first;
+    for (auto& sub : dir->GetSubdirectories()) {
+        const auto name = sub->GetName();
+        const auto child = std::make_shared<RomFSBuildDirectoryContext>();
+        // Set child's path.
+        child->cur_path_ofs = parent->path_len + 1;
+        child->path_len = child->cur_path_ofs + static_cast<u32>(name.size());
+        child->path = parent->path + "/" + name;
 
-            if (ext != nullptr && ext->GetFileRelative(child->path + ".stub") != nullptr)
-                continue;
+        if (get_ext_file(name + ".stub") != nullptr)
+            continue;
 
-            // Sanity check on path_len
-            ASSERT(child->path_len < FS_MAX_PATH);
+        // Sanity check on path_len
+        ASSERT(child->path_len < FS_MAX_PATH);
 
-            if (AddDirectory(parent, child)) {
-                child_dirs.push_back(child);
-            }
-        } else {
-            const auto child = std::make_shared<RomFSBuildFileContext>();
-            // Set child's path.
-            child->cur_path_ofs = parent->path_len + 1;
-            child->path_len = child->cur_path_ofs + static_cast<u32>(kv.first.size());
-            child->path = parent->path + "/" + kv.first;
+        if (AddDirectory(parent, child)) {
+            child_dirs.emplace_back(child, std::move(sub));
+        }
+    }
 
-            if (ext != nullptr && ext->GetFileRelative(child->path + ".stub") != nullptr)
-                continue;
+    for (auto& file : dir->GetFiles()) {
+        const auto name = file->GetName();
+        const auto child = std::make_shared<RomFSBuildFileContext>();
+        // Set child's path.
+        child->cur_path_ofs = parent->path_len + 1;
+        child->path_len = child->cur_path_ofs + static_cast<u32>(name.size());
+        child->path = parent->path + "/" + name;
 
-            // Sanity check on path_len
-            ASSERT(child->path_len < FS_MAX_PATH);
+        if (get_ext_file(name + ".stub") != nullptr)
+            continue;
 
-            child->source = root_romfs->GetFileRelative(child->path);
+        // Sanity check on path_len
+        ASSERT(child->path_len < FS_MAX_PATH);
 
-            if (ext != nullptr) {
-                const auto ips = ext->GetFileRelative(child->path + ".ips");
+        child->source = std::move(file);
 
-                if (ips != nullptr) {
-                    auto patched = PatchIPS(child->source, ips);
-                    if (patched != nullptr)
-                        child->source = std::move(patched);
-                }
-            }
+        const auto ips = get_ext_file(name + ".ips");
+        if (ips != nullptr) {
+            auto patched = PatchIPS(child->source, ips);
+            if (patched != nullptr)
+                child->source = std::move(patched);
+        }
 
-            child->size = child->source->GetSize();
+        child->size = child->source->GetSize();
 
-            AddFile(parent, child);
-        }
+        AddFile(parent, child);
     }
 
-    for (auto& child : child_dirs) {
-        this->VisitDirectory(root_romfs, ext, child);
+    for (auto& [child, child_dir] : child_dirs) {
+        VirtualDir child_ext;
+        if (ext_dir != nullptr) {
+            child_ext =
+                ext_dir->GetSubdirectory(child->path.substr(child->cur_path_ofs));
+        }
+        this->VisitDirectory(std::move(child_dir), std::move(child_ext), child);
     }
 }
 
@@ -59,7 +59,10 @@ private:
     u64 file_hash_table_size = 0;
     u64 file_partition_size = 0;
 
-    void VisitDirectory(VirtualDir filesys, VirtualDir ext,
+    // Adds dir's entries to the context, where dir is the directory parent refers to and ext_dir
+    // is the matching subdirectory of the extension tree (may be nullptr). Both are resolved by
+    // the caller so the layer stack is only walked once per directory.
+    void VisitDirectory(VirtualDir dir, VirtualDir ext_dir,
                         std::shared_ptr<RomFSBuildDirectoryContext> parent);
 
     bool AddDirectory(std::shared_ptr<RomFSBuildDirectoryContext> parent_dir_ctx,
@@ -13,7 +13,6 @@
 #include "common/logging/log.h"
 #include "common/swap.h"
 #include "core/file_sys/ips_layer.h"
-#include "core/file_sys/vfs_vector.h"
 
 namespace FileSys {
 
@@ -65,6 +64,118 @@ static bool IsEOF(IPSFileType type, const std::vector<u8>& data) {
     return type == IPSFileType::IPS32 && std::equal(data.begin(), data.end(), eeof.begin());
 }
 
+namespace {
+
+// An implementation of VfsFile that overlays patch records on top of another file and applies
+// them on the read path, only for the ranges a read actually touches. This avoids copying whole
+// NSOs into memory at patch time just to overwrite a handful of bytes.
+class PatchedVfsFile : public VfsFile {
+public:
+    explicit PatchedVfsFile(VirtualFile base_) : base(std::move(base_)) {}
+    ~PatchedVfsFile() override = default;
+
+    /// Overlays data at offset; where records overlap, the record added last wins
+    void AddRecord(u64 offset, std::vector<u8> data) {
+        if (data.empty()) {
+            return;
+        }
+        const u64 end = offset + data.size();
+
+        // Trim or split an existing record overlapping the start of the new one
+        const auto after = overlay.lower_bound(offset);
+        if (after != overlay.begin()) {
+            const auto prev = std::prev(after);
+            const u64 prev_end = prev->first + prev->second.size();
+            if (prev_end > offset) {
+                if (prev_end > end) {
+                    std::vector<u8> tail(prev->second.begin() +
+                                             static_cast<std::ptrdiff_t>(end - prev->first),
+                                         prev->second.end());
+                    overlay.emplace(end, std::move(tail));
+                }
+                prev->second.resize(offset - prev->first);
+            }
+        }
+
+        // Drop or trim existing records the new one covers
+        auto it = overlay.lower_bound(offset);
+        while (it != overlay.end() && it->first < end) {
+            if (it->first + it->second.size() <= end) {
+                it = overlay.erase(it);
+            } else {
+                std::vector<u8> tail(it->second.begin() +
+                                         static_cast<std::ptrdiff_t>(end - it->first),
+                                     it->second.end());
+                overlay.erase(it);
+                overlay.emplace(end, std::move(tail));
+                break;
+            }
+        }
+
+        overlay.emplace(offset, std::move(data));
+    }
+
+    std::string GetName() const override {
+        return base->GetName();
+    }
+
+    std::size_t GetSize() const override {
+        return base->GetSize();
+    }
+
+    bool Resize(std::size_t new_size) override {
+        return false;
+    }
+
+    std::shared_ptr<VfsDirectory> GetContainingDirectory() const override {
+        return base->GetContainingDirectory();
+    }
+
+    bool IsWritable() const override {
+        return false;
+    }
+
+    bool IsReadable() const override {
+        return true;
+    }
+
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override {
+        const auto read = base->Read(data, length, offset);
+        const u64 read_end = offset + read;
+
+        auto it = overlay.upper_bound(offset);
+        if (it != overlay.begin()) {
+            --it;
+        }
+        for (; it != overlay.end() && it->first < read_end; ++it) {
+            const u64 record_start = it->first;
+            const u64 record_end = record_start + it->second.size();
+            const u64 copy_start = std::max<u64>(record_start, offset);
+            const u64 copy_end = std::min(record_end, read_end);
+            if (copy_start >= copy_end) {
+                continue;
+            }
+            std::memcpy(data + (copy_start - offset),
+                        it->second.data() + (copy_start - record_start), copy_end - copy_start);
+        }
+        return read;
+    }
+
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override {
+        return 0;
+    }
+
+    bool Rename(std::string_view name) override {
+        return base->Rename(name);
+    }
+
+private:
+    VirtualFile base;
+    std::map<u64, std::vector<u8>> overlay; ///< Sorted and non-overlapping after AddRecord
+};
+
+} // Anonymous namespace
+
 VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips) {
     if (in == nullptr || ips == nullptr)
         return nullptr;
@@ -73,7 +184,8 @@ VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips) {
     if (type == IPSFileType::Error)
         return nullptr;
 
-    auto in_data = in->ReadAllBytes();
+    const auto in_size = in->GetSize();
+    auto patched = std::make_shared<PatchedVfsFile>(in);
 
     std::vector<u8> temp(type == IPSFileType::IPS ? 3 : 4);
     u64 offset = 5; // After header
@@ -106,16 +218,17 @@ VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips) {
             if (!data)
                 return nullptr;
 
-            if (real_offset + rle_size > in_data.size())
-                rle_size = static_cast<u16>(in_data.size() - real_offset);
-            std::memset(in_data.data() + real_offset, *data, rle_size);
+            if (real_offset + rle_size > in_size)
+                rle_size = static_cast<u16>(in_size - real_offset);
+            patched->AddRecord(real_offset, std::vector<u8>(rle_size, *data));
         } else { // Standard Patch
-            auto read = data_size;
-            if (real_offset + read > in_data.size())
-                read = static_cast<u16>(in_data.size() - real_offset);
-            if (ips->Read(in_data.data() + real_offset, read, offset) != data_size)
+            if (real_offset + data_size > in_size)
+                return nullptr;
+            std::vector<u8> record(data_size);
+            if (ips->Read(record.data(), data_size, offset) != data_size)
                 return nullptr;
             offset += data_size;
+            patched->AddRecord(real_offset, std::move(record));
         }
     }
 
@@ -123,8 +236,7 @@ VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips) {
         return nullptr;
     }
 
-    return std::make_shared<VectorVfsFile>(std::move(in_data), in->GetName(),
-                                           in->GetContainingDirectory());
+    return patched;
 }
 
 struct IPSwitchCompiler::IPSwitchPatch {
@@ -313,25 +425,27 @@ VirtualFile IPSwitchCompiler::Apply(const VirtualFile& in) const {
     if (in == nullptr || !valid)
         return nullptr;
 
-    auto in_data = in->ReadAllBytes();
+    const auto in_size = in->GetSize();
+    auto patched = std::make_shared<PatchedVfsFile>(in);
 
     for (const auto& patch : patches) {
         if (!patch.enabled)
             continue;
 
         for (const auto& record : patch.records) {
-            if (record.first >= in_data.size())
+            if (record.first >= in_size)
                 continue;
             auto replace_size = record.second.size();
-            if (record.first + replace_size > in_data.size())
-                replace_size = in_data.size() - record.first;
-            for (std::size_t i = 0; i < replace_size; ++i)
-                in_data[i + record.first] = record.second[i];
+            if (record.first + replace_size > in_size)
+                replace_size = in_size - record.first;
+            patched->AddRecord(record.first, std::vector<u8>(record.second.begin(),
+                                                             record.second.begin() +
+                                                                 static_cast<std::ptrdiff_t>(
+                                                                     replace_size)));
         }
     }
 
-    return std::make_shared<VectorVfsFile>(std::move(in_data), in->GetName(),
-                                           in->GetContainingDirectory());
+    return patched;
 }
 
 } // namespace FileSys
@@ -5,34 +5,68 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <limits>
 
 #include "common/assert.h"
 #include "core/crypto/aes_util.h"
 #include "core/file_sys/nca_patch.h"
 
 namespace FileSys {
+namespace {
+
+/**
+ * Finds the index of the entry covering offset in a flattened, patch-address-sorted entry array.
+ * The sequential hint is probed first: a hit on the cached interval or the one following it
+ * skips the binary search entirely.
+ */
+template <typename Entry>
+std::size_t FindEntryIndex(const std::vector<Entry>& entries, std::atomic<std::size_t>& hint,
+                           u64 offset) {
+    const std::size_t cached = hint.load(std::memory_order_relaxed);
+    if (cached + 1 < entries.size() && entries[cached].address_patch <= offset) {
+        if (offset < entries[cached + 1].address_patch) {
+            return cached;
+        }
+        if (cached + 2 < entries.size() && offset < entries[cached + 2].address_patch) {
+            hint.store(cached + 1, std::memory_order_relaxed);
+            return cached + 1;
+        }
+    }
+
+    const auto it =
+        std::upper_bound(entries.begin(), entries.end(), offset,
+                         [](u64 off, const Entry& entry) { return off < entry.address_patch; });
+    const std::size_t index =
+        it == entries.begin()
+            ? 0
+            : static_cast<std::size_t>(std::distance(entries.begin(), it)) - 1;
+    hint.store(index, std::memory_order_relaxed);
+    return index;
+}
+
+} // Anonymous namespace
 
 BKTR::BKTR(VirtualFile base_romfs_, VirtualFile bktr_romfs_, RelocationBlock relocation_,
            std::vector<RelocationBucket> relocation_buckets_, SubsectionBlock subsection_,
            std::vector<SubsectionBucket> subsection_buckets_, bool is_encrypted_,
            Core::Crypto::Key128 key_, u64 base_offset_, u64 ivfc_offset_,
            std::array<u8, 8> section_ctr_)
-    : relocation(relocation_), relocation_buckets(std::move(relocation_buckets_)),
-      subsection(subsection_), subsection_buckets(std::move(subsection_buckets_)),
-      base_romfs(std::move(base_romfs_)), bktr_romfs(std::move(bktr_romfs_)),
-      encrypted(is_encrypted_), key(key_), base_offset(base_offset_), ivfc_offset(ivfc_offset_),
-      section_ctr(section_ctr_) {
-    for (std::size_t i = 0; i < relocation.number_buckets - 1; ++i) {
-        relocation_buckets[i].entries.push_back({relocation.base_offsets[i + 1], 0, 0});
+    : relocation(relocation_), subsection(subsection_), base_romfs(std::move(base_romfs_)),
+      bktr_romfs(std::move(bktr_romfs_)), encrypted(is_encrypted_), key(key_),
+      base_offset(base_offset_), ivfc_offset(ivfc_offset_), section_ctr(section_ctr_) {
+    // Flatten the buckets into single sorted arrays up front; buckets are ordered by base offset
+    // and entries are ordered within each bucket, so concatenation preserves the sort.
+    for (std::size_t i = 0; i < relocation.number_buckets; ++i) {
+        const auto& entries = relocation_buckets_[i].entries;
+        flat_relocations.insert(flat_relocations.end(), entries.begin(), entries.end());
     }
+    flat_relocations.push_back({relocation.size, 0, 0});
 
-    for (std::size_t i = 0; i < subsection.number_buckets - 1; ++i) {
-        subsection_buckets[i].entries.push_back({subsection_buckets[i + 1].entries[0].address_patch,
-                                                 {0},
-                                                 subsection_buckets[i + 1].entries[0].ctr});
+    for (std::size_t i = 0; i < subsection.number_buckets; ++i) {
+        const auto& entries = subsection_buckets_[i].entries;
+        flat_subsections.insert(flat_subsections.end(), entries.begin(), entries.end());
     }
-
-    relocation_buckets.back().entries.push_back({relocation.size, 0, 0});
+    flat_subsections.push_back({std::numeric_limits<u64>::max(), {0}, 0});
 }
 
 BKTR::~BKTR() = default;
@@ -109,70 +143,24 @@ std::size_t BKTR::Read(u8* data, std::size_t length, std::size_t offset) const {
     return raw_read;
 }
 
-template <bool Subsection, typename BlockType, typename BucketType>
-std::pair<std::size_t, std::size_t> BKTR::SearchBucketEntry(u64 offset, BlockType block,
-                                                            BucketType buckets) const {
-    if constexpr (Subsection) {
-        const auto last_bucket = buckets[block.number_buckets - 1];
-        if (offset >= last_bucket.entries[last_bucket.number_entries].address_patch)
-            return {block.number_buckets - 1, last_bucket.number_entries};
-    } else {
-        ASSERT_MSG(offset <= block.size, "Offset is out of bounds in BKTR relocation block.");
-    }
-
-    std::size_t bucket_id = std::count_if(
-        block.base_offsets.begin() + 1, block.base_offsets.begin() + block.number_buckets,
-        [&offset](u64 base_offset) { return base_offset <= offset; });
-
-    const auto bucket = buckets[bucket_id];
-
-    if (bucket.number_entries == 1)
-        return {bucket_id, 0};
-
-    std::size_t low = 0;
-    std::size_t mid = 0;
-    std::size_t high = bucket.number_entries - 1;
-    while (low <= high) {
-        mid = (low + high) / 2;
-        if (bucket.entries[mid].address_patch > offset) {
-            high = mid - 1;
-        } else {
-            if (mid == bucket.number_entries - 1 ||
-                bucket.entries[mid + 1].address_patch > offset) {
-                return {bucket_id, mid};
-            }
-
-            low = mid + 1;
-        }
-    }
-
-    UNREACHABLE_MSG("Offset could not be found in BKTR block.");
-}
-
 RelocationEntry BKTR::GetRelocationEntry(u64 offset) const {
-    const auto res = SearchBucketEntry<false>(offset, relocation, relocation_buckets);
-    return relocation_buckets[res.first].entries[res.second];
+    ASSERT_MSG(offset <= relocation.size, "Offset is out of bounds in BKTR relocation block.");
+    return flat_relocations[FindEntryIndex(flat_relocations, relocation_hint, offset)];
 }
 
 RelocationEntry BKTR::GetNextRelocationEntry(u64 offset) const {
-    const auto res = SearchBucketEntry<false>(offset, relocation, relocation_buckets);
-    const auto bucket = relocation_buckets[res.first];
-    if (res.second + 1 < bucket.entries.size())
-        return bucket.entries[res.second + 1];
-    return relocation_buckets[res.first + 1].entries[0];
+    ASSERT_MSG(offset < relocation.size, "Offset is out of bounds in BKTR relocation block.");
+    // The end sentinel guarantees a following entry for every in-bounds offset
+    return flat_relocations[FindEntryIndex(flat_relocations, relocation_hint, offset) + 1];
 }
 
 SubsectionEntry BKTR::GetSubsectionEntry(u64 offset) const {
-    const auto res = SearchBucketEntry<true>(offset, subsection, subsection_buckets);
-    return subsection_buckets[res.first].entries[res.second];
+    return flat_subsections[FindEntryIndex(flat_subsections, subsection_hint, offset)];
 }
 
 SubsectionEntry BKTR::GetNextSubsectionEntry(u64 offset) const {
-    const auto res = SearchBucketEntry<true>(offset, subsection, subsection_buckets);
-    const auto bucket = subsection_buckets[res.first];
-    if (res.second + 1 < bucket.entries.size())
-        return bucket.entries[res.second + 1];
-    return subsection_buckets[res.first + 1].entries[0];
+    const std::size_t index = FindEntryIndex(flat_subsections, subsection_hint, offset);
+    return flat_subsections[std::min(index + 1, flat_subsections.size() - 1)];
 }
 
 std::string BKTR::GetName() const {
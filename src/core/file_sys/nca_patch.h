@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -117,10 +118,6 @@ public:
     bool Rename(std::string_view name) override;
 
 private:
-    template <bool Subsection, typename BlockType, typename BucketType>
-    std::pair<std::size_t, std::size_t> SearchBucketEntry(u64 offset, BlockType block,
-                                                          BucketType buckets) const;
-
     RelocationEntry GetRelocationEntry(u64 offset) const;
     RelocationEntry GetNextRelocationEntry(u64 offset) const;
 
@@ -128,9 +125,18 @@ private:
     SubsectionEntry GetNextSubsectionEntry(u64 offset) const;
 
     RelocationBlock relocation;
-    std::vector<RelocationBucket> relocation_buckets;
     SubsectionBlock subsection;
-    std::vector<SubsectionBucket> subsection_buckets;
+
+    /// Relocation and subsection entries flattened out of their buckets at construction, sorted
+    /// by patch address and terminated by a sentinel, so reads do one binary search over a
+    /// contiguous array instead of nested bucket scans.
+    std::vector<RelocationEntry> flat_relocations;
+    std::vector<SubsectionEntry> flat_subsections;
+
+    /// Index of the last relocation/subsection hit. RomFS access is overwhelmingly sequential,
+    /// so the next lookup usually lands in the same or the following interval.
+    mutable std::atomic<std::size_t> relocation_hint{0};
+    mutable std::atomic<std::size_t> subsection_hint{0};
 
     // Should be the raw base romfs, decrypted.
     VirtualFile base_romfs;
@@ -58,6 +58,8 @@ PartitionFilesystem::PartitionFilesystem(std::shared_ptr<VfsFile> file) {
     std::size_t entries_offset = sizeof(Header);
     std::size_t strtab_offset = entries_offset + (pfs_header.num_entries * entry_size);
     content_offset = strtab_offset + pfs_header.strtab_size;
+    pfs_file = std::move(file);
+    entries.reserve(pfs_header.num_entries);
     for (u16 i = 0; i < pfs_header.num_entries; i++) {
         FSEntry entry;
 
@@ -65,11 +67,9 @@ PartitionFilesystem::PartitionFilesystem(std::shared_ptr<VfsFile> file) {
         std::string name(
             reinterpret_cast<const char*>(&file_data[strtab_offset + entry.strtab_offset]));
 
-        offsets.insert_or_assign(name, content_offset + entry.offset);
-        sizes.insert_or_assign(name, entry.size);
-
-        pfs_files.emplace_back(std::make_shared<OffsetVfsFile>(
-            file, entry.size, content_offset + entry.offset, std::move(name)));
+        // Child handles are created lazily in OpenEntry; enumerating hundreds of archives
+        // should not allocate a VfsFile per contained file up front.
+        entries.push_back({std::move(name), content_offset + entry.offset, entry.size});
     }
 
     status = Loader::ResultStatus::Success;
@@ -82,15 +82,44 @@ Loader::ResultStatus PartitionFilesystem::GetStatus() const {
 }
 
 std::map<std::string, u64> PartitionFilesystem::GetFileOffsets() const {
-    return offsets;
+    std::map<std::string, u64> out;
+    for (const auto& entry : entries)
+        out.insert_or_assign(entry.name, entry.offset);
+    return out;
 }
 
 std::map<std::string, u64> PartitionFilesystem::GetFileSizes() const {
-    return sizes;
+    std::map<std::string, u64> out;
+    for (const auto& entry : entries)
+        out.insert_or_assign(entry.name, entry.size);
+    return out;
+}
+
+VirtualFile PartitionFilesystem::OpenEntry(const PartitionEntry& entry) const {
+    const auto it = opened_files.find(entry.name);
+    if (it != opened_files.end())
+        return it->second;
+
+    auto child = std::make_shared<OffsetVfsFile>(pfs_file, entry.size, entry.offset, entry.name);
+    opened_files.emplace(entry.name, child);
+    return child;
 }
 
 std::vector<std::shared_ptr<VfsFile>> PartitionFilesystem::GetFiles() const {
-    return pfs_files;
+    std::vector<std::shared_ptr<VfsFile>> out;
+    out.reserve(entries.size());
+    for (const auto& entry : entries)
+        out.push_back(OpenEntry(entry));
+    return out;
+}
+
+std::shared_ptr<VfsFile> PartitionFilesystem::GetFile(std::string_view name) const {
+    const auto it =
+        std::find_if(entries.begin(), entries.end(),
+                     [name](const PartitionEntry& entry) { return entry.name == name; });
+    if (it == entries.end())
+        return nullptr;
+    return OpenEntry(*it);
 }
 
 std::vector<std::shared_ptr<VfsDirectory>> PartitionFilesystem::GetSubdirectories() const {
@@ -110,8 +139,8 @@ void PartitionFilesystem::PrintDebugInfo() const {
     LOG_DEBUG(Service_FS, "Magic:                  {:.4}", pfs_header.magic);
     LOG_DEBUG(Service_FS, "Files:                  {}", pfs_header.num_entries);
     for (u32 i = 0; i < pfs_header.num_entries; i++) {
-        LOG_DEBUG(Service_FS, " > File {}:              {} (0x{:X} bytes)", i,
-                  pfs_files[i]->GetName(), pfs_files[i]->GetSize());
+        LOG_DEBUG(Service_FS, " > File {}:              {} (0x{:X} bytes)", i, entries[i].name,
+                  entries[i].size);
     }
 }
 } // namespace FileSys
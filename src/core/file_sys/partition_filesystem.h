@@ -5,7 +5,9 @@
 #pragma once
 
 #include <array>
+#include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "common/common_funcs.h"
 #include "common/common_types.h"
@@ -33,6 +35,7 @@ public:
     std::map<std::string, u64> GetFileSizes() const;
 
     std::vector<std::shared_ptr<VfsFile>> GetFiles() const override;
+    std::shared_ptr<VfsFile> GetFile(std::string_view name) const override;
     std::vector<std::shared_ptr<VfsDirectory>> GetSubdirectories() const override;
     std::string GetName() const override;
     std::shared_ptr<VfsDirectory> GetParentDirectory() const override;
@@ -77,16 +80,25 @@ private:
 
 #pragma pack(pop)
 
+    /// A parsed entry of the PFS/HFS entry table
+    struct PartitionEntry {
+        std::string name;
+        u64 offset;
+        u64 size;
+    };
+
+    /// Returns the child handle for entry, creating and caching it on first use
+    VirtualFile OpenEntry(const PartitionEntry& entry) const;
+
     Loader::ResultStatus status{};
 
     Header pfs_header{};
     bool is_hfs = false;
     std::size_t content_offset = 0;
 
-    std::map<std::string, u64> offsets;
-    std::map<std::string, u64> sizes;
-
-    std::vector<VirtualFile> pfs_files;
+    VirtualFile pfs_file;
+    std::vector<PartitionEntry> entries;
+    mutable std::map<std::string, VirtualFile, std::less<>> opened_files;
 };
 
 } // namespace FileSys
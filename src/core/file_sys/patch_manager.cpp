@@ -6,6 +6,8 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <mutex>
+#include <unordered_map>
 
 #include "common/file_util.h"
 #include "common/hex_util.h"
@@ -18,6 +20,7 @@
 #include "core/file_sys/patch_manager.h"
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/romfs.h"
+#include "core/file_sys/vfs_cached.h"
 #include "core/file_sys/vfs_layered.h"
 #include "core/file_sys/vfs_vector.h"
 #include "core/hle/service/filesystem/filesystem.h"
@@ -66,6 +69,169 @@ std::shared_ptr<VfsDirectory> FindSubdirectoryCaseless(const std::shared_ptr<Vfs
 #endif
 }
 
+namespace {
+
+void AppendCommaIfNotEmpty(std::string& to, const std::string& with) {
+    if (to.empty())
+        to += with;
+    else
+        to += ", " + with;
+}
+
+bool IsDirValidAndNonEmpty(const VirtualDir& dir) {
+    return dir != nullptr && (!dir->GetFiles().empty() || !dir->GetSubdirectories().empty());
+}
+
+/// One mod subdirectory of a title's load directory, with its content roots probed once.
+struct ModEntry {
+    VirtualDir dir;
+    VirtualDir exefs;
+    VirtualDir romfs;
+    VirtualDir romfs_ext;
+    VirtualDir cheats;
+    std::string types; ///< Human-readable list of patch types for the add-ons list
+};
+
+/// Cached discovery of a title's mod directory, shared between boot and game list scans.
+struct ModDiscovery {
+    std::string load_root_path;
+    u64 token = 0;
+    std::vector<ModEntry> mods;
+};
+
+std::mutex mod_discovery_mutex;
+std::unordered_map<u64, std::shared_ptr<const ModDiscovery>> mod_discovery_cache;
+
+std::string BuildModTypesList(const ModEntry& mod) {
+    std::string types;
+    if (IsDirValidAndNonEmpty(mod.exefs)) {
+        bool ips = false;
+        bool ipswitch = false;
+        bool layeredfs = false;
+
+        for (const auto& file : mod.exefs->GetFiles()) {
+            if (file->GetExtension() == "ips") {
+                ips = true;
+            } else if (file->GetExtension() == "pchtxt") {
+                ipswitch = true;
+            } else if (std::find(EXEFS_FILE_NAMES.begin(), EXEFS_FILE_NAMES.end(),
+                                 file->GetName()) != EXEFS_FILE_NAMES.end()) {
+                layeredfs = true;
+            }
+        }
+
+        if (ips)
+            AppendCommaIfNotEmpty(types, "IPS");
+        if (ipswitch)
+            AppendCommaIfNotEmpty(types, "IPSwitch");
+        if (layeredfs)
+            AppendCommaIfNotEmpty(types, "LayeredExeFS");
+    }
+    if (IsDirValidAndNonEmpty(mod.romfs))
+        AppendCommaIfNotEmpty(types, "LayeredFS");
+    if (IsDirValidAndNonEmpty(mod.cheats))
+        AppendCommaIfNotEmpty(types, "Cheats");
+    return types;
+}
+
+/**
+ * Combines the modification times of the load root and of every mod directory in it. The root's
+ * timestamp changes when mods are added or removed and a mod's timestamp when its content roots
+ * do, so a matching token means the cached discovery is still valid. Edits deeper inside a mod
+ * keep the cached handles correct because the real VFS enumerates lazily.
+ */
+u64 GetModDirectoriesToken(const std::string& root_path, const std::vector<VirtualDir>& dirs) {
+    u64 token = FileUtil::GetModificationTime(root_path);
+    for (const auto& dir : dirs) {
+        token = token * 31 + FileUtil::GetModificationTime(dir->GetFullPath());
+    }
+    return token;
+}
+
+/**
+ * Returns the mod directory discovery for a title, reusing the cached result when the directory
+ * timestamps have not changed. The game list queries every title on each refresh and probing mod
+ * directories is expensive on network shares, so only the root listing and one stat per mod are
+ * paid per query.
+ */
+std::shared_ptr<const ModDiscovery> DiscoverMods(u64 title_id) {
+    const auto load_dir =
+        Core::System::GetInstance().GetFileSystemController().GetModificationLoadRoot(title_id);
+    if (load_dir == nullptr) {
+        return nullptr;
+    }
+
+    auto patch_dirs = load_dir->GetSubdirectories();
+    std::sort(patch_dirs.begin(), patch_dirs.end(),
+              [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
+
+    const auto path = load_dir->GetFullPath();
+    const u64 token = GetModDirectoriesToken(path, patch_dirs);
+
+    std::lock_guard lock{mod_discovery_mutex};
+    auto& slot = mod_discovery_cache[title_id];
+    if (slot != nullptr && slot->load_root_path == path && slot->token == token) {
+        return slot;
+    }
+
+    auto discovery = std::make_shared<ModDiscovery>();
+    discovery->load_root_path = path;
+    discovery->token = token;
+    discovery->mods.reserve(patch_dirs.size());
+    for (auto& subdir : patch_dirs) {
+        ModEntry mod;
+        mod.exefs = FindSubdirectoryCaseless(subdir, "exefs");
+        mod.romfs = FindSubdirectoryCaseless(subdir, "romfs");
+        mod.romfs_ext = FindSubdirectoryCaseless(subdir, "romfs_ext");
+        mod.cheats = FindSubdirectoryCaseless(subdir, "cheats");
+        mod.types = BuildModTypesList(mod);
+        mod.dir = std::move(subdir);
+        discovery->mods.push_back(std::move(mod));
+    }
+    slot = std::move(discovery);
+    return slot;
+}
+
+std::vector<VirtualFile> CollectPatches(const std::vector<ModEntry>& mods, u64 title_id,
+                                        const std::string& build_id) {
+    const auto& disabled = Settings::values.disabled_addons[title_id];
+
+    std::vector<VirtualFile> out;
+    out.reserve(mods.size());
+    for (const auto& mod : mods) {
+        if (std::find(disabled.cbegin(), disabled.cend(), mod.dir->GetName()) != disabled.cend())
+            continue;
+
+        if (mod.exefs != nullptr) {
+            for (const auto& file : mod.exefs->GetFiles()) {
+                if (file->GetExtension() == "ips") {
+                    auto name = file->GetName();
+                    const auto p1 = name.substr(0, name.find('.'));
+                    const auto this_build_id = p1.substr(0, p1.find_last_not_of('0') + 1);
+
+                    if (build_id == this_build_id)
+                        out.push_back(file);
+                } else if (file->GetExtension() == "pchtxt") {
+                    IPSwitchCompiler compiler{file};
+                    if (!compiler.IsValid())
+                        continue;
+
+                    auto this_build_id = Common::HexToString(compiler.GetBuildID());
+                    this_build_id =
+                        this_build_id.substr(0, this_build_id.find_last_not_of('0') + 1);
+
+                    if (build_id == this_build_id)
+                        out.push_back(file);
+                }
+            }
+        }
+    }
+
+    return out;
+}
+
+} // Anonymous namespace
+
 PatchManager::PatchManager(u64 title_id) : title_id(title_id) {}
 
 PatchManager::~PatchManager() = default;
@@ -108,23 +274,16 @@ VirtualDir PatchManager::PatchExeFS(VirtualDir exefs) const {
     }
 
     // LayeredExeFS
-    const auto load_dir =
-        Core::System::GetInstance().GetFileSystemController().GetModificationLoadRoot(title_id);
-    if (load_dir != nullptr && load_dir->GetSize() > 0) {
-        auto patch_dirs = load_dir->GetSubdirectories();
-        std::sort(
-            patch_dirs.begin(), patch_dirs.end(),
-            [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
-
+    const auto discovery = DiscoverMods(title_id);
+    if (discovery != nullptr && !discovery->mods.empty()) {
         std::vector<VirtualDir> layers;
-        layers.reserve(patch_dirs.size() + 1);
-        for (const auto& subdir : patch_dirs) {
-            if (std::find(disabled.begin(), disabled.end(), subdir->GetName()) != disabled.end())
+        layers.reserve(discovery->mods.size() + 1);
+        for (const auto& mod : discovery->mods) {
+            if (std::find(disabled.begin(), disabled.end(), mod.dir->GetName()) != disabled.end())
                 continue;
 
-            auto exefs_dir = FindSubdirectoryCaseless(subdir, "exefs");
-            if (exefs_dir != nullptr)
-                layers.push_back(std::move(exefs_dir));
+            if (mod.exefs != nullptr)
+                layers.push_back(mod.exefs);
         }
         layers.push_back(exefs);
 
@@ -138,45 +297,6 @@ VirtualDir PatchManager::PatchExeFS(VirtualDir exefs) const {
     return exefs;
 }
 
-std::vector<VirtualFile> PatchManager::CollectPatches(const std::vector<VirtualDir>& patch_dirs,
-                                                      const std::string& build_id) const {
-    const auto& disabled = Settings::values.disabled_addons[title_id];
-
-    std::vector<VirtualFile> out;
-    out.reserve(patch_dirs.size());
-    for (const auto& subdir : patch_dirs) {
-        if (std::find(disabled.cbegin(), disabled.cend(), subdir->GetName()) != disabled.cend())
-            continue;
-
-        auto exefs_dir = FindSubdirectoryCaseless(subdir, "exefs");
-        if (exefs_dir != nullptr) {
-            for (const auto& file : exefs_dir->GetFiles()) {
-                if (file->GetExtension() == "ips") {
-                    auto name = file->GetName();
-                    const auto p1 = name.substr(0, name.find('.'));
-                    const auto this_build_id = p1.substr(0, p1.find_last_not_of('0') + 1);
-
-                    if (build_id == this_build_id)
-                        out.push_back(file);
-                } else if (file->GetExtension() == "pchtxt") {
-                    IPSwitchCompiler compiler{file};
-                    if (!compiler.IsValid())
-                        continue;
-
-                    auto this_build_id = Common::HexToString(compiler.GetBuildID());
-                    this_build_id =
-                        this_build_id.substr(0, this_build_id.find_last_not_of('0') + 1);
-
-                    if (build_id == this_build_id)
-                        out.push_back(file);
-                }
-            }
-        }
-    }
-
-    return out;
-}
-
 std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::string& name) const {
     if (nso.size() < sizeof(Loader::NSOHeader)) {
         return nso;
@@ -208,17 +328,12 @@ std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::st
 
     LOG_INFO(Loader, "Patching NSO for name={}, build_id={}", name, build_id);
 
-    const auto load_dir =
-        Core::System::GetInstance().GetFileSystemController().GetModificationLoadRoot(title_id);
-    if (load_dir == nullptr) {
+    const auto discovery = DiscoverMods(title_id);
+    if (discovery == nullptr) {
         LOG_ERROR(Loader, "Cannot load mods for invalid title_id={:016X}", title_id);
         return nso;
     }
-
-    auto patch_dirs = load_dir->GetSubdirectories();
-    std::sort(patch_dirs.begin(), patch_dirs.end(),
-              [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
-    const auto patches = CollectPatches(patch_dirs, build_id);
+    const auto patches = CollectPatches(discovery->mods, title_id, build_id);
 
     auto out = nso;
     for (const auto& patch_file : patches) {
@@ -252,18 +367,13 @@ bool PatchManager::HasNSOPatch(const std::array<u8, 32>& build_id_) const {
 
     LOG_INFO(Loader, "Querying NSO patch existence for build_id={}", build_id);
 
-    const auto load_dir =
-        Core::System::GetInstance().GetFileSystemController().GetModificationLoadRoot(title_id);
-    if (load_dir == nullptr) {
+    const auto discovery = DiscoverMods(title_id);
+    if (discovery == nullptr) {
         LOG_ERROR(Loader, "Cannot load mods for invalid title_id={:016X}", title_id);
         return false;
     }
 
-    auto patch_dirs = load_dir->GetSubdirectories();
-    std::sort(patch_dirs.begin(), patch_dirs.end(),
-              [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
-
-    return !CollectPatches(patch_dirs, build_id).empty();
+    return !CollectPatches(discovery->mods, title_id, build_id).empty();
 }
 
 namespace {
@@ -296,32 +406,27 @@ std::optional<std::vector<Core::Memory::CheatEntry>> ReadCheatFileFromFolder(
 
 std::vector<Core::Memory::CheatEntry> PatchManager::CreateCheatList(
     const Core::System& system, const std::array<u8, 32>& build_id_) const {
-    const auto load_dir = system.GetFileSystemController().GetModificationLoadRoot(title_id);
-    if (load_dir == nullptr) {
+    const auto discovery = DiscoverMods(title_id);
+    if (discovery == nullptr) {
         LOG_ERROR(Loader, "Cannot load mods for invalid title_id={:016X}", title_id);
         return {};
     }
 
     const auto& disabled = Settings::values.disabled_addons[title_id];
-    auto patch_dirs = load_dir->GetSubdirectories();
-    std::sort(patch_dirs.begin(), patch_dirs.end(),
-              [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
-
     std::vector<Core::Memory::CheatEntry> out;
-    for (const auto& subdir : patch_dirs) {
-        if (std::find(disabled.cbegin(), disabled.cend(), subdir->GetName()) != disabled.cend()) {
+    for (const auto& mod : discovery->mods) {
+        if (std::find(disabled.cbegin(), disabled.cend(), mod.dir->GetName()) != disabled.cend()) {
             continue;
         }
 
-        auto cheats_dir = FindSubdirectoryCaseless(subdir, "cheats");
-        if (cheats_dir != nullptr) {
-            auto res = ReadCheatFileFromFolder(system, title_id, build_id_, cheats_dir, true);
+        if (mod.cheats != nullptr) {
+            auto res = ReadCheatFileFromFolder(system, title_id, build_id_, mod.cheats, true);
             if (res.has_value()) {
                 std::copy(res->begin(), res->end(), std::back_inserter(out));
                 continue;
             }
 
-            res = ReadCheatFileFromFolder(system, title_id, build_id_, cheats_dir, false);
+            res = ReadCheatFileFromFolder(system, title_id, build_id_, mod.cheats, false);
             if (res.has_value()) {
                 std::copy(res->begin(), res->end(), std::back_inserter(out));
             }
@@ -332,10 +437,11 @@ std::vector<Core::Memory::CheatEntry> PatchManager::CreateCheatList(
 }
 
 static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType type) {
-    const auto load_dir =
-        Core::System::GetInstance().GetFileSystemController().GetModificationLoadRoot(title_id);
-    if ((type != ContentRecordType::Program && type != ContentRecordType::Data) ||
-        load_dir == nullptr || load_dir->GetSize() <= 0) {
+    if (type != ContentRecordType::Program && type != ContentRecordType::Data) {
+        return;
+    }
+    const auto discovery = DiscoverMods(title_id);
+    if (discovery == nullptr || discovery->mods.empty()) {
         return;
     }
 
@@ -345,26 +451,20 @@ static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType t
     }
 
     const auto& disabled = Settings::values.disabled_addons[title_id];
-    auto patch_dirs = load_dir->GetSubdirectories();
-    std::sort(patch_dirs.begin(), patch_dirs.end(),
-              [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
-
     std::vector<VirtualDir> layers;
     std::vector<VirtualDir> layers_ext;
-    layers.reserve(patch_dirs.size() + 1);
-    layers_ext.reserve(patch_dirs.size() + 1);
-    for (const auto& subdir : patch_dirs) {
-        if (std::find(disabled.cbegin(), disabled.cend(), subdir->GetName()) != disabled.cend()) {
+    layers.reserve(discovery->mods.size() + 1);
+    layers_ext.reserve(discovery->mods.size() + 1);
+    for (const auto& mod : discovery->mods) {
+        if (std::find(disabled.cbegin(), disabled.cend(), mod.dir->GetName()) != disabled.cend()) {
             continue;
         }
 
-        auto romfs_dir = FindSubdirectoryCaseless(subdir, "romfs");
-        if (romfs_dir != nullptr)
-            layers.push_back(std::move(romfs_dir));
+        if (mod.romfs != nullptr)
+            layers.push_back(mod.romfs);
 
-        auto ext_dir = FindSubdirectoryCaseless(subdir, "romfs_ext");
-        if (ext_dir != nullptr)
-            layers_ext.push_back(std::move(ext_dir));
+        if (mod.romfs_ext != nullptr)
+            layers_ext.push_back(mod.romfs_ext);
     }
 
     // When there are no layers to apply, return early as there is no need to rebuild the RomFS
@@ -433,18 +533,9 @@ VirtualFile PatchManager::PatchRomFS(VirtualFile romfs, u64 ivfc_offset, Content
     // LayeredFS
     ApplyLayeredFS(romfs, title_id, type);
 
-    return romfs;
-}
-
-static void AppendCommaIfNotEmpty(std::string& to, const std::string& with) {
-    if (to.empty())
-        to += with;
-    else
-        to += ", " + with;
-}
-
-static bool IsDirValidAndNonEmpty(const VirtualDir& dir) {
-    return dir != nullptr && (!dir->GetFiles().empty() || !dir->GetSubdirectories().empty());
+    // Cache de-layered blocks at the top of the patch stack so repeated reads skip the
+    // layered/update/decryption chain entirely
+    return std::make_shared<CachedVfsFile>(std::move(romfs));
 }
 
 std::map<std::string, std::string, std::less<>> PatchManager::GetPatchVersionNames(
@@ -482,47 +573,16 @@ std::map<std::string, std::string, std::less<>> PatchManager::GetPatchVersionNam
     }
 
     // General Mods (LayeredFS and IPS)
-    const auto mod_dir =
-        Core::System::GetInstance().GetFileSystemController().GetModificationLoadRoot(title_id);
-    if (mod_dir != nullptr && mod_dir->GetSize() > 0) {
-        for (const auto& mod : mod_dir->GetSubdirectories()) {
-            std::string types;
-
-            const auto exefs_dir = FindSubdirectoryCaseless(mod, "exefs");
-            if (IsDirValidAndNonEmpty(exefs_dir)) {
-                bool ips = false;
-                bool ipswitch = false;
-                bool layeredfs = false;
-
-                for (const auto& file : exefs_dir->GetFiles()) {
-                    if (file->GetExtension() == "ips") {
-                        ips = true;
-                    } else if (file->GetExtension() == "pchtxt") {
-                        ipswitch = true;
-                    } else if (std::find(EXEFS_FILE_NAMES.begin(), EXEFS_FILE_NAMES.end(),
-                                         file->GetName()) != EXEFS_FILE_NAMES.end()) {
-                        layeredfs = true;
-                    }
-                }
-
-                if (ips)
-                    AppendCommaIfNotEmpty(types, "IPS");
-                if (ipswitch)
-                    AppendCommaIfNotEmpty(types, "IPSwitch");
-                if (layeredfs)
-                    AppendCommaIfNotEmpty(types, "LayeredExeFS");
-            }
-            if (IsDirValidAndNonEmpty(FindSubdirectoryCaseless(mod, "romfs")))
-                AppendCommaIfNotEmpty(types, "LayeredFS");
-            if (IsDirValidAndNonEmpty(FindSubdirectoryCaseless(mod, "cheats")))
-                AppendCommaIfNotEmpty(types, "Cheats");
-
-            if (types.empty())
+    const auto discovery = DiscoverMods(title_id);
+    if (discovery != nullptr) {
+        for (const auto& mod : discovery->mods) {
+            if (mod.types.empty())
                 continue;
 
+            const auto name = mod.dir->GetName();
             const auto mod_disabled =
-                std::find(disabled.begin(), disabled.end(), mod->GetName()) != disabled.end();
-            out.insert_or_assign(mod_disabled ? "[D] " + mod->GetName() : mod->GetName(), types);
+                std::find(disabled.begin(), disabled.end(), name) != disabled.end();
+            out.insert_or_assign(mod_disabled ? "[D] " + name : name, mod.types);
         }
     }
 
@@ -7,6 +7,7 @@
 #include <regex>
 #include <mbedtls/sha256.h>
 #include "common/assert.h"
+#include "common/common_funcs.h"
 #include "common/file_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
@@ -24,6 +25,27 @@ namespace FileSys {
 // The size of blocks to use when vfs raw copying into nand.
 constexpr size_t VFS_RC_LARGE_COPY_BLOCK = 0x400000;
 
+// On-disk layout of the persistent content index stored in the yuzu_meta directory.
+constexpr u32 CONTENT_INDEX_MAGIC = Common::MakeMagic('Y', 'R', 'C', 'I');
+constexpr u32 CONTENT_INDEX_VERSION = 1;
+constexpr const char* CONTENT_INDEX_FILENAME = "registered_index.bin";
+
+struct ContentIndexHeader {
+    u32_le magic;
+    u32_le version;
+    u64_le count;
+};
+static_assert(sizeof(ContentIndexHeader) == 0x10, "ContentIndexHeader has incorrect size.");
+
+struct ContentIndexEntry {
+    NcaID id;
+    u64_le file_size;
+    u64_le title_id;
+    u8 is_meta;
+    INSERT_PADDING_BYTES(7);
+};
+static_assert(sizeof(ContentIndexEntry) == 0x28, "ContentIndexEntry has incorrect size.");
+
 std::string ContentProviderEntry::DebugInfo() const {
     return fmt::format("title_id={:016X}, content_type={:02X}", title_id, static_cast<u8>(type));
 }
@@ -204,6 +226,8 @@ bool PlaceholderCache::Register(RegisteredCache* cache, const NcaID& placeholder
     if (res != InstallResult::Success)
         return false;
 
+    cache->RefreshEntry(install);
+
     return Delete(placeholder);
 }
 
@@ -404,26 +428,48 @@ std::vector<NcaID> RegisteredCache::AccumulateFiles() const {
 
 void RegisteredCache::ProcessFiles(const std::vector<NcaID>& ids) {
     for (const auto& id : ids) {
-        const auto file = GetFileAtID(id);
+        ProcessFile(id);
+    }
+}
 
-        if (file == nullptr)
-            continue;
-        const auto nca = std::make_shared<NCA>(parser(file, id), nullptr, 0);
-        if (nca->GetStatus() != Loader::ResultStatus::Success ||
-            nca->GetType() != NCAContentType::Meta) {
-            continue;
-        }
+void RegisteredCache::ProcessFile(const NcaID& id) {
+    const auto file = GetFileAtID(id);
 
-        const auto section0 = nca->GetSubdirectories()[0];
+    if (file == nullptr)
+        return;
 
-        for (const auto& section0_file : section0->GetFiles()) {
-            if (section0_file->GetExtension() != "cnmt")
-                continue;
+    // Unchanged files that the index classified as non-meta content do not need to be opened
+    // and parsed again; they only carry data that the meta NCAs point at.
+    const auto file_size = static_cast<u64>(file->GetSize());
+    const auto it = index.find(id);
+    if (it != index.end() && it->second.file_size == file_size && !it->second.is_meta) {
+        return;
+    }
 
-            meta.insert_or_assign(nca->GetTitleId(), CNMT(section0_file));
-            meta_id.insert_or_assign(nca->GetTitleId(), id);
-            break;
-        }
+    const auto nca = std::make_shared<NCA>(parser(file, id), nullptr, 0);
+    const bool is_meta = nca->GetStatus() == Loader::ResultStatus::Success &&
+                         nca->GetType() == NCAContentType::Meta;
+    const u64 title_id = is_meta ? nca->GetTitleId() : 0;
+
+    if (it == index.end() || it->second.file_size != file_size || it->second.is_meta != is_meta ||
+        it->second.title_id != title_id) {
+        index[id] = {file_size, title_id, is_meta};
+        index_dirty = true;
+    }
+
+    if (!is_meta) {
+        return;
+    }
+
+    const auto section0 = nca->GetSubdirectories()[0];
+
+    for (const auto& section0_file : section0->GetFiles()) {
+        if (section0_file->GetExtension() != "cnmt")
+            continue;
+
+        meta.insert_or_assign(nca->GetTitleId(), CNMT(section0_file));
+        meta_id.insert_or_assign(nca->GetTitleId(), id);
+        break;
     }
 }
 
@@ -444,9 +490,93 @@ void RegisteredCache::AccumulateYuzuMeta() {
 void RegisteredCache::Refresh() {
     if (dir == nullptr)
         return;
+    LoadIndex();
     const auto ids = AccumulateFiles();
     ProcessFiles(ids);
+
+    // Drop index entries for files that no longer exist.
+    for (auto it = index.begin(); it != index.end();) {
+        if (std::find(ids.begin(), ids.end(), it->first) == ids.end()) {
+            it = index.erase(it);
+            index_dirty = true;
+        } else {
+            ++it;
+        }
+    }
+
     AccumulateYuzuMeta();
+    SaveIndex();
+}
+
+void RegisteredCache::RefreshEntry(const NcaID& id) {
+    if (dir == nullptr)
+        return;
+    // Force a reparse in case an existing entry was overwritten in place.
+    index.erase(id);
+    ProcessFile(id);
+    SaveIndex();
+}
+
+void RegisteredCache::LoadIndex() {
+    index.clear();
+    index_dirty = false;
+
+    const auto meta_dir = dir->GetSubdirectory("yuzu_meta");
+    if (meta_dir == nullptr)
+        return;
+    const auto file = meta_dir->GetFile(CONTENT_INDEX_FILENAME);
+    if (file == nullptr)
+        return;
+
+    ContentIndexHeader header{};
+    if (file->ReadObject(&header) != sizeof(header) || header.magic != CONTENT_INDEX_MAGIC ||
+        header.version != CONTENT_INDEX_VERSION) {
+        return;
+    }
+
+    const auto count = static_cast<std::size_t>(header.count);
+    if (file->GetSize() < sizeof(header) + count * sizeof(ContentIndexEntry))
+        return;
+
+    std::vector<ContentIndexEntry> entries(count);
+    if (file->ReadArray(entries.data(), count, sizeof(header)) != count)
+        return;
+
+    for (const auto& entry : entries) {
+        index[entry.id] = {entry.file_size, entry.title_id, entry.is_meta != 0};
+    }
+}
+
+void RegisteredCache::SaveIndex() {
+    if (!index_dirty)
+        return;
+
+    const auto meta_dir = dir->CreateDirectoryRelative("yuzu_meta");
+    if (meta_dir == nullptr)
+        return;
+    auto file = meta_dir->GetFile(CONTENT_INDEX_FILENAME);
+    if (file == nullptr)
+        file = meta_dir->CreateFile(CONTENT_INDEX_FILENAME);
+    if (file == nullptr)
+        return;
+
+    std::vector<ContentIndexEntry> entries;
+    entries.reserve(index.size());
+    for (const auto& [id, entry] : index) {
+        ContentIndexEntry out{};
+        out.id = id;
+        out.file_size = entry.file_size;
+        out.title_id = entry.title_id;
+        out.is_meta = entry.is_meta ? 1 : 0;
+        entries.push_back(out);
+    }
+
+    const ContentIndexHeader header{CONTENT_INDEX_MAGIC, CONTENT_INDEX_VERSION,
+                                    static_cast<u64>(entries.size())};
+    file->Resize(sizeof(header) + entries.size() * sizeof(ContentIndexEntry));
+    file->WriteObject(header);
+    file->WriteArray(entries.data(), entries.size(), sizeof(header));
+    index_dirty = false;
 }
 
 RegisteredCache::RegisteredCache(VirtualDir dir_, ContentProviderParsingFunction parsing_function)
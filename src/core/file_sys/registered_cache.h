@@ -139,6 +139,12 @@ public:
 
     void Refresh() override;
 
+    /**
+     * Incrementally parses and indexes a single content file, so installers do not need to
+     * rescan the entire directory after adding an entry.
+     */
+    void RefreshEntry(const NcaID& id);
+
     bool HasEntry(u64 title_id, ContentRecordType type) const override;
 
     std::optional<u32> GetEntryVersion(u64 title_id) const override;
@@ -175,7 +181,10 @@ private:
                             std::function<bool(const CNMT&, const ContentRecord&)> filter) const;
     std::vector<NcaID> AccumulateFiles() const;
     void ProcessFiles(const std::vector<NcaID>& ids);
+    void ProcessFile(const NcaID& id);
     void AccumulateYuzuMeta();
+    void LoadIndex();
+    void SaveIndex();
     std::optional<NcaID> GetNcaIDFromMetadata(u64 title_id, ContentRecordType type) const;
     VirtualFile GetFileAtID(NcaID id) const;
     VirtualFile OpenFileOrDirectoryConcat(const VirtualDir& dir, std::string_view path) const;
@@ -183,9 +192,22 @@ private:
                                 bool overwrite_if_exists, std::optional<NcaID> override_id = {});
     bool RawInstallYuzuMeta(const CNMT& cnmt);
 
+    // Persisted per-file metadata used to skip parsing unchanged NCAs on Refresh. Entries are
+    // revalidated against the current file size; content ids are hashes, so a matching size
+    // means the previous classification still holds.
+    struct IndexEntry {
+        u64 file_size;
+        u64 title_id;
+        bool is_meta;
+    };
+
     VirtualDir dir;
     ContentProviderParsingFunction parser;
 
+    // On-disk content index, keyed by content id.
+    std::map<NcaID, IndexEntry> index;
+    bool index_dirty = false;
+
     // maps tid -> NcaID of meta
     std::map<u64, NcaID> meta_id;
     // maps tid -> meta
@@ -9,6 +9,7 @@
 #include "core/core.h"
 #include "core/file_sys/savedata_factory.h"
 #include "core/file_sys/vfs.h"
+#include "core/file_sys/vfs_cached.h"
 #include "core/hle/kernel/process.h"
 
 namespace FileSys {
@@ -94,7 +95,13 @@ ResultVal<VirtualDir> SaveDataFactory::Create(SaveDataSpaceId space,
         return RESULT_UNKNOWN;
     }
 
-    return MakeResult<VirtualDir>(std::move(out));
+    if (const auto it = save_cache.find(save_directory); it != save_cache.end()) {
+        return MakeResult<VirtualDir>(it->second);
+    }
+
+    VirtualDir cached = std::make_shared<CachedVfsDirectory>(std::move(out));
+    save_cache.emplace(save_directory, cached);
+    return MakeResult<VirtualDir>(std::move(cached));
 }
 
 ResultVal<VirtualDir> SaveDataFactory::Open(SaveDataSpaceId space,
@@ -103,6 +110,10 @@ ResultVal<VirtualDir> SaveDataFactory::Open(SaveDataSpaceId space,
     const auto save_directory =
         GetFullPath(space, meta.type, meta.title_id, meta.user_id, meta.save_id);
 
+    if (const auto it = save_cache.find(save_directory); it != save_cache.end()) {
+        return MakeResult<VirtualDir>(it->second);
+    }
+
     auto out = dir->GetDirectoryRelative(save_directory);
 
     if (out == nullptr && ShouldSaveDataBeAutomaticallyCreated(space, meta)) {
@@ -115,7 +126,9 @@ ResultVal<VirtualDir> SaveDataFactory::Open(SaveDataSpaceId space,
         return RESULT_UNKNOWN;
     }
 
-    return MakeResult<VirtualDir>(std::move(out));
+    VirtualDir cached = std::make_shared<CachedVfsDirectory>(std::move(out));
+    save_cache.emplace(save_directory, cached);
+    return MakeResult<VirtualDir>(std::move(cached));
 }
 
 VirtualDir SaveDataFactory::GetSaveDataSpaceDirectory(SaveDataSpaceId space) const {
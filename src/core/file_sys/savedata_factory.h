@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
 #include "common/common_funcs.h"
@@ -79,6 +80,12 @@ public:
 
 private:
     VirtualDir dir;
+
+    /// Caching directory handles previously returned by Open/Create, keyed by full save path.
+    /// Titles that autosave re-open and re-enumerate their save on a timer; serving the same
+    /// cached tree avoids re-statting it on the host every time. Writes go through the cached
+    /// handles, which keep their listings up to date.
+    mutable std::map<std::string, VirtualDir, std::less<>> save_cache;
 };
 
 } // namespace FileSys
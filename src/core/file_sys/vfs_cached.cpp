@@ -0,0 +1,338 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "common/logging/log.h"
+#include "core/file_sys/vfs_cached.h"
+
+namespace FileSys {
+
+namespace {
+
+constexpr std::size_t BLOCK_SIZE = 0x10000;     ///< 64 KiB of de-layered data per block
+constexpr std::size_t CACHE_BUDGET = 0x4000000; ///< 64 MiB shared across all cached files
+
+struct BlockKey {
+    u64 file_id;
+    u64 block_index;
+
+    bool operator==(const BlockKey& other) const {
+        return file_id == other.file_id && block_index == other.block_index;
+    }
+};
+
+struct BlockKeyHash {
+    std::size_t operator()(const BlockKey& key) const {
+        return std::hash<u64>()(key.file_id ^ (key.block_index << 16 | key.block_index >> 48));
+    }
+};
+
+/// LRU cache of file blocks with one byte budget shared by every CachedVfsFile
+class BlockCache {
+public:
+    u64 RegisterFile() {
+        std::lock_guard lock{mutex};
+        return next_file_id++;
+    }
+
+    /// Copies up to length bytes out of the cached block; returns false on a cache miss
+    bool Read(const BlockKey& key, std::size_t block_offset, std::size_t length, u8* out,
+              std::size_t& out_length) {
+        std::lock_guard lock{mutex};
+        const auto it = blocks.find(key);
+        if (it == blocks.end()) {
+            misses++;
+            return false;
+        }
+        hits++;
+        lru.splice(lru.begin(), lru, it->second);
+        const auto& data = it->second->second;
+        out_length = block_offset < data.size()
+                         ? std::min(length, data.size() - block_offset)
+                         : 0;
+        std::memcpy(out, data.data() + block_offset, out_length);
+        return true;
+    }
+
+    void Insert(const BlockKey& key, std::vector<u8> data) {
+        std::lock_guard lock{mutex};
+        if (blocks.find(key) != blocks.end()) {
+            return;
+        }
+        total_bytes += data.size();
+        lru.emplace_front(key, std::move(data));
+        blocks.emplace(key, lru.begin());
+        while (total_bytes > CACHE_BUDGET && !lru.empty()) {
+            total_bytes -= lru.back().second.size();
+            blocks.erase(lru.back().first);
+            lru.pop_back();
+        }
+    }
+
+    /// Drops every cached block belonging to file_id
+    void InvalidateFile(u64 file_id) {
+        std::lock_guard lock{mutex};
+        for (auto it = lru.begin(); it != lru.end();) {
+            if (it->first.file_id == file_id) {
+                total_bytes -= it->second.size();
+                blocks.erase(it->first);
+                it = lru.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void LogStatistics() const {
+        std::lock_guard lock{mutex};
+        const u64 lookups = hits + misses;
+        if (lookups == 0) {
+            return;
+        }
+        LOG_DEBUG(Loader, "VFS block cache: {} hits, {} misses ({:.1f}% hit rate), {} KiB resident",
+                  hits, misses, 100.0 * static_cast<double>(hits) / static_cast<double>(lookups),
+                  total_bytes / 1024);
+    }
+
+private:
+    mutable std::mutex mutex;
+    std::list<std::pair<BlockKey, std::vector<u8>>> lru;
+    std::unordered_map<BlockKey, std::list<std::pair<BlockKey, std::vector<u8>>>::iterator,
+                       BlockKeyHash>
+        blocks;
+    std::size_t total_bytes{};
+    u64 next_file_id = 1;
+    u64 hits{};
+    u64 misses{};
+};
+
+BlockCache& GetBlockCache() {
+    static BlockCache block_cache;
+    return block_cache;
+}
+
+} // Anonymous namespace
+
+CachedVfsFile::CachedVfsFile(VirtualFile file_)
+    : file(std::move(file_)), cache_id(GetBlockCache().RegisterFile()) {}
+
+CachedVfsFile::~CachedVfsFile() {
+    GetBlockCache().LogStatistics();
+    GetBlockCache().InvalidateFile(cache_id);
+}
+
+std::string CachedVfsFile::GetName() const {
+    return file->GetName();
+}
+
+std::size_t CachedVfsFile::GetSize() const {
+    return file->GetSize();
+}
+
+bool CachedVfsFile::Resize(std::size_t new_size) {
+    GetBlockCache().InvalidateFile(cache_id);
+    return file->Resize(new_size);
+}
+
+std::shared_ptr<VfsDirectory> CachedVfsFile::GetContainingDirectory() const {
+    return file->GetContainingDirectory();
+}
+
+bool CachedVfsFile::IsWritable() const {
+    return file->IsWritable();
+}
+
+bool CachedVfsFile::IsReadable() const {
+    return file->IsReadable();
+}
+
+std::size_t CachedVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    auto& cache = GetBlockCache();
+    std::size_t read = 0;
+    while (read < length) {
+        const std::size_t current = offset + read;
+        const u64 block_index = current / BLOCK_SIZE;
+        const std::size_t block_offset = current % BLOCK_SIZE;
+        const std::size_t copy_length = std::min(length - read, BLOCK_SIZE - block_offset);
+        const BlockKey key{cache_id, block_index};
+
+        std::size_t copied = 0;
+        if (!cache.Read(key, block_offset, copy_length, data + read, copied)) {
+            // Miss: pull the whole block through the patch stack once, then serve from memory
+            std::vector<u8> block(BLOCK_SIZE);
+            block.resize(file->Read(block.data(), BLOCK_SIZE, block_index * BLOCK_SIZE));
+            copied = block_offset < block.size()
+                         ? std::min(copy_length, block.size() - block_offset)
+                         : 0;
+            std::memcpy(data + read, block.data() + block_offset, copied);
+            cache.Insert(key, std::move(block));
+        }
+
+        read += copied;
+        if (copied < copy_length) {
+            // Short block: end of file or a short read from the backing chain
+            break;
+        }
+    }
+    return read;
+}
+
+std::size_t CachedVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    // Writes are not expected on patched content; drop this file's blocks rather than
+    // tracking partial overlaps
+    GetBlockCache().InvalidateFile(cache_id);
+    return file->Write(data, length, offset);
+}
+
+bool CachedVfsFile::Rename(std::string_view name) {
+    return file->Rename(name);
+}
+
+CachedVfsDirectory::CachedVfsDirectory(VirtualDir dir_) : dir(std::move(dir_)) {}
+
+CachedVfsDirectory::~CachedVfsDirectory() = default;
+
+void CachedVfsDirectory::Populate() const {
+    if (populated) {
+        return;
+    }
+    for (auto& file : dir->GetFiles()) {
+        auto name = file->GetName();
+        cached_files.emplace(std::move(name), std::move(file));
+    }
+    for (auto& subdir : dir->GetSubdirectories()) {
+        auto name = subdir->GetName();
+        cached_dirs.emplace(std::move(name),
+                            std::make_shared<CachedVfsDirectory>(std::move(subdir)));
+    }
+    populated = true;
+}
+
+void CachedVfsDirectory::InvalidateListing() {
+    populated = false;
+    cached_files.clear();
+    cached_dirs.clear();
+}
+
+std::shared_ptr<VfsFile> CachedVfsDirectory::GetFile(std::string_view name) const {
+    Populate();
+    const auto it = cached_files.find(name);
+    return it == cached_files.end() ? nullptr : it->second;
+}
+
+std::shared_ptr<VfsDirectory> CachedVfsDirectory::GetSubdirectory(std::string_view name) const {
+    Populate();
+    const auto it = cached_dirs.find(name);
+    return it == cached_dirs.end() ? nullptr : it->second;
+}
+
+std::vector<std::shared_ptr<VfsFile>> CachedVfsDirectory::GetFiles() const {
+    Populate();
+    std::vector<std::shared_ptr<VfsFile>> out;
+    out.reserve(cached_files.size());
+    for (const auto& [name, file] : cached_files) {
+        out.push_back(file);
+    }
+    return out;
+}
+
+std::vector<std::shared_ptr<VfsDirectory>> CachedVfsDirectory::GetSubdirectories() const {
+    Populate();
+    std::vector<std::shared_ptr<VfsDirectory>> out;
+    out.reserve(cached_dirs.size());
+    for (const auto& [name, subdir] : cached_dirs) {
+        out.push_back(subdir);
+    }
+    return out;
+}
+
+bool CachedVfsDirectory::IsWritable() const {
+    return dir->IsWritable();
+}
+
+bool CachedVfsDirectory::IsReadable() const {
+    return dir->IsReadable();
+}
+
+std::string CachedVfsDirectory::GetName() const {
+    return dir->GetName();
+}
+
+std::shared_ptr<VfsDirectory> CachedVfsDirectory::GetParentDirectory() const {
+    return dir->GetParentDirectory();
+}
+
+std::shared_ptr<VfsDirectory> CachedVfsDirectory::CreateSubdirectory(std::string_view name) {
+    auto out = dir->CreateSubdirectory(name);
+    if (out == nullptr) {
+        return nullptr;
+    }
+    auto cached = std::make_shared<CachedVfsDirectory>(std::move(out));
+    if (populated) {
+        cached_dirs.insert_or_assign(std::string(name), cached);
+    }
+    return cached;
+}
+
+std::shared_ptr<VfsFile> CachedVfsDirectory::CreateFile(std::string_view name) {
+    auto out = dir->CreateFile(name);
+    if (out != nullptr && populated) {
+        cached_files.insert_or_assign(std::string(name), out);
+    }
+    return out;
+}
+
+bool CachedVfsDirectory::DeleteSubdirectory(std::string_view name) {
+    if (!dir->DeleteSubdirectory(name)) {
+        return false;
+    }
+    if (const auto it = cached_dirs.find(name); it != cached_dirs.end()) {
+        cached_dirs.erase(it);
+    }
+    return true;
+}
+
+bool CachedVfsDirectory::DeleteSubdirectoryRecursive(std::string_view name) {
+    if (!dir->DeleteSubdirectoryRecursive(name)) {
+        return false;
+    }
+    if (const auto it = cached_dirs.find(name); it != cached_dirs.end()) {
+        cached_dirs.erase(it);
+    }
+    return true;
+}
+
+bool CachedVfsDirectory::CleanSubdirectoryRecursive(std::string_view name) {
+    if (!dir->CleanSubdirectoryRecursive(name)) {
+        return false;
+    }
+    // The directory itself survives; keep the handle so callers see the same node, but drop its
+    // listing since everything beneath it is gone.
+    if (const auto it = cached_dirs.find(name); it != cached_dirs.end()) {
+        it->second->InvalidateListing();
+    }
+    return true;
+}
+
+bool CachedVfsDirectory::DeleteFile(std::string_view name) {
+    if (!dir->DeleteFile(name)) {
+        return false;
+    }
+    if (const auto it = cached_files.find(name); it != cached_files.end()) {
+        cached_files.erase(it);
+    }
+    return true;
+}
+
+bool CachedVfsDirectory::Rename(std::string_view name) {
+    return dir->Rename(name);
+}
+
+} // namespace FileSys
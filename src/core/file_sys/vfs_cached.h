@@ -0,0 +1,79 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/file_sys/vfs.h"
+
+namespace FileSys {
+
+// An implementation of VfsFile that caches fixed-size blocks of another VfsFile in memory.
+// Intended to sit on top of layered/patched file chains (LayeredFS, updates), where every read
+// otherwise walks several indirection layers with their own offset math and decryption. All
+// cached files share one LRU block budget; statistics are logged when a cached file is destroyed.
+class CachedVfsFile : public VfsFile {
+public:
+    explicit CachedVfsFile(VirtualFile file_);
+    ~CachedVfsFile() override;
+
+    std::string GetName() const override;
+    std::size_t GetSize() const override;
+    bool Resize(std::size_t new_size) override;
+    std::shared_ptr<VfsDirectory> GetContainingDirectory() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    bool Rename(std::string_view name) override;
+
+private:
+    VirtualFile file;
+    u64 cache_id; ///< Distinguishes this file's blocks in the shared cache
+};
+
+// An implementation of VfsDirectory that caches the listing of another VfsDirectory, handing out
+// the same child handles on every lookup. Mutations are written through to the wrapped directory
+// and the listing is updated in place, so the backing filesystem is only enumerated once per
+// directory. Intended for the save data tree, which titles re-open and re-list on every autosave.
+class CachedVfsDirectory : public VfsDirectory {
+public:
+    explicit CachedVfsDirectory(VirtualDir dir_);
+    ~CachedVfsDirectory() override;
+
+    std::shared_ptr<VfsFile> GetFile(std::string_view name) const override;
+    std::shared_ptr<VfsDirectory> GetSubdirectory(std::string_view name) const override;
+    std::vector<std::shared_ptr<VfsFile>> GetFiles() const override;
+    std::vector<std::shared_ptr<VfsDirectory>> GetSubdirectories() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::string GetName() const override;
+    std::shared_ptr<VfsDirectory> GetParentDirectory() const override;
+    std::shared_ptr<VfsDirectory> CreateSubdirectory(std::string_view name) override;
+    std::shared_ptr<VfsFile> CreateFile(std::string_view name) override;
+    bool DeleteSubdirectory(std::string_view name) override;
+    bool DeleteSubdirectoryRecursive(std::string_view name) override;
+    bool CleanSubdirectoryRecursive(std::string_view name) override;
+    bool DeleteFile(std::string_view name) override;
+    bool Rename(std::string_view name) override;
+
+private:
+    /// Enumerates the wrapped directory on first use, filling the cached listing.
+    void Populate() const;
+
+    /// Drops the cached listing so the next lookup re-enumerates the wrapped directory.
+    void InvalidateListing();
+
+    VirtualDir dir;
+    mutable bool populated = false;
+    mutable std::map<std::string, VirtualFile, std::less<>> cached_files;
+    mutable std::map<std::string, std::shared_ptr<CachedVfsDirectory>, std::less<>> cached_dirs;
+};
+
+} // namespace FileSys
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <utility>
 #include "common/assert.h"
@@ -12,6 +13,23 @@
 #include "common/logging/log.h"
 #include "core/file_sys/vfs_real.h"
 
+#ifdef _WIN32
+#include <windows.h>
+#include "common/string_util.h"
+
+// windows.h defines these to their wide variants, which collide with the VfsFilesystem interface
+#undef CreateFile
+#undef CreateDirectory
+#undef CopyFile
+#undef MoveFile
+#undef DeleteFile
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace FileSys {
 
 static std::string ModeFlagsToString(Mode mode) {
@@ -219,9 +237,15 @@ RealVfsFile::RealVfsFile(RealVfsFilesystem& base_, std::shared_ptr<FileUtil::IOF
       parent_path(FileUtil::GetParentPath(path_)),
       path_components(FileUtil::SplitPathComponents(path_)),
       parent_components(FileUtil::SliceVector(path_components, 0, path_components.size() - 1)),
-      perms(perms_) {}
+      perms(perms_) {
+    if (perms == Mode::Read) {
+        TryMapForRead();
+    }
+}
 
-RealVfsFile::~RealVfsFile() = default;
+RealVfsFile::~RealVfsFile() {
+    Unmap();
+}
 
 std::string RealVfsFile::GetName() const {
     return path_components.back();
@@ -232,6 +256,8 @@ std::size_t RealVfsFile::GetSize() const {
 }
 
 bool RealVfsFile::Resize(std::size_t new_size) {
+    // A stale mapping would clamp reads to the old size, so drop it before resizing.
+    Unmap();
     return backing->Resize(new_size);
 }
 
@@ -248,12 +274,23 @@ bool RealVfsFile::IsReadable() const {
 }
 
 std::size_t RealVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    if (mapped_ptr != nullptr) {
+        if (offset >= mapped_size) {
+            return 0;
+        }
+        const std::size_t copy_size = std::min(length, mapped_size - offset);
+        std::memcpy(data, mapped_ptr + offset, copy_size);
+        return copy_size;
+    }
     if (!backing->Seek(offset, SEEK_SET))
         return 0;
     return backing->ReadBytes(data, length);
 }
 
 std::size_t RealVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    // Read-only files are the only ones that get mapped, so this is not expected to be hit;
+    // drop the mapping regardless so reads cannot miss size changes made through the IOFile.
+    Unmap();
     if (!backing->Seek(offset, SEEK_SET))
         return 0;
     return backing->WriteBytes(data, length);
@@ -264,9 +301,74 @@ bool RealVfsFile::Rename(std::string_view name) {
 }
 
 bool RealVfsFile::Close() {
+    Unmap();
     return backing->Close();
 }
 
+void RealVfsFile::TryMapForRead() {
+    // Address space is the limiting factor here, so do not even try on 32-bit hosts.
+    if constexpr (sizeof(void*) < 8) {
+        return;
+    }
+
+#ifdef _WIN32
+    const HANDLE file = CreateFileW(Common::UTF8ToUTF16W(path).c_str(), GENERIC_READ,
+                                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                    nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        return;
+    }
+    const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        return;
+    }
+    void* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == nullptr) {
+        return;
+    }
+    mapped_ptr = static_cast<u8*>(view);
+    mapped_size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+        close(fd);
+        return;
+    }
+    const auto file_size = static_cast<std::size_t>(file_stat.st_size);
+    void* const view = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        return;
+    }
+    mapped_ptr = static_cast<u8*>(view);
+    mapped_size = file_size;
+#endif
+}
+
+void RealVfsFile::Unmap() {
+    if (mapped_ptr == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(mapped_ptr);
+#else
+    munmap(mapped_ptr, mapped_size);
+#endif
+    mapped_ptr = nullptr;
+    mapped_size = 0;
+}
+
 // TODO(DarkLordZach): MSVC would not let me combine the following two functions using 'if
 // constexpr' because there is a compile error in the branch not used.
 
@@ -63,8 +63,20 @@ private:
 
     bool Close();
 
+    /**
+     * Attempts to memory map the backing file so Read() becomes a copy from the mapping, with
+     * the OS page cache handling readahead. Mapping can legitimately fail (32-bit hosts,
+     * exhausted address space); reads then keep going through the IOFile.
+     */
+    void TryMapForRead();
+
+    /// Releases the read mapping, if one exists.
+    void Unmap();
+
     RealVfsFilesystem& base;
     std::shared_ptr<FileUtil::IOFile> backing;
+    u8* mapped_ptr{};
+    std::size_t mapped_size{};
     std::string path;
     std::string parent_path;
     std::vector<std::string> path_components;
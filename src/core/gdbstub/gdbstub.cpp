@@ -145,6 +145,11 @@ bool defer_start = false;
 u8 command_buffer[GDB_BUFFER_SIZE];
 u32 command_length;
 
+// Buffered socket input so reading a packet costs one recv() rather than one syscall per byte.
+u8 recv_buffer[GDB_BUFFER_SIZE];
+std::size_t recv_buffer_size = 0;
+std::size_t recv_buffer_offset = 0;
+
 u32 latest_signal = 0;
 bool memory_break = false;
 
@@ -454,16 +459,21 @@ static u128 GdbHexToU128(const u8* src) {
     return output;
 }
 
-/// Read a byte from the gdb client.
+/// Read a byte from the gdb client, refilling the receive buffer when it runs dry.
 static u8 ReadByte() {
-    u8 c;
-    std::size_t received_size = recv(gdbserver_socket, reinterpret_cast<char*>(&c), 1, MSG_WAITALL);
-    if (received_size != 1) {
-        LOG_ERROR(Debug_GDBStub, "recv failed: {}", received_size);
-        Shutdown();
+    if (recv_buffer_offset == recv_buffer_size) {
+        const auto received_size = recv(gdbserver_socket, reinterpret_cast<char*>(recv_buffer),
+                                        static_cast<int>(sizeof(recv_buffer)), 0);
+        if (received_size <= 0) {
+            LOG_ERROR(Debug_GDBStub, "recv failed: {}", received_size);
+            Shutdown();
+            return 0;
+        }
+        recv_buffer_size = static_cast<std::size_t>(received_size);
+        recv_buffer_offset = 0;
     }
 
-    return c;
+    return recv_buffer[recv_buffer_offset++];
 }
 
 /// Calculate the checksum of the current command buffer.
@@ -510,7 +520,7 @@ static void RemoveBreakpoint(BreakpointType type, VAddr addr) {
     if (type == BreakpointType::Execute) {
         auto& system = Core::System::GetInstance();
         system.Memory().WriteBlock(bp->second.addr, bp->second.inst.data(), bp->second.inst.size());
-        system.InvalidateCpuInstructionCaches();
+        system.InvalidateCpuInstructionCacheRange(bp->second.addr, bp->second.inst.size());
     }
     p.erase(addr);
 }
@@ -802,6 +812,11 @@ static bool IsDataAvailable() {
         return false;
     }
 
+    // Bytes already buffered from a previous recv() count as available data.
+    if (recv_buffer_offset < recv_buffer_size) {
+        return true;
+    }
+
     fd_set fd_socket;
 
     FD_ZERO(&fd_socket);
@@ -1002,7 +1017,7 @@ static void WriteMemory() {
     std::vector<u8> data(len);
     GdbHexToMem(data.data(), len_pos + 1, len);
     memory.WriteBlock(addr, data.data(), len);
-    system.InvalidateCpuInstructionCaches();
+    system.InvalidateCpuInstructionCacheRange(addr, len);
     SendReply("OK");
 }
 
@@ -1066,7 +1081,7 @@ static bool CommitBreakpoint(BreakpointType type, VAddr addr, u64 len) {
     static constexpr std::array<u8, 4> btrap{0x00, 0x7d, 0x20, 0xd4};
     if (type == BreakpointType::Execute) {
         memory.WriteBlock(addr, btrap.data(), btrap.size());
-        system.InvalidateCpuInstructionCaches();
+        system.InvalidateCpuInstructionCacheRange(addr, btrap.size());
     }
     p.insert({addr, breakpoint});
 
@@ -1332,6 +1347,8 @@ static void Init(u16 port) {
     } else {
         LOG_INFO(Debug_GDBStub, "Client connected.");
         saddr_client.sin_addr.s_addr = ntohl(saddr_client.sin_addr.s_addr);
+        recv_buffer_size = 0;
+        recv_buffer_offset = 0;
     }
 
     // Clean up temporary socket if it's still alive at this point.
@@ -11,19 +11,35 @@
 namespace Core::Hardware {
 
 InterruptManager::InterruptManager(Core::System& system_in) : system(system_in) {
-    gpu_interrupt_event = Core::Timing::CreateEvent("GPUInterrupt", [this](u64 message, s64) {
-        auto nvdrv = system.ServiceManager().GetService<Service::Nvidia::NVDRV>("nvdrv");
-        const u32 syncpt = static_cast<u32>(message >> 32);
-        const u32 value = static_cast<u32>(message);
-        nvdrv->SignalGPUInterruptSyncpt(syncpt, value);
-    });
+    gpu_interrupt_event = Core::Timing::CreateEvent(
+        "GPUInterrupt",
+        [](std::uintptr_t context, u64, s64) {
+            auto& manager = *reinterpret_cast<InterruptManager*>(context);
+            // Allow interrupts raised from here on to schedule the next batch before draining,
+            // so none can end up enqueued with no event pending to deliver them.
+            manager.gpu_interrupt_scheduled.store(false, std::memory_order_release);
+            auto nvdrv =
+                manager.system.ServiceManager().GetService<Service::Nvidia::NVDRV>("nvdrv");
+            u64 message;
+            while (manager.pending_gpu_interrupts.TryPop(message)) {
+                const u32 syncpt = static_cast<u32>(message >> 32);
+                const u32 value = static_cast<u32>(message);
+                nvdrv->SignalGPUInterruptSyncpt(syncpt, value);
+            }
+        },
+        reinterpret_cast<std::uintptr_t>(this));
 }
 
 InterruptManager::~InterruptManager() = default;
 
 void InterruptManager::GPUInterruptSyncpt(const u32 syncpoint_id, const u32 value) {
     const u64 msg = (static_cast<u64>(syncpoint_id) << 32ULL) | value;
-    system.CoreTiming().ScheduleEvent(10, gpu_interrupt_event, msg);
+    pending_gpu_interrupts.Push(msg);
+    // Interrupts raised while a delivery is pending ride along with it instead of scheduling
+    // an event each; GPU-heavy frames raise hundreds within the same quantum.
+    if (!gpu_interrupt_scheduled.exchange(true, std::memory_order_acq_rel)) {
+        system.CoreTiming().ScheduleEvent(10, gpu_interrupt_event);
+    }
 }
 
 } // namespace Core::Hardware
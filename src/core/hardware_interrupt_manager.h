@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include "common/common_types.h"
+#include "common/mpmc_queue.h"
 
 namespace Core {
 class System;
@@ -28,6 +30,14 @@ public:
 private:
     Core::System& system;
     std::shared_ptr<Core::Timing::EventType> gpu_interrupt_event;
+
+    /// Syncpoint interrupts raised since the batch event was last scheduled, packed as
+    /// (syncpoint << 32) | value. Bounded so raising an interrupt never allocates.
+    Common::MPMCQueue<u64, 128> pending_gpu_interrupts{Common::QueueWaitStrategy::Spin};
+
+    /// Whether a batch delivery event is already scheduled; interrupts raised while it is set
+    /// only enqueue their message.
+    std::atomic<bool> gpu_interrupt_scheduled{false};
 };
 
 } // namespace Core::Hardware
@@ -3,7 +3,6 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
-#include <vector>
 
 #include "common/assert.h"
 #include "common/common_types.h"
@@ -21,23 +20,32 @@
 
 namespace Kernel {
 
-// Wake up num_to_wake (or all) threads in a vector.
-void AddressArbiter::WakeThreads(const std::vector<std::shared_ptr<Thread>>& waiting_threads,
-                                 s32 num_to_wake) {
-    auto& time_manager = system.Kernel().TimeManager();
+void AddressArbiter::WakeThreads(VAddr address, s32 num_to_wake) {
+    const auto bucket = arb_threads.find(address);
+    if (bucket == arb_threads.end()) {
+        return;
+    }
+    std::list<std::shared_ptr<Thread>>& thread_list = bucket->second;
+
     // Only process up to 'target' threads, unless 'target' is <= 0, in which case process
     // them all.
-    std::size_t last = waiting_threads.size();
+    std::size_t last = thread_list.size();
     if (num_to_wake > 0) {
         last = std::min(last, static_cast<std::size_t>(num_to_wake));
     }
 
-    // Signal the waiting threads.
+    // Signal the waiting threads, popping them off the front of their bucket directly instead of
+    // re-resolving the bucket per thread.
     for (std::size_t i = 0; i < last; i++) {
-        waiting_threads[i]->SetSynchronizationResults(nullptr, RESULT_SUCCESS);
-        RemoveThread(waiting_threads[i]);
-        waiting_threads[i]->WaitForArbitration(false);
-        waiting_threads[i]->ResumeFromWait();
+        std::shared_ptr<Thread> thread = std::move(thread_list.front());
+        thread_list.pop_front();
+        thread->SetSynchronizationResults(nullptr, RESULT_SUCCESS);
+        thread->WaitForArbitration(false);
+        thread->ResumeFromWait();
+    }
+
+    if (thread_list.empty()) {
+        arb_threads.erase(bucket);
     }
 }
 
@@ -60,9 +68,7 @@ ResultCode AddressArbiter::SignalToAddress(VAddr address, SignalType type, s32 v
 
 ResultCode AddressArbiter::SignalToAddressOnly(VAddr address, s32 num_to_wake) {
     SchedulerLock lock(system.Kernel());
-    const std::vector<std::shared_ptr<Thread>> waiting_threads =
-        GetThreadsWaitingOnAddress(address);
-    WakeThreads(waiting_threads, num_to_wake);
+    WakeThreads(address, num_to_wake);
     return RESULT_SUCCESS;
 }
 
@@ -101,9 +107,8 @@ ResultCode AddressArbiter::ModifyByWaitingCountAndSignalToAddressIfEqual(VAddr a
         return ERR_INVALID_ADDRESS_STATE;
     }
 
-    // Get threads waiting on the address.
-    const std::vector<std::shared_ptr<Thread>> waiting_threads =
-        GetThreadsWaitingOnAddress(address);
+    // Get the number of threads waiting on the address.
+    const std::size_t waiting_count = GetThreadsWaitingOnAddress(address);
 
     const std::size_t current_core = system.CurrentCoreIndex();
     auto& monitor = system.Monitor();
@@ -116,15 +121,15 @@ ResultCode AddressArbiter::ModifyByWaitingCountAndSignalToAddressIfEqual(VAddr a
         }
         // Determine the modified value depending on the waiting count.
         if (num_to_wake <= 0) {
-            if (waiting_threads.empty()) {
+            if (waiting_count == 0) {
                 updated_value = value + 1;
             } else {
                 updated_value = value - 1;
             }
         } else {
-            if (waiting_threads.empty()) {
+            if (waiting_count == 0) {
                 updated_value = value + 1;
-            } else if (waiting_threads.size() <= static_cast<u32>(num_to_wake)) {
+            } else if (waiting_count <= static_cast<u32>(num_to_wake)) {
                 updated_value = value - 1;
             } else {
                 updated_value = value;
@@ -132,7 +137,7 @@ ResultCode AddressArbiter::ModifyByWaitingCountAndSignalToAddressIfEqual(VAddr a
         }
     } while (!monitor.ExclusiveWrite32(current_core, address, updated_value));
 
-    WakeThreads(waiting_threads, num_to_wake);
+    WakeThreads(address, num_to_wake);
     return RESULT_SUCCESS;
 }
 
@@ -300,7 +305,11 @@ void AddressArbiter::InsertThread(std::shared_ptr<Thread> thread) {
 
 void AddressArbiter::RemoveThread(std::shared_ptr<Thread> thread) {
     const VAddr arb_addr = thread->GetArbiterWaitAddress();
-    std::list<std::shared_ptr<Thread>>& thread_list = arb_threads[arb_addr];
+    const auto bucket = arb_threads.find(arb_addr);
+    if (bucket == arb_threads.end()) {
+        return;
+    }
+    std::list<std::shared_ptr<Thread>>& thread_list = bucket->second;
 
     const auto iter = std::find_if(thread_list.cbegin(), thread_list.cend(),
                                    [&thread](const auto& entry) { return thread == entry; });
@@ -308,16 +317,13 @@ void AddressArbiter::RemoveThread(std::shared_ptr<Thread> thread) {
     if (iter != thread_list.cend()) {
         thread_list.erase(iter);
     }
+    if (thread_list.empty()) {
+        arb_threads.erase(bucket);
+    }
 }
 
-std::vector<std::shared_ptr<Thread>> AddressArbiter::GetThreadsWaitingOnAddress(
-    VAddr address) const {
+std::size_t AddressArbiter::GetThreadsWaitingOnAddress(VAddr address) const {
     const auto iter = arb_threads.find(address);
-    if (iter == arb_threads.cend()) {
-        return {};
-    }
-
-    const std::list<std::shared_ptr<Thread>>& thread_list = iter->second;
-    return {thread_list.cbegin(), thread_list.cend()};
+    return iter != arb_threads.cend() ? iter->second.size() : 0;
 }
 } // namespace Kernel
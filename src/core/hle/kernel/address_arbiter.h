@@ -7,7 +7,6 @@
 #include <list>
 #include <memory>
 #include <unordered_map>
-#include <vector>
 
 #include "common/common_types.h"
 
@@ -73,8 +72,8 @@ private:
     /// Waits on an address if the value passed is equal to the argument value.
     ResultCode WaitForAddressIfEqual(VAddr address, s32 value, s64 timeout);
 
-    /// Wake up num_to_wake (or all) threads in a vector.
-    void WakeThreads(const std::vector<std::shared_ptr<Thread>>& waiting_threads, s32 num_to_wake);
+    /// Wake up num_to_wake (or all) threads waiting on the given address.
+    void WakeThreads(VAddr address, s32 num_to_wake);
 
     /// Insert a thread into the address arbiter container
     void InsertThread(std::shared_ptr<Thread> thread);
@@ -82,10 +81,12 @@ private:
     /// Removes a thread from the address arbiter container
     void RemoveThread(std::shared_ptr<Thread> thread);
 
-    // Gets the threads waiting on an address.
-    std::vector<std::shared_ptr<Thread>> GetThreadsWaitingOnAddress(VAddr address) const;
+    // Gets the number of threads waiting on an address.
+    std::size_t GetThreadsWaitingOnAddress(VAddr address) const;
 
-    /// List of threads waiting for a address arbiter
+    /// Per-address buckets of threads waiting on the address arbiter, each ordered by priority.
+    /// Buckets are erased when their last waiter leaves, so signals only ever touch the waiters
+    /// of the signalled address.
     std::unordered_map<VAddr, std::list<std::shared_ptr<Thread>>> arb_threads;
 
     Core::System& system;
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include "common/slab_allocator.h"
 #include "core/hle/kernel/client_session.h"
 #include "core/hle/kernel/errors.h"
 #include "core/hle/kernel/hle_ipc.h"
@@ -39,7 +40,7 @@ bool ClientSession::IsSignaled() const {
 ResultVal<std::shared_ptr<ClientSession>> ClientSession::Create(KernelCore& kernel,
                                                                 std::shared_ptr<Session> parent,
                                                                 std::string name) {
-    std::shared_ptr<ClientSession> client_session{std::make_shared<ClientSession>(kernel)};
+    std::shared_ptr<ClientSession> client_session{Common::MakeSlabShared<ClientSession>(kernel)};
 
     client_session->name = std::move(name);
     client_session->parent = std::move(parent);
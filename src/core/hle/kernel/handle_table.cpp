@@ -53,7 +53,7 @@ ResultVal<Handle> HandleTable::Create(std::shared_ptr<Object> obj) {
         LOG_ERROR(Kernel, "Unable to allocate Handle, too many slots in use.");
         return ERR_HANDLE_TABLE_FULL;
     }
-    next_free_slot = generations[slot];
+    next_free_slot = table[slot].generation;
 
     const u16 generation = next_generation++;
 
@@ -63,8 +63,8 @@ ResultVal<Handle> HandleTable::Create(std::shared_ptr<Object> obj) {
         next_generation = 1;
     }
 
-    generations[slot] = generation;
-    objects[slot] = std::move(obj);
+    table[slot].generation = generation;
+    table[slot].object = std::move(obj);
 
     Handle handle = generation | (slot << 15);
     return MakeResult<Handle>(handle);
@@ -87,9 +87,9 @@ ResultCode HandleTable::Close(Handle handle) {
 
     const u16 slot = GetSlot(handle);
 
-    objects[slot] = nullptr;
+    table[slot].object = nullptr;
 
-    generations[slot] = next_free_slot;
+    table[slot].generation = next_free_slot;
     next_free_slot = slot;
     return RESULT_SUCCESS;
 }
@@ -98,7 +98,8 @@ bool HandleTable::IsValid(Handle handle) const {
     const std::size_t slot = GetSlot(handle);
     const u16 generation = GetGeneration(handle);
 
-    return slot < table_size && objects[slot] != nullptr && generations[slot] == generation;
+    return slot < table_size && table[slot].object != nullptr &&
+           table[slot].generation == generation;
 }
 
 std::shared_ptr<Object> HandleTable::GetGeneric(Handle handle) const {
@@ -111,13 +112,26 @@ std::shared_ptr<Object> HandleTable::GetGeneric(Handle handle) const {
     if (!IsValid(handle)) {
         return nullptr;
     }
-    return objects[GetSlot(handle)];
+    return table[GetSlot(handle)].object;
+}
+
+Object* HandleTable::GetGenericRaw(Handle handle) const {
+    if (handle == CurrentThread) {
+        return GetCurrentThread();
+    } else if (handle == CurrentProcess) {
+        return Core::System::GetInstance().CurrentProcess();
+    }
+
+    if (!IsValid(handle)) {
+        return nullptr;
+    }
+    return table[GetSlot(handle)].object.get();
 }
 
 void HandleTable::Clear() {
     for (u16 i = 0; i < table_size; ++i) {
-        generations[i] = i + 1;
-        objects[i] = nullptr;
+        table[i].generation = i + 1;
+        table[i].object = nullptr;
     }
     next_free_slot = 0;
 }
@@ -27,17 +27,17 @@ enum KernelHandle : Handle {
  * approximately the same restrictions as the handle manager in the CTR-OS.
  *
  * Handles contain two sub-fields: a slot index (bits 31:15) and a generation value (bits 14:0).
- * The slot index is used to index into the arrays in this class to access the data corresponding
+ * The slot index is used to index into the table in this class to access the data corresponding
  * to the Handle.
  *
  * To prevent accidental use of a freed Handle whose slot has already been reused, a global counter
  * is kept and incremented every time a Handle is created. This is the Handle's "generation". The
- * value of the counter is stored into the Handle as well as in the handle table (in the
- * "generations" array). When looking up a handle, the Handle's generation must match with the
+ * value of the counter is stored into the Handle as well as in the handle table (in the slot's
+ * generation field). When looking up a handle, the Handle's generation must match with the
  * value stored on the class, otherwise the Handle is considered invalid.
  *
- * To find free slots when allocating a Handle without needing to scan the entire object array, the
- * generations field of unallocated slots is re-purposed as a linked list of indices to free slots.
+ * To find free slots when allocating a Handle without needing to scan the entire table, the
+ * generation field of unallocated slots is re-purposed as a linked list of indices to free slots.
  * When a Handle is created, an index is popped off the list and used for the new Handle. When it
  * is destroyed, it is again pushed onto the list to be re-used by the next allocation. It is
  * likely that this allocation strategy differs from the one used in CTR-OS, but this hasn't been
@@ -96,6 +96,18 @@ public:
      */
     std::shared_ptr<Object> GetGeneric(Handle handle) const;
 
+    /**
+     * Looks up a handle without taking a reference.
+     *
+     * The returned pointer is borrowed from the table: it is only valid as long as the handle
+     * remains in the table, i.e. for the duration of the current SVC, and must not be stored.
+     * Prefer this over GetGeneric()/Get() on hot paths where ownership does not escape the
+     * caller, as it avoids the atomic ref-count traffic of copying a shared_ptr per lookup.
+     *
+     * @return Pointer to the looked-up object, or `nullptr` if the handle is not valid.
+     */
+    Object* GetGenericRaw(Handle handle) const;
+
     /**
      * Looks up a handle while verifying its type.
      * @return Pointer to the looked-up object, or `nullptr` if the handle is not valid or its
@@ -106,18 +118,37 @@ public:
         return DynamicObjectCast<T>(GetGeneric(handle));
     }
 
+    /**
+     * Looks up a handle without taking a reference, verifying its type. The same lifetime
+     * restrictions as GetGenericRaw() apply to the returned pointer.
+     */
+    template <class T>
+    T* GetRaw(Handle handle) const {
+        Object* const object = GetGenericRaw(handle);
+        if (object != nullptr && object->GetHandleType() == T::HANDLE_TYPE) {
+            return static_cast<T*>(object);
+        }
+        return nullptr;
+    }
+
     /// Closes all handles held in this table.
     void Clear();
 
 private:
-    /// Stores the Object referenced by the handle or null if the slot is empty.
-    std::array<std::shared_ptr<Object>, MAX_COUNT> objects;
-
-    /**
-     * The value of `next_generation` when the handle was created, used to check for validity. For
-     * empty slots, contains the index of the next free slot in the list.
-     */
-    std::array<u16, MAX_COUNT> generations;
+    /// A single slot of the table. Object and generation live side by side so a lookup touches
+    /// one cache line rather than two parallel arrays.
+    struct Entry {
+        /// The Object referenced by the handle, or null if the slot is empty.
+        std::shared_ptr<Object> object;
+
+        /**
+         * The value of `next_generation` when the handle was created, used to check for validity.
+         * For empty slots, contains the index of the next free slot in the list.
+         */
+        u16 generation;
+    };
+
+    std::array<Entry, MAX_COUNT> table;
 
     /**
      * The limited size of the handle table. This can be specified by process
@@ -93,6 +93,35 @@ HLERequestContext::HLERequestContext(KernelCore& kernel, Core::Memory::Memory& m
 
 HLERequestContext::~HLERequestContext() = default;
 
+void HLERequestContext::Reset(std::shared_ptr<ServerSession> session,
+                              std::shared_ptr<Thread> new_thread) {
+    server_session = std::move(session);
+    thread = std::move(new_thread);
+
+    // Drop the object references taken for the previous request, but only shrink the lists so
+    // their storage stays with the context.
+    move_objects.clear();
+    copy_objects.clear();
+    domain_objects.clear();
+    domain_request_handlers.clear();
+
+    command_header.reset();
+    handle_descriptor_header.reset();
+    data_payload_header.reset();
+    domain_message_header.reset();
+    buffer_x_desciptors.clear();
+    buffer_a_desciptors.clear();
+    buffer_b_desciptors.clear();
+    buffer_w_desciptors.clear();
+    buffer_c_desciptors.clear();
+
+    data_payload_offset = 0;
+    buffer_c_offset = 0;
+    command = 0;
+    is_thread_waiting = false;
+    cmd_buf[0] = 0;
+}
+
 void HLERequestContext::ParseCommandBuffer(const HandleTable& handle_table, u32_le* src_cmdbuf,
                                            bool incoming) {
     IPC::RequestParser rp(src_cmdbuf);
@@ -287,6 +316,55 @@ ResultCode HLERequestContext::WriteToOutgoingCommandBuffer(Thread& thread) {
     return RESULT_SUCCESS;
 }
 
+namespace {
+
+/// Returns a host pointer spanning the whole guest range, or nullptr when the memory backing the
+/// range is not physically contiguous.
+const u8* GetContiguousPointer(const Core::Memory::Memory& memory, VAddr address,
+                               std::size_t size) {
+    const u8* const base = memory.GetPointer(address);
+    if (base == nullptr || size == 0) {
+        return base;
+    }
+    const VAddr end = address + size - 1;
+    for (VAddr page = (address & ~Core::Memory::PAGE_MASK) + Core::Memory::PAGE_SIZE; page <= end;
+         page += Core::Memory::PAGE_SIZE) {
+        if (memory.GetPointer(page) != base + (page - address)) {
+            return nullptr;
+        }
+    }
+    return base;
+}
+
+} // Anonymous namespace
+
+BufferView HLERequestContext::ReadBufferView(std::size_t buffer_index) const {
+    VAddr address{};
+    std::size_t size{};
+    const bool is_buffer_a{BufferDescriptorA().size() > buffer_index &&
+                           BufferDescriptorA()[buffer_index].Size()};
+    if (is_buffer_a) {
+        ASSERT_OR_EXECUTE_MSG(BufferDescriptorA().size() > buffer_index, { return {}; },
+                              "BufferDescriptorA invalid buffer_index {}", buffer_index);
+        address = BufferDescriptorA()[buffer_index].Address();
+        size = BufferDescriptorA()[buffer_index].Size();
+    } else {
+        ASSERT_OR_EXECUTE_MSG(BufferDescriptorX().size() > buffer_index, { return {}; },
+                              "BufferDescriptorX invalid buffer_index {}", buffer_index);
+        address = BufferDescriptorX()[buffer_index].Address();
+        size = BufferDescriptorX()[buffer_index].Size();
+    }
+
+    if (const u8* const host_ptr = GetContiguousPointer(memory, address, size)) {
+        return BufferView(host_ptr, size);
+    }
+
+    // The buffer crosses non-contiguous pages, stage a copy.
+    std::vector<u8> staging(size);
+    memory.ReadBlock(address, staging.data(), staging.size());
+    return BufferView(std::move(staging));
+}
+
 std::vector<u8> HLERequestContext::ReadBuffer(std::size_t buffer_index) const {
     std::vector<u8> buffer{};
     const bool is_buffer_a{BufferDescriptorA().size() > buffer_index &&
@@ -82,6 +82,50 @@ protected:
     std::vector<std::shared_ptr<ServerSession>> connected_sessions;
 };
 
+/**
+ * A read-only view over an IPC input buffer. When the buffer is physically contiguous the view
+ * points directly into guest memory, otherwise it owns a staged copy of the data. Views must not
+ * outlive the request that produced them.
+ */
+class BufferView {
+public:
+    BufferView() = default;
+
+    explicit BufferView(const u8* data_, std::size_t size_) : view_data{data_}, view_size{size_} {}
+
+    explicit BufferView(std::vector<u8>&& staging_)
+        : staging{std::move(staging_)}, view_data{staging.data()}, view_size{staging.size()} {}
+
+    const u8* data() const {
+        return view_data;
+    }
+
+    std::size_t size() const {
+        return view_size;
+    }
+
+    bool empty() const {
+        return view_size == 0;
+    }
+
+    const u8* begin() const {
+        return view_data;
+    }
+
+    const u8* end() const {
+        return view_data + view_size;
+    }
+
+    u8 operator[](std::size_t index) const {
+        return view_data[index];
+    }
+
+private:
+    std::vector<u8> staging;
+    const u8* view_data = nullptr;
+    std::size_t view_size = 0;
+};
+
 /**
  * Class containing information about an in-flight IPC request being handled by an HLE service
  * implementation. Services should avoid using old global APIs (e.g. Kernel::GetCommandBuffer()) and
@@ -141,6 +185,11 @@ public:
         const std::string& reason, u64 timeout, WakeupCallback&& callback,
         std::shared_ptr<WritableEvent> writable_event = nullptr);
 
+    /// Rearms this context to service a new request, releasing every reference taken for the
+    /// previous one. The descriptor and object list storage is kept allocated so a recycled
+    /// context does not go back to the heap on every request.
+    void Reset(std::shared_ptr<ServerSession> session, std::shared_ptr<Thread> new_thread);
+
     /// Populates this context with data from the requesting process/thread.
     ResultCode PopulateFromIncomingCommandBuffer(const HandleTable& handle_table,
                                                  u32_le* src_cmdbuf);
@@ -187,6 +236,10 @@ public:
     /// Helper function to read a buffer using the appropriate buffer descriptor
     std::vector<u8> ReadBuffer(std::size_t buffer_index = 0) const;
 
+    /// Reads a buffer as a view into guest memory, avoiding the copy of ReadBuffer when the
+    /// buffer's backing memory is contiguous.
+    BufferView ReadBufferView(std::size_t buffer_index = 0) const;
+
     /// Helper function to write a buffer using the appropriate buffer descriptor
     std::size_t WriteBuffer(const void* buffer, std::size_t size,
                             std::size_t buffer_index = 0) const;
@@ -63,7 +63,7 @@ struct KernelCore::Impl {
         InitializePhysicalCores();
         InitializeSystemResourceLimit(kernel);
         InitializeMemoryLayout();
-        InitializePreemption(kernel);
+        InitializePreemption();
         InitializeSchedulers();
         InitializeSuspendThreads();
     }
@@ -142,16 +142,19 @@ struct KernelCore::Impl {
         }
     }
 
-    void InitializePreemption(KernelCore& kernel) {
+    void InitializePreemption() {
         preemption_event = Core::Timing::CreateEvent(
-            "PreemptionCallback", [this, &kernel](u64 userdata, s64 cycles_late) {
+            "PreemptionCallback",
+            [](std::uintptr_t context, u64, s64) {
+                auto& impl = *reinterpret_cast<Impl*>(context);
                 {
-                    SchedulerLock lock(kernel);
-                    global_scheduler.PreemptThreads();
+                    SchedulerLock lock(impl.system.Kernel());
+                    impl.global_scheduler.PreemptThreads();
                 }
                 s64 time_interval = Core::Timing::msToCycles(std::chrono::milliseconds(10));
-                system.CoreTiming().ScheduleEvent(time_interval, preemption_event);
-            });
+                impl.system.CoreTiming().ScheduleEvent(time_interval, impl.preemption_event);
+            },
+            reinterpret_cast<std::uintptr_t>(this));
 
         s64 time_interval = Core::Timing::msToCycles(std::chrono::milliseconds(10));
         system.CoreTiming().ScheduleEvent(time_interval, preemption_event);
@@ -251,7 +254,7 @@ struct KernelCore::Impl {
         constexpr PAddr time_addr{layout.System().StartAddress() + hid_size + font_size + irs_size};
 
         // Initialize memory manager
-        memory_manager = std::make_unique<Memory::MemoryManager>();
+        memory_manager = std::make_unique<Memory::MemoryManager>(system.DeviceMemory());
         memory_manager->InitializeManager(Memory::MemoryManager::Pool::Application,
                                           layout.Application().StartAddress(),
                                           layout.Application().EndAddress());
@@ -481,6 +484,16 @@ void KernelCore::InvalidateAllInstructionCaches() {
     }
 }
 
+void KernelCore::InvalidateCpuInstructionCacheRange(VAddr addr, std::size_t size) {
+    auto& threads = GlobalScheduler().GetThreadList();
+    for (auto& thread : threads) {
+        if (!thread->IsHLEThread()) {
+            auto& arm_interface = thread->ArmInterface();
+            arm_interface.InvalidateCacheRange(addr, size);
+        }
+    }
+}
+
 void KernelCore::PrepareReschedule(std::size_t id) {
     // TODO: Reimplement, this
 }
@@ -152,6 +152,9 @@ public:
 
     void InvalidateAllInstructionCaches();
 
+    /// Invalidates only the cached instructions intersecting the given range on every core.
+    void InvalidateCpuInstructionCacheRange(VAddr addr, std::size_t size);
+
     /// Adds a port to the named port table
     void AddNamedPort(std::string name, std::shared_ptr<ClientPort> port);
 
@@ -12,13 +12,27 @@ MemoryBlockManager::MemoryBlockManager(VAddr start_addr, VAddr end_addr)
     const u64 num_pages{(end_addr - start_addr) / PageSize};
     memory_block_tree.emplace_back(start_addr, num_pages, MemoryState::Free, MemoryPermission::None,
                                    MemoryAttribute::None);
+    hint_iterator = memory_block_tree.begin();
 }
 
 MemoryBlockManager::iterator MemoryBlockManager::FindIterator(VAddr addr) {
-    auto node{memory_block_tree.begin()};
-    while (node != end()) {
-        const VAddr end_addr{node->GetNumPages() * PageSize + node->GetAddress()};
-        if (node->GetAddress() <= addr && end_addr - 1 >= addr) {
+    // The blocks tile the managed range in address order, so walk from the hint towards the
+    // target instead of scanning the whole tree from the front.
+    auto node{hint_iterator};
+    if (node == memory_block_tree.end()) {
+        node = memory_block_tree.begin();
+    }
+    while (node != memory_block_tree.end()) {
+        if (addr < node->GetAddress()) {
+            if (node == memory_block_tree.begin()) {
+                return end();
+            }
+            node = std::prev(node);
+            continue;
+        }
+        const VAddr node_end_addr{node->GetNumPages() * PageSize + node->GetAddress()};
+        if (node_end_addr - 1 >= addr) {
+            hint_iterator = node;
             return node;
         }
         node = std::next(node);
@@ -68,7 +82,7 @@ void MemoryBlockManager::Update(VAddr addr, std::size_t num_pages, MemoryState p
                                 MemoryState state, MemoryPermission perm,
                                 MemoryAttribute attribute) {
     const VAddr end_addr{addr + num_pages * PageSize};
-    iterator node{memory_block_tree.begin()};
+    iterator node{FindIterator(addr)};
 
     prev_attribute |= MemoryAttribute::IpcAndDeviceMapped;
 
@@ -109,7 +123,7 @@ void MemoryBlockManager::Update(VAddr addr, std::size_t num_pages, MemoryState p
 void MemoryBlockManager::Update(VAddr addr, std::size_t num_pages, MemoryState state,
                                 MemoryPermission perm, MemoryAttribute attribute) {
     const VAddr end_addr{addr + num_pages * PageSize};
-    iterator node{memory_block_tree.begin()};
+    iterator node{FindIterator(addr)};
 
     while (node != memory_block_tree.end()) {
         MemoryBlock* block{&(*node)};
@@ -144,7 +158,7 @@ void MemoryBlockManager::Update(VAddr addr, std::size_t num_pages, MemoryState s
 void MemoryBlockManager::UpdateLock(VAddr addr, std::size_t num_pages, LockFunc&& lock_func,
                                     MemoryPermission perm) {
     const VAddr end_addr{addr + num_pages * PageSize};
-    iterator node{memory_block_tree.begin()};
+    iterator node{FindIterator(addr)};
 
     while (node != memory_block_tree.end()) {
         MemoryBlock* block{&(*node)};
@@ -193,6 +207,9 @@ void MemoryBlockManager::MergeAdjacent(iterator it, iterator& next_it) {
         if (next_it == it_to_erase) {
             next_it = std::next(next_it);
         }
+        if (hint_iterator == it_to_erase) {
+            hint_iterator = memory_block_tree.end();
+        }
         memory_block_tree.erase(it_to_erase);
     };
 
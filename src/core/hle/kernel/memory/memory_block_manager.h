@@ -61,6 +61,10 @@ private:
     const VAddr end_addr;
 
     MemoryBlockTree memory_block_tree;
+
+    /// Block the last lookup landed on. Attribute and permission storms sweep the address space
+    /// in order, so starting the next search here avoids walking the whole tree every call.
+    iterator hint_iterator;
 };
 
 } // namespace Kernel::Memory
@@ -8,6 +8,7 @@
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/scope_exit.h"
+#include "core/device_memory.h"
 #include "core/hle/kernel/errors.h"
 #include "core/hle/kernel/memory/memory_manager.h"
 #include "core/hle/kernel/memory/page_linked_list.h"
@@ -167,6 +168,11 @@ ResultCode MemoryManager::Free(PageLinkedList& page_list, std::size_t num_pages,
         const auto min_num_pages{std::min<size_t>(
             it.GetNumPages(), (chosen_manager.GetEndAddress() - it.GetAddress()) / PageSize)};
         chosen_manager.Free(it.GetAddress(), min_num_pages);
+
+        // Give the host pages back so a freed guest heap stops costing committed RAM. The range
+        // reads back as zeroes if it is ever allocated again, which is at least as strong a
+        // guarantee as handing out recycled dirty pages.
+        device_memory.DecommitRegion(it.GetAddress(), min_num_pages * PageSize);
     }
 
     return RESULT_SUCCESS;
@@ -11,6 +11,10 @@
 #include "core/hle/kernel/memory/page_heap.h"
 #include "core/hle/result.h"
 
+namespace Core {
+class DeviceMemory;
+}
+
 namespace Kernel::Memory {
 
 class PageLinkedList;
@@ -37,7 +41,7 @@ public:
         Mask = (0xF << Shift),
     };
 
-    MemoryManager() = default;
+    explicit MemoryManager(Core::DeviceMemory& device_memory) : device_memory{device_memory} {}
 
     constexpr std::size_t GetSize(Pool pool) const {
         return managers[static_cast<std::size_t>(pool)].GetSize();
@@ -89,6 +93,8 @@ private:
     };
 
 private:
+    /// Host backing of guest DRAM; freed guest pages are decommitted through it
+    Core::DeviceMemory& device_memory;
     std::array<std::mutex, static_cast<std::size_t>(Pool::Count)> pool_locks;
     std::array<Impl, MaxManagerCount> managers;
 };
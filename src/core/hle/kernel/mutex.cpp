@@ -35,8 +35,8 @@ static std::pair<std::shared_ptr<Thread>, u32> GetHighestPriorityMutexWaitingThr
             continue;
 
         ++num_waiters;
-        if (highest_priority_thread == nullptr ||
-            thread->GetPriority() < highest_priority_thread->GetPriority()) {
+        // The waiters list is kept sorted by priority, so the first match is the winner.
+        if (highest_priority_thread == nullptr) {
             highest_priority_thread = thread;
         }
     }
@@ -6,6 +6,8 @@
 // licensed under GPLv2 or later under exception provided by the author.
 
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <set>
 #include <unordered_set>
 #include <utility>
@@ -14,6 +16,7 @@
 #include "common/bit_util.h"
 #include "common/fiber.h"
 #include "common/logging/log.h"
+#include "common/microprofile.h"
 #include "core/arm/arm_interface.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -24,9 +27,30 @@
 #include "core/hle/kernel/scheduler.h"
 #include "core/hle/kernel/time_manager.h"
 
+MICROPROFILE_DEFINE(Kernel_SelectThreads, "Kernel", "Select Threads", MP_RGB(70, 200, 70));
+
 namespace Kernel {
 
-GlobalScheduler::GlobalScheduler(KernelCore& kernel) : kernel{kernel} {}
+namespace {
+
+/// Adds a duration to a log2-nanosecond-bucketed histogram.
+void RecordLockDuration(std::array<u64, Core::SchedulerStatistics::NUM_LOCK_BUCKETS>& histogram,
+                        std::chrono::steady_clock::duration duration) {
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    const u64 clamped = static_cast<u64>(std::max<s64>(ns, 1));
+    const u32 bucket = std::min<u32>(Common::Log2Floor64(clamped),
+                                     Core::SchedulerStatistics::NUM_LOCK_BUCKETS - 1);
+    ++histogram[bucket];
+}
+
+} // Anonymous namespace
+
+GlobalScheduler::GlobalScheduler(KernelCore& kernel) : kernel{kernel} {
+    for (std::size_t core = 0; core < Core::Hardware::NUM_CPU_CORES; core++) {
+        scheduled_queue[core].SetLinkSlot(0);
+        suggested_queue[core].SetLinkSlot(core + 1);
+    }
+}
 
 GlobalScheduler::~GlobalScheduler() = default;
 
@@ -44,6 +68,7 @@ void GlobalScheduler::RemoveThread(std::shared_ptr<Thread> thread) {
 }
 
 u32 GlobalScheduler::SelectThreads() {
+    MICROPROFILE_SCOPE(Kernel_SelectThreads);
     ASSERT(is_locked);
     const auto update_thread = [](Thread* thread, Scheduler& sched) {
         sched.guard.lock();
@@ -60,7 +85,8 @@ u32 GlobalScheduler::SelectThreads() {
         sched.guard.unlock();
         return reschedule_pending;
     };
-    if (!is_reselection_pending.load()) {
+    u32 pending_cores = reselection_pending_cores.exchange(0, std::memory_order_acquire);
+    if (pending_cores == 0) {
         return 0;
     }
     std::array<Thread*, Core::Hardware::NUM_CPU_CORES> top_threads{};
@@ -130,8 +156,17 @@ u32 GlobalScheduler::SelectThreads() {
 
         idle_cores &= ~(1ul << core_id);
     }
+
+    // Load balancing above may have transferred threads between cores, which marks the affected
+    // cores as pending again; fold those into this pass so their selection is updated now.
+    pending_cores |= reselection_pending_cores.exchange(0, std::memory_order_acquire);
+
     u32 cores_needing_context_switch{};
     for (u32 core = 0; core < Core::Hardware::NUM_CPU_CORES; core++) {
+        if ((pending_cores & (1ul << core)) == 0) {
+            // The core's queues are untouched since the last pass, keep its selection.
+            continue;
+        }
         Scheduler& sched = kernel.Scheduler(core);
         ASSERT(top_threads[core] == nullptr || top_threads[core]->GetProcessorID() == core);
         if (update_thread(top_threads[core], sched)) {
@@ -146,7 +181,7 @@ bool GlobalScheduler::YieldThread(Thread* yielding_thread) {
     // Note: caller should use critical section, etc.
     if (!yielding_thread->IsRunnable()) {
         // Normally this case shouldn't happen except for SetThreadActivity.
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
         return false;
     }
     const u32 core_id = static_cast<u32>(yielding_thread->GetProcessorID());
@@ -156,7 +191,7 @@ bool GlobalScheduler::YieldThread(Thread* yielding_thread) {
     Reschedule(priority, core_id, yielding_thread);
     const Thread* const winner = scheduled_queue[core_id].front();
     if (kernel.GetCurrentHostThreadID() != core_id) {
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
     }
 
     return AskForReselectionOrMarkRedundant(yielding_thread, winner);
@@ -168,7 +203,7 @@ bool GlobalScheduler::YieldThreadAndBalanceLoad(Thread* yielding_thread) {
     // etc.
     if (!yielding_thread->IsRunnable()) {
         // Normally this case shouldn't happen except for SetThreadActivity.
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
         return false;
     }
     const u32 core_id = static_cast<u32>(yielding_thread->GetProcessorID());
@@ -184,7 +219,7 @@ bool GlobalScheduler::YieldThreadAndBalanceLoad(Thread* yielding_thread) {
 
     Thread* next_thread = scheduled_queue[core_id].front(priority);
     Thread* winner = nullptr;
-    for (auto& thread : suggested_queue[core_id]) {
+    for (auto* thread : suggested_queue[core_id]) {
         const s32 source_core = thread->GetProcessorID();
         if (source_core >= 0) {
             if (current_threads[source_core] != nullptr) {
@@ -212,7 +247,7 @@ bool GlobalScheduler::YieldThreadAndBalanceLoad(Thread* yielding_thread) {
     }
 
     if (kernel.GetCurrentHostThreadID() != core_id) {
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
     }
 
     return AskForReselectionOrMarkRedundant(yielding_thread, winner);
@@ -224,7 +259,7 @@ bool GlobalScheduler::YieldThreadAndWaitForLoadBalancing(Thread* yielding_thread
     // etc.
     if (!yielding_thread->IsRunnable()) {
         // Normally this case shouldn't happen except for SetThreadActivity.
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
         return false;
     }
     Thread* winner = nullptr;
@@ -241,7 +276,7 @@ bool GlobalScheduler::YieldThreadAndWaitForLoadBalancing(Thread* yielding_thread
         for (std::size_t i = 0; i < current_threads.size(); i++) {
             current_threads[i] = scheduled_queue[i].empty() ? nullptr : scheduled_queue[i].front();
         }
-        for (auto& thread : suggested_queue[core_id]) {
+        for (auto* thread : suggested_queue[core_id]) {
             const s32 source_core = thread->GetProcessorID();
             if (source_core < 0 || thread == current_threads[source_core]) {
                 continue;
@@ -264,7 +299,7 @@ bool GlobalScheduler::YieldThreadAndWaitForLoadBalancing(Thread* yielding_thread
     }
 
     if (kernel.GetCurrentHostThreadID() != core_id) {
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
     }
 
     return AskForReselectionOrMarkRedundant(yielding_thread, winner);
@@ -288,7 +323,7 @@ void GlobalScheduler::PreemptThreads() {
         Thread* current_thread =
             scheduled_queue[core_id].empty() ? nullptr : scheduled_queue[core_id].front();
         Thread* winner = nullptr;
-        for (auto& thread : suggested_queue[core_id]) {
+        for (auto* thread : suggested_queue[core_id]) {
             const s32 source_core = thread->GetProcessorID();
             if (thread->GetPriority() != priority) {
                 continue;
@@ -318,7 +353,7 @@ void GlobalScheduler::PreemptThreads() {
         }
 
         if (current_thread != nullptr && current_thread->GetPriority() > priority) {
-            for (auto& thread : suggested_queue[core_id]) {
+            for (auto* thread : suggested_queue[core_id]) {
                 const s32 source_core = thread->GetProcessorID();
                 if (thread->GetPriority() < priority) {
                     continue;
@@ -347,7 +382,7 @@ void GlobalScheduler::PreemptThreads() {
             }
         }
 
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
     }
 }
 
@@ -378,34 +413,40 @@ void GlobalScheduler::EnableInterruptAndSchedule(u32 cores_pending_reschedule,
 void GlobalScheduler::Suggest(u32 priority, std::size_t core, Thread* thread) {
     ASSERT(is_locked);
     suggested_queue[core].add(thread, priority);
+    SetReselectionPending(core);
 }
 
 void GlobalScheduler::Unsuggest(u32 priority, std::size_t core, Thread* thread) {
     ASSERT(is_locked);
     suggested_queue[core].remove(thread, priority);
+    SetReselectionPending(core);
 }
 
 void GlobalScheduler::Schedule(u32 priority, std::size_t core, Thread* thread) {
     ASSERT(is_locked);
     ASSERT_MSG(thread->GetProcessorID() == s32(core), "Thread must be assigned to this core.");
     scheduled_queue[core].add(thread, priority);
+    SetReselectionPending(core);
 }
 
 void GlobalScheduler::SchedulePrepend(u32 priority, std::size_t core, Thread* thread) {
     ASSERT(is_locked);
     ASSERT_MSG(thread->GetProcessorID() == s32(core), "Thread must be assigned to this core.");
     scheduled_queue[core].add(thread, priority, false);
+    SetReselectionPending(core);
 }
 
 void GlobalScheduler::Reschedule(u32 priority, std::size_t core, Thread* thread) {
     ASSERT(is_locked);
     scheduled_queue[core].remove(thread, priority);
     scheduled_queue[core].add(thread, priority);
+    SetReselectionPending(core);
 }
 
 void GlobalScheduler::Unschedule(u32 priority, std::size_t core, Thread* thread) {
     ASSERT(is_locked);
     scheduled_queue[core].remove(thread, priority);
+    SetReselectionPending(core);
 }
 
 void GlobalScheduler::TransferToCore(u32 priority, s32 destination_core, Thread* thread) {
@@ -416,6 +457,9 @@ void GlobalScheduler::TransferToCore(u32 priority, s32 destination_core, Thread*
         return;
     }
     thread->SetProcessorID(destination_core);
+    if (source_core >= 0 && destination_core >= 0) {
+        ++stats.thread_migrations;
+    }
     if (source_core >= 0) {
         Unschedule(priority, static_cast<u32>(source_core), thread);
     }
@@ -434,7 +478,7 @@ bool GlobalScheduler::AskForReselectionOrMarkRedundant(Thread* current_thread,
         current_thread->IncrementYieldCount();
         return true;
     } else {
-        is_reselection_pending.store(true, std::memory_order_release);
+        SetReselectionPending();
         return false;
     }
 }
@@ -555,11 +599,21 @@ void GlobalScheduler::Lock() {
     if (current_thread == current_owner) {
         ++scope_lock;
     } else {
-        inner_lock.lock();
+        // Only time the wait when the fast path loses, so the uncontended path pays for a single
+        // clock read (taken below for the hold histogram).
+        if (!inner_lock.try_lock()) {
+            const auto wait_start = std::chrono::steady_clock::now();
+            inner_lock.lock();
+            ++stats.contended_acquisitions;
+            RecordLockDuration(stats.lock_wait_histogram,
+                               std::chrono::steady_clock::now() - wait_start);
+        }
         is_locked = true;
         current_owner = current_thread;
         ASSERT(current_owner != Core::EmuThreadHandle::InvalidHandle());
         scope_lock = 1;
+        ++stats.lock_acquisitions;
+        lock_acquire_time = std::chrono::steady_clock::now();
     }
 }
 
@@ -569,6 +623,13 @@ void GlobalScheduler::Unlock() {
         return;
     }
     u32 cores_pending_reschedule = SelectThreads();
+    for (u32 core = 0; core < Core::Hardware::NUM_CPU_CORES; core++) {
+        if (((cores_pending_reschedule >> core) & 1) != 0) {
+            ++stats.core_reschedules[core];
+        }
+    }
+    RecordLockDuration(stats.lock_hold_histogram,
+                       std::chrono::steady_clock::now() - lock_acquire_time);
     Core::EmuThreadHandle leaving_thread = current_owner;
     current_owner = Core::EmuThreadHandle::InvalidHandle();
     scope_lock = 1;
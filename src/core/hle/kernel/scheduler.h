@@ -5,15 +5,17 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <vector>
 
 #include "common/common_types.h"
-#include "common/multi_level_queue.h"
+#include "common/intrusive_multi_level_queue.h"
 #include "common/spin_lock.h"
 #include "core/hardware_properties.h"
 #include "core/hle/kernel/thread.h"
+#include "core/perf_stats.h"
 
 namespace Common {
 class Fiber;
@@ -113,12 +115,24 @@ public:
         return Core::Hardware::NUM_CPU_CORES;
     }
 
+    /// Marks all cores as needing thread reselection.
     void SetReselectionPending() {
-        is_reselection_pending.store(true, std::memory_order_release);
+        reselection_pending_cores.fetch_or(all_cores_mask, std::memory_order_release);
+    }
+
+    /// Marks a single core as needing thread reselection.
+    void SetReselectionPending(std::size_t core) {
+        reselection_pending_cores.fetch_or(1U << core, std::memory_order_release);
     }
 
     bool IsReselectionPending() const {
-        return is_reselection_pending.load(std::memory_order_acquire);
+        return reselection_pending_cores.load(std::memory_order_acquire) != 0;
+    }
+
+    /// Returns the lock contention and reschedule counters collected since boot. Only meaningful
+    /// once emulation has stopped; the counters are written under the scheduler lock.
+    const Core::SchedulerStatistics& GetStatistics() const {
+        return stats;
     }
 
     void Shutdown();
@@ -176,11 +190,21 @@ private:
     bool AskForReselectionOrMarkRedundant(Thread* current_thread, const Thread* winner);
 
     static constexpr u32 min_regular_priority = 2;
-    std::array<Common::MultiLevelQueue<Thread*, THREADPRIO_COUNT>, Core::Hardware::NUM_CPU_CORES>
+    static constexpr u32 all_cores_mask = (1U << Core::Hardware::NUM_CPU_CORES) - 1;
+    // Scheduled membership is exclusive to one core, so every scheduled queue shares link slot
+    // 0; a thread may be suggested on several cores at once, so each suggested queue gets its
+    // own slot. The slots are assigned in the constructor.
+    std::array<Common::IntrusiveMultiLevelQueue<Thread, THREADPRIO_COUNT>,
+               Core::Hardware::NUM_CPU_CORES>
         scheduled_queue;
-    std::array<Common::MultiLevelQueue<Thread*, THREADPRIO_COUNT>, Core::Hardware::NUM_CPU_CORES>
+    std::array<Common::IntrusiveMultiLevelQueue<Thread, THREADPRIO_COUNT>,
+               Core::Hardware::NUM_CPU_CORES>
         suggested_queue;
-    std::atomic<bool> is_reselection_pending{false};
+
+    // Bitmask of cores whose ready/suggested queues changed since the last SelectThreads pass.
+    // Cores that are not marked keep their previous selection, so scheduling operations on one
+    // core do not force reselection work for the others.
+    std::atomic<u32> reselection_pending_cores{0};
 
     // The priority levels at which the global scheduler preempts threads every 10 ms. They are
     // ordered from Core 0 to Core 3.
@@ -192,6 +216,11 @@ private:
     std::atomic<s64> scope_lock{};
     Core::EmuThreadHandle current_owner{Core::EmuThreadHandle::InvalidHandle()};
 
+    /// Contention and reschedule counters, written while holding the scheduler lock.
+    Core::SchedulerStatistics stats{};
+    /// Point the current outermost lock acquisition completed at, for the hold histogram.
+    std::chrono::steady_clock::time_point lock_acquire_time{};
+
     Common::SpinLock global_list_guard{};
 
     /// Lists all thread ids that aren't deleted/etc.
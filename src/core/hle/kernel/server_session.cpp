@@ -8,6 +8,7 @@
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/logging/log.h"
+#include "common/slab_allocator.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/hle/ipc_helpers.h"
@@ -31,10 +32,17 @@ ServerSession::~ServerSession() = default;
 ResultVal<std::shared_ptr<ServerSession>> ServerSession::Create(KernelCore& kernel,
                                                                 std::shared_ptr<Session> parent,
                                                                 std::string name) {
-    std::shared_ptr<ServerSession> session{std::make_shared<ServerSession>(kernel)};
+    std::shared_ptr<ServerSession> session{Common::MakeSlabShared<ServerSession>(kernel)};
 
+    // The event holds a raw context rather than the session itself; keeping a shared_ptr in the
+    // callback would make the session and its event own each other. Occurrences outliving the
+    // session are dropped through the event type's weak reference in the timing queue.
     session->request_event = Core::Timing::CreateEvent(
-        name, [session](u64 userdata, s64 cycles_late) { session->CompleteSyncRequest(); });
+        name,
+        [](std::uintptr_t context, u64, s64) {
+            reinterpret_cast<ServerSession*>(context)->CompleteSyncRequest();
+        },
+        reinterpret_cast<std::uintptr_t>(session.get()));
     session->name = std::move(name);
     session->parent = std::move(parent);
 
@@ -138,8 +146,13 @@ ResultCode ServerSession::HandleDomainSyncRequest(Kernel::HLERequestContext& con
 ResultCode ServerSession::QueueSyncRequest(std::shared_ptr<Thread> thread,
                                            Core::Memory::Memory& memory) {
     u32* cmd_buf{reinterpret_cast<u32*>(memory.GetPointer(thread->GetTLSAddress()))};
-    auto context =
-        std::make_shared<HLERequestContext>(kernel, memory, SharedFrom(this), std::move(thread));
+    std::shared_ptr<HLERequestContext> context;
+    if (free_contexts.TryPop(context)) {
+        context->Reset(SharedFrom(this), std::move(thread));
+    } else {
+        context = Common::MakeSlabShared<HLERequestContext>(kernel, memory, SharedFrom(this),
+                                                            std::move(thread));
+    }
 
     context->PopulateFromIncomingCommandBuffer(kernel.CurrentProcess()->GetHandleTable(), cmd_buf);
     request_queue.Push(std::move(context));
@@ -150,7 +163,8 @@ ResultCode ServerSession::QueueSyncRequest(std::shared_ptr<Thread> thread,
 ResultCode ServerSession::CompleteSyncRequest() {
     ASSERT(!request_queue.Empty());
 
-    auto& context = *request_queue.Front();
+    auto context_ptr = std::move(request_queue.Front());
+    auto& context = *context_ptr;
 
     ResultCode result = RESULT_SUCCESS;
     // If the session has been converted to a domain, handle the domain request
@@ -179,6 +193,14 @@ ResultCode ServerSession::CompleteSyncRequest() {
 
     request_queue.Pop();
 
+    // Recycle the context unless something else is still holding on to it, which happens when
+    // SleepClientThread keeps the request alive past this point. The Reset drops the references
+    // to the requesting thread and this session so a parked context does not pin them.
+    if (context_ptr.use_count() == 1) {
+        context_ptr->Reset(nullptr, nullptr);
+        free_contexts.TryPush(std::move(context_ptr));
+    }
+
     return result;
 }
 
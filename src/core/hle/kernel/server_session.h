@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/mpmc_queue.h"
 #include "common/threadsafe_queue.h"
 #include "core/hle/kernel/synchronization_object.h"
 #include "core/hle/result.h"
@@ -165,6 +166,10 @@ private:
 
     /// Queue of scheduled service requests
     Common::MPSCQueue<std::shared_ptr<Kernel::HLERequestContext>> request_queue;
+
+    /// Completed request contexts kept around so the next request on this session can reuse
+    /// their buffer storage instead of allocating a fresh context.
+    Common::MPMCQueue<std::shared_ptr<Kernel::HLERequestContext>, 4> free_contexts;
 };
 
 } // namespace Kernel
@@ -359,7 +359,7 @@ static ResultCode SendSyncRequest(Core::System& system, Handle handle) {
         {
             SchedulerLock lock(system.Kernel());
             auto* sync_object = thread->GetHLESyncObject();
-            sync_object->RemoveWaitingThread(SharedFrom(thread));
+            sync_object->RemoveWaitingThread(thread);
         }
 
         thread->InvokeHLECallback(SharedFrom(thread));
@@ -377,7 +377,7 @@ static ResultCode GetThreadId(Core::System& system, u64* thread_id, Handle threa
     LOG_TRACE(Kernel_SVC, "called thread=0x{:08X}", thread_handle);
 
     const auto& handle_table = system.Kernel().CurrentProcess()->GetHandleTable();
-    const std::shared_ptr<Thread> thread = handle_table.Get<Thread>(thread_handle);
+    const Thread* const thread = handle_table.GetRaw<Thread>(thread_handle);
     if (!thread) {
         LOG_ERROR(Kernel_SVC, "Thread handle does not exist, handle=0x{:08X}", thread_handle);
         return ERR_INVALID_HANDLE;
@@ -403,13 +403,13 @@ static ResultCode GetProcessId(Core::System& system, u64* process_id, Handle han
     LOG_DEBUG(Kernel_SVC, "called handle=0x{:08X}", handle);
 
     const auto& handle_table = system.Kernel().CurrentProcess()->GetHandleTable();
-    const std::shared_ptr<Process> process = handle_table.Get<Process>(handle);
+    const Process* const process = handle_table.GetRaw<Process>(handle);
     if (process) {
         *process_id = process->GetProcessID();
         return RESULT_SUCCESS;
     }
 
-    const std::shared_ptr<Thread> thread = handle_table.Get<Thread>(handle);
+    const Thread* const thread = handle_table.GetRaw<Thread>(handle);
     if (thread) {
         const Process* const owner_process = thread->GetOwnerProcess();
         if (!owner_process) {
@@ -1154,7 +1154,7 @@ static ResultCode GetThreadPriority(Core::System& system, u32* priority, Handle
     LOG_TRACE(Kernel_SVC, "called");
 
     const auto& handle_table = system.Kernel().CurrentProcess()->GetHandleTable();
-    const std::shared_ptr<Thread> thread = handle_table.Get<Thread>(handle);
+    const Thread* const thread = handle_table.GetRaw<Thread>(handle);
     if (!thread) {
         *priority = 0;
         LOG_ERROR(Kernel_SVC, "Thread handle does not exist, handle=0x{:08X}", handle);
@@ -1919,12 +1919,12 @@ static ResultCode ResetSignal(Core::System& system, Handle handle) {
 
     const auto& handle_table = system.Kernel().CurrentProcess()->GetHandleTable();
 
-    auto event = handle_table.Get<ReadableEvent>(handle);
+    auto* const event = handle_table.GetRaw<ReadableEvent>(handle);
     if (event) {
         return event->Reset();
     }
 
-    auto process = handle_table.Get<Process>(handle);
+    auto* const process = handle_table.GetRaw<Process>(handle);
     if (process) {
         return process->ClearSignalState();
     }
@@ -2120,13 +2120,13 @@ static ResultCode ClearEvent(Core::System& system, Handle handle) {
 
     const auto& handle_table = system.Kernel().CurrentProcess()->GetHandleTable();
 
-    auto writable_event = handle_table.Get<WritableEvent>(handle);
+    auto* const writable_event = handle_table.GetRaw<WritableEvent>(handle);
     if (writable_event) {
         writable_event->Clear();
         return RESULT_SUCCESS;
     }
 
-    auto readable_event = handle_table.Get<ReadableEvent>(handle);
+    auto* const readable_event = handle_table.GetRaw<ReadableEvent>(handle);
     if (readable_event) {
         readable_event->Clear();
         return RESULT_SUCCESS;
@@ -2144,7 +2144,7 @@ static ResultCode SignalEvent(Core::System& system, Handle handle) {
     LOG_DEBUG(Kernel_SVC, "called. Handle=0x{:08X}", handle);
 
     HandleTable& handle_table = system.Kernel().CurrentProcess()->GetHandleTable();
-    auto writable_event = handle_table.Get<WritableEvent>(handle);
+    auto* const writable_event = handle_table.GetRaw<WritableEvent>(handle);
 
     if (!writable_event) {
         LOG_ERROR(Kernel_SVC, "Non-existent writable event handle used (0x{:08X})", handle);
@@ -2363,7 +2363,7 @@ struct FunctionDef {
 };
 } // namespace
 
-static const FunctionDef SVC_Table_32[] = {
+static constexpr FunctionDef SVC_Table_32[] = {
     {0x00, nullptr, "Unknown"},
     {0x01, SvcWrap32<SetHeapSize32>, "SetHeapSize32"},
     {0x02, nullptr, "Unknown"},
@@ -2490,7 +2490,7 @@ static const FunctionDef SVC_Table_32[] = {
     {0x7B, nullptr, "TerminateProcess32"},
 };
 
-static const FunctionDef SVC_Table_64[] = {
+static constexpr FunctionDef SVC_Table_64[] = {
     {0x00, nullptr, "Unknown"},
     {0x01, SvcWrap64<SetHeapSize>, "SetHeapSize"},
     {0x02, nullptr, "SetMemoryPermission"},
@@ -2637,21 +2637,65 @@ static const FunctionDef* GetSVCInfo64(u32 func_num) {
     return &SVC_Table_64[func_num];
 }
 
+namespace {
+
+/// Dispatches the hottest 64-bit SVCs directly, saving the generic table's indirect call and the
+/// repeated Core::System register accessor trips of the SvcWrap64 marshallers. Must mirror the
+/// corresponding SVC_Table_64 entries.
+bool CallFastPath64(Core::System& system, u32 immediate) {
+    auto& arm = system.CurrentArmInterface();
+    switch (immediate) {
+    case 0x1A: // ArbitrateLock
+        arm.SetReg(0, ArbitrateLock(system, static_cast<Handle>(arm.GetReg(0)), arm.GetReg(1),
+                                    static_cast<Handle>(arm.GetReg(2)))
+                          .raw);
+        return true;
+    case 0x1B: // ArbitrateUnlock
+        arm.SetReg(0, ArbitrateUnlock(system, arm.GetReg(0)).raw);
+        return true;
+    case 0x1D: // SignalProcessWideKey
+        SignalProcessWideKey(system, arm.GetReg(0), static_cast<s32>(arm.GetReg(1)));
+        return true;
+    case 0x1E: // GetSystemTick
+        arm.SetReg(0, GetSystemTick(system));
+        return true;
+    case 0x21: // SendSyncRequest
+        arm.SetReg(0, SendSyncRequest(system, static_cast<Handle>(arm.GetReg(0))).raw);
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // Anonymous namespace
+
 void Call(Core::System& system, u32 immediate) {
     system.ExitDynarmicProfile();
     auto& kernel = system.Kernel();
     kernel.EnterSVCProfile();
 
-    const FunctionDef* info = system.CurrentProcess()->Is64BitProcess() ? GetSVCInfo64(immediate)
-                                                                        : GetSVCInfo32(immediate);
-    if (info) {
-        if (info->func) {
-            info->func(system);
-        } else {
-            LOG_CRITICAL(Kernel_SVC, "Unimplemented SVC function {}(..)", info->name);
+    if (system.CurrentProcess()->Is64BitProcess()) {
+        if (!CallFastPath64(system, immediate)) {
+            const FunctionDef* info = GetSVCInfo64(immediate);
+            if (info && info->func) {
+                info->func(system);
+            } else if (info) {
+                LOG_CRITICAL(Kernel_SVC, "Unimplemented SVC function {}(..)", info->name);
+            } else {
+                LOG_CRITICAL(Kernel_SVC, "Unknown SVC function 0x{:X}", immediate);
+            }
         }
     } else {
-        LOG_CRITICAL(Kernel_SVC, "Unknown SVC function 0x{:X}", immediate);
+        const FunctionDef* info = GetSVCInfo32(immediate);
+        if (info) {
+            if (info->func) {
+                info->func(system);
+            } else {
+                LOG_CRITICAL(Kernel_SVC, "Unimplemented SVC function {}(..)", info->name);
+            }
+        } else {
+            LOG_CRITICAL(Kernel_SVC, "Unknown SVC function 0x{:X}", immediate);
+        }
     }
 
     kernel.ExitSVCProfile();
@@ -21,7 +21,7 @@ void Synchronization::SignalObject(SynchronizationObject& obj) const {
     SchedulerLock lock(kernel);
     auto& time_manager = kernel.TimeManager();
     if (obj.IsSignaled()) {
-        for (auto thread : obj.GetWaitingThreads()) {
+        for (const auto& thread : obj.GetWaitingThreads()) {
             if (thread->GetSchedulingStatus() == ThreadSchedStatus::Paused) {
                 if (thread->GetStatus() != ThreadStatus::WaitHLEEvent) {
                     ASSERT(thread->GetStatus() == ThreadStatus::WaitSynch);
@@ -73,8 +73,11 @@ std::pair<ResultCode, Handle> Synchronization::WaitFor(
             return {ERR_SYNCHRONIZATION_CANCELED, InvalidHandle};
         }
 
+        // Take the shared reference once; guest frameworks routinely wait on dozens of handles
+        // and SharedFrom goes through the object's control block on every call.
+        auto shared_thread = SharedFrom(thread);
         for (auto& object : sync_objects) {
-            object->AddWaitingThread(SharedFrom(thread));
+            object->AddWaitingThread(shared_thread);
         }
 
         thread->SetSynchronizationObjects(&sync_objects);
@@ -94,20 +97,19 @@ std::pair<ResultCode, Handle> Synchronization::WaitFor(
         ResultCode signaling_result = thread->GetSignalingResult();
         SynchronizationObject* signaling_object = thread->GetSignalingObject();
         thread->SetSynchronizationObjects(nullptr);
-        auto shared_thread = SharedFrom(thread);
-        for (auto& obj : sync_objects) {
-            obj->RemoveWaitingThread(shared_thread);
+        // Unregister from every object's waiter list and recover the index of the object that
+        // woke us up in the same pass; the thread already knows which object signaled it.
+        s32 signaling_index = -1;
+        for (std::size_t i = 0; i < sync_objects.size(); ++i) {
+            sync_objects[i]->RemoveWaitingThread(thread);
+            if (sync_objects[i].get() == signaling_object) {
+                signaling_index = static_cast<s32>(i);
+            }
         }
         if (signaling_object != nullptr) {
-            const auto itr = std::find_if(
-                sync_objects.begin(), sync_objects.end(),
-                [signaling_object](const std::shared_ptr<SynchronizationObject>& object) {
-                    return object.get() == signaling_object;
-                });
-            ASSERT(itr != sync_objects.end());
+            ASSERT(signaling_index != -1);
             signaling_object->Acquire(thread);
-            const u32 index = static_cast<s32>(std::distance(sync_objects.begin(), itr));
-            return {signaling_result, index};
+            return {signaling_result, static_cast<u32>(signaling_index)};
         }
         return {signaling_result, -1};
     }
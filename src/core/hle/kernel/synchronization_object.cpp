@@ -29,13 +29,19 @@ void SynchronizationObject::AddWaitingThread(std::shared_ptr<Thread> thread) {
         waiting_threads.push_back(std::move(thread));
 }
 
-void SynchronizationObject::RemoveWaitingThread(std::shared_ptr<Thread> thread) {
-    auto itr = std::find(waiting_threads.begin(), waiting_threads.end(), thread);
+void SynchronizationObject::RemoveWaitingThread(Thread* thread) {
+    auto itr = std::find_if(
+        waiting_threads.begin(), waiting_threads.end(),
+        [thread](const std::shared_ptr<Thread>& waiter) { return waiter.get() == thread; });
     // If a thread passed multiple handles to the same object,
     // the kernel might attempt to remove the thread from the object's
     // waiting threads list multiple times.
-    if (itr != waiting_threads.end())
-        waiting_threads.erase(itr);
+    if (itr != waiting_threads.end()) {
+        // Waiters are woken independently of their position in the list, so the hole can be
+        // filled with the last entry instead of shifting everything after it.
+        *itr = std::move(waiting_threads.back());
+        waiting_threads.pop_back();
+    }
 }
 
 void SynchronizationObject::ClearWaitingThreads() {
@@ -11,6 +11,7 @@
 #include "common/common_types.h"
 #include "common/fiber.h"
 #include "common/logging/log.h"
+#include "common/slab_allocator.h"
 #include "common/thread_queue_list.h"
 #include "core/arm/arm_interface.h"
 #ifdef ARCHITECTURE_x86_64
@@ -190,7 +191,7 @@ ResultVal<std::shared_ptr<Thread>> Thread::Create(Core::System& system, ThreadTy
         }
     }
 
-    std::shared_ptr<Thread> thread = std::make_shared<Thread>(kernel);
+    std::shared_ptr<Thread> thread = Common::MakeSlabShared<Thread>(kernel);
 
     thread->thread_id = kernel.CreateNewThreadID();
     thread->status = ThreadStatus::Dormant;
@@ -318,8 +319,8 @@ void Thread::AddMutexWaiter(std::shared_ptr<Thread> thread) {
     if (thread->lock_owner.get() == this) {
         // If the thread is already waiting for this thread to release the mutex, ensure that the
         // waiters list is consistent and return without doing anything.
-        const auto iter = std::find(wait_mutex_threads.begin(), wait_mutex_threads.end(), thread);
-        ASSERT(iter != wait_mutex_threads.end());
+        DEBUG_ASSERT(std::find(wait_mutex_threads.begin(), wait_mutex_threads.end(), thread) !=
+                     wait_mutex_threads.end());
         return;
     }
 
@@ -327,13 +328,14 @@ void Thread::AddMutexWaiter(std::shared_ptr<Thread> thread) {
     ASSERT(thread->lock_owner == nullptr);
 
     // Ensure that the thread is not already in the list of mutex waiters
-    const auto iter = std::find(wait_mutex_threads.begin(), wait_mutex_threads.end(), thread);
-    ASSERT(iter == wait_mutex_threads.end());
-
-    // Keep the list in an ordered fashion
-    const auto insertion_point = std::find_if(
-        wait_mutex_threads.begin(), wait_mutex_threads.end(),
-        [&thread](const auto& entry) { return entry->GetPriority() > thread->GetPriority(); });
+    DEBUG_ASSERT(std::find(wait_mutex_threads.begin(), wait_mutex_threads.end(), thread) ==
+                 wait_mutex_threads.end());
+
+    // Keep the list in an ordered fashion. The list is sorted by priority, so a binary search
+    // finds the insertion point; equal priorities keep their FIFO order.
+    const auto insertion_point = std::upper_bound(
+        wait_mutex_threads.begin(), wait_mutex_threads.end(), thread->GetPriority(),
+        [](u32 priority, const auto& entry) { return priority < entry->GetPriority(); });
     wait_mutex_threads.insert(insertion_point, thread);
     thread->lock_owner = SharedFrom(this);
 
@@ -4,14 +4,17 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/intrusive_multi_level_queue.h"
 #include "common/spin_lock.h"
 #include "core/arm/arm_interface.h"
+#include "core/hardware_properties.h"
 #include "core/hle/kernel/object.h"
 #include "core/hle/kernel/synchronization_object.h"
 #include "core/hle/result.h"
@@ -388,7 +391,7 @@ public:
 
     void ClearSynchronizationObjects() {
         for (const auto& waiting_object : *wait_objects) {
-            waiting_object->RemoveWaitingThread(SharedFrom(this));
+            waiting_object->RemoveWaitingThread(this);
         }
         wait_objects->clear();
     }
@@ -509,6 +512,11 @@ public:
         return scheduling_state == static_cast<u32>(ThreadSchedStatus::Runnable);
     }
 
+    /// Link storage for the global scheduler's intrusive priority queues.
+    Common::IntrusiveMultiLevelQueueLink<Thread>& GetMultiLevelQueueLink(std::size_t slot) {
+        return scheduler_queue_links[slot];
+    }
+
     bool IsRunning() const {
         return is_running;
     }
@@ -656,6 +664,11 @@ private:
 
     Scheduler* scheduler = nullptr;
 
+    /// Queue links for the global scheduler: slot 0 threads the scheduled queue of whichever
+    /// core this thread is assigned to, slot 1 + core the suggested queue of each core.
+    std::array<Common::IntrusiveMultiLevelQueueLink<Thread>, Core::Hardware::NUM_CPU_CORES + 1>
+        scheduler_queue_links{};
+
     u32 ideal_core{0xFFFFFFFF};
     u64 affinity_mask{0x1};
 
@@ -16,16 +16,19 @@ namespace Kernel {
 
 TimeManager::TimeManager(Core::System& system_) : system{system_} {
     time_manager_event_type = Core::Timing::CreateEvent(
-        "Kernel::TimeManagerCallback", [this](u64 thread_handle, [[maybe_unused]] s64 cycles_late) {
-            SchedulerLock lock(system.Kernel());
+        "Kernel::TimeManagerCallback",
+        [](std::uintptr_t context, u64 thread_handle, [[maybe_unused]] s64 cycles_late) {
+            auto& time_manager = *reinterpret_cast<TimeManager*>(context);
+            SchedulerLock lock(time_manager.system.Kernel());
             Handle proper_handle = static_cast<Handle>(thread_handle);
-            if (cancelled_events[proper_handle]) {
+            if (time_manager.cancelled_events[proper_handle]) {
                 return;
             }
             std::shared_ptr<Thread> thread =
-                this->system.Kernel().RetrieveThreadFromGlobalHandleTable(proper_handle);
+                time_manager.system.Kernel().RetrieveThreadFromGlobalHandleTable(proper_handle);
             thread->OnWakeUp();
-        });
+        },
+        reinterpret_cast<std::uintptr_t>(this));
 }
 
 void TimeManager::ScheduleTimeEvent(Handle& event_handle, Thread* timetask, s64 nanoseconds) {
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include "common/slab_allocator.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/memory/page_table.h"
 #include "core/hle/kernel/process.h"
@@ -24,7 +25,7 @@ std::shared_ptr<TransferMemory> TransferMemory::Create(KernelCore& kernel,
                                                        VAddr base_address, std::size_t size,
                                                        Memory::MemoryPermission permissions) {
     std::shared_ptr<TransferMemory> transfer_memory{
-        std::make_shared<TransferMemory>(kernel, memory)};
+        Common::MakeSlabShared<TransferMemory>(kernel, memory)};
 
     transfer_memory->base_address = base_address;
     transfer_memory->size = size;
@@ -4,6 +4,9 @@
 
 #include <algorithm>
 #include <array>
+#include <map>
+#include <mutex>
+#include <vector>
 #include "common/common_paths.h"
 #include "common/common_types.h"
 #include "common/file_util.h"
@@ -44,6 +47,60 @@ static constexpr u32 SanitizeJPEGSize(std::size_t size) {
     return static_cast<u32>(std::min(size, max_jpeg_image_size));
 }
 
+namespace {
+
+/**
+ * Caches profile image files in memory, keyed by UUID and validated against the file's
+ * modification time. Titles poll GetImageSize/LoadImage repeatedly on menu screens, so serving
+ * the bytes from memory keeps those calls off the disk; an edited image is picked up through
+ * the mtime check on the next query.
+ */
+class ProfileImageCache {
+public:
+    /// Returns the image bytes for a profile, already clamped to the maximum JPEG size. Falls
+    /// back to the built-in backup image when the user has not provided one.
+    const std::vector<u8>& GetImage(Common::UUID uuid) {
+        const auto path = GetImagePath(uuid);
+        const u64 mtime = FileUtil::GetModificationTime(path);
+
+        std::lock_guard lock{cache_mutex};
+        const auto key = std::make_pair(uuid.uuid[0], uuid.uuid[1]);
+        auto& entry = cache[key];
+        if (entry.mtime == mtime && !entry.data.empty()) {
+            return entry.data;
+        }
+
+        const FileUtil::IOFile image(path, "rb");
+        if (!image.IsOpen()) {
+            LOG_WARNING(Service_ACC,
+                        "Failed to load user provided image! Falling back to built-in backup...");
+            entry.data.assign(Core::Constants::ACCOUNT_BACKUP_JPEG.begin(),
+                              Core::Constants::ACCOUNT_BACKUP_JPEG.end());
+        } else {
+            entry.data.resize(SanitizeJPEGSize(image.GetSize()));
+            image.ReadBytes(entry.data.data(), entry.data.size());
+        }
+        entry.mtime = mtime;
+        return entry.data;
+    }
+
+    static ProfileImageCache& Instance() {
+        static ProfileImageCache cache;
+        return cache;
+    }
+
+private:
+    struct CachedImage {
+        u64 mtime = 0;
+        std::vector<u8> data;
+    };
+
+    std::mutex cache_mutex;
+    std::map<std::pair<u64, u64>, CachedImage> cache;
+};
+
+} // Anonymous namespace
+
 class IManagerForSystemService final : public ServiceFramework<IManagerForSystemService> {
 public:
     explicit IManagerForSystemService(Common::UUID user_id)
@@ -320,21 +377,9 @@ protected:
         IPC::ResponseBuilder rb{ctx, 3};
         rb.Push(RESULT_SUCCESS);
 
-        const FileUtil::IOFile image(GetImagePath(user_id), "rb");
-        if (!image.IsOpen()) {
-            LOG_WARNING(Service_ACC,
-                        "Failed to load user provided image! Falling back to built-in backup...");
-            ctx.WriteBuffer(Core::Constants::ACCOUNT_BACKUP_JPEG);
-            rb.Push(SanitizeJPEGSize(Core::Constants::ACCOUNT_BACKUP_JPEG.size()));
-            return;
-        }
-
-        const u32 size = SanitizeJPEGSize(image.GetSize());
-        std::vector<u8> buffer(size);
-        image.ReadBytes(buffer.data(), buffer.size());
-
-        ctx.WriteBuffer(buffer.data(), buffer.size());
-        rb.Push<u32>(size);
+        const auto& image = ProfileImageCache::Instance().GetImage(user_id);
+        ctx.WriteBuffer(image.data(), image.size());
+        rb.Push(SanitizeJPEGSize(image.size()));
     }
 
     void GetImageSize(Kernel::HLERequestContext& ctx) {
@@ -342,15 +387,7 @@ protected:
         IPC::ResponseBuilder rb{ctx, 3};
         rb.Push(RESULT_SUCCESS);
 
-        const FileUtil::IOFile image(GetImagePath(user_id), "rb");
-
-        if (!image.IsOpen()) {
-            LOG_WARNING(Service_ACC,
-                        "Failed to load user provided image! Falling back to built-in backup...");
-            rb.Push(SanitizeJPEGSize(Core::Constants::ACCOUNT_BACKUP_JPEG.size()));
-        } else {
-            rb.Push(SanitizeJPEGSize(image.GetSize()));
-        }
+        rb.Push(SanitizeJPEGSize(ProfileImageCache::Instance().GetImage(user_id).size()));
     }
 
     void Store(Kernel::HLERequestContext& ctx) {
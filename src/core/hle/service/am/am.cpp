@@ -6,6 +6,7 @@
 #include <array>
 #include <cinttypes>
 #include <cstring>
+#include <mutex>
 #include "audio_core/audio_renderer.h"
 #include "core/core.h"
 #include "core/file_sys/control_metadata.h"
@@ -753,10 +754,64 @@ void ICommonStateGetter::SetCpuBoostMode(Kernel::HLERequestContext& ctx) {
 
 IStorageImpl::~IStorageImpl() = default;
 
+namespace {
+
+/**
+ * Recycles the heap allocations behind IStorage buffers. Applets create and destroy several
+ * storages per transaction, almost always with the same handful of sizes, so returning the
+ * buffers here instead of freeing them makes storage creation allocation-free in the steady
+ * state.
+ */
+class StorageBufferPool {
+public:
+    /// Returns a zeroed buffer of the requested size, reusing a pooled allocation if one fits.
+    std::vector<u8> Acquire(std::size_t size) {
+        {
+            std::lock_guard lock{pool_mutex};
+            if (!free_buffers.empty()) {
+                std::vector<u8> buffer = std::move(free_buffers.back());
+                free_buffers.pop_back();
+                buffer.clear();
+                buffer.resize(size);
+                return buffer;
+            }
+        }
+        return std::vector<u8>(size);
+    }
+
+    /// Returns a buffer's allocation to the pool once its storage is destroyed.
+    void Release(std::vector<u8>&& buffer) {
+        if (buffer.capacity() == 0) {
+            return;
+        }
+        std::lock_guard lock{pool_mutex};
+        if (free_buffers.size() < MAX_POOLED_BUFFERS) {
+            free_buffers.emplace_back(std::move(buffer));
+        }
+    }
+
+    static StorageBufferPool& Instance() {
+        static StorageBufferPool pool;
+        return pool;
+    }
+
+private:
+    static constexpr std::size_t MAX_POOLED_BUFFERS = 8;
+
+    std::mutex pool_mutex;
+    std::vector<std::vector<u8>> free_buffers;
+};
+
+} // Anonymous namespace
+
 class StorageDataImpl final : public IStorageImpl {
 public:
     explicit StorageDataImpl(std::vector<u8>&& buffer) : buffer{std::move(buffer)} {}
 
+    ~StorageDataImpl() override {
+        StorageBufferPool::Instance().Release(std::move(buffer));
+    }
+
     std::vector<u8>& GetData() override {
         return buffer;
     }
@@ -1003,7 +1058,9 @@ void IStorageAccessor::Write(Kernel::HLERequestContext& ctx) {
     IPC::RequestParser rp{ctx};
 
     const u64 offset{rp.Pop<u64>()};
-    const std::vector<u8> data{ctx.ReadBuffer()};
+    // Writes come straight out of the request's buffer view; staging them in a vector first
+    // would copy every interactive applet payload twice.
+    const auto data{ctx.ReadBufferView()};
 
     LOG_DEBUG(Service_AM, "called, offset={}, size={}", offset, data.size());
 
@@ -1091,7 +1148,7 @@ void ILibraryAppletCreator::CreateStorage(Kernel::HLERequestContext& ctx) {
     const u64 size{rp.Pop<u64>()};
     LOG_DEBUG(Service_AM, "called, size={}", size);
 
-    std::vector<u8> buffer(size);
+    std::vector<u8> buffer = StorageBufferPool::Instance().Acquire(size);
 
     IPC::ResponseBuilder rb{ctx, 2, 0, 1};
     rb.Push(RESULT_SUCCESS);
@@ -14,6 +14,7 @@
 #include "common/hex_util.h"
 #include "common/logging/log.h"
 #include "common/string_util.h"
+#include "common/thread.h"
 #include "core/file_sys/directory.h"
 #include "core/file_sys/errors.h"
 #include "core/file_sys/mode.h"
@@ -25,6 +26,9 @@
 #include "core/file_sys/vfs.h"
 #include "core/hle/ipc_helpers.h"
 #include "core/hle/kernel/process.h"
+#include "core/hle/kernel/thread.h"
+#include "core/hle/kernel/writable_event.h"
+#include "core/hle/lock.h"
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/hle/service/filesystem/fsp_srv.h"
 #include "core/reporter.h"
@@ -114,8 +118,8 @@ private:
 
 class IFile final : public ServiceFramework<IFile> {
 public:
-    explicit IFile(FileSys::VirtualFile backend_)
-        : ServiceFramework("IFile"), backend(std::move(backend_)) {
+    explicit IFile(FileSys::VirtualFile backend_, std::shared_ptr<FileSystemWorker> worker_)
+        : ServiceFramework("IFile"), backend(std::move(backend_)), worker(std::move(worker_)) {
         static const FunctionInfo functions[] = {
             {0, &IFile::Read, "Read"},       {1, &IFile::Write, "Write"},
             {2, &IFile::Flush, "Flush"},     {3, &IFile::SetSize, "SetSize"},
@@ -126,6 +130,7 @@ public:
 
 private:
     FileSys::VirtualFile backend;
+    std::shared_ptr<FileSystemWorker> worker;
 
     void Read(Kernel::HLERequestContext& ctx) {
         IPC::RequestParser rp{ctx};
@@ -150,15 +155,26 @@ private:
             return;
         }
 
-        // Read the data from the Storage backend
-        std::vector<u8> output = backend->ReadBytes(length, offset);
-
-        // Write the data to memory
-        ctx.WriteBuffer(output);
-
-        IPC::ResponseBuilder rb{ctx, 4};
-        rb.Push(RESULT_SUCCESS);
-        rb.Push(static_cast<u64>(output.size()));
+        // Run the backend read on the FS worker so the emulated core can schedule other
+        // threads while the host IO completes. Guest memory is only written from the wakeup
+        // callback, which runs back on the emulated core.
+        auto output = std::make_shared<std::vector<u8>>();
+        auto event = ctx.SleepClientThread(
+            "IFile::Read", UINT64_MAX,
+            [output](std::shared_ptr<Kernel::Thread> thread, Kernel::HLERequestContext& ctx,
+                     Kernel::ThreadWakeupReason reason) {
+                ctx.WriteBuffer(*output);
+
+                IPC::ResponseBuilder rb{ctx, 4};
+                rb.Push(RESULT_SUCCESS);
+                rb.Push(static_cast<u64>(output->size()));
+            });
+        worker->QueueWork([backend = backend, output, event, offset, length] {
+            *output = backend->ReadBytes(length, offset);
+
+            std::lock_guard lock{HLE::g_hle_lock};
+            event->Signal();
+        });
     }
 
     void Write(Kernel::HLERequestContext& ctx) {
@@ -184,7 +200,7 @@ private:
             return;
         }
 
-        const std::vector<u8> data = ctx.ReadBuffer();
+        const Kernel::BufferView data = ctx.ReadBufferView();
 
         ASSERT_MSG(
             static_cast<s64>(data.size()) <= length,
@@ -192,9 +208,8 @@ private:
             length, data.size());
 
         // Write the data to the Storage backend
-        const auto write_size =
-            static_cast<std::size_t>(std::distance(data.begin(), data.begin() + length));
-        const std::size_t written = backend->Write(data.data(), write_size, offset);
+        const std::size_t written =
+            backend->Write(data.data(), static_cast<std::size_t>(length), offset);
 
         ASSERT_MSG(static_cast<s64>(written) == length,
                    "Could not write all bytes to file (requested={:016X}, actual={:016X}).", length,
@@ -302,8 +317,10 @@ private:
 
 class IFileSystem final : public ServiceFramework<IFileSystem> {
 public:
-    explicit IFileSystem(FileSys::VirtualDir backend, SizeGetter size)
-        : ServiceFramework("IFileSystem"), backend(std::move(backend)), size(std::move(size)) {
+    explicit IFileSystem(FileSys::VirtualDir backend, SizeGetter size,
+                         std::shared_ptr<FileSystemWorker> worker_)
+        : ServiceFramework("IFileSystem"), backend(std::move(backend)), size(std::move(size)),
+          worker(std::move(worker_)) {
         static const FunctionInfo functions[] = {
             {0, &IFileSystem::CreateFile, "CreateFile"},
             {1, &IFileSystem::DeleteFile, "DeleteFile"},
@@ -420,7 +437,7 @@ public:
             return;
         }
 
-        auto file = std::make_shared<IFile>(result.Unwrap());
+        auto file = std::make_shared<IFile>(result.Unwrap(), worker);
 
         IPC::ResponseBuilder rb{ctx, 2, 0, 1};
         rb.Push(RESULT_SUCCESS);
@@ -496,6 +513,7 @@ public:
 private:
     VfsDirectoryServiceWrapper backend;
     SizeGetter size;
+    std::shared_ptr<FileSystemWorker> worker;
 };
 
 class ISaveDataInfoReader final : public ServiceFramework<ISaveDataInfoReader> {
@@ -650,8 +668,45 @@ private:
     u64 next_entry_index = 0;
 };
 
+FileSystemWorker::FileSystemWorker() : thread{&FileSystemWorker::Run, this} {}
+
+FileSystemWorker::~FileSystemWorker() {
+    {
+        std::lock_guard lock{mutex};
+        stopping = true;
+    }
+    cv.notify_one();
+    thread.join();
+}
+
+void FileSystemWorker::QueueWork(std::function<void()>&& work) {
+    {
+        std::lock_guard lock{mutex};
+        work_queue.push(std::move(work));
+    }
+    cv.notify_one();
+}
+
+void FileSystemWorker::Run() {
+    Common::SetCurrentThreadName("yuzu:FSWorker");
+
+    std::unique_lock lock{mutex};
+    while (true) {
+        cv.wait(lock, [this] { return stopping || !work_queue.empty(); });
+        if (stopping) {
+            return;
+        }
+        auto work{std::move(work_queue.front())};
+        work_queue.pop();
+        lock.unlock();
+        work();
+        lock.lock();
+    }
+}
+
 FSP_SRV::FSP_SRV(FileSystemController& fsc, const Core::Reporter& reporter)
-    : ServiceFramework("fsp-srv"), fsc(fsc), reporter(reporter) {
+    : ServiceFramework("fsp-srv"), fsc(fsc), worker(std::make_shared<FileSystemWorker>()),
+      reporter(reporter) {
     // clang-format off
     static const FunctionInfo functions[] = {
         {0, nullptr, "OpenFileSystem"},
@@ -801,8 +856,10 @@ void FSP_SRV::OpenFileSystemWithPatch(Kernel::HLERequestContext& ctx) {
 void FSP_SRV::OpenSdCardFileSystem(Kernel::HLERequestContext& ctx) {
     LOG_DEBUG(Service_FS, "called");
 
-    auto filesystem = std::make_shared<IFileSystem>(
-        fsc.OpenSDMC().Unwrap(), SizeGetter::FromStorageId(fsc, FileSys::StorageId::SdCard));
+    auto filesystem =
+        std::make_shared<IFileSystem>(fsc.OpenSDMC().Unwrap(),
+                                      SizeGetter::FromStorageId(fsc, FileSys::StorageId::SdCard),
+                                      worker);
 
     IPC::ResponseBuilder rb{ctx, 2, 0, 1};
     rb.Push(RESULT_SUCCESS);
@@ -853,8 +910,8 @@ void FSP_SRV::OpenSaveDataFileSystem(Kernel::HLERequestContext& ctx) {
         id = FileSys::StorageId::NandSystem;
     }
 
-    auto filesystem =
-        std::make_shared<IFileSystem>(std::move(dir.Unwrap()), SizeGetter::FromStorageId(fsc, id));
+    auto filesystem = std::make_shared<IFileSystem>(std::move(dir.Unwrap()),
+                                                    SizeGetter::FromStorageId(fsc, id), worker);
 
     IPC::ResponseBuilder rb{ctx, 2, 0, 1};
     rb.Push(RESULT_SUCCESS);
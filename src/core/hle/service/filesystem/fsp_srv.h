@@ -4,7 +4,12 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
 #include "core/hle/service/service.h"
 
 namespace Core {
@@ -30,6 +35,29 @@ enum class LogMode : u32 {
     LogToSdCard = Log | RedirectToSdCard,
 };
 
+/**
+ * Runs queued backend file IO on a dedicated thread so that large streaming reads overlap with
+ * emulation instead of stalling the emulated core that issued the IPC request. Completion is
+ * reported by signaling the wakeup event of the sleeping client thread.
+ */
+class FileSystemWorker {
+public:
+    FileSystemWorker();
+    ~FileSystemWorker();
+
+    /// Queues work to run on the worker thread, in submission order
+    void QueueWork(std::function<void()>&& work);
+
+private:
+    void Run();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::queue<std::function<void()>> work_queue;
+    bool stopping{};
+    std::thread thread;
+};
+
 class FSP_SRV final : public ServiceFramework<FSP_SRV> {
 public:
     explicit FSP_SRV(FileSystemController& fsc, const Core::Reporter& reporter);
@@ -53,6 +81,7 @@ private:
     void OpenMultiCommitManager(Kernel::HLERequestContext& ctx);
 
     FileSystemController& fsc;
+    std::shared_ptr<FileSystemWorker> worker;
 
     FileSys::VirtualFile romfs;
     u64 current_process_id = 0;
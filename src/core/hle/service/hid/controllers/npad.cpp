@@ -311,6 +311,7 @@ void Controller_NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing, u8*
                                std::size_t data_len) {
     if (!IsControllerActivated())
         return;
+    ConsumeVibrations();
     for (std::size_t i = 0; i < shared_memory_entries.size(); i++) {
         auto& npad = shared_memory_entries[i];
         const std::array<NPadGeneric*, 7> controller_npads{&npad.main_controller_states,
@@ -334,6 +335,9 @@ void Controller_NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing, u8*
 
             auto& cur_entry = main_controller->npad[main_controller->common.last_entry_index];
 
+            // Carry the previous state into the new ring slot, so an unchanged tick below only
+            // needs this header bump instead of repacking the whole entry
+            cur_entry = last_entry;
             cur_entry.timestamp = last_entry.timestamp + 1;
             cur_entry.timestamp2 = cur_entry.timestamp;
         }
@@ -347,6 +351,20 @@ void Controller_NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing, u8*
         RequestPadStateUpdate(npad_index);
         auto& pad_state = npad_pad_states[npad_index];
 
+        // The new ring slot already carries the previous state; when neither the pad state nor
+        // the controller type changed since the last tick, the packing below would write the
+        // same bytes again.
+        auto& last_state = last_pad_states[npad_index];
+        if (controller_type == last_connected_types[npad_index] &&
+            pad_state.pad_states.raw == last_state.pad_states.raw &&
+            std::memcmp(&pad_state.l_stick, &last_state.l_stick, sizeof(AnalogPosition)) == 0 &&
+            std::memcmp(&pad_state.r_stick, &last_state.r_stick, sizeof(AnalogPosition)) == 0) {
+            press_state |= static_cast<u32>(pad_state.pad_states.raw);
+            continue;
+        }
+        last_state = pad_state;
+        last_connected_types[npad_index] = controller_type;
+
         auto& main_controller =
             npad.main_controller_states.npad[npad.main_controller_states.common.last_entry_index];
         auto& handheld_entry =
@@ -507,15 +525,55 @@ void Controller_NPad::VibrateController(const std::vector<u32>& controller_ids,
     if (!can_controllers_vibrate) {
         return;
     }
-    for (std::size_t i = 0; i < controller_ids.size(); i++) {
-        std::size_t controller_pos = NPadIdToIndex(static_cast<u32>(i));
+    for (std::size_t i = 0; i < controller_ids.size() && i < vibrations.size(); i++) {
+        const std::size_t controller_pos = NPadIdToIndex(controller_ids[i]);
+        if (controller_pos >= vibration_slots.size()) {
+            continue;
+        }
         if (connected_controllers[controller_pos].is_connected) {
-            // TODO(ogniK): Vibrate the physical controller
+            PublishVibration(controller_pos, vibrations[i]);
         }
     }
     last_processed_vibration = vibrations.back();
 }
 
+void Controller_NPad::PublishVibration(std::size_t npad_index, const Vibration& vibration) {
+    auto& slot = vibration_slots[npad_index];
+    const u32 sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.latest = vibration;
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+void Controller_NPad::ConsumeVibrations() {
+    for (std::size_t i = 0; i < vibration_slots.size(); ++i) {
+        auto& slot = vibration_slots[i];
+        u32 sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence == consumed_vibration_sequences[i]) {
+            continue;
+        }
+        // Seqlock read: retry while the writer is mid-update or rewrote the slot under us.
+        Vibration vibration;
+        do {
+            if (sequence & 1) {
+                sequence = slot.sequence.load(std::memory_order_acquire);
+                continue;
+            }
+            vibration = slot.latest;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const u32 end_sequence = slot.sequence.load(std::memory_order_relaxed);
+            if (end_sequence == sequence) {
+                break;
+            }
+            sequence = end_sequence;
+        } while (true);
+        consumed_vibration_sequences[i] = sequence;
+        applied_vibrations[i] = vibration;
+        // TODO(ogniK): Vibrate the physical controller with applied_vibrations[i]
+    }
+}
+
 std::shared_ptr<Kernel::ReadableEvent> Controller_NPad::GetStyleSetChangedEvent(u32 npad_id) const {
     // TODO(ogniK): Figure out the best time to signal this event. This event seems that it should
     // be signalled at least once, and signaled after a new controller is connected?
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include "common/bit_field.h"
 #include "common/common_types.h"
 #include "core/frontend/input.h"
@@ -309,10 +310,21 @@ private:
         bool is_connected;
     };
 
+    /// Single-writer latest-value slot for vibration output. The IPC handlers publish into it
+    /// without blocking and the update tick consumes whatever is newest at its own cadence, so
+    /// per-frame rumble bursts never wait on the output side; intermediate values are
+    /// intentionally dropped. The sequence is odd while the payload is being rewritten (seqlock).
+    struct VibrationSlot {
+        std::atomic<u32> sequence{0};
+        Vibration latest{};
+    };
+
     void InitNewlyAddedControler(std::size_t controller_idx);
     bool IsControllerSupported(NPadControllerType controller) const;
     NPadControllerType DecideBestController(NPadControllerType priority) const;
     void RequestPadStateUpdate(u32 npad_id);
+    void PublishVibration(std::size_t npad_index, const Vibration& vibration);
+    void ConsumeVibrations();
 
     u32 press_state{};
 
@@ -331,10 +343,18 @@ private:
     // Each controller should have their own styleset changed event
     std::array<Kernel::EventPair, 10> styleset_changed_events;
     Vibration last_processed_vibration{};
+    std::array<VibrationSlot, 10> vibration_slots{};
+    /// Slot sequence each pad had when its value was last handed to the output side
+    std::array<u32, 10> consumed_vibration_sequences{};
+    /// Vibration value most recently handed to the output side, per pad
+    std::array<Vibration, 10> applied_vibrations{};
     std::array<ControllerHolder, 10> connected_controllers{};
     GyroscopeZeroDriftMode gyroscope_zero_drift_mode{GyroscopeZeroDriftMode::Standard};
     bool can_controllers_vibrate{true};
     std::array<ControllerPad, 10> npad_pad_states{};
+    /// Pad state and controller type each pad had on the previous tick, for change detection
+    std::array<ControllerPad, 10> last_pad_states{};
+    std::array<NPadControllerType, 10> last_connected_types{};
     bool is_in_lr_assignment_mode{false};
     Core::System& system;
 };
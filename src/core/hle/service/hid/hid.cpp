@@ -75,10 +75,12 @@ IAppletResource::IAppletResource(Core::System& system)
     GetController<Controller_Stubbed>(HidController::Unknown3).SetCommonHeaderOffset(0x5000);
 
     // Register update callbacks
-    pad_update_event =
-        Core::Timing::CreateEvent("HID::UpdatePadCallback", [this](u64 userdata, s64 ns_late) {
-            UpdateControllers(userdata, ns_late);
-        });
+    pad_update_event = Core::Timing::CreateEvent(
+        "HID::UpdatePadCallback",
+        [](std::uintptr_t context, u64 userdata, s64 ns_late) {
+            reinterpret_cast<IAppletResource*>(context)->UpdateControllers(userdata, ns_late);
+        },
+        reinterpret_cast<std::uintptr_t>(this));
 
     // TODO(shinyquagsire23): Other update callbacks? (accel, gyro?)
 
@@ -111,11 +113,12 @@ void IAppletResource::UpdateControllers(u64 userdata, s64 ns_late) {
     auto& core_timing = system.CoreTiming();
 
     const bool should_reload = Settings::values.is_device_reload_pending.exchange(false);
+    u8* const shared_memory = shared_mem->GetPointer();
     for (const auto& controller : controllers) {
         if (should_reload) {
             controller->OnLoadInputDevices();
         }
-        controller->OnUpdate(core_timing, shared_mem->GetPointer(), SHARED_MEMORY_SIZE);
+        controller->OnUpdate(core_timing, shared_memory, SHARED_MEMORY_SIZE);
     }
 
     core_timing.ScheduleEvent(pad_update_ticks - ns_late, pad_update_event);
@@ -514,7 +514,7 @@ public:
                                      header.segment_headers[DATA_INDEX].memory_size, nro_address});
 
         // Invalidate JIT caches for the newly mapped process code
-        system.InvalidateCpuInstructionCaches();
+        system.InvalidateCpuInstructionCacheRange(*map_result, nro_size + bss_size);
 
         IPC::ResponseBuilder rb{ctx, 4};
         rb.Push(RESULT_SUCCESS);
@@ -574,9 +574,10 @@ public:
             return;
         }
 
-        const auto result{UnmapNro(iter->second)};
+        const auto& info = iter->second;
+        const auto result{UnmapNro(info)};
 
-        system.InvalidateCpuInstructionCaches();
+        system.InvalidateCpuInstructionCacheRange(info.nro_address, info.nro_size + info.bss_size);
 
         nro.erase(iter);
 
@@ -12,6 +12,7 @@
 #include "common/file_util.h"
 #include "common/logging/log.h"
 #include "common/swap.h"
+#include "common/swap_bytes.h"
 #include "core/core.h"
 #include "core/file_sys/content_archive.h"
 #include "core/file_sys/nca_metadata.h"
@@ -81,9 +82,12 @@ static void DecryptSharedFont(const std::vector<u32>& input, Kernel::PhysicalMem
 
     const u32 KEY = input[0] ^ EXPECTED_RESULT; // Derive key using an inverse xor
     std::vector<u32> transformed_font(input.size());
-    // TODO(ogniK): Figure out a better way to do this
-    std::transform(input.begin(), input.end(), transformed_font.begin(),
-                   [&KEY](u32 font_data) { return Common::swap32(font_data ^ KEY); });
+    // swap32(x ^ KEY) == swap32(x) ^ swap32(KEY), so the whole font can go through the bulk
+    // byteswap and the key is folded in afterwards.
+    const u32 swapped_key = Common::swap32(KEY);
+    Common::SwapBytes32(input.data(), transformed_font.data(), input.size());
+    std::transform(transformed_font.begin(), transformed_font.end(), transformed_font.begin(),
+                   [swapped_key](u32 font_data) { return font_data ^ swapped_key; });
     transformed_font[1] = Common::swap32(transformed_font[1]) ^ KEY; // "re-encrypt" the size
     std::memcpy(output.data() + offset, transformed_font.data(),
                 transformed_font.size() * sizeof(u32));
@@ -212,8 +216,7 @@ PL_U::PL_U(Core::System& system)
         std::vector<u32> font_data_u32(font_fp->GetSize() / sizeof(u32));
         font_fp->ReadBytes<u32>(font_data_u32.data(), font_fp->GetSize());
         // We need to be BigEndian as u32s for the xor encryption
-        std::transform(font_data_u32.begin(), font_data_u32.end(), font_data_u32.begin(),
-                       Common::swap32);
+        Common::SwapBytes32(font_data_u32.data(), font_data_u32.data(), font_data_u32.size());
         // Font offset and size do not account for the header
         const FontRegion region{static_cast<u32>(offset + 8),
                                 static_cast<u32>((font_data_u32.size() * sizeof(u32)) - 8)};
@@ -39,7 +39,8 @@ public:
      * @param output A buffer where the output data will be written to.
      * @returns The result code of the ioctl.
      */
-    virtual u32 ioctl(Ioctl command, const std::vector<u8>& input, const std::vector<u8>& input2,
+    virtual u32 ioctl(Ioctl command, const Kernel::BufferView& input,
+                      const Kernel::BufferView& input2,
                       std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
                       IoctlVersion version) = 0;
 
@@ -20,7 +20,7 @@ public:
     explicit nvhost_as_gpu(Core::System& system, std::shared_ptr<nvmap> nvmap_dev);
     ~nvhost_as_gpu() override;
 
-    u32 ioctl(Ioctl command, const std::vector<u8>& input, const std::vector<u8>& input2,
+    u32 ioctl(Ioctl command, const Kernel::BufferView& input, const Kernel::BufferView& input2,
               std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
               IoctlVersion version) override;
 
@@ -117,13 +117,13 @@ private:
 
     u32 channel{};
 
-    u32 InitalizeEx(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 AllocateSpace(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 Remap(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 MapBufferEx(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 UnmapBuffer(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 BindChannel(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 GetVARegions(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 InitalizeEx(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 AllocateSpace(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 Remap(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 MapBufferEx(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 UnmapBuffer(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 BindChannel(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 GetVARegions(const Kernel::BufferView& input, std::vector<u8>& output);
 
     std::shared_ptr<nvmap> nvmap_dev;
 };
@@ -17,7 +17,7 @@ public:
     explicit nvhost_ctrl(Core::System& system, EventInterface& events_interface);
     ~nvhost_ctrl() override;
 
-    u32 ioctl(Ioctl command, const std::vector<u8>& input, const std::vector<u8>& input2,
+    u32 ioctl(Ioctl command, const Kernel::BufferView& input, const Kernel::BufferView& input2,
               std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
               IoctlVersion version) override;
 
@@ -133,16 +133,16 @@ private:
     };
     static_assert(sizeof(IocCtrlEventKill) == 8, "IocCtrlEventKill is incorrect size");
 
-    u32 NvOsGetConfigU32(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 NvOsGetConfigU32(const Kernel::BufferView& input, std::vector<u8>& output);
 
-    u32 IocCtrlEventWait(const std::vector<u8>& input, std::vector<u8>& output, bool is_async,
+    u32 IocCtrlEventWait(const Kernel::BufferView& input, std::vector<u8>& output, bool is_async,
                          IoctlCtrl& ctrl);
 
-    u32 IocCtrlEventRegister(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 IocCtrlEventRegister(const Kernel::BufferView& input, std::vector<u8>& output);
 
-    u32 IocCtrlEventUnregister(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 IocCtrlEventUnregister(const Kernel::BufferView& input, std::vector<u8>& output);
 
-    u32 IocCtrlEventSignal(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 IocCtrlEventSignal(const Kernel::BufferView& input, std::vector<u8>& output);
 
     EventInterface& events_interface;
 };
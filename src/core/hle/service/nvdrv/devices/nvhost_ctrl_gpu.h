@@ -16,7 +16,7 @@ public:
     explicit nvhost_ctrl_gpu(Core::System& system);
     ~nvhost_ctrl_gpu() override;
 
-    u32 ioctl(Ioctl command, const std::vector<u8>& input, const std::vector<u8>& input2,
+    u32 ioctl(Ioctl command, const Kernel::BufferView& input, const Kernel::BufferView& input2,
               std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
               IoctlVersion version) override;
 
@@ -159,17 +159,18 @@ private:
     };
     static_assert(sizeof(IoctlGetGpuTime) == 0x10, "IoctlGetGpuTime is incorrect size");
 
-    u32 GetCharacteristics(const std::vector<u8>& input, std::vector<u8>& output,
+    u32 GetCharacteristics(const Kernel::BufferView& input, std::vector<u8>& output,
                            std::vector<u8>& output2, IoctlVersion version);
-    u32 GetTPCMasks(const std::vector<u8>& input, std::vector<u8>& output, std::vector<u8>& output2,
+    u32 GetTPCMasks(const Kernel::BufferView& input, std::vector<u8>& output,
+                    std::vector<u8>& output2,
                     IoctlVersion version);
-    u32 GetActiveSlotMask(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 ZCullGetCtxSize(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 ZCullGetInfo(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 ZBCSetTable(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 ZBCQueryTable(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 FlushL2(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 GetGpuTime(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 GetActiveSlotMask(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 ZCullGetCtxSize(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 ZCullGetInfo(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 ZBCSetTable(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 ZBCQueryTable(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 FlushL2(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 GetGpuTime(const Kernel::BufferView& input, std::vector<u8>& output);
 };
 
 } // namespace Service::Nvidia::Devices
@@ -24,7 +24,7 @@ public:
     explicit nvhost_gpu(Core::System& system, std::shared_ptr<nvmap> nvmap_dev);
     ~nvhost_gpu() override;
 
-    u32 ioctl(Ioctl command, const std::vector<u8>& input, const std::vector<u8>& input2,
+    u32 ioctl(Ioctl command, const Kernel::BufferView& input, const Kernel::BufferView& input2,
               std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
               IoctlVersion version) override;
 
@@ -182,20 +182,20 @@ private:
     u32_le channel_priority{};
     u32_le channel_timeslice{};
 
-    u32 SetNVMAPfd(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 SetClientData(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 GetClientData(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 ZCullBind(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 SetErrorNotifier(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 SetChannelPriority(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 AllocGPFIFOEx2(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 AllocateObjectContext(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 SubmitGPFIFO(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 KickoffPB(const std::vector<u8>& input, std::vector<u8>& output,
-                  const std::vector<u8>& input2, IoctlVersion version);
-    u32 GetWaitbase(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 ChannelSetTimeout(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 ChannelSetTimeslice(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 SetNVMAPfd(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 SetClientData(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 GetClientData(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 ZCullBind(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 SetErrorNotifier(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 SetChannelPriority(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 AllocGPFIFOEx2(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 AllocateObjectContext(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 SubmitGPFIFO(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 KickoffPB(const Kernel::BufferView& input, std::vector<u8>& output,
+                  const Kernel::BufferView& input2, IoctlVersion version);
+    u32 GetWaitbase(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 ChannelSetTimeout(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 ChannelSetTimeslice(const Kernel::BufferView& input, std::vector<u8>& output);
 
     std::shared_ptr<nvmap> nvmap_dev;
     u32 assigned_syncpoints{};
@@ -22,7 +22,7 @@ public:
     /// Returns the allocated address of an nvmap object given its handle.
     VAddr GetObjectAddress(u32 handle) const;
 
-    u32 ioctl(Ioctl command, const std::vector<u8>& input, const std::vector<u8>& input2,
+    u32 ioctl(Ioctl command, const Kernel::BufferView& input, const Kernel::BufferView& input2,
               std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
               IoctlVersion version) override;
 
@@ -119,12 +119,12 @@ private:
     };
     static_assert(sizeof(IocGetIdParams) == 8, "IocGetIdParams has wrong size");
 
-    u32 IocCreate(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 IocAlloc(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 IocGetId(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 IocFromId(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 IocParam(const std::vector<u8>& input, std::vector<u8>& output);
-    u32 IocFree(const std::vector<u8>& input, std::vector<u8>& output);
+    u32 IocCreate(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 IocAlloc(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 IocGetId(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 IocFromId(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 IocParam(const Kernel::BufferView& input, std::vector<u8>& output);
+    u32 IocFree(const Kernel::BufferView& input, std::vector<u8>& output);
 };
 
 } // namespace Service::Nvidia::Devices
@@ -38,50 +38,61 @@ void NVDRV::IoctlBase(Kernel::HLERequestContext& ctx, IoctlVersion version) {
     u32 fd = rp.Pop<u32>();
     u32 command = rp.Pop<u32>();
 
-    /// Ioctl 3 has 2 outputs, first in the input params, second is the result
-    std::vector<u8> output(ctx.GetWriteBufferSize(0));
-    std::vector<u8> output2;
+    /// Ioctl 3 has 2 outputs, first in the input params, second is the result.
+    /// The scratch vectors are session members so repeated ioctls reuse their capacity.
+    ioctl_output.assign(ctx.GetWriteBufferSize(0), 0);
+    ioctl_output2.clear();
     if (version == IoctlVersion::Version3) {
-        output2.resize((ctx.GetWriteBufferSize(1)));
+        ioctl_output2.assign(ctx.GetWriteBufferSize(1), 0);
     }
 
     /// Ioctl2 has 2 inputs. It's used to pass data directly instead of providing a pointer.
     /// KickOfPB uses this
-    auto input = ctx.ReadBuffer(0);
+    const auto input = ctx.ReadBufferView(0);
 
-    std::vector<u8> input2;
+    Kernel::BufferView input2;
     if (version == IoctlVersion::Version2) {
-        input2 = ctx.ReadBuffer(1);
+        input2 = ctx.ReadBufferView(1);
     }
 
     IoctlCtrl ctrl{};
 
-    u32 result = nvdrv->Ioctl(fd, command, input, input2, output, output2, ctrl, version);
+    u32 result =
+        nvdrv->Ioctl(fd, command, input, input2, ioctl_output, ioctl_output2, ctrl, version);
 
     if (ctrl.must_delay) {
         ctrl.fresh_call = false;
-        ctx.SleepClientThread("NVServices::DelayedResponse", ctrl.timeout,
-                              [=](std::shared_ptr<Kernel::Thread> thread,
-                                  Kernel::HLERequestContext& ctx,
-                                  Kernel::ThreadWakeupReason reason) {
-                                  IoctlCtrl ctrl2{ctrl};
-                                  std::vector<u8> tmp_output = output;
-                                  std::vector<u8> tmp_output2 = output2;
-                                  u32 result = nvdrv->Ioctl(fd, command, input, input2, tmp_output,
-                                                            tmp_output2, ctrl2, version);
-                                  ctx.WriteBuffer(tmp_output, 0);
-                                  if (version == IoctlVersion::Version3) {
-                                      ctx.WriteBuffer(tmp_output2, 1);
-                                  }
-                                  IPC::ResponseBuilder rb{ctx, 3};
-                                  rb.Push(RESULT_SUCCESS);
-                                  rb.Push(result);
-                              },
-                              nvdrv->GetEventWriteable(ctrl.event_id));
+        // The views alias the request buffers, which do not outlive this call; the delayed
+        // retry has to stage its own copies of the inputs.
+        std::vector<u8> input_copy(input.begin(), input.end());
+        std::vector<u8> input2_copy(input2.begin(), input2.end());
+        std::vector<u8> output_copy = ioctl_output;
+        std::vector<u8> output2_copy = ioctl_output2;
+        ctx.SleepClientThread(
+            "NVServices::DelayedResponse", ctrl.timeout,
+            [this, fd, command, ctrl, version, input_copy, input2_copy, output_copy,
+             output2_copy](std::shared_ptr<Kernel::Thread> thread,
+                           Kernel::HLERequestContext& ctx, Kernel::ThreadWakeupReason reason) {
+                IoctlCtrl ctrl2{ctrl};
+                std::vector<u8> tmp_output = output_copy;
+                std::vector<u8> tmp_output2 = output2_copy;
+                const Kernel::BufferView tmp_input(input_copy.data(), input_copy.size());
+                const Kernel::BufferView tmp_input2(input2_copy.data(), input2_copy.size());
+                u32 result = nvdrv->Ioctl(fd, command, tmp_input, tmp_input2, tmp_output,
+                                          tmp_output2, ctrl2, version);
+                ctx.WriteBuffer(tmp_output, 0);
+                if (version == IoctlVersion::Version3) {
+                    ctx.WriteBuffer(tmp_output2, 1);
+                }
+                IPC::ResponseBuilder rb{ctx, 3};
+                rb.Push(RESULT_SUCCESS);
+                rb.Push(result);
+            },
+            nvdrv->GetEventWriteable(ctrl.event_id));
     } else {
-        ctx.WriteBuffer(output);
+        ctx.WriteBuffer(ioctl_output);
         if (version == IoctlVersion::Version3) {
-            ctx.WriteBuffer(output2, 1);
+            ctx.WriteBuffer(ioctl_output2, 1);
         }
     }
     IPC::ResponseBuilder rb{ctx, 3};
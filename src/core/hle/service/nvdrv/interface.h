@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include "core/hle/service/nvdrv/nvdrv.h"
 #include "core/hle/service/service.h"
 
@@ -38,6 +39,11 @@ private:
     std::shared_ptr<Module> nvdrv;
 
     u64 pid{};
+
+    /// Per-session output scratch buffers, reused across ioctls to avoid reallocating them on
+    /// every call.
+    std::vector<u8> ioctl_output;
+    std::vector<u8> ioctl_output2;
 };
 
 } // namespace Service::Nvidia
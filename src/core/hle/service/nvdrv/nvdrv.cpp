@@ -63,28 +63,37 @@ u32 Module::Open(const std::string& device_name) {
                device_name);
 
     auto device = devices[device_name];
-    const u32 fd = next_fd++;
 
-    open_files[fd] = std::move(device);
+    // Reuse the slot of a previously closed descriptor when one is available. Descriptor 0 is
+    // never handed out, matching the numbering the driver has always used.
+    if (open_files.empty()) {
+        open_files.emplace_back();
+    }
+    for (std::size_t fd = 1; fd < open_files.size(); ++fd) {
+        if (!open_files[fd]) {
+            open_files[fd] = std::move(device);
+            return static_cast<u32>(fd);
+        }
+    }
 
+    const u32 fd = static_cast<u32>(open_files.size());
+    open_files.push_back(std::move(device));
     return fd;
 }
 
-u32 Module::Ioctl(u32 fd, u32 command, const std::vector<u8>& input, const std::vector<u8>& input2,
+u32 Module::Ioctl(u32 fd, u32 command, const Kernel::BufferView& input,
+                  const Kernel::BufferView& input2,
                   std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
                   IoctlVersion version) {
-    auto itr = open_files.find(fd);
-    ASSERT_MSG(itr != open_files.end(), "Tried to talk to an invalid device");
+    ASSERT_MSG(fd < open_files.size() && open_files[fd], "Tried to talk to an invalid device");
 
-    auto& device = itr->second;
-    return device->ioctl({command}, input, input2, output, output2, ctrl, version);
+    return open_files[fd]->ioctl({command}, input, input2, output, output2, ctrl, version);
 }
 
 ResultCode Module::Close(u32 fd) {
-    auto itr = open_files.find(fd);
-    ASSERT_MSG(itr != open_files.end(), "Tried to talk to an invalid device");
+    ASSERT_MSG(fd < open_files.size() && open_files[fd], "Tried to talk to an invalid device");
 
-    open_files.erase(itr);
+    open_files[fd].reset();
 
     // TODO(flerovium): return correct result code if operation failed.
     return RESULT_SUCCESS;
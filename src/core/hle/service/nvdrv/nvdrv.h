@@ -106,7 +106,8 @@ public:
     /// Opens a device node and returns a file descriptor to it.
     u32 Open(const std::string& device_name);
     /// Sends an ioctl command to the specified file descriptor.
-    u32 Ioctl(u32 fd, u32 command, const std::vector<u8>& input, const std::vector<u8>& input2,
+    u32 Ioctl(u32 fd, u32 command, const Kernel::BufferView& input,
+              const Kernel::BufferView& input2,
               std::vector<u8>& output, std::vector<u8>& output2, IoctlCtrl& ctrl,
               IoctlVersion version);
     /// Closes a device file descriptor and returns operation success.
@@ -119,11 +120,9 @@ public:
     std::shared_ptr<Kernel::WritableEvent> GetEventWriteable(u32 event_id) const;
 
 private:
-    /// Id to use for the next open file descriptor.
-    u32 next_fd = 1;
-
-    /// Mapping of file descriptors to the devices they reference.
-    std::unordered_map<u32, std::shared_ptr<Devices::nvdevice>> open_files;
+    /// Open devices indexed directly by file descriptor; closed entries stay as null slots and
+    /// are reused by later opens. Ioctl dispatch is a bounds check and an array load.
+    std::vector<std::shared_ptr<Devices::nvdevice>> open_files;
 
     /// Mapping of device node names to their implementation.
     std::unordered_map<std::string, std::shared_ptr<Devices::nvdevice>> devices;
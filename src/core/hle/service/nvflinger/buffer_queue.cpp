@@ -24,63 +24,45 @@ BufferQueue::~BufferQueue() = default;
 void BufferQueue::SetPreallocatedBuffer(u32 slot, const IGBPBuffer& igbp_buffer) {
     LOG_WARNING(Service, "Adding graphics buffer {}", slot);
 
-    Buffer buffer{};
+    // Registration is serialized by the HLE lock; only the slot states and the queued-slot FIFO
+    // are touched concurrently.
+    Buffer& buffer = queue.emplace_back();
     buffer.slot = slot;
     buffer.igbp_buffer = igbp_buffer;
-    buffer.status = Buffer::Status::Free;
-    free_buffers.push_back(slot);
 
-    queue.emplace_back(buffer);
     buffer_wait_event.writable->Signal();
 }
 
 std::optional<std::pair<u32, Service::Nvidia::MultiFence*>> BufferQueue::DequeueBuffer(u32 width,
                                                                                        u32 height) {
+    for (Buffer& buffer : queue) {
+        // Only consider free buffers. Buffers become free once again after they've been
+        // Acquired and Released by the compositor, see the NVFlinger::Compose method.
+        if (buffer.status.load(std::memory_order_relaxed) != Buffer::Status::Free) {
+            continue;
+        }
 
-    if (free_buffers.empty()) {
-        return {};
-    }
-
-    auto f_itr = free_buffers.begin();
-    auto itr = queue.end();
-
-    while (f_itr != free_buffers.end()) {
-        auto slot = *f_itr;
-        itr = std::find_if(queue.begin(), queue.end(), [&](const Buffer& buffer) {
-            // Only consider free buffers. Buffers become free once again after they've been
-            // Acquired and Released by the compositor, see the NVFlinger::Compose method.
-            if (buffer.status != Buffer::Status::Free) {
-                return false;
-            }
-
-            if (buffer.slot != slot) {
-                return false;
-            }
-
-            // Make sure that the parameters match.
-            return buffer.igbp_buffer.width == width && buffer.igbp_buffer.height == height;
-        });
-
-        if (itr != queue.end()) {
-            free_buffers.erase(f_itr);
-            break;
+        // Make sure that the parameters match.
+        if (buffer.igbp_buffer.width != width || buffer.igbp_buffer.height != height) {
+            continue;
         }
-        ++f_itr;
-    }
 
-    if (itr == queue.end()) {
-        return {};
+        // Claim the slot. The acquire pairs with the release in ReleaseBuffer so the producer
+        // observes the compositor being done with the buffer contents.
+        Buffer::Status expected = Buffer::Status::Free;
+        if (buffer.status.compare_exchange_strong(expected, Buffer::Status::Dequeued,
+                                                  std::memory_order_acquire)) {
+            return {{buffer.slot, &buffer.multi_fence}};
+        }
     }
-
-    itr->status = Buffer::Status::Dequeued;
-    return {{itr->slot, &itr->multi_fence}};
+    return {};
 }
 
 const IGBPBuffer& BufferQueue::RequestBuffer(u32 slot) const {
     auto itr = std::find_if(queue.begin(), queue.end(),
                             [&](const Buffer& buffer) { return buffer.slot == slot; });
     ASSERT(itr != queue.end());
-    ASSERT(itr->status == Buffer::Status::Dequeued);
+    ASSERT(itr->status.load(std::memory_order_relaxed) == Buffer::Status::Dequeued);
     return itr->igbp_buffer;
 }
 
@@ -90,45 +72,50 @@ void BufferQueue::QueueBuffer(u32 slot, BufferTransformFlags transform,
     auto itr = std::find_if(queue.begin(), queue.end(),
                             [&](const Buffer& buffer) { return buffer.slot == slot; });
     ASSERT(itr != queue.end());
-    ASSERT(itr->status == Buffer::Status::Dequeued);
-    itr->status = Buffer::Status::Queued;
+    ASSERT(itr->status.load(std::memory_order_relaxed) == Buffer::Status::Dequeued);
     itr->transform = transform;
     itr->crop_rect = crop_rect;
     itr->swap_interval = swap_interval;
     itr->multi_fence = multi_fence;
-    queue_sequence.push_back(slot);
+    // Publish the payload before the compositor can observe the slot as queued
+    itr->status.store(Buffer::Status::Queued, std::memory_order_release);
+    queue_sequence.Push(slot);
 }
 
 std::optional<std::reference_wrapper<const BufferQueue::Buffer>> BufferQueue::AcquireBuffer() {
-    auto itr = queue.end();
-    // Iterate to find a queued buffer matching the requested slot.
-    while (itr == queue.end() && !queue_sequence.empty()) {
-        u32 slot = queue_sequence.front();
-        itr = std::find_if(queue.begin(), queue.end(), [&slot](const Buffer& buffer) {
-            return buffer.status == Buffer::Status::Queued && buffer.slot == slot;
-        });
-        queue_sequence.pop_front();
+    u32 slot;
+    while (queue_sequence.TryPop(slot)) {
+        const auto itr = std::find_if(queue.begin(), queue.end(),
+                                      [slot](const Buffer& buffer) { return buffer.slot == slot; });
+        if (itr == queue.end()) {
+            // The queue was disconnected between queueing and acquisition
+            continue;
+        }
+        Buffer::Status expected = Buffer::Status::Queued;
+        if (itr->status.compare_exchange_strong(expected, Buffer::Status::Acquired,
+                                                std::memory_order_acquire)) {
+            return *itr;
+        }
     }
-    if (itr == queue.end())
-        return {};
-    itr->status = Buffer::Status::Acquired;
-    return *itr;
+    return {};
 }
 
 void BufferQueue::ReleaseBuffer(u32 slot) {
     auto itr = std::find_if(queue.begin(), queue.end(),
                             [&](const Buffer& buffer) { return buffer.slot == slot; });
     ASSERT(itr != queue.end());
-    ASSERT(itr->status == Buffer::Status::Acquired);
-    itr->status = Buffer::Status::Free;
-    free_buffers.push_back(slot);
+    ASSERT(itr->status.load(std::memory_order_relaxed) == Buffer::Status::Acquired);
+    itr->status.store(Buffer::Status::Free, std::memory_order_release);
 
-    buffer_wait_event.writable->Signal();
+    // The compositor signals the wait event itself once every display has been composed,
+    // batching the guest wakeups; see NVFlinger::Compose.
 }
 
 void BufferQueue::Disconnect() {
     queue.clear();
-    queue_sequence.clear();
+    u32 ignored;
+    while (queue_sequence.TryPop(ignored)) {
+    }
     id = 1;
     layer_id = 1;
 }
@@ -4,12 +4,13 @@
 
 #pragma once
 
-#include <list>
+#include <atomic>
+#include <deque>
 #include <optional>
-#include <vector>
 
 #include "common/common_funcs.h"
 #include "common/math_util.h"
+#include "common/mpmc_queue.h"
 #include "common/swap.h"
 #include "core/hle/kernel/object.h"
 #include "core/hle/kernel/writable_event.h"
@@ -79,13 +80,15 @@ public:
     struct Buffer {
         enum class Status { Free = 0, Queued = 1, Dequeued = 2, Acquired = 3 };
 
-        u32 slot;
-        Status status = Status::Free;
-        IGBPBuffer igbp_buffer;
-        BufferTransformFlags transform;
-        Common::Rectangle<int> crop_rect;
-        u32 swap_interval;
-        Service::Nvidia::MultiFence multi_fence;
+        u32 slot = 0;
+        /// Lifecycle state of the slot. Transitions happen through compare-and-swap so the guest
+        /// producer and the compositor never serialize on a lock for queue state.
+        std::atomic<Status> status{Status::Free};
+        IGBPBuffer igbp_buffer{};
+        BufferTransformFlags transform{};
+        Common::Rectangle<int> crop_rect{};
+        u32 swap_interval = 0;
+        Service::Nvidia::MultiFence multi_fence{};
     };
 
     void SetPreallocatedBuffer(u32 slot, const IGBPBuffer& igbp_buffer);
@@ -109,12 +112,18 @@ public:
     std::shared_ptr<Kernel::ReadableEvent> GetBufferWaitEvent() const;
 
 private:
+    /// Capacity of the queued-slot FIFO; has to exceed the number of buffers any guest
+    /// preallocates on one queue.
+    static constexpr std::size_t MaxBufferSlots = 64;
+
     u32 id;
     u64 layer_id;
 
-    std::list<u32> free_buffers;
-    std::vector<Buffer> queue;
-    std::list<u32> queue_sequence;
+    /// Registered buffer slots. Stored in a deque so slot storage stays stable while the other
+    /// thread scans it; registration itself is serialized by the HLE lock.
+    std::deque<Buffer> queue;
+    /// Slots queued by the guest in submission order, drained by the compositor.
+    Common::MPMCQueue<u32, MaxBufferSlots> queue_sequence;
     Kernel::EventPair buffer_wait_event;
 };
 
@@ -16,6 +16,7 @@
 #include "core/hardware_properties.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/readable_event.h"
+#include "core/hle/kernel/writable_event.h"
 #include "core/hle/service/nvdrv/devices/nvdisp_disp0.h"
 #include "core/hle/service/nvdrv/nvdrv.h"
 #include "core/hle/service/nvflinger/buffer_queue.h"
@@ -67,14 +68,17 @@ NVFlinger::NVFlinger(Core::System& system) : system(system) {
     guard = std::make_shared<std::mutex>();
 
     // Schedule the screen composition events
-    composition_event =
-        Core::Timing::CreateEvent("ScreenComposition", [this](u64 userdata, s64 ns_late) {
-            Lock();
-            Compose();
-            const auto ticks = GetNextTicks();
-            this->system.CoreTiming().ScheduleEvent(std::max<s64>(0LL, ticks - ns_late),
-                                                    composition_event);
-        });
+    composition_event = Core::Timing::CreateEvent(
+        "ScreenComposition",
+        [](std::uintptr_t context, u64, s64 ns_late) {
+            auto& nvflinger = *reinterpret_cast<NVFlinger*>(context);
+            nvflinger.Lock();
+            nvflinger.Compose();
+            const auto ticks = nvflinger.GetNextTicks();
+            nvflinger.system.CoreTiming().ScheduleEvent(std::max<s64>(0LL, ticks - ns_late),
+                                                        nvflinger.composition_event);
+        },
+        reinterpret_cast<std::uintptr_t>(this));
     if (system.IsMulticore()) {
         is_running = true;
         wait_event = std::make_unique<Common::Event>();
@@ -218,6 +222,11 @@ const VI::Layer* NVFlinger::FindLayer(u64 display_id, u64 layer_id) const {
 }
 
 void NVFlinger::Compose() {
+    const u32 transactions = transaction_count.exchange(0, std::memory_order_relaxed);
+    if (transactions != 0) {
+        LOG_TRACE(Service, "Composing frame after {} buffer queue transactions", transactions);
+    }
+
     for (auto& display : displays) {
         // Trigger vsync for this display at the end of drawing
         SCOPE_EXIT({ display.SignalVSyncEvent(); });
@@ -262,7 +271,16 @@ void NVFlinger::Compose() {
 
         swap_interval = buffer->get().swap_interval;
         buffer_queue.ReleaseBuffer(buffer->get().slot);
+        pending_buffer_wakeups.push_back(buffer_queue.GetWritableBufferWaitEvent());
+    }
+
+    // Wake the guest threads waiting on the released buffers only after every display has been
+    // composed. Each display owns its queue, so there is one wakeup per queue and the guest is
+    // not woken mid-composition just to contend on the lock.
+    for (const auto& wait_event : pending_buffer_wakeups) {
+        wait_event->Signal();
     }
+    pending_buffer_wakeups.clear();
 }
 
 s64 NVFlinger::GetNextTicks() const {
@@ -84,6 +84,11 @@ public:
     /// finished.
     void Compose();
 
+    /// Counts a buffer queue transaction towards the per-frame statistics.
+    void CountBufferQueueTransaction() {
+        transaction_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
     s64 GetNextTicks() const;
 
     std::unique_lock<std::mutex> Lock() {
@@ -112,6 +117,10 @@ private:
     std::vector<VI::Display> displays;
     std::vector<BufferQueue> buffer_queues;
 
+    /// Buffer wait events to signal once every display has been composed; kept as a member so
+    /// composition does not allocate every frame.
+    std::vector<std::shared_ptr<Kernel::WritableEvent>> pending_buffer_wakeups;
+
     /// Id to use for the next layer that is created, this counter is shared among all displays.
     u64 next_layer_id = 1;
     /// Id to use for the next buffer queue that is created, this counter is shared among all
@@ -120,6 +129,10 @@ private:
 
     u32 swap_interval = 1;
 
+    /// Number of buffer queue transactions since the last composition, used to monitor how chatty
+    /// the guest compositor is.
+    std::atomic<u32> transaction_count{};
+
     /// Event that handles screen composition.
     std::shared_ptr<Core::Timing::EventType> composition_event;
 
@@ -3,9 +3,11 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <chrono>
 #include <fmt/format.h>
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "common/microprofile.h"
 #include "common/string_util.h"
 #include "core/core.h"
 #include "core/hle/ipc.h"
@@ -59,6 +61,7 @@
 #include "core/hle/service/psc/psc.h"
 #include "core/hle/service/ptm/psm.h"
 #include "core/hle/service/service.h"
+#include "core/hle/service/service_trace.h"
 #include "core/hle/service/set/settings.h"
 #include "core/hle/service/sm/sm.h"
 #include "core/hle/service/sockets/sockets.h"
@@ -70,6 +73,8 @@
 #include "core/hle/service/wlan/wlan.h"
 #include "core/reporter.h"
 
+MICROPROFILE_DEFINE(Service_HLERequest, "HLE Service", "Request", MP_RGB(200, 140, 70));
+
 namespace Service {
 
 /**
@@ -93,7 +98,8 @@ namespace Service {
 
 ServiceFrameworkBase::ServiceFrameworkBase(const char* service_name, u32 max_sessions,
                                            InvokerFn* handler_invoker)
-    : service_name(service_name), max_sessions(max_sessions), handler_invoker(handler_invoker) {}
+    : service_name(service_name), service_name_cstr(service_name), max_sessions(max_sessions),
+      handler_invoker(handler_invoker) {}
 
 ServiceFrameworkBase::~ServiceFrameworkBase() = default;
 
@@ -134,6 +140,23 @@ void ServiceFrameworkBase::RegisterHandlersBase(const FunctionInfoBase* function
         // Usually this array is sorted by id already, so hint to insert at the end
         handlers.emplace_hint(handlers.cend(), functions[i].expected_header, functions[i]);
     }
+
+    // Interfaces mostly use small command ids, but a few (am, prepo, vi) register ids in the ten
+    // thousands; capping the table keeps those from inflating every instance.
+    static constexpr u32 dense_dispatch_limit = 0x100;
+
+    // The handler map reallocates on insertion, so the table has to be rebuilt from scratch after
+    // every registration. The map is sorted by command id.
+    dense_handlers.clear();
+    for (const auto& [expected_header, info] : handlers) {
+        if (expected_header >= dense_dispatch_limit) {
+            break;
+        }
+        if (dense_handlers.size() <= expected_header) {
+            dense_handlers.resize(expected_header + 1, nullptr);
+        }
+        dense_handlers[expected_header] = &info;
+    }
 }
 
 void ServiceFrameworkBase::ReportUnimplementedFunction(Kernel::HLERequestContext& ctx,
@@ -155,13 +178,45 @@ void ServiceFrameworkBase::ReportUnimplementedFunction(Kernel::HLERequestContext
 }
 
 void ServiceFrameworkBase::InvokeRequest(Kernel::HLERequestContext& ctx) {
-    auto itr = handlers.find(ctx.GetCommand());
-    const FunctionInfoBase* info = itr == handlers.end() ? nullptr : &itr->second;
+    MICROPROFILE_SCOPE(Service_HLERequest);
+
+    const u32 command = ctx.GetCommand();
+    const FunctionInfoBase* info;
+    if (command < dense_handlers.size()) {
+        info = dense_handlers[command];
+    } else {
+        const auto itr = handlers.find(command);
+        info = itr == handlers.end() ? nullptr : &itr->second;
+    }
     if (info == nullptr || info->handler_callback == nullptr) {
         return ReportUnimplementedFunction(ctx, info);
     }
 
     LOG_TRACE(Service, "{}", MakeFunctionString(info->name, GetServiceName(), ctx.CommandBuffer()));
+    if (IPCTrace::IsEnabled()) {
+        const auto start = std::chrono::steady_clock::now();
+        handler_invoker(this, info->handler_callback, ctx);
+        const auto duration = std::chrono::steady_clock::now() - start;
+        std::size_t transferred_bytes = IPC::COMMAND_BUFFER_LENGTH * sizeof(u32);
+        for (const auto& buffer : ctx.BufferDescriptorA()) {
+            transferred_bytes += buffer.Size();
+        }
+        for (const auto& buffer : ctx.BufferDescriptorB()) {
+            transferred_bytes += buffer.Size();
+        }
+        for (const auto& buffer : ctx.BufferDescriptorX()) {
+            transferred_bytes += buffer.Size();
+        }
+        for (const auto& buffer : ctx.BufferDescriptorC()) {
+            transferred_bytes += buffer.Size();
+        }
+        IPCTrace::RecordRequest(
+            service_name_cstr, info->name,
+            static_cast<u64>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()),
+            transferred_bytes);
+        return;
+    }
     handler_invoker(this, info->handler_callback, ctx);
 }
 
@@ -259,6 +314,7 @@ void Init(std::shared_ptr<SM::ServiceManager>& sm, Core::System& system) {
 
 /// Shutdown ServiceManager
 void Shutdown() {
+    IPCTrace::DumpSummary();
     LOG_DEBUG(Service, "shutdown OK");
 }
 } // namespace Service
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 #include <boost/container/flat_map.hpp>
 #include "common/common_types.h"
 #include "core/hle/kernel/hle_ipc.h"
@@ -97,6 +98,8 @@ private:
 
     /// Identifier string used to connect to the service.
     std::string service_name;
+    /// The static name literal the service was constructed with, used by the IPC trace.
+    const char* service_name_cstr;
     /// Maximum number of concurrent sessions that this service can handle.
     u32 max_sessions;
 
@@ -107,6 +110,9 @@ private:
     /// Function used to safely up-cast pointers to the derived class before invoking a handler.
     InvokerFn* handler_invoker;
     boost::container::flat_map<u32, FunctionInfoBase> handlers;
+    /// Dispatch table indexed directly by command id for the low command ids most requests use,
+    /// rebuilt from the handler map on registration. Entries point into the handler map.
+    std::vector<const FunctionInfoBase*> dense_handlers;
 };
 
 /**
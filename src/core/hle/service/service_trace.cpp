@@ -0,0 +1,176 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/bit_util.h"
+#include "common/logging/log.h"
+#include "common/spin_lock.h"
+#include "core/hle/service/service_trace.h"
+#include "core/settings.h"
+
+namespace Service::IPCTrace {
+namespace {
+
+constexpr std::size_t NUM_LATENCY_BUCKETS = 32;
+constexpr std::size_t NUM_SUMMARY_ENTRIES = 20;
+
+/// Accumulated figures for one (service, command) pair.
+struct CommandStats {
+    u64 count = 0;
+    u64 total_ns = 0;
+    u64 min_ns = std::numeric_limits<u64>::max();
+    u64 max_ns = 0;
+    u64 transferred_bytes = 0;
+    /// Bucket N counts requests that took [2^N, 2^(N+1)) nanoseconds.
+    std::array<u64, NUM_LATENCY_BUCKETS> latency_histogram{};
+
+    void Record(u64 duration_ns, std::size_t bytes) {
+        ++count;
+        total_ns += duration_ns;
+        min_ns = std::min(min_ns, duration_ns);
+        max_ns = std::max(max_ns, duration_ns);
+        transferred_bytes += bytes;
+        const u32 bucket = 63 - Common::CountLeadingZeroes64(duration_ns | 1);
+        ++latency_histogram[std::min<std::size_t>(bucket, NUM_LATENCY_BUCKETS - 1)];
+    }
+
+    void Merge(const CommandStats& other) {
+        count += other.count;
+        total_ns += other.total_ns;
+        min_ns = std::min(min_ns, other.min_ns);
+        max_ns = std::max(max_ns, other.max_ns);
+        transferred_bytes += other.transferred_bytes;
+        for (std::size_t i = 0; i < NUM_LATENCY_BUCKETS; ++i) {
+            latency_histogram[i] += other.latency_histogram[i];
+        }
+    }
+};
+
+/// Keys a shard entry by the service and function name pointers. The names come from static
+/// tables, so pointer identity suffices on the recording path; the shutdown merge folds
+/// duplicate pointers by content.
+struct CommandKey {
+    const char* service;
+    const char* function;
+
+    bool operator==(const CommandKey& other) const {
+        return service == other.service && function == other.function;
+    }
+};
+
+struct CommandKeyHash {
+    std::size_t operator()(const CommandKey& key) const {
+        const std::size_t hash = std::hash<const void*>()(key.service);
+        return hash * 31 + std::hash<const void*>()(key.function);
+    }
+};
+
+/// Per-thread accumulation shard. The spin lock is uncontended while recording; the only other
+/// acquirer is the shutdown merge.
+struct Shard {
+    Common::SpinLock lock;
+    std::unordered_map<CommandKey, CommandStats, CommandKeyHash> entries;
+};
+
+std::mutex shard_registry_mutex;
+
+std::vector<std::unique_ptr<Shard>>& GetShardRegistry() {
+    static std::vector<std::unique_ptr<Shard>> registry;
+    return registry;
+}
+
+Shard& GetThreadShard() {
+    thread_local Shard* const shard = [] {
+        auto new_shard = std::make_unique<Shard>();
+        Shard* const ptr = new_shard.get();
+        std::lock_guard lock{shard_registry_mutex};
+        GetShardRegistry().push_back(std::move(new_shard));
+        return ptr;
+    }();
+    return *shard;
+}
+
+/// Upper bound in nanoseconds of the histogram bucket the given percentile falls into.
+u64 ApproximatePercentile(const CommandStats& stats, double fraction) {
+    const u64 target = static_cast<u64>(static_cast<double>(stats.count) * fraction);
+    u64 seen = 0;
+    for (std::size_t bucket = 0; bucket < NUM_LATENCY_BUCKETS; ++bucket) {
+        seen += stats.latency_histogram[bucket];
+        if (seen > target) {
+            return u64{1} << (bucket + 1);
+        }
+    }
+    return stats.max_ns;
+}
+
+} // Anonymous namespace
+
+bool IsEnabled() {
+    return Settings::values.enable_ipc_trace;
+}
+
+void RecordRequest(const char* service_name, const char* function_name, u64 duration_ns,
+                   std::size_t transferred_bytes) {
+    Shard& shard = GetThreadShard();
+    std::lock_guard lock{shard.lock};
+    shard.entries[CommandKey{service_name, function_name}].Record(duration_ns, transferred_bytes);
+}
+
+void DumpSummary() {
+    // Fold the per-thread shards by name content; distinct instances of the same interface
+    // record through distinct pointers but belong to the same line in the summary.
+    std::map<std::pair<std::string_view, std::string_view>, CommandStats> merged;
+    {
+        std::lock_guard registry_lock{shard_registry_mutex};
+        for (const auto& shard : GetShardRegistry()) {
+            std::lock_guard shard_lock{shard->lock};
+            for (const auto& [key, stats] : shard->entries) {
+                merged[{key.service, key.function}].Merge(stats);
+            }
+            shard->entries.clear();
+        }
+    }
+    if (merged.empty()) {
+        return;
+    }
+
+    std::vector<std::pair<std::pair<std::string_view, std::string_view>, CommandStats>> sorted(
+        merged.begin(), merged.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.total_ns > rhs.second.total_ns;
+    });
+
+    u64 total_calls = 0;
+    u64 total_ns = 0;
+    for (const auto& [name, stats] : sorted) {
+        total_calls += stats.count;
+        total_ns += stats.total_ns;
+    }
+    LOG_INFO(Service, "IPC trace: {} requests, {:.3f} ms total, by time spent:", total_calls,
+             static_cast<double>(total_ns) / 1e6);
+    const std::size_t num_entries = std::min(sorted.size(), NUM_SUMMARY_ENTRIES);
+    for (std::size_t i = 0; i < num_entries; ++i) {
+        const auto& [name, stats] = sorted[i];
+        LOG_INFO(Service,
+                 "  {}:{}: {} calls, {:.3f} ms total, {:.1f} us avg, ~{:.1f} us p95, "
+                 "{:.1f} us max, {} KiB",
+                 name.first, name.second, stats.count,
+                 static_cast<double>(stats.total_ns) / 1e6,
+                 static_cast<double>(stats.total_ns) / static_cast<double>(stats.count) / 1e3,
+                 static_cast<double>(ApproximatePercentile(stats, 0.95)) / 1e3,
+                 static_cast<double>(stats.max_ns) / 1e3, stats.transferred_bytes / 1024);
+    }
+}
+
+} // namespace Service::IPCTrace
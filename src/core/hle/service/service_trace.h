@@ -0,0 +1,28 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace Service::IPCTrace {
+
+/// Returns true when the IPC trace was enabled in the debugging settings.
+bool IsEnabled();
+
+/**
+ * Records one dispatched IPC request. Both names must have static lifetime, which holds for the
+ * service name literals and the generated function tables. Recording writes to a per-thread
+ * shard, so concurrent cores never contend with each other.
+ */
+void RecordRequest(const char* service_name, const char* function_name, u64 duration_ns,
+                   std::size_t transferred_bytes);
+
+/// Merges all per-thread shards, logs a summary of the most expensive (service, command) pairs
+/// and resets the recorded figures. Called once per session from Service::Shutdown.
+void DumpSummary();
+
+} // namespace Service::IPCTrace
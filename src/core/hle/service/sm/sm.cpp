@@ -53,7 +53,8 @@ ResultVal<std::shared_ptr<Kernel::ServerPort>> ServiceManager::RegisterService(
 
     CASCADE_CODE(ValidateServiceName(name));
 
-    if (registered_services.find(name) != registered_services.end()) {
+    const u64 key = EncodeServiceName(name);
+    if (registered_services.find(key) != registered_services.end()) {
         LOG_ERROR(Service_SM, "Service is already registered! service={}", name);
         return ERR_ALREADY_REGISTERED;
     }
@@ -62,14 +63,14 @@ ResultVal<std::shared_ptr<Kernel::ServerPort>> ServiceManager::RegisterService(
     auto [server_port, client_port] =
         Kernel::ServerPort::CreatePortPair(kernel, max_sessions, name);
 
-    registered_services.emplace(std::move(name), std::move(client_port));
+    registered_services.emplace(key, std::move(client_port));
     return MakeResult(std::move(server_port));
 }
 
 ResultCode ServiceManager::UnregisterService(const std::string& name) {
     CASCADE_CODE(ValidateServiceName(name));
 
-    const auto iter = registered_services.find(name);
+    const auto iter = registered_services.find(EncodeServiceName(name));
     if (iter == registered_services.end()) {
         LOG_ERROR(Service_SM, "Server is not registered! service={}", name);
         return ERR_SERVICE_NOT_REGISTERED;
@@ -82,7 +83,7 @@ ResultVal<std::shared_ptr<Kernel::ClientPort>> ServiceManager::GetServicePort(
     const std::string& name) {
 
     CASCADE_CODE(ValidateServiceName(name));
-    auto it = registered_services.find(name);
+    auto it = registered_services.find(EncodeServiceName(name));
     if (it == registered_services.end()) {
         LOG_ERROR(Service_SM, "Server is not registered! service={}", name);
         return ERR_SERVICE_NOT_REGISTERED;
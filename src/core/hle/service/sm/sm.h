@@ -6,9 +6,11 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <unordered_map>
 
+#include "common/common_types.h"
 #include "core/hle/kernel/client_port.h"
 #include "core/hle/kernel/object.h"
 #include "core/hle/kernel/server_port.h"
@@ -56,11 +58,21 @@ public:
     ResultVal<std::shared_ptr<Kernel::ClientPort>> GetServicePort(const std::string& name);
     ResultVal<std::shared_ptr<Kernel::ClientSession>> ConnectToService(const std::string& name);
 
+    /// Packs a service name (at most eight characters) into the u64 key the registry is indexed
+    /// by, avoiding string hashing and allocation on every lookup.
+    static constexpr u64 EncodeServiceName(std::string_view name) {
+        u64 key = 0;
+        for (std::size_t i = 0; i < name.size() && i < 8; ++i) {
+            key |= static_cast<u64>(static_cast<u8>(name[i])) << (i * 8);
+        }
+        return key;
+    }
+
     template <typename T>
     std::shared_ptr<T> GetService(const std::string& service_name) const {
         static_assert(std::is_base_of_v<Kernel::SessionRequestHandler, T>,
                       "Not a base of ServiceFrameworkBase");
-        auto service = registered_services.find(service_name);
+        auto service = registered_services.find(EncodeServiceName(service_name));
         if (service == registered_services.end()) {
             LOG_DEBUG(Service, "Can't find service: {}", service_name);
             return nullptr;
@@ -78,8 +90,9 @@ private:
     std::weak_ptr<SM> sm_interface;
     std::unique_ptr<Controller> controller_interface;
 
-    /// Map of registered services, retrieved using GetServicePort or ConnectToService.
-    std::unordered_map<std::string, std::shared_ptr<Kernel::ClientPort>> registered_services;
+    /// Map of registered services keyed by their encoded name, retrieved using GetServicePort or
+    /// ConnectToService.
+    std::unordered_map<u64, std::shared_ptr<Kernel::ClientPort>> registered_services;
 };
 
 } // namespace Service::SM
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <climits>
+#include <limits>
 
 #include "common/assert.h"
 #include "common/logging/log.h"
@@ -828,6 +829,39 @@ static ResultCode ToCalendarTimeImpl(const TimeZoneRule& rules, s64 time, Calend
     return result;
 }
 
+/// Finds the epoch bounds of the transition interval containing time. Returns false in the
+/// extrapolated go_back/go_ahead regions, which repeat POSIX rules instead of using the table.
+static bool GetActiveRuleInterval(const TimeZoneRule& rules, s64 time, s64& interval_start,
+                                  s64& interval_end) {
+    if (rules.time_count == 0) {
+        interval_start = std::numeric_limits<s64>::min();
+        interval_end = std::numeric_limits<s64>::max();
+        return true;
+    }
+    if ((rules.go_ahead && time < rules.ats[0]) ||
+        (rules.go_back && time > rules.ats[rules.time_count - 1])) {
+        return false;
+    }
+    if (time < rules.ats[0]) {
+        interval_start = std::numeric_limits<s64>::min();
+        interval_end = rules.ats[0];
+        return true;
+    }
+    s32 low{1};
+    s32 high{rules.time_count};
+    while (low < high) {
+        const s32 mid{(low + high) >> 1};
+        if (time < rules.ats[mid]) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    interval_start = rules.ats[low - 1];
+    interval_end = low < rules.time_count ? rules.ats[low] : std::numeric_limits<s64>::max();
+    return true;
+}
+
 TimeZoneManager::TimeZoneManager() = default;
 TimeZoneManager::~TimeZoneManager() = default;
 
@@ -842,6 +876,8 @@ ResultCode TimeZoneManager::SetDeviceLocationNameWithTimeZoneRule(const std::str
     if (ParseTimeZoneBinary(rule, vfs_file)) {
         device_location_name = location_name;
         time_zone_rule = rule;
+        // Conversions cached under the previous rule are no longer valid
+        time_zone_generation++;
         return RESULT_SUCCESS;
     }
     return ERROR_TIME_ZONE_CONVERSION_FAILED;
@@ -853,11 +889,44 @@ ResultCode TimeZoneManager::SetUpdatedTime(const Clock::SteadyClockTimePoint& va
 }
 
 ResultCode TimeZoneManager::ToCalendarTimeWithMyRules(s64 time, CalendarInfo& calendar) const {
-    if (is_initialized) {
-        return ToCalendarTime(time_zone_rule, time, calendar);
-    } else {
+    if (!is_initialized) {
         return ERROR_UNINITIALIZED_CLOCK;
     }
+
+    // Titles poll local time every frame; within the same transition interval and calendar day
+    // only the time-of-day fields change, so fill them from the cached day base
+    auto& cache{conversion_cache};
+    if (cache.valid && cache.generation == time_zone_generation && time >= cache.interval_start &&
+        time < cache.interval_end) {
+        const s64 day_offset{time - cache.day_start};
+        if (day_offset >= 0 && day_offset < seconds_per_day) {
+            calendar = cache.day_calendar;
+            calendar.time.hour = static_cast<s8>(day_offset / seconds_per_hour);
+            calendar.time.minute =
+                static_cast<s8>((day_offset / seconds_per_minute) % minutes_per_hour);
+            calendar.time.second = static_cast<s8>(day_offset % seconds_per_minute);
+            return RESULT_SUCCESS;
+        }
+    }
+
+    if (const ResultCode result{ToCalendarTime(time_zone_rule, time, calendar)};
+        result != RESULT_SUCCESS) {
+        return result;
+    }
+
+    s64 interval_start{};
+    s64 interval_end{};
+    if (GetActiveRuleInterval(time_zone_rule, time, interval_start, interval_end)) {
+        const s64 local_seconds{calendar.time.hour * seconds_per_hour +
+                                calendar.time.minute * seconds_per_minute + calendar.time.second};
+        cache.generation = time_zone_generation;
+        cache.interval_start = interval_start;
+        cache.interval_end = interval_end;
+        cache.day_start = time - local_seconds;
+        cache.day_calendar = calendar;
+        cache.valid = true;
+    }
+    return RESULT_SUCCESS;
 }
 
 ResultCode TimeZoneManager::ParseTimeZoneRuleBinary(TimeZoneRule& rules,
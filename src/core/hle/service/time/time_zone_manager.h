@@ -42,10 +42,24 @@ public:
     ResultCode ToPosixTimeWithMyRule(const CalendarTime& calendar_time, s64& posix_time) const;
 
 private:
+    /// Caches the last conversion made with the device rule. Titles poll local time every frame,
+    /// so repeat conversions within the same transition interval and calendar day reduce to two
+    /// bound checks and recomputing hour/minute/second from the cached day base.
+    struct ConversionCache {
+        bool valid{};
+        u32 generation{};       ///< Value of time_zone_generation this entry was filled under
+        s64 interval_start{};   ///< Inclusive epoch bound of the active transition interval
+        s64 interval_end{};     ///< Exclusive epoch bound of the active transition interval
+        s64 day_start{};        ///< Epoch time of the cached calendar day at 00:00 local time
+        CalendarInfo day_calendar{}; ///< Conversion result for day_start
+    };
+
     bool is_initialized{};
     TimeZoneRule time_zone_rule{};
     std::string device_location_name{"GMT"};
     u128 time_zone_rule_version{};
+    u32 time_zone_generation{}; ///< Bumped on rule updates to invalidate cached conversions
+    mutable ConversionCache conversion_cache{};
     std::size_t total_location_name_count{};
     Clock::SteadyClockTimePoint time_zone_update_time_point{
         Clock::SteadyClockTimePoint::GetRandom()};
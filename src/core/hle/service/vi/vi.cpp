@@ -120,7 +120,8 @@ public:
         static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
 
         if (buffer.size() < write_index + sizeof(T)) {
-            buffer.resize(buffer.size() + sizeof(T) + DefaultBufferSize);
+            // Grow geometrically so large responses don't reallocate once per written field
+            buffer.resize(std::max(write_index + sizeof(T), buffer.size() * 2));
         }
 
         std::memcpy(buffer.data() + write_index, &val, sizeof(T));
@@ -149,7 +150,7 @@ public:
         DeserializeData();
     }
 
-    std::vector<u8> Serialize() {
+    const std::vector<u8>& Serialize() {
         ASSERT(read_index == 0);
         write_index = sizeof(Header);
 
@@ -512,6 +513,7 @@ private:
                   static_cast<u32>(transaction), flags);
 
         nv_flinger->Lock();
+        nv_flinger->CountBufferQueueTransaction();
         auto& buffer_queue = nv_flinger->FindBufferQueue(id);
 
         switch (transaction) {
@@ -530,8 +532,10 @@ private:
 
             buffer_queue.SetPreallocatedBuffer(request.data.slot, request.buffer);
 
-            IGBPSetPreallocatedBufferResponseParcel response{};
-            ctx.WriteBuffer(response.Serialize());
+            // The reply carries no state, so it is serialized once and the bytes reused
+            static const std::vector<u8> response{
+                IGBPSetPreallocatedBufferResponseParcel{}.Serialize()};
+            ctx.WriteBuffer(response);
             break;
         }
         case TransactionId::DequeueBuffer: {
@@ -581,8 +585,10 @@ private:
                                      request.data.GetCropRect(), request.data.swap_interval,
                                      request.data.multi_fence);
 
-            IGBPQueueBufferResponseParcel response{1280, 720};
-            ctx.WriteBuffer(response.Serialize());
+            // The reply is constant, so it is serialized once and the bytes reused
+            static const std::vector<u8> response{
+                IGBPQueueBufferResponseParcel{1280, 720}.Serialize()};
+            ctx.WriteBuffer(response);
             break;
         }
         case TransactionId::Query: {
@@ -605,23 +611,23 @@ private:
 
             buffer_queue.Disconnect();
 
-            IGBPEmptyResponseParcel response{};
-            ctx.WriteBuffer(response.Serialize());
+            static const std::vector<u8> response{IGBPEmptyResponseParcel{}.Serialize()};
+            ctx.WriteBuffer(response);
             break;
         }
         case TransactionId::DetachBuffer: {
             const auto buffer = ctx.ReadBuffer();
 
-            IGBPEmptyResponseParcel response{};
-            ctx.WriteBuffer(response.Serialize());
+            static const std::vector<u8> response{IGBPEmptyResponseParcel{}.Serialize()};
+            ctx.WriteBuffer(response);
             break;
         }
         case TransactionId::SetBufferCount: {
             LOG_WARNING(Service_VI, "(STUBBED) called, transaction=SetBufferCount");
             [[maybe_unused]] const auto buffer = ctx.ReadBuffer();
 
-            IGBPEmptyResponseParcel response{};
-            ctx.WriteBuffer(response.Serialize());
+            static const std::vector<u8> response{IGBPEmptyResponseParcel{}.Serialize()};
+            ctx.WriteBuffer(response);
             break;
         }
         default:
@@ -2,8 +2,11 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <array>
 #include <cinttypes>
 #include <cstring>
+#include <future>
 #include <vector>
 
 #include "common/common_funcs.h"
@@ -12,6 +15,7 @@
 #include "common/logging/log.h"
 #include "common/lz4_compression.h"
 #include "common/swap.h"
+#include "common/thread_pool.h"
 #include "core/core.h"
 #include "core/file_sys/patch_manager.h"
 #include "core/gdbstub/gdbstub.h"
@@ -35,15 +39,11 @@ struct MODHeader {
 };
 static_assert(sizeof(MODHeader) == 0x1c, "MODHeader has incorrect size.");
 
-std::vector<u8> DecompressSegment(const std::vector<u8>& compressed_data,
-                                  const NSOSegmentHeader& header) {
-    std::vector<u8> uncompressed_data =
-        Common::Compression::DecompressDataLZ4(compressed_data, header.size);
+void DecompressSegment(const std::vector<u8>& compressed_data, const NSOSegmentHeader& header,
+                       u8* dest) {
+    const bool success = Common::Compression::DecompressDataLZ4(compressed_data, dest, header.size);
 
-    ASSERT_MSG(uncompressed_data.size() == header.size, "{} != {}", header.size,
-               uncompressed_data.size());
-
-    return uncompressed_data;
+    ASSERT_MSG(success, "LZ4 decompression of segment of size {} failed", header.size);
 }
 
 constexpr u32 PageAlignSize(u32 size) {
@@ -91,15 +91,44 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::Process& process,
     // Build program image
     Kernel::CodeSet codeset;
     Kernel::PhysicalMemory program_image;
+
+    // Read all segments up front and size the program image once, so each segment can be
+    // decompressed directly into place rather than through an intermediate buffer.
+    std::array<std::vector<u8>, 3> segment_data;
+    std::array<std::size_t, 3> segment_sizes{};
+    std::size_t image_end = 0;
     for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
-        std::vector<u8> data =
-            file.ReadBytes(nso_header.segments_compressed_size[i], nso_header.segments[i].offset);
-        if (nso_header.IsSegmentCompressed(i)) {
-            data = DecompressSegment(data, nso_header.segments[i]);
+        segment_data[i] = file.ReadBytes(nso_header.segments_compressed_size[i],
+                                         nso_header.segments[i].offset);
+        segment_sizes[i] = nso_header.IsSegmentCompressed(i) ? nso_header.segments[i].size
+                                                             : segment_data[i].size();
+        image_end = std::max<std::size_t>(image_end,
+                                          nso_header.segments[i].location + segment_sizes[i]);
+    }
+    program_image.resize(image_end);
+
+    // Decompress all segments in parallel, as decompression dominates module load time.
+    {
+        auto& pool = Common::ThreadPool::GetPool();
+        std::array<std::future<void>, 3> decompressions;
+        for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
+            u8* const dest = program_image.data() + nso_header.segments[i].location;
+            if (nso_header.IsSegmentCompressed(i)) {
+                decompressions[i] = pool.Push([&nso_header, &segment_data, dest, i] {
+                    DecompressSegment(segment_data[i], nso_header.segments[i], dest);
+                });
+            } else {
+                std::memcpy(dest, segment_data[i].data(), segment_data[i].size());
+            }
+        }
+        for (auto& decompression : decompressions) {
+            if (decompression.valid()) {
+                decompression.wait();
+            }
         }
-        program_image.resize(nso_header.segments[i].location + static_cast<u32>(data.size()));
-        std::memcpy(program_image.data() + nso_header.segments[i].location, data.data(),
-                    data.size());
+    }
+
+    for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
         codeset.segments[i].addr = nso_header.segments[i].location;
         codeset.segments[i].offset = nso_header.segments[i].location;
         codeset.segments[i].size = nso_header.segments[i].size;
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <optional>
 #include <utility>
@@ -13,6 +14,7 @@
 #include "common/logging/log.h"
 #include "common/page_table.h"
 #include "common/swap.h"
+#include "common/virtual_buffer.h"
 #include "core/arm/arm_interface.h"
 #include "core/core.h"
 #include "core/device_memory.h"
@@ -22,14 +24,95 @@
 #include "core/memory.h"
 #include "video_core/gpu.h"
 
+#ifdef ARCHITECTURE_x86_64
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+
+#ifdef _MSC_VER
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
 namespace Core::Memory {
 
+namespace {
+
+/// Copies above this size bypass the cache with non-temporal stores; framebuffer-sized guest
+/// memcpys would otherwise evict most of the LLC for data that is not read back by the CPU.
+constexpr std::size_t STREAMING_COPY_THRESHOLD = 2 * 1024 * 1024;
+
+#ifdef ARCHITECTURE_x86_64
+TARGET_AVX2 void StreamingCopyAvx2(u8* dest, const u8* src, std::size_t size) {
+    // Align the destination; non-temporal stores require it, the source may load unaligned.
+    const std::size_t head = std::min(size, (32 - (reinterpret_cast<uintptr_t>(dest) & 31)) & 31);
+    std::memcpy(dest, src, head);
+    dest += head;
+    src += head;
+    size -= head;
+
+    std::size_t offset = 0;
+    for (; offset + 32 <= size; offset += 32) {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + offset));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dest + offset), value);
+    }
+    _mm_sfence();
+
+    std::memcpy(dest + offset, src + offset, size - offset);
+}
+#endif
+
+/// Copies a host-contiguous run, streaming past the cache when the run is large enough.
+void BulkCopy(u8* dest, const u8* src, std::size_t size) {
+#ifdef ARCHITECTURE_x86_64
+    static const bool has_avx2 = Common::GetCPUCaps().avx2;
+    if (has_avx2 && size >= STREAMING_COPY_THRESHOLD) {
+        StreamingCopyAvx2(dest, src, size);
+        return;
+    }
+#endif
+    std::memcpy(dest, src, size);
+}
+
+/**
+ * Extends a block walk past the current page while the following pages are plain memory backed by
+ * host storage contiguous with it. Pages of the same run share the same rebased pointer, so the
+ * scan is two loads per page instead of the per-page PageType switch.
+ *
+ * @returns The number of bytes, at most remaining_size, coverable with a single host copy.
+ */
+std::size_t CoalesceContiguousRun(const Common::PageTable& page_table, std::size_t page_index,
+                                  std::size_t page_offset, std::size_t remaining_size) {
+    const u8* const run_pointer = page_table.pointers[page_index];
+    std::size_t run_size = PAGE_SIZE - page_offset;
+    while (run_size < remaining_size &&
+           page_table.attributes[page_index + 1] == Common::PageType::Memory &&
+           page_table.pointers[page_index + 1] == run_pointer) {
+        ++page_index;
+        run_size += PAGE_SIZE;
+    }
+    return std::min(run_size, remaining_size);
+}
+
+} // Anonymous namespace
+
 // Implementation class used to keep the specifics of the memory subsystem hidden
 // from outside classes. This also allows modification to the internals of the memory
 // subsystem without needing to rebuild all files that make use of the memory interface.
 struct Memory::Impl {
+    /// Size of the host region reserved for fastmem views, covering the largest supported
+    /// guest address space width (39 bits).
+    static constexpr u64 FASTMEM_REGION_SIZE = 1ULL << 39;
+
     explicit Impl(Core::System& system_) : system{system_} {}
 
+    ~Impl() {
+        if (fastmem_arena) {
+            Common::FreeMemoryRegion(fastmem_arena, FASTMEM_REGION_SIZE);
+        }
+    }
+
     void SetCurrentPageTable(Kernel::Process& process, u32 core_id) {
         current_page_table = &process.PageTable().PageTableImpl();
 
@@ -77,10 +160,8 @@ struct Memory::Impl {
             return true;
         }
 
-        if (page_table.attributes[vaddr >> PAGE_BITS] != Common::PageType::Special) {
-            return false;
-        }
-
+        // Note: PageType::Special pages are never created; the MemoryHook machinery is
+        // unimplemented here (see MapIoRegion/AddDebugHook), so they are simply invalid.
         return false;
     }
 
@@ -217,7 +298,7 @@ struct Memory::Impl {
         std::size_t page_offset = src_addr & PAGE_MASK;
 
         while (remaining_size > 0) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
             const auto current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -232,9 +313,11 @@ struct Memory::Impl {
             case Common::PageType::Memory: {
                 DEBUG_ASSERT(page_table.pointers[page_index]);
 
+                copy_amount =
+                    CoalesceContiguousRun(page_table, page_index, page_offset, remaining_size);
                 const u8* const src_ptr =
                     page_table.pointers[page_index] + page_offset + (page_index << PAGE_BITS);
-                std::memcpy(dest_buffer, src_ptr, copy_amount);
+                BulkCopy(static_cast<u8*>(dest_buffer), src_ptr, copy_amount);
                 break;
             }
             case Common::PageType::RasterizerCachedMemory: {
@@ -247,7 +330,7 @@ struct Memory::Impl {
                 UNREACHABLE();
             }
 
-            page_index++;
+            page_index += (page_offset + copy_amount + PAGE_SIZE - 1) >> PAGE_BITS;
             page_offset = 0;
             dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
             remaining_size -= copy_amount;
@@ -263,7 +346,7 @@ struct Memory::Impl {
         std::size_t page_offset = src_addr & PAGE_MASK;
 
         while (remaining_size > 0) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
             const auto current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -278,9 +361,11 @@ struct Memory::Impl {
             case Common::PageType::Memory: {
                 DEBUG_ASSERT(page_table.pointers[page_index]);
 
+                copy_amount =
+                    CoalesceContiguousRun(page_table, page_index, page_offset, remaining_size);
                 const u8* const src_ptr =
                     page_table.pointers[page_index] + page_offset + (page_index << PAGE_BITS);
-                std::memcpy(dest_buffer, src_ptr, copy_amount);
+                BulkCopy(static_cast<u8*>(dest_buffer), src_ptr, copy_amount);
                 break;
             }
             case Common::PageType::RasterizerCachedMemory: {
@@ -292,7 +377,7 @@ struct Memory::Impl {
                 UNREACHABLE();
             }
 
-            page_index++;
+            page_index += (page_offset + copy_amount + PAGE_SIZE - 1) >> PAGE_BITS;
             page_offset = 0;
             dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
             remaining_size -= copy_amount;
@@ -315,7 +400,7 @@ struct Memory::Impl {
         std::size_t page_offset = dest_addr & PAGE_MASK;
 
         while (remaining_size > 0) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
             const auto current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -329,9 +414,11 @@ struct Memory::Impl {
             case Common::PageType::Memory: {
                 DEBUG_ASSERT(page_table.pointers[page_index]);
 
+                copy_amount =
+                    CoalesceContiguousRun(page_table, page_index, page_offset, remaining_size);
                 u8* const dest_ptr =
                     page_table.pointers[page_index] + page_offset + (page_index << PAGE_BITS);
-                std::memcpy(dest_ptr, src_buffer, copy_amount);
+                BulkCopy(dest_ptr, static_cast<const u8*>(src_buffer), copy_amount);
                 break;
             }
             case Common::PageType::RasterizerCachedMemory: {
@@ -344,7 +431,7 @@ struct Memory::Impl {
                 UNREACHABLE();
             }
 
-            page_index++;
+            page_index += (page_offset + copy_amount + PAGE_SIZE - 1) >> PAGE_BITS;
             page_offset = 0;
             src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
             remaining_size -= copy_amount;
@@ -359,7 +446,7 @@ struct Memory::Impl {
         std::size_t page_offset = dest_addr & PAGE_MASK;
 
         while (remaining_size > 0) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
             const auto current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -373,9 +460,11 @@ struct Memory::Impl {
             case Common::PageType::Memory: {
                 DEBUG_ASSERT(page_table.pointers[page_index]);
 
+                copy_amount =
+                    CoalesceContiguousRun(page_table, page_index, page_offset, remaining_size);
                 u8* const dest_ptr =
                     page_table.pointers[page_index] + page_offset + (page_index << PAGE_BITS);
-                std::memcpy(dest_ptr, src_buffer, copy_amount);
+                BulkCopy(dest_ptr, static_cast<const u8*>(src_buffer), copy_amount);
                 break;
             }
             case Common::PageType::RasterizerCachedMemory: {
@@ -387,7 +476,7 @@ struct Memory::Impl {
                 UNREACHABLE();
             }
 
-            page_index++;
+            page_index += (page_offset + copy_amount + PAGE_SIZE - 1) >> PAGE_BITS;
             page_offset = 0;
             src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
             remaining_size -= copy_amount;
@@ -409,7 +498,7 @@ struct Memory::Impl {
         std::size_t page_offset = dest_addr & PAGE_MASK;
 
         while (remaining_size > 0) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
             const auto current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -423,6 +512,8 @@ struct Memory::Impl {
             case Common::PageType::Memory: {
                 DEBUG_ASSERT(page_table.pointers[page_index]);
 
+                copy_amount =
+                    CoalesceContiguousRun(page_table, page_index, page_offset, remaining_size);
                 u8* dest_ptr =
                     page_table.pointers[page_index] + page_offset + (page_index << PAGE_BITS);
                 std::memset(dest_ptr, 0, copy_amount);
@@ -438,7 +529,7 @@ struct Memory::Impl {
                 UNREACHABLE();
             }
 
-            page_index++;
+            page_index += (page_offset + copy_amount + PAGE_SIZE - 1) >> PAGE_BITS;
             page_offset = 0;
             remaining_size -= copy_amount;
         }
@@ -456,7 +547,7 @@ struct Memory::Impl {
         std::size_t page_offset = src_addr & PAGE_MASK;
 
         while (remaining_size > 0) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
             const auto current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -470,6 +561,8 @@ struct Memory::Impl {
             }
             case Common::PageType::Memory: {
                 DEBUG_ASSERT(page_table.pointers[page_index]);
+                copy_amount =
+                    CoalesceContiguousRun(page_table, page_index, page_offset, remaining_size);
                 const u8* src_ptr =
                     page_table.pointers[page_index] + page_offset + (page_index << PAGE_BITS);
                 WriteBlock(process, dest_addr, src_ptr, copy_amount);
@@ -485,7 +578,7 @@ struct Memory::Impl {
                 UNREACHABLE();
             }
 
-            page_index++;
+            page_index += (page_offset + copy_amount + PAGE_SIZE - 1) >> PAGE_BITS;
             page_offset = 0;
             dest_addr += static_cast<VAddr>(copy_amount);
             src_addr += static_cast<VAddr>(copy_amount);
@@ -502,6 +595,10 @@ struct Memory::Impl {
             return;
         }
 
+        // Rasterizer transitions rewrite page pointers in place, so retire any translations that
+        // threads may have cached for them.
+        translation_epoch.fetch_add(1, std::memory_order_relaxed);
+
         // Iterate over a contiguous CPU address space, which corresponds to the specified GPU
         // address space, marking the region as un/cached. The region is marked un/cached at a
         // granularity of CPU pages, hence why we iterate on a CPU page basis (note: GPU page size
@@ -521,6 +618,7 @@ struct Memory::Impl {
                 case Common::PageType::Memory:
                     page_type = Common::PageType::RasterizerCachedMemory;
                     current_page_table->pointers[vaddr >> PAGE_BITS] = nullptr;
+                    UnmapFastmemViews(vaddr & ~PAGE_MASK, PAGE_SIZE);
                     break;
                 case Common::PageType::RasterizerCachedMemory:
                     // There can be more than one GPU region mapped per CPU region, so it's common
@@ -551,6 +649,9 @@ struct Memory::Impl {
                         page_type = Common::PageType::Memory;
                         current_page_table->pointers[vaddr >> PAGE_BITS] =
                             pointer - (vaddr & ~PAGE_MASK);
+                        MapFastmemViews(vaddr & ~PAGE_MASK, PAGE_SIZE,
+                                        current_page_table->backing_addr[vaddr >> PAGE_BITS] +
+                                            (vaddr & ~PAGE_MASK));
                     }
                     break;
                 }
@@ -570,11 +671,62 @@ struct Memory::Impl {
      * @param memory     The memory to map.
      * @param type       The page type to map the memory as.
      */
+    /**
+     * Lazily reserves the contiguous host region used to back fastmem views of the guest
+     * address space. The region starts out fully inaccessible; guest pages are mapped into it
+     * as aliased views of the DRAM backing file as they are mapped into the page table.
+     */
+    void EnsureFastmemArena() {
+        if (fastmem_arena_initialized) {
+            return;
+        }
+        fastmem_arena_initialized = true;
+        if (system.DeviceMemory().BackingFile() == Common::InvalidBackingFileHandle) {
+            return;
+        }
+        fastmem_arena = static_cast<u8*>(Common::ReserveMemoryRegion(FASTMEM_REGION_SIZE));
+        if (!fastmem_arena) {
+            LOG_WARNING(HW_Memory,
+                        "Unable to reserve fastmem arena, falling back to the page table path");
+        }
+    }
+
+    /// Maps an aliased view of physical memory into the fastmem arena.
+    void MapFastmemViews(VAddr vaddr, u64 size, PAddr target) {
+        if (!fastmem_arena || vaddr + size > FASTMEM_REGION_SIZE) {
+            return;
+        }
+        Common::MapBackingFileView(fastmem_arena + vaddr, system.DeviceMemory().BackingFile(),
+                                   target - DramMemoryMap::Base, size);
+    }
+
+    /// Returns a range of the fastmem arena to an inaccessible reservation, so that accesses
+    /// fall back to the page table path.
+    void UnmapFastmemViews(VAddr vaddr, u64 size) {
+        if (!fastmem_arena || vaddr + size > FASTMEM_REGION_SIZE) {
+            return;
+        }
+        Common::UnmapBackingFileView(fastmem_arena + vaddr, size);
+    }
+
     void MapPages(Common::PageTable& page_table, VAddr base, u64 size, PAddr target,
                   Common::PageType type) {
         LOG_DEBUG(HW_Memory, "Mapping {:016X} onto {:016X}-{:016X}", target, base * PAGE_SIZE,
                   (base + size) * PAGE_SIZE);
 
+        // Invalidate every thread's last-translation cache; entries filled before this point must
+        // not outlive the mapping they were resolved through.
+        translation_epoch.fetch_add(1, std::memory_order_relaxed);
+
+        // Note: only the application process maps memory while it is the current process, so a
+        // single arena tracking the most recent mappings is sufficient.
+        EnsureFastmemArena();
+        if (type == Common::PageType::Memory && target != 0) {
+            MapFastmemViews(base << PAGE_BITS, size << PAGE_BITS, target);
+        } else {
+            UnmapFastmemViews(base << PAGE_BITS, size << PAGE_BITS);
+        }
+
         // During boot, current_page_table might not be set yet, in which case we need not flush
         if (system.IsPoweredOn()) {
             auto& gpu = system.GPU();
@@ -614,6 +766,51 @@ struct Memory::Impl {
         }
     }
 
+    /// One-entry translation cache holding the last page resolved through the page table for
+    /// a given access class. Entries are thread local, so every core (and host thread doing HLE
+    /// accesses) keeps its own copy without any cross-core contention.
+    struct TranslationCacheEntry {
+        const Common::PageTable* page_table = nullptr;
+        u64 epoch = 0;
+        VAddr page = 0;
+        u8* pointer = nullptr;
+    };
+
+    struct TranslationCache {
+        TranslationCacheEntry read;
+        TranslationCacheEntry write;
+    };
+
+    /**
+     * Looks up a page in the last-translation cache.
+     *
+     * An entry only hits while it refers to the page table that is current on this thread and no
+     * mapping has changed since it was filled; both MapPages and RasterizerMarkRegionCached bump
+     * the epoch, which lazily invalidates every thread's entries.
+     *
+     * @returns The cached page pointer in page table addressing (add the full virtual address to
+     *          form the host pointer), or nullptr on a miss.
+     */
+    u8* ProbeTranslationCache(const TranslationCacheEntry& entry, const VAddr page) const {
+        if (entry.page != page || entry.page_table != current_page_table ||
+            entry.epoch != translation_epoch.load(std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return entry.pointer;
+    }
+
+    /// Remembers the translation of a plain memory page. The epoch must have been sampled before
+    /// the page table lookup, so that a mapping change racing the fill leaves a stale epoch in the
+    /// entry rather than a stale pointer behind a current one.
+    static void FillTranslationCache(TranslationCacheEntry& entry,
+                                     const Common::PageTable* page_table, const u64 epoch,
+                                     const VAddr page, u8* const pointer) {
+        entry.page_table = page_table;
+        entry.epoch = epoch;
+        entry.page = page;
+        entry.pointer = pointer;
+    }
+
     /**
      * Reads a particular data type out of memory at the given virtual address.
      *
@@ -627,15 +824,25 @@ struct Memory::Impl {
      */
     template <typename T>
     T Read(const VAddr vaddr) {
-        const u8* const page_pointer = current_page_table->pointers[vaddr >> PAGE_BITS];
-        if (page_pointer != nullptr) {
+        const VAddr page = vaddr >> PAGE_BITS;
+        if (const u8* const cached_pointer = ProbeTranslationCache(translation_cache.read, page)) {
             // NOTE: Avoid adding any extra logic to this fast-path block
             T value;
+            std::memcpy(&value, &cached_pointer[vaddr], sizeof(T));
+            return value;
+        }
+
+        const u64 epoch = translation_epoch.load(std::memory_order_relaxed);
+        u8* const page_pointer = current_page_table->pointers[page];
+        if (page_pointer != nullptr) {
+            FillTranslationCache(translation_cache.read, current_page_table, epoch, page,
+                                 page_pointer);
+            T value;
             std::memcpy(&value, &page_pointer[vaddr], sizeof(T));
             return value;
         }
 
-        const Common::PageType type = current_page_table->attributes[vaddr >> PAGE_BITS];
+        const Common::PageType type = current_page_table->attributes[page];
         switch (type) {
         case Common::PageType::Unmapped:
             LOG_ERROR(HW_Memory, "Unmapped Read{} @ 0x{:08X}", sizeof(T) * 8, vaddr);
@@ -669,14 +876,23 @@ struct Memory::Impl {
      */
     template <typename T>
     void Write(const VAddr vaddr, const T data) {
-        u8* const page_pointer = current_page_table->pointers[vaddr >> PAGE_BITS];
-        if (page_pointer != nullptr) {
+        const VAddr page = vaddr >> PAGE_BITS;
+        if (u8* const cached_pointer = ProbeTranslationCache(translation_cache.write, page)) {
             // NOTE: Avoid adding any extra logic to this fast-path block
+            std::memcpy(&cached_pointer[vaddr], &data, sizeof(T));
+            return;
+        }
+
+        const u64 epoch = translation_epoch.load(std::memory_order_relaxed);
+        u8* const page_pointer = current_page_table->pointers[page];
+        if (page_pointer != nullptr) {
+            FillTranslationCache(translation_cache.write, current_page_table, epoch, page,
+                                 page_pointer);
             std::memcpy(&page_pointer[vaddr], &data, sizeof(T));
             return;
         }
 
-        const Common::PageType type = current_page_table->attributes[vaddr >> PAGE_BITS];
+        const Common::PageType type = current_page_table->attributes[page];
         switch (type) {
         case Common::PageType::Unmapped:
             LOG_ERROR(HW_Memory, "Unmapped Write{} 0x{:08X} @ 0x{:016X}", sizeof(data) * 8,
@@ -758,9 +974,17 @@ struct Memory::Impl {
     }
 
     Common::PageTable* current_page_table = nullptr;
+    /// Monotonic mapping generation; incremented whenever page table contents change. Starts at 1
+    /// so that default-constructed translation cache entries can never hit.
+    std::atomic<u64> translation_epoch{1};
+    static thread_local TranslationCache translation_cache;
+    u8* fastmem_arena = nullptr;
+    bool fastmem_arena_initialized = false;
     Core::System& system;
 };
 
+thread_local Memory::Impl::TranslationCache Memory::Impl::translation_cache;
+
 Memory::Memory(Core::System& system) : impl{std::make_unique<Impl>(system)} {}
 Memory::~Memory() = default;
 
@@ -807,6 +1031,11 @@ const u8* Memory::GetPointer(VAddr vaddr) const {
     return impl->GetPointer(vaddr);
 }
 
+u8* Memory::GetFastmemBase() {
+    impl->EnsureFastmemArena();
+    return impl->fastmem_arena;
+}
+
 u8 Memory::Read8(const VAddr addr) {
     return impl->Read8(addr);
 }
@@ -160,6 +160,17 @@ public:
      */
     const u8* GetPointer(VAddr vaddr) const;
 
+    /**
+     * Gets the base of the contiguous host region backing fastmem views of the guest address
+     * space. Guest pages that are plain memory are kept mapped at base + vaddr, while unmapped
+     * and rasterizer-cached pages are left inaccessible so accesses through the region fault
+     * and can fall back to the page table path.
+     *
+     * @returns The fastmem arena base, or nullptr when the host cannot provide aliased
+     *          mappings and only the page table path is available.
+     */
+    u8* GetFastmemBase();
+
     /**
      * Reads an 8-bit unsigned value from the current process' address space
      * at the given virtual address.
@@ -190,7 +190,10 @@ CheatEngine::~CheatEngine() {
 void CheatEngine::Initialize() {
     event = Core::Timing::CreateEvent(
         "CheatEngine::FrameCallback::" + Common::HexToString(metadata.main_nso_build_id),
-        [this](u64 userdata, s64 ns_late) { FrameCallback(userdata, ns_late); });
+        [](std::uintptr_t context, u64 userdata, s64 ns_late) {
+            reinterpret_cast<CheatEngine*>(context)->FrameCallback(userdata, ns_late);
+        },
+        reinterpret_cast<std::uintptr_t>(this));
     core_timing.ScheduleEvent(CHEAT_ENGINE_TICKS, event);
 
     metadata.process_id = system.CurrentProcess()->GetProcessID();
@@ -232,6 +232,20 @@ void DmntCheatVm::LogOpcode(const CheatVmOpcode& opcode) {
 DmntCheatVm::Callbacks::~Callbacks() = default;
 
 bool DmntCheatVm::DecodeNextOpcode(CheatVmOpcode& out) {
+    // Fast path: replay the decode cached at load time. Offsets that were not decoded during the
+    // load-time pass (or anything after a decode failure) fall back to the full decoder below.
+    if (decode_success && instruction_ptr < num_opcodes) {
+        if (const u32 index = decoded_indices[instruction_ptr]; index != 0) {
+            const CachedOpcode& cached = decoded_program[index - 1];
+            out = cached.opcode;
+            instruction_ptr = cached.next_instruction_ptr;
+            return true;
+        }
+    }
+    return DecodeNextOpcodeImpl(out);
+}
+
+bool DmntCheatVm::DecodeNextOpcodeImpl(CheatVmOpcode& out) {
     // If we've ever seen a decode failure, return false.
     bool valid = decode_success;
     CheatVmOpcode opcode = {};
@@ -606,6 +620,31 @@ bool DmntCheatVm::DecodeNextOpcode(CheatVmOpcode& out) {
     return valid;
 }
 
+void DmntCheatVm::DecodeProgram() {
+    decoded_program.clear();
+    decoded_indices.fill(0);
+
+    // Run the decoder over the program once, front to back. Decoding is purely linear, so every
+    // instruction start the execution loop can ever jump to is visited by this pass. If decoding
+    // fails partway through, the valid prefix stays cached and execution hits the same failure
+    // through the fallback decoder.
+    instruction_ptr = 0;
+    decode_success = true;
+
+    CheatVmOpcode opcode{};
+    while (instruction_ptr < num_opcodes) {
+        const std::size_t start = instruction_ptr;
+        if (!DecodeNextOpcodeImpl(opcode)) {
+            break;
+        }
+        decoded_program.push_back({opcode, instruction_ptr});
+        decoded_indices[start] = static_cast<u32>(decoded_program.size());
+    }
+
+    instruction_ptr = 0;
+    decode_success = true;
+}
+
 void DmntCheatVm::SkipConditionalBlock() {
     if (condition_depth > 0) {
         // We want to continue until we're out of the current block.
@@ -681,6 +720,7 @@ bool DmntCheatVm::LoadProgram(const std::vector<CheatEntry>& entries) {
             // Bounds check.
             if (entries[i].definition.num_opcodes + num_opcodes > MaximumProgramOpcodeCount) {
                 num_opcodes = 0;
+                DecodeProgram();
                 return false;
             }
 
@@ -690,6 +730,7 @@ bool DmntCheatVm::LoadProgram(const std::vector<CheatEntry>& entries) {
         }
     }
 
+    DecodeProgram();
     return true;
 }
 
@@ -304,7 +304,21 @@ private:
     std::array<u64, NumRegisters> saved_values{};
     std::array<std::size_t, NumRegisters> loop_tops{};
 
+    /// Decoded image of an instruction, cached at its starting dword offset.
+    struct CachedOpcode {
+        CheatVmOpcode opcode;
+        std::size_t next_instruction_ptr;
+    };
+
+    /// Program decoded once at load time; entries are keyed by the dword offset of the
+    /// instruction, so instruction_ptr keeps its interpreter semantics (loop tops and
+    /// conditional skips jump between dword offsets).
+    std::vector<CachedOpcode> decoded_program;
+    std::array<u32, MaximumProgramOpcodeCount> decoded_indices{};
+
+    void DecodeProgram();
     bool DecodeNextOpcode(CheatVmOpcode& out);
+    bool DecodeNextOpcodeImpl(CheatVmOpcode& out);
     void SkipConditionalBlock();
     void ResetState();
 
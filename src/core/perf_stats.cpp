@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iterator>
 #include <mutex>
 #include <numeric>
@@ -12,6 +13,7 @@
 #include <fmt/chrono.h>
 #include <fmt/format.h>
 #include "common/file_util.h"
+#include "common/logging/log.h"
 #include "common/math_util.h"
 #include "core/perf_stats.h"
 #include "core/settings.h"
@@ -25,11 +27,70 @@ using std::chrono::microseconds;
 // booting that we shouldn't account for
 constexpr std::size_t IgnoreFrames = 5;
 
+// Histogram buckets double in size every BucketsPerDoubling entries, starting at
+// HistogramMinimumMs. The last bucket catches everything from roughly one second up.
+constexpr double HistogramMinimumMs = 0.25;
+constexpr double BucketsPerDoubling = 10.0;
+
+// Frames this far over the 60 Hz budget are considered stutters and attributed to the blocking
+// events recorded while they ran.
+constexpr auto StutterThreshold = 25ms;
+
+static std::size_t FrametimeToBucket(double frametime_ms) {
+    if (frametime_ms <= HistogramMinimumMs) {
+        return 0;
+    }
+    const double index = std::log2(frametime_ms / HistogramMinimumMs) * BucketsPerDoubling;
+    return std::min(static_cast<std::size_t>(index), Core::PerfStats::NUM_HISTOGRAM_BUCKETS - 1);
+}
+
+static double BucketToFrametime(std::size_t bucket) {
+    return HistogramMinimumMs * std::exp2((static_cast<double>(bucket) + 0.5) / BucketsPerDoubling);
+}
+
+// Approximates a percentile of a log2-nanosecond-bucketed histogram, returning the midpoint of
+// the bucket the percentile falls into, in nanoseconds.
+static u64 LockHistogramPercentile(
+    const std::array<u64, Core::SchedulerStatistics::NUM_LOCK_BUCKETS>& histogram, double pct) {
+    const u64 total = std::accumulate(histogram.begin(), histogram.end(), u64{0});
+    if (total == 0) {
+        return 0;
+    }
+    const u64 target = static_cast<u64>(static_cast<double>(total) * pct);
+    u64 seen = 0;
+    for (std::size_t bucket = 0; bucket < histogram.size(); ++bucket) {
+        seen += histogram[bucket];
+        if (seen > target) {
+            return (u64{1} << bucket) + (u64{1} << bucket) / 2;
+        }
+    }
+    return u64{1} << (histogram.size() - 1);
+}
+
 namespace Core {
 
 PerfStats::PerfStats(u64 title_id) : title_id(title_id) {}
 
 PerfStats::~PerfStats() {
+    if (scheduler_stats.lock_acquisitions != 0) {
+        const auto& sched = scheduler_stats;
+        const double contention_pct = 100.0 * static_cast<double>(sched.contended_acquisitions) /
+                                      static_cast<double>(sched.lock_acquisitions);
+        LOG_INFO(Core,
+                 "Title {:016X} scheduler lock: {} acquisitions, {} contended ({:.2f}%), "
+                 "wait p50/p95/p99 = {}/{}/{} ns, hold p50/p95/p99 = {}/{}/{} ns",
+                 title_id, sched.lock_acquisitions, sched.contended_acquisitions, contention_pct,
+                 LockHistogramPercentile(sched.lock_wait_histogram, 0.50),
+                 LockHistogramPercentile(sched.lock_wait_histogram, 0.95),
+                 LockHistogramPercentile(sched.lock_wait_histogram, 0.99),
+                 LockHistogramPercentile(sched.lock_hold_histogram, 0.50),
+                 LockHistogramPercentile(sched.lock_hold_histogram, 0.95),
+                 LockHistogramPercentile(sched.lock_hold_histogram, 0.99));
+        LOG_INFO(Core, "Reschedules per core: {} / {} / {} / {}, thread migrations: {}",
+                 sched.core_reschedules[0], sched.core_reschedules[1], sched.core_reschedules[2],
+                 sched.core_reschedules[3], sched.thread_migrations);
+    }
+
     if (!Settings::values.record_frame_times || title_id == 0) {
         return;
     }
@@ -44,6 +105,26 @@ PerfStats::~PerfStats() {
         fmt::format("{}/{:%F-%H-%M}_{:016X}.csv", path, *std::localtime(&t), title_id);
     FileUtil::IOFile file(filename, "w");
     file.WriteString(stream.str());
+
+    if (gpu_spans.empty()) {
+        return;
+    }
+
+    // Dump the GPU spans in the chrome://tracing format so frame time can be attributed to
+    // passes by loading the file in the tracing viewer.
+    std::string trace = "[";
+    for (const auto& span : gpu_spans) {
+        trace += fmt::format(
+            R"({{"name":"{}","cat":"gpu","ph":"X","pid":0,"tid":0,"ts":{:.3f},"dur":{:.3f}}},)",
+            span.bucket, static_cast<double>(span.start_ns) / 1000.0,
+            static_cast<double>(span.duration_ns) / 1000.0);
+    }
+    trace.back() = ']';
+
+    const std::string trace_filename =
+        fmt::format("{}/{:%F-%H-%M}_{:016X}_gputrace.json", path, *std::localtime(&t), title_id);
+    FileUtil::IOFile trace_file(trace_filename, "w");
+    trace_file.WriteString(trace);
 }
 
 void PerfStats::BeginSystemFrame() {
@@ -57,13 +138,25 @@ void PerfStats::EndSystemFrame() {
 
     auto frame_end = Clock::now();
     const auto frame_time = frame_end - frame_begin;
+    const double frame_time_ms = std::chrono::duration<double, std::milli>(frame_time).count();
     if (current_index < perf_history.size()) {
-        perf_history[current_index++] =
-            std::chrono::duration<double, std::milli>(frame_time).count();
+        perf_history[current_index++] = frame_time_ms;
     }
+    frametime_histogram[FrametimeToBucket(frame_time_ms)] += 1;
     accumulated_frametime += frame_time;
     system_frames += 1;
 
+    if (frame_time > StutterThreshold && !frame_blocking_events.empty()) {
+        std::string attribution;
+        for (const auto& event : frame_blocking_events) {
+            attribution += fmt::format(" {} {:.2f}ms", event.subsystem,
+                                       std::chrono::duration<double, std::milli>(event.duration)
+                                           .count());
+        }
+        LOG_DEBUG(Core, "Frame took {:.2f}ms, blocked on:{}", frame_time_ms, attribution);
+    }
+    frame_blocking_events.clear();
+
     previous_frame_length = frame_end - previous_frame_end;
     previous_frame_end = frame_end;
 }
@@ -74,6 +167,34 @@ void PerfStats::EndGameFrame() {
     game_frames += 1;
 }
 
+void PerfStats::RecordPresentLatency(Clock::duration latency) {
+    std::lock_guard lock{object_mutex};
+
+    accumulated_present_latency += latency;
+    presented_frames += 1;
+}
+
+void PerfStats::RecordBlockingEvent(const char* subsystem, Clock::duration duration) {
+    std::lock_guard lock{object_mutex};
+
+    frame_blocking_events.push_back({subsystem, duration});
+}
+
+void PerfStats::RecordSchedulerStats(const SchedulerStatistics& stats) {
+    std::lock_guard lock{object_mutex};
+
+    scheduler_stats = stats;
+}
+
+void PerfStats::RecordGPUSpan(const char* bucket, u64 start_ns, u64 duration_ns) {
+    if (!Settings::values.record_frame_times) {
+        return;
+    }
+    std::lock_guard lock{object_mutex};
+
+    gpu_spans.push_back({bucket, start_ns, duration_ns});
+}
+
 double PerfStats::GetMeanFrametime() {
     std::lock_guard lock{object_mutex};
 
@@ -85,6 +206,22 @@ double PerfStats::GetMeanFrametime() {
     return sum / (current_index - IgnoreFrames);
 }
 
+std::size_t PerfStats::GetFrameCount() {
+    std::lock_guard lock{object_mutex};
+
+    return current_index;
+}
+
+std::vector<double> PerfStats::GetFrameTimeHistory() {
+    std::lock_guard lock{object_mutex};
+
+    if (current_index <= IgnoreFrames) {
+        return {};
+    }
+    return std::vector<double>(perf_history.begin() + IgnoreFrames,
+                               perf_history.begin() + current_index);
+}
+
 PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us) {
     std::lock_guard lock{object_mutex};
 
@@ -100,13 +237,39 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     results.frametime = duration_cast<DoubleSecs>(accumulated_frametime).count() /
                         static_cast<double>(system_frames);
     results.emulation_speed = system_us_per_second.count() / 1'000'000.0;
+    results.present_latency =
+        presented_frames > 0 ? duration_cast<DoubleSecs>(accumulated_present_latency).count() /
+                                   static_cast<double>(presented_frames)
+                             : 0.0;
+
+    // Walk the histogram once for all three percentiles; buckets are in ascending frametime
+    // order, so each percentile is the bucket where the running frame count crosses its target.
+    const auto percentile = [this](double fraction) {
+        const auto target = static_cast<u32>(fraction * static_cast<double>(system_frames));
+        u32 seen = 0;
+        for (std::size_t bucket = 0; bucket < NUM_HISTOGRAM_BUCKETS; ++bucket) {
+            seen += frametime_histogram[bucket];
+            if (seen > target) {
+                return BucketToFrametime(bucket) / 1000.0;
+            }
+        }
+        return 0.0;
+    };
+    if (system_frames > 0) {
+        results.frametime_p50 = percentile(0.50);
+        results.frametime_p95 = percentile(0.95);
+        results.frametime_p99 = percentile(0.99);
+    }
 
     // Reset counters
     reset_point = now;
     reset_point_system_us = current_system_time_us;
     accumulated_frametime = Clock::duration::zero();
+    frametime_histogram.fill(0);
     system_frames = 0;
     game_frames = 0;
+    accumulated_present_latency = Clock::duration::zero();
+    presented_frames = 0;
 
     return results;
 }
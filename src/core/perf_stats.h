@@ -8,10 +8,33 @@
 #include <chrono>
 #include <cstddef>
 #include <mutex>
+#include <vector>
 #include "common/common_types.h"
+#include "core/hardware_properties.h"
 
 namespace Core {
 
+/// Scheduler lock contention counters collected by the kernel over the whole session. All fields
+/// are written under the scheduler lock; they are only read after emulation has shut down.
+struct SchedulerStatistics {
+    /// Number of logarithmic buckets in the lock timing histograms. Bucket N counts durations in
+    /// [2^N, 2^(N+1)) nanoseconds.
+    static constexpr std::size_t NUM_LOCK_BUCKETS = 32;
+
+    /// Outermost scheduler lock acquisitions. Reentrant locking is not counted.
+    u64 lock_acquisitions = 0;
+    /// Acquisitions that found the lock held by another emulated core
+    u64 contended_acquisitions = 0;
+    /// Histogram of walltime spent waiting for a contended lock
+    std::array<u64, NUM_LOCK_BUCKETS> lock_wait_histogram = {};
+    /// Histogram of walltime the lock was held for
+    std::array<u64, NUM_LOCK_BUCKETS> lock_hold_histogram = {};
+    /// Number of reschedules requested for each core by scheduler unlocks
+    std::array<u64, Hardware::NUM_CPU_CORES> core_reschedules = {};
+    /// Number of times a runnable thread was moved to a different core
+    u64 thread_migrations = 0;
+};
+
 struct PerfStatsResults {
     /// System FPS (LCD VBlanks) in Hz
     double system_fps;
@@ -21,6 +44,14 @@ struct PerfStatsResults {
     double frametime;
     /// Ratio of walltime / emulated time elapsed
     double emulation_speed;
+    /// Mean walltime spent blocked on the host presentation engine per frame, in seconds
+    double present_latency;
+    /// Median walltime per system frame over the sampling window, in seconds
+    double frametime_p50;
+    /// 95th percentile walltime per system frame over the sampling window, in seconds
+    double frametime_p95;
+    /// 99th percentile walltime per system frame over the sampling window, in seconds
+    double frametime_p99;
 };
 
 /**
@@ -35,10 +66,31 @@ public:
 
     using Clock = std::chrono::high_resolution_clock;
 
+    /// Number of frametime histogram buckets. Buckets are exponentially sized between 0.25 ms
+    /// and roughly one second, giving ~7% relative precision over the whole range.
+    static constexpr std::size_t NUM_HISTOGRAM_BUCKETS = 128;
+
     void BeginSystemFrame();
     void EndSystemFrame();
     void EndGameFrame();
 
+    /// Records the time the renderer spent blocked on the host presentation engine for a frame.
+    void RecordPresentLatency(Clock::duration latency);
+
+    /// Attributes a span of GPU time to a named bucket. The bucket name must be statically
+    /// allocated. Spans are only collected while frame time recording is enabled and are dumped
+    /// as a chrome://tracing JSON file on shutdown.
+    void RecordGPUSpan(const char* bucket, u64 start_ns, u64 duration_ns);
+
+    /// Records that the current frame blocked on a subsystem, e.g. a shader compilation or an
+    /// ASTC decode. The subsystem name must be statically allocated. Frames that blow their
+    /// budget are attributed to the recorded events in the logs.
+    void RecordBlockingEvent(const char* subsystem, Clock::duration duration);
+
+    /// Stores the kernel scheduler counters so they are part of the shutdown summary. Called
+    /// once, after emulation has stopped but before the kernel is torn down.
+    void RecordSchedulerStats(const SchedulerStatistics& stats);
+
     PerfStatsResults GetAndResetStats(std::chrono::microseconds current_system_time_us);
 
     /**
@@ -46,6 +98,14 @@ public:
      */
     double GetMeanFrametime();
 
+    /// Returns the number of system frames presented since boot. Saturates once the history
+    /// buffer is full, after roughly an hour of emulation.
+    std::size_t GetFrameCount();
+
+    /// Returns a copy of the recorded frametime history in milliseconds, oldest first, with the
+    /// boot overhead frames removed.
+    std::vector<double> GetFrameTimeHistory();
+
     /**
      * Gets the ratio between walltime and the emulated time of the previous system frame. This is
      * useful for scaling inputs or outputs moving between the two time domains.
@@ -53,8 +113,33 @@ public:
     double GetLastFrameTimeScale();
 
 private:
+    /// A subsystem the current frame blocked on and for how long.
+    struct BlockingEvent {
+        const char* subsystem; ///< Statically allocated subsystem name
+        Clock::duration duration;
+    };
+
+    /// A completed span of GPU work attributed to a named bucket.
+    struct GPUSpan {
+        const char* bucket; ///< Statically allocated bucket name
+        u64 start_ns;       ///< Host clock time the span was issued at
+        u64 duration_ns;    ///< GPU time spent executing the span
+    };
+
     std::mutex object_mutex{};
 
+    /// GPU spans recorded by the renderer backends since boot.
+    std::vector<GPUSpan> gpu_spans;
+
+    /// Scheduler counters handed over by the kernel at shutdown.
+    SchedulerStatistics scheduler_stats{};
+
+    /// Blocking events recorded since the current frame began.
+    std::vector<BlockingEvent> frame_blocking_events;
+
+    /// Histogram of frametimes since the last reset, used for the percentile exports.
+    std::array<u32, NUM_HISTOGRAM_BUCKETS> frametime_histogram{};
+
     /// Title ID for the game that is running. 0 if there is no game running yet
     u64 title_id{0};
     /// Current index for writing to the perf_history array
@@ -75,6 +160,11 @@ private:
     /// Cumulative number of game frames (GSP frame submissions) since last reset
     u32 game_frames = 0;
 
+    /// Cumulative walltime spent blocked on the host presentation engine since last reset
+    Clock::duration accumulated_present_latency = Clock::duration::zero();
+    /// Cumulative number of frames presented to the host since last reset
+    u32 presented_frames = 0;
+
     /// Point when the previous system frame ended
     Clock::time_point previous_frame_end = reset_point;
     /// Point when the current system frame began
@@ -421,6 +421,16 @@ struct Values {
 
     // Core
     bool use_multi_core;
+    // Pin subsystem host threads (GPU, renderer, audio) to cores disjoint from the emulated
+    // cores. Only effective on hosts with at least six cores.
+    bool pin_host_threads;
+
+    // Per-title JIT profile, applied by the settings overlay on boot. The defaults are the safe
+    // configuration every title runs with; overlays may relax them for titles measured to
+    // tolerate it. Consumed by the dynarmic backends when building their configs.
+    bool cpu_jit_skip_misalignment_checks = false;
+    bool cpu_jit_relax_unpredictable = false;
+    u32 cpu_jit_minimum_run_cycles = 1000;
 
     // Data Storage
     bool use_virtual_sd;
@@ -473,6 +483,10 @@ struct Values {
     bool dump_exefs;
     bool dump_nso;
     bool reporting_services;
+    /// Collect per (service, command) IPC timing and log a summary at shutdown.
+    bool enable_ipc_trace;
+    /// Record the GPU command stream to a capture file for offline analysis and replay.
+    bool record_gpu_stream;
     bool quest_flag;
     bool disable_cpu_opt;
     bool disable_macro_jit;
@@ -501,4 +515,10 @@ std::string GetTimeZoneString();
 void Apply();
 void LogSettings();
 
+/// Applies the per-title settings overlay for the given title id, if one exists in the config
+/// directory. Overlays are small versioned binary files holding overrides for the
+/// performance-relevant settings, so they can be parsed during boot without going through the
+/// frontend configuration machinery; see settings.cpp for the on-disk layout.
+void LoadTitleOverlay(u64 title_id);
+
 } // namespace Settings
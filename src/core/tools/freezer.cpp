@@ -2,8 +2,13 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "common/thread_pool.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/core_timing_util.h"
@@ -32,37 +37,24 @@ u64 MemoryReadWidth(Core::Memory::Memory& memory, u32 width, VAddr addr) {
     }
 }
 
-void MemoryWriteWidth(Core::Memory::Memory& memory, u32 width, VAddr addr, u64 value) {
-    switch (width) {
-    case 1:
-        memory.Write8(addr, static_cast<u8>(value));
-        break;
-    case 2:
-        memory.Write16(addr, static_cast<u16>(value));
-        break;
-    case 4:
-        memory.Write32(addr, static_cast<u32>(value));
-        break;
-    case 8:
-        memory.Write64(addr, value);
-        break;
-    default:
-        UNREACHABLE();
-    }
-}
-
 } // Anonymous namespace
 
 Freezer::Freezer(Core::Timing::CoreTiming& core_timing_, Core::Memory::Memory& memory_)
     : core_timing{core_timing_}, memory{memory_} {
     event = Core::Timing::CreateEvent(
         "MemoryFreezer::FrameCallback",
-        [this](u64 userdata, s64 ns_late) { FrameCallback(userdata, ns_late); });
+        [](std::uintptr_t context, u64 userdata, s64 ns_late) {
+            reinterpret_cast<Freezer*>(context)->FrameCallback(userdata, ns_late);
+        },
+        reinterpret_cast<std::uintptr_t>(this));
     core_timing.ScheduleEvent(MEMORY_FREEZER_TICKS, event);
 }
 
 Freezer::~Freezer() {
     core_timing.UnscheduleEvent(event, 0);
+    if (enforce_work.valid()) {
+        enforce_work.wait();
+    }
 }
 
 void Freezer::SetActive(bool active) {
@@ -164,16 +156,73 @@ void Freezer::FrameCallback(u64 userdata, s64 ns_late) {
         return;
     }
 
+    // Enforce the frozen values on the shared worker pool so dozens of entries do not stall
+    // whichever guest core this event happens to run on. If the previous frame's enforcement
+    // is somehow still running, this frame is skipped rather than queued up behind it.
+    using namespace std::chrono_literals;
+    if (!enforce_work.valid() || enforce_work.wait_for(0s) == std::future_status::ready) {
+        enforce_work = Common::ThreadPool::GetPool().Push([this] { EnforceFrozenValues(); });
+    }
+
+    core_timing.ScheduleEvent(MEMORY_FREEZER_TICKS - ns_late, event);
+}
+
+void Freezer::EnforceFrozenValues() {
     std::lock_guard lock{entries_mutex};
 
-    for (const auto& entry : entries) {
-        LOG_DEBUG(Common_Memory,
-                  "Enforcing memory freeze at address={:016X}, value={:016X}, width={:02X}",
-                  entry.address, entry.value, entry.width);
-        MemoryWriteWidth(memory, entry.width, entry.address, entry.value);
+    if (entries.empty()) {
+        return;
     }
 
-    core_timing.ScheduleEvent(MEMORY_FREEZER_TICKS - ns_late, event);
+    // Group the entries by page so each page is serviced with one block read and at most one
+    // block write, instead of a read-modify-write per frozen value.
+    std::vector<const Entry*> sorted(entries.size());
+    std::transform(entries.begin(), entries.end(), sorted.begin(),
+                   [](const Entry& entry) { return &entry; });
+    std::sort(sorted.begin(), sorted.end(),
+              [](const Entry* lhs, const Entry* rhs) { return lhs->address < rhs->address; });
+
+    std::vector<u8> page_data;
+    for (std::size_t run_begin = 0; run_begin < sorted.size();) {
+        const VAddr page = sorted[run_begin]->address >> Core::Memory::PAGE_BITS;
+        std::size_t run_end = run_begin + 1;
+        while (run_end < sorted.size() &&
+               (sorted[run_end]->address >> Core::Memory::PAGE_BITS) == page) {
+            ++run_end;
+        }
+
+        const Entry& last = *sorted[run_end - 1];
+        const VAddr span_begin = sorted[run_begin]->address;
+        const std::size_t span_size = last.address + last.width - span_begin;
+        page_data.resize(span_size);
+        memory.ReadBlock(span_begin, page_data.data(), span_size);
+
+        bool dirty = false;
+        for (std::size_t i = run_begin; i < run_end; ++i) {
+            const Entry& entry = *sorted[i];
+            const std::size_t offset = entry.address - span_begin;
+            u64 current = 0;
+            std::memcpy(&current, page_data.data() + offset, entry.width);
+            const u64 frozen =
+                entry.width == 8 ? entry.value : entry.value & ((u64(1) << (entry.width * 8)) - 1);
+            if (current == frozen) {
+                continue;
+            }
+            LOG_DEBUG(Common_Memory,
+                      "Enforcing memory freeze at address={:016X}, value={:016X}, width={:02X}",
+                      entry.address, entry.value, entry.width);
+            std::memcpy(page_data.data() + offset, &entry.value, entry.width);
+            dirty = true;
+        }
+
+        // The untouched bytes in the span were read just above, so writing them back along
+        // with the patched values is a no-op for them.
+        if (dirty) {
+            memory.WriteBlock(span_begin, page_data.data(), span_size);
+        }
+
+        run_begin = run_end;
+    }
 }
 
 void Freezer::FillEntryReads() {
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <atomic>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -73,6 +74,7 @@ public:
 
 private:
     void FrameCallback(u64 userdata, s64 cycles_late);
+    void EnforceFrozenValues();
     void FillEntryReads();
 
     std::atomic_bool active{false};
@@ -80,6 +82,10 @@ private:
     mutable std::mutex entries_mutex;
     std::vector<Entry> entries;
 
+    /// Enforcement work dispatched to the shared thread pool for the current frame; waited on
+    /// during destruction so workers never outlive the freezer.
+    std::future<void> enforce_work;
+
     std::shared_ptr<Core::Timing::EventType> event;
     Core::Timing::CoreTiming& core_timing;
     Core::Memory::Memory& memory;
@@ -6,6 +6,7 @@
 #include <atomic>
 #include <cmath>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -49,31 +50,36 @@ static int SDLEventWatcher(void* user_data, SDL_Event* event) {
 class SDLJoystick {
 public:
     SDLJoystick(std::string guid_, int port_, SDL_Joystick* joystick)
-        : guid{std::move(guid_)}, port{port_}, sdl_joystick{joystick, &SDL_JoystickClose} {}
+        : snapshot{std::make_shared<const State>()}, guid{std::move(guid_)}, port{port_},
+          sdl_joystick{joystick, &SDL_JoystickClose} {}
 
     void SetButton(int button, bool value) {
         std::lock_guard lock{mutex};
         state.buttons.insert_or_assign(button, value);
+        Publish();
     }
 
     bool GetButton(int button) const {
-        std::lock_guard lock{mutex};
-        return state.buttons.at(button);
+        const auto current = std::atomic_load(&snapshot);
+        const auto it = current->buttons.find(button);
+        return it != current->buttons.end() && it->second;
     }
 
     void SetAxis(int axis, Sint16 value) {
         std::lock_guard lock{mutex};
         state.axes.insert_or_assign(axis, value);
+        Publish();
     }
 
     float GetAxis(int axis) const {
-        std::lock_guard lock{mutex};
-        return state.axes.at(axis) / 32767.0f;
+        return GetAxisFromState(*std::atomic_load(&snapshot), axis);
     }
 
     std::tuple<float, float> GetAnalog(int axis_x, int axis_y) const {
-        float x = GetAxis(axis_x);
-        float y = GetAxis(axis_y);
+        // Read both axes out of one snapshot so a stick position is never torn across updates.
+        const auto current = std::atomic_load(&snapshot);
+        float x = GetAxisFromState(*current, axis_x);
+        float y = GetAxisFromState(*current, axis_y);
         y = -y; // 3DS uses an y-axis inverse from SDL
 
         // Make sure the coordinates are in the unit circle,
@@ -91,11 +97,13 @@ public:
     void SetHat(int hat, Uint8 direction) {
         std::lock_guard lock{mutex};
         state.hats.insert_or_assign(hat, direction);
+        Publish();
     }
 
     bool GetHatDirection(int hat, Uint8 direction) const {
-        std::lock_guard lock{mutex};
-        return (state.hats.at(hat) & direction) != 0;
+        const auto current = std::atomic_load(&snapshot);
+        const auto it = current->hats.find(hat);
+        return it != current->hats.end() && (it->second & direction) != 0;
     }
     /**
      * The guid of the joystick
@@ -124,7 +132,23 @@ private:
         std::unordered_map<int, bool> buttons;
         std::unordered_map<int, Sint16> axes;
         std::unordered_map<int, Uint8> hats;
-    } state;
+    };
+
+    static float GetAxisFromState(const State& current, int axis) {
+        const auto it = current.axes.find(axis);
+        return (it != current.axes.end() ? it->second : 0) / 32767.0f;
+    }
+
+    /// Publishes a copy of the pending state for the readers. Must be called with mutex held.
+    void Publish() {
+        std::atomic_store(&snapshot, std::make_shared<const State>(state));
+    }
+
+    /// Pending state, written by the event thread under mutex.
+    State state;
+    /// Immutable snapshot republished after every event. The HID update path reads it without
+    /// taking any lock, so event bursts cannot add jitter to the core servicing the HID timer.
+    std::shared_ptr<const State> snapshot;
     std::string guid;
     int port;
     std::unique_ptr<SDL_Joystick, decltype(&SDL_JoystickClose)> sdl_joystick;
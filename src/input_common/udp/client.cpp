@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cmath>
 #include <cstring>
 #include <functional>
 #include <thread>
@@ -66,6 +67,24 @@ public:
 
 private:
     void HandleReceive(const boost::system::error_code& error, std::size_t bytes_transferred) {
+        ProcessPacket(bytes_transferred);
+
+        // Drain every datagram already queued on the socket before re-arming the async wait, so
+        // a burst of packets costs a single handler wake instead of one wake per datagram. The
+        // receive buffer is reused for each of them.
+        boost::system::error_code ec{};
+        while (socket.available(ec) > 0 && !ec) {
+            const std::size_t bytes =
+                socket.receive_from(boost::asio::buffer(receive_buffer), receive_endpoint, 0, ec);
+            if (ec) {
+                break;
+            }
+            ProcessPacket(bytes);
+        }
+        StartReceive();
+    }
+
+    void ProcessPacket(std::size_t bytes_transferred) {
         if (auto type = Response::Validate(receive_buffer.data(), bytes_transferred)) {
             switch (*type) {
             case Type::Version: {
@@ -89,7 +108,6 @@ private:
             }
             }
         }
-        StartReceive();
     }
 
     void HandleSend(const boost::system::error_code& error) {
@@ -141,6 +159,12 @@ Client::Client(std::shared_ptr<DeviceStatus> status, const std::string& host, u1
 Client::~Client() {
     socket->Stop();
     thread.join();
+    if (packets_received > 1) {
+        LOG_INFO(Input,
+                 "UDP pad statistics: {} packets, mean interval {:.2f} ms, jitter {:.2f} ms, "
+                 "peak gap {:.2f} ms",
+                 packets_received, smoothed_interval_ms, smoothed_jitter_ms, peak_interval_ms);
+    }
 }
 
 void Client::ReloadSocket(const std::string& host, u16 port, u8 pad_index, u32 client_id) {
@@ -167,22 +191,37 @@ void Client::OnPadData(Response::PadData data) {
         return;
     }
     packet_sequence = data.packet_counter;
+
+    // Arrival telemetry: smoothed interval/jitter in the style of the RFC 3550 estimator, plus
+    // the worst gap seen, so motion transport delay can be quantified.
+    const auto now = std::chrono::steady_clock::now();
+    if (packets_received++ > 0) {
+        const double interval_ms =
+            std::chrono::duration<double, std::milli>(now - last_arrival).count();
+        peak_interval_ms = std::max(peak_interval_ms, interval_ms);
+        smoothed_jitter_ms +=
+            (std::abs(interval_ms - smoothed_interval_ms) - smoothed_jitter_ms) / 16.0;
+        smoothed_interval_ms += (interval_ms - smoothed_interval_ms) / 16.0;
+    }
+    last_arrival = now;
+
     // TODO: Check how the Switch handles motions and how the CemuhookUDP motion
     // directions correspond to the ones of the Switch
     Common::Vec3f accel = Common::MakeVec<float>(data.accel.x, data.accel.y, data.accel.z);
     Common::Vec3f gyro = Common::MakeVec<float>(data.gyro.pitch, data.gyro.yaw, data.gyro.roll);
-    {
-        std::lock_guard guard(status->update_mutex);
 
-        status->motion_status = {accel, gyro};
+    DeviceStatus::Sample sample;
+    sample.motion_status = {accel, gyro};
 
-        // TODO: add a setting for "click" touch. Click touch refers to a device that differentiates
-        // between a simple "tap" and a hard press that causes the touch screen to click.
-        const bool is_active = data.touch_1.is_active != 0;
+    // TODO: add a setting for "click" touch. Click touch refers to a device that differentiates
+    // between a simple "tap" and a hard press that causes the touch screen to click.
+    const bool is_active = data.touch_1.is_active != 0;
 
-        float x = 0;
-        float y = 0;
+    float x = 0;
+    float y = 0;
 
+    {
+        std::lock_guard guard(status->update_mutex);
         if (is_active && status->touch_calibration) {
             const u16 min_x = status->touch_calibration->min_x;
             const u16 max_x = status->touch_calibration->max_x;
@@ -194,9 +233,10 @@ void Client::OnPadData(Response::PadData data) {
             y = (std::clamp(static_cast<u16>(data.touch_1.y), min_y, max_y) - min_y) /
                 static_cast<float>(max_y - min_y);
         }
-
-        status->touch_status = {x, y, is_active};
     }
+
+    sample.touch_status = {x, y, is_active};
+    status->PublishSample(sample);
 }
 
 void Client::StartCommunication(const std::string& host, u16 port, u8 pad_index, u32 client_id) {
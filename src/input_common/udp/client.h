@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -29,9 +31,36 @@ struct Version;
 } // namespace Response
 
 struct DeviceStatus {
+    /// A complete motion/touch sample. Published as a unit so readers never observe a mix of
+    /// two packets.
+    struct Sample {
+        std::tuple<Common::Vec3<float>, Common::Vec3<float>> motion_status;
+        std::tuple<float, float, bool> touch_status;
+    };
+
+    /// Publishes a new sample without allocating. Must only be called from the receive thread.
+    void PublishSample(const Sample& sample) {
+        sample_version.fetch_add(1, std::memory_order_acq_rel); // odd: write in progress
+        latest_sample = sample;
+        sample_version.fetch_add(1, std::memory_order_release);
+    }
+
+    /// Returns the latest complete sample. Lock-free; never blocks the receive thread.
+    Sample ReadLatestSample() const {
+        while (true) {
+            const u32 before = sample_version.load(std::memory_order_acquire);
+            if ((before & 1) == 0) {
+                const Sample sample = latest_sample;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sample_version.load(std::memory_order_relaxed) == before) {
+                    return sample;
+                }
+            }
+        }
+    }
+
+    /// Guards touch_calibration; the sample slot is synchronized by sample_version instead.
     std::mutex update_mutex;
-    std::tuple<Common::Vec3<float>, Common::Vec3<float>> motion_status;
-    std::tuple<float, float, bool> touch_status;
 
     // calibration data for scaling the device's touch area to 3ds
     struct CalibrationData {
@@ -41,6 +70,10 @@ struct DeviceStatus {
         u16 max_y{};
     };
     std::optional<CalibrationData> touch_calibration;
+
+private:
+    Sample latest_sample{};
+    std::atomic<u32> sample_version{0};
 };
 
 class Client {
@@ -61,6 +94,14 @@ private:
     std::shared_ptr<DeviceStatus> status;
     std::thread thread;
     u64 packet_sequence = 0;
+
+    /// Packet arrival telemetry, so motion transport jitter can be quantified. Updated on the
+    /// receive thread only; a summary is logged when the client shuts down.
+    u64 packets_received = 0;
+    std::chrono::steady_clock::time_point last_arrival{};
+    double smoothed_interval_ms = 0.0;
+    double smoothed_jitter_ms = 0.0;
+    double peak_interval_ms = 0.0;
 };
 
 /// An async job allowing configuration of the touchpad calibration.
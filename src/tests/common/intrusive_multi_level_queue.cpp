@@ -0,0 +1,86 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "common/intrusive_multi_level_queue.h"
+
+namespace Common {
+
+namespace {
+struct DummyThread {
+    explicit DummyThread(f32 value) : value{value} {}
+
+    IntrusiveMultiLevelQueueLink<DummyThread>& GetMultiLevelQueueLink(std::size_t slot) {
+        return links[slot];
+    }
+
+    f32 value;
+    std::array<IntrusiveMultiLevelQueueLink<DummyThread>, 2> links{};
+};
+} // Anonymous namespace
+
+TEST_CASE("IntrusiveMultiLevelQueue", "[common]") {
+    std::array<DummyThread, 8> values = {DummyThread{0.0}, DummyThread{5.0}, DummyThread{1.0},
+                                         DummyThread{9.0}, DummyThread{8.0}, DummyThread{2.0},
+                                         DummyThread{6.0}, DummyThread{7.0}};
+    Common::IntrusiveMultiLevelQueue<DummyThread, 64> mlq;
+    REQUIRE(mlq.empty());
+    mlq.add(&values[2], 2);
+    mlq.add(&values[7], 7);
+    mlq.add(&values[3], 3);
+    mlq.add(&values[4], 4);
+    mlq.add(&values[0], 0);
+    mlq.add(&values[5], 5);
+    mlq.add(&values[6], 6);
+    mlq.add(&values[1], 1);
+    u32 index = 0;
+    bool all_set = true;
+    for (auto* thread : mlq) {
+        all_set &= (thread == &values[index]);
+        index++;
+    }
+    REQUIRE(all_set);
+    REQUIRE(!mlq.empty());
+    REQUIRE(mlq.size() == 8);
+    DummyThread front{8.0};
+    mlq.add(&front, 2, false);
+    REQUIRE(mlq.front(2) == &front);
+    mlq.yield(2);
+    REQUIRE(mlq.front(2) == &values[2]);
+    REQUIRE(mlq.size(2) == 2);
+    REQUIRE(mlq.empty(8));
+    DummyThread moved{10.0};
+    mlq.add(&moved, 8);
+    mlq.remove(&moved, 8);
+    mlq.add(&moved, 9);
+    REQUIRE(mlq.front(9) == &moved);
+    REQUIRE(mlq.empty(8));
+    REQUIRE(!mlq.empty(9));
+    mlq.remove(&values[0], 0);
+    REQUIRE(mlq.highest_priority_set() == 1);
+    mlq.remove(&values[1], 1);
+    REQUIRE(mlq.highest_priority_set() == 2);
+    REQUIRE(mlq.empty(1));
+    // Removing an element that is not queued at the given priority is a no-op.
+    mlq.remove(&values[1], 1);
+    REQUIRE(mlq.empty(1));
+
+    // The same element can sit in several queues at once, one link slot each.
+    Common::IntrusiveMultiLevelQueue<DummyThread, 64> other;
+    other.SetLinkSlot(1);
+    other.add(&values[2], 30);
+    REQUIRE(other.front() == &values[2]);
+    REQUIRE(mlq.front(2) == &values[2]);
+    other.clear();
+    REQUIRE(other.empty());
+    REQUIRE(mlq.front(2) == &values[2]);
+
+    mlq.clear();
+    REQUIRE(mlq.empty());
+    REQUIRE(mlq.size() == 0);
+}
+
+} // namespace Common
@@ -0,0 +1,102 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "common/mpmc_queue.h"
+
+namespace Common {
+
+TEST_CASE("MPMCQueue: Basic Operation", "[common]") {
+    MPMCQueue<u64, 8> queue;
+    REQUIRE(queue.Empty());
+
+    // Elements come back out in push order.
+    for (u64 i = 0; i < 8; ++i) {
+        REQUIRE(queue.TryPush(i));
+    }
+    REQUIRE(queue.Size() == 8);
+
+    // The queue is bounded; a ninth push must fail.
+    REQUIRE(!queue.TryPush(u64{8}));
+
+    u64 value{};
+    REQUIRE(queue.TryPop(value));
+    REQUIRE(value == 0);
+
+    // Popping frees a slot for a new push, wrapping the ring.
+    REQUIRE(queue.TryPush(u64{8}));
+    for (u64 expected = 1; expected <= 8; ++expected) {
+        REQUIRE(queue.TryPop(value));
+        REQUIRE(value == expected);
+    }
+    REQUIRE(!queue.TryPop(value));
+}
+
+TEST_CASE("MPMCQueue: Batched Pop", "[common]") {
+    MPMCQueue<u64, 16> queue;
+    for (u64 i = 0; i < 10; ++i) {
+        queue.Push(i);
+    }
+
+    // A batch drains as many elements as are available, up to the requested count.
+    std::array<u64, 16> batch{};
+    REQUIRE(queue.PopBatch(batch.data(), 4) == 4);
+    REQUIRE(batch[0] == 0);
+    REQUIRE(batch[3] == 3);
+    REQUIRE(queue.PopBatch(batch.data(), batch.size()) == 6);
+    REQUIRE(batch[5] == 9);
+    REQUIRE(queue.PopBatch(batch.data(), batch.size()) == 0);
+}
+
+TEST_CASE("MPMCQueue: Multiple Producers And Consumers", "[common]") {
+    constexpr std::size_t NumProducers = 4;
+    constexpr std::size_t ElementsPerProducer = 4096;
+    constexpr std::size_t NumElements = NumProducers * ElementsPerProducer;
+
+    MPMCQueue<u64, 64> queue;
+    std::atomic<u64> popped_sum{0};
+    std::atomic<std::size_t> popped_count{0};
+
+    std::vector<std::thread> consumers;
+    for (std::size_t i = 0; i < 2; ++i) {
+        consumers.emplace_back([&] {
+            std::array<u64, 32> batch;
+            while (popped_count.load() < NumElements) {
+                const std::size_t count = queue.PopBatch(batch.data(), batch.size());
+                for (std::size_t j = 0; j < count; ++j) {
+                    popped_sum += batch[j];
+                }
+                popped_count += count;
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (std::size_t i = 0; i < NumProducers; ++i) {
+        producers.emplace_back([&, i] {
+            for (std::size_t j = 0; j < ElementsPerProducer; ++j) {
+                queue.Push(static_cast<u64>(i * ElementsPerProducer + j));
+            }
+        });
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+
+    // Every element was consumed exactly once.
+    REQUIRE(popped_count == NumElements);
+    REQUIRE(popped_sum == u64{NumElements} * (NumElements - 1) / 2);
+}
+
+} // namespace Common
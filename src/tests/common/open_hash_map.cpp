@@ -0,0 +1,83 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstddef>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "common/open_hash_map.h"
+
+namespace Common {
+
+TEST_CASE("OpenHashMap: Basic Tests", "[common]") {
+    OpenHashMap<u64, int> map;
+
+    REQUIRE(map.Empty());
+    REQUIRE(map.Find(42) == nullptr);
+
+    map[42] = 7;
+    REQUIRE(map.Size() == 1);
+    REQUIRE(map.Find(42) != nullptr);
+    REQUIRE(*map.Find(42) == 7);
+
+    // operator[] on an existing key returns the stored value.
+    map[42] = 8;
+    REQUIRE(map.Size() == 1);
+    REQUIRE(*map.Find(42) == 8);
+
+    // operator[] on a missing key default constructs the value.
+    REQUIRE(map[100] == 0);
+    REQUIRE(map.Size() == 2);
+}
+
+TEST_CASE("OpenHashMap: Erase", "[common]") {
+    OpenHashMap<u64, int> map;
+
+    map[1] = 10;
+    map[2] = 20;
+
+    REQUIRE(map.Erase(1));
+    REQUIRE(map.Size() == 1);
+    REQUIRE(map.Find(1) == nullptr);
+    REQUIRE(*map.Find(2) == 20);
+
+    // Erasing a missing key is a no-op.
+    REQUIRE(!map.Erase(1));
+    REQUIRE(map.Size() == 1);
+
+    // Tombstones must not break probing for keys inserted afterwards.
+    map[1] = 30;
+    REQUIRE(*map.Find(1) == 30);
+}
+
+TEST_CASE("OpenHashMap: Growth", "[common]") {
+    // Start intentionally small to force several rehashes. Page-aligned keys exercise the hash
+    // mixing of low entropy pointer-like keys.
+    OpenHashMap<u64, u64> map(1);
+
+    constexpr std::size_t count = 1000;
+    for (std::size_t i = 0; i < count; ++i) {
+        map[i << 12] = i;
+    }
+    REQUIRE(map.Size() == count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const u64* const value = map.Find(i << 12);
+        REQUIRE(value != nullptr);
+        REQUIRE(*value == i);
+    }
+
+    // Erase every other entry and reinsert to churn tombstones through a rehash.
+    for (std::size_t i = 0; i < count; i += 2) {
+        REQUIRE(map.Erase(i << 12));
+    }
+    REQUIRE(map.Size() == count / 2);
+    for (std::size_t i = 0; i < count; i += 2) {
+        map[i << 12] = i + 1;
+    }
+    REQUIRE(map.Size() == count);
+    REQUIRE(*map.Find(0) == 1);
+    REQUIRE(*map.Find(2 << 12) == 3);
+    REQUIRE(*map.Find(1 << 12) == 1);
+}
+
+} // namespace Common
@@ -76,6 +76,59 @@ TEST_CASE("RingBuffer: Basic Tests", "[common]") {
     REQUIRE(buf.Size() == 0);
 }
 
+TEST_CASE("RingBuffer: Reserve and Commit", "[common]") {
+    RingBuffer<char, 4, 1> buf;
+
+    // A reserved slice of an empty buffer spans the whole array.
+    {
+        const auto slice = buf.Reserve(4);
+        REQUIRE(slice.slot_count == 4);
+        for (std::size_t i = 0; i < 3; i++) {
+            slice.data[i] = static_cast<char>(i);
+        }
+        // Committing fewer slots than reserved publishes only those.
+        buf.Commit(3);
+    }
+
+    REQUIRE(buf.Size() == 3);
+
+    // Reservations are clamped to the contiguous run before the wrap-around point.
+    {
+        const auto slice = buf.Reserve(4);
+        REQUIRE(slice.slot_count == 1);
+        slice.data[0] = 3;
+        buf.Commit(1);
+    }
+
+    REQUIRE(buf.Size() == 4);
+
+    // A full buffer hands out an empty slice.
+    REQUIRE(buf.Reserve(4).slot_count == 0);
+
+    {
+        const std::vector<char> popped = buf.Pop(2);
+        REQUIRE(popped.size() == 2);
+        REQUIRE(popped[0] == 0);
+        REQUIRE(popped[1] == 1);
+    }
+
+    // After popping past the wrap, the freed slots at the front become reservable again.
+    {
+        const auto slice = buf.Reserve(4);
+        REQUIRE(slice.slot_count == 2);
+        slice.data[0] = 4;
+        slice.data[1] = 5;
+        buf.Commit(2);
+    }
+
+    const std::vector<char> popped = buf.Pop();
+    REQUIRE(popped.size() == 4);
+    REQUIRE(popped[0] == 2);
+    REQUIRE(popped[1] == 3);
+    REQUIRE(popped[2] == 4);
+    REQUIRE(popped[3] == 5);
+}
+
 TEST_CASE("RingBuffer: Threaded Test", "[common]") {
     RingBuffer<char, 4, 2> buf;
     const char seed = 42;
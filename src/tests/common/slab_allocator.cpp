@@ -0,0 +1,57 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/slab_allocator.h"
+
+namespace Common {
+
+TEST_CASE("SlabAllocator: Entries are recycled", "[common]") {
+    SlabAllocator<u64> allocator;
+
+    u64* const first = allocator.allocate(1);
+    *first = 0xdeadbeef;
+    allocator.deallocate(first, 1);
+
+    // A freed entry is handed back out before the pool grows.
+    u64* const second = allocator.allocate(1);
+    REQUIRE(first == second);
+    allocator.deallocate(second, 1);
+}
+
+TEST_CASE("SlabAllocator: Distinct live allocations", "[common]") {
+    SlabAllocator<u64> allocator;
+    constexpr std::size_t num_entries = 1000;
+
+    std::vector<u64*> entries;
+    for (std::size_t i = 0; i < num_entries; ++i) {
+        u64* const entry = allocator.allocate(1);
+        *entry = i;
+        entries.push_back(entry);
+    }
+
+    for (std::size_t i = 0; i < num_entries; ++i) {
+        REQUIRE(*entries[i] == i);
+        allocator.deallocate(entries[i], 1);
+    }
+}
+
+TEST_CASE("SlabAllocator: Shared pointer integration", "[common]") {
+    struct Object {
+        explicit Object(int value) : value{value} {}
+        int value;
+    };
+
+    auto object = MakeSlabShared<Object>(42);
+    REQUIRE(object->value == 42);
+
+    std::weak_ptr<Object> weak = object;
+    object.reset();
+    REQUIRE(weak.expired());
+}
+
+} // namespace Common
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "common/alignment.h"
 #include "common/common_types.h"
@@ -15,6 +17,11 @@ namespace VideoCommon {
 
 class BufferBlock {
 public:
+    /// Bytes covered by one bit of the GPU write mask.
+    static constexpr std::size_t WRITTEN_BYTES_PER_BIT = 4;
+    /// Bytes covered by one storage word of the GPU write mask.
+    static constexpr std::size_t WRITTEN_BYTES_PER_WORD = WRITTEN_BYTES_PER_BIT * 64;
+
     bool Overlaps(VAddr start, VAddr end) const {
         return (cpu_addr < end) && (cpu_addr_end > start);
     }
@@ -52,16 +59,83 @@ public:
         epoch = new_epoch;
     }
 
+    /// Marks a range of the block as written by the GPU. The mask is allocated on first use, so
+    /// blocks that never hold GPU-written data carry no extra storage.
+    void MarkWritten(std::size_t offset, std::size_t mark_size) {
+        if (write_mask.empty()) {
+            write_mask.resize((size + WRITTEN_BYTES_PER_WORD - 1) / WRITTEN_BYTES_PER_WORD);
+        }
+        const std::size_t first_bit = offset / WRITTEN_BYTES_PER_BIT;
+        const std::size_t last_bit = (offset + mark_size - 1) / WRITTEN_BYTES_PER_BIT;
+        for (std::size_t word = first_bit / 64; word <= last_bit / 64; ++word) {
+            write_mask[word] |= WordMask(word, first_bit, last_bit);
+        }
+    }
+
+    /// Clears the written bits covering a range of the block.
+    void UnmarkWritten(std::size_t offset, std::size_t unmark_size) {
+        if (write_mask.empty()) {
+            return;
+        }
+        const std::size_t first_bit = offset / WRITTEN_BYTES_PER_BIT;
+        const std::size_t last_bit = (offset + unmark_size - 1) / WRITTEN_BYTES_PER_BIT;
+        for (std::size_t word = first_bit / 64; word <= last_bit / 64; ++word) {
+            write_mask[word] &= ~WordMask(word, first_bit, last_bit);
+        }
+    }
+
+    /// Returns true when any byte in the given range is marked as GPU written.
+    bool IsWrittenRegion(std::size_t offset, std::size_t query_size) const {
+        if (write_mask.empty()) {
+            return false;
+        }
+        const std::size_t first_bit = offset / WRITTEN_BYTES_PER_BIT;
+        const std::size_t last_bit = (offset + query_size - 1) / WRITTEN_BYTES_PER_BIT;
+        for (std::size_t word = first_bit / 64; word <= last_bit / 64; ++word) {
+            if ((write_mask[word] & WordMask(word, first_bit, last_bit)) != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Merges another block's write mask into this one. The offset comes from block placement,
+    /// which is BLOCK_PAGE_SIZE aligned, so the copy is always mask-word aligned.
+    void InheritWriteMask(const BufferBlock& other, std::size_t offset) {
+        if (other.write_mask.empty()) {
+            return;
+        }
+        if (write_mask.empty()) {
+            write_mask.resize((size + WRITTEN_BYTES_PER_WORD - 1) / WRITTEN_BYTES_PER_WORD);
+        }
+        const std::size_t word_offset = offset / WRITTEN_BYTES_PER_WORD;
+        for (std::size_t word = 0; word < other.write_mask.size(); ++word) {
+            write_mask[word_offset + word] |= other.write_mask[word];
+        }
+    }
+
 protected:
     explicit BufferBlock(VAddr cpu_addr_, std::size_t size_) : size{size_} {
         SetCpuAddr(cpu_addr_);
     }
 
 private:
+    /// Returns the bits of a mask word that fall inside [first_bit, last_bit].
+    static u64 WordMask(std::size_t word, std::size_t first_bit, std::size_t last_bit) {
+        const std::size_t base = word * 64;
+        const std::size_t low = first_bit > base ? first_bit - base : 0;
+        const std::size_t high = std::min<std::size_t>(last_bit - base, 63);
+        const u64 high_mask = high == 63 ? ~u64{0} : (u64{1} << (high + 1)) - 1;
+        return high_mask & ~((u64{1} << low) - 1);
+    }
+
     VAddr cpu_addr{};
     VAddr cpu_addr_end{};
     std::size_t size{};
     u64 epoch{};
+    /// One bit per WRITTEN_BYTES_PER_BIT bytes, set while a GPU-written map covers them. Empty
+    /// until the block first holds written data.
+    std::vector<u64> write_mask;
 };
 
 } // namespace VideoCommon
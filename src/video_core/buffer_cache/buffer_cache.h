@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -14,7 +15,6 @@
 
 #include <boost/container/small_vector.hpp>
 #include <boost/icl/interval_set.hpp>
-#include <boost/intrusive/set.hpp>
 
 #include "common/alignment.h"
 #include "common/assert.h"
@@ -36,9 +36,13 @@ class BufferCache {
     using IntervalType = typename IntervalSet::interval_type;
     using VectorMapInterval = boost::container::small_vector<MapInterval*, 1>;
 
-    static constexpr u64 WRITE_PAGE_BIT = 11;
     static constexpr u64 BLOCK_PAGE_BITS = 21;
     static constexpr u64 BLOCK_PAGE_SIZE = 1ULL << BLOCK_PAGE_BITS;
+    static constexpr u64 REGISTRY_PAGE_BITS = 16;
+
+    // Cache management is a big overhead, so only cache entries with a given size.
+    // TODO: Figure out which size is the best for given games.
+    static constexpr std::size_t MAX_STREAM_SIZE = 0x800;
 
 public:
     struct BufferInfo {
@@ -47,8 +51,14 @@ public:
         u64 address;
     };
 
+    struct SmallUploadEntry {
+        GPUVAddr gpu_addr;
+        std::size_t size;
+    };
+
     BufferInfo UploadMemory(GPUVAddr gpu_addr, std::size_t size, std::size_t alignment = 4,
-                            bool is_written = false, bool use_fast_cbuf = false) {
+                            bool is_written = false, bool use_fast_cbuf = false,
+                            bool prefer_cached = false) {
         std::lock_guard lock{mutex};
 
         auto& memory_manager = system.GPU().MemoryManager();
@@ -58,10 +68,9 @@ public:
         }
         const VAddr cpu_addr = *cpu_addr_opt;
 
-        // Cache management is a big overhead, so only cache entries with a given size.
-        // TODO: Figure out which size is the best for given games.
-        constexpr std::size_t max_stream_size = 0x800;
-        if (use_fast_cbuf || size < max_stream_size) {
+        // Callers that rebind the same data every pass can prefer the cached path, where the
+        // written page tracking skips re-reading guest memory that has not changed.
+        if (use_fast_cbuf || (size < MAX_STREAM_SIZE && !prefer_cached)) {
             if (!is_written && !IsRegionWritten(cpu_addr, cpu_addr + size - 1)) {
                 const bool is_granular = memory_manager.IsGranularRange(gpu_addr, size);
                 if (use_fast_cbuf) {
@@ -89,23 +98,78 @@ public:
             }
         }
 
-        Buffer* const block = GetBlock(cpu_addr, size);
-        MapInterval* const map = MapAddress(block, gpu_addr, cpu_addr, size);
-        if (!map) {
-            return GetEmptyBuffer(size);
-        }
-        if (is_written) {
-            map->MarkAsModified(true, GetModifiedTicks());
-            if (Settings::IsGPULevelHigh() && Settings::values.use_asynchronous_gpu_emulation) {
-                MarkForAsyncFlush(map);
+        return CachedBufferUpload(gpu_addr, cpu_addr, size, is_written);
+    }
+
+    /**
+     * Uploads a batch of small reads packed into a single stream buffer reservation. Entries
+     * qualifying for the stream fast path share one allocation and lock acquisition instead of
+     * paying them once per buffer; the rest take the regular cached path. Batched entries are
+     * never marked as written, matching UploadMemory's defaults. Results are stored in entry
+     * order.
+     */
+    void UploadMemoryBatch(const SmallUploadEntry* entries, std::size_t count,
+                           std::size_t alignment, BufferInfo* infos) {
+        std::lock_guard lock{mutex};
+        auto& memory_manager = system.GPU().MemoryManager();
+
+        struct StreamEntry {
+            std::size_t index;
+            std::size_t offset;
+        };
+        struct CachedEntry {
+            std::size_t index;
+            VAddr cpu_addr;
+        };
+        boost::container::small_vector<StreamEntry, 16> stream_entries;
+        boost::container::small_vector<CachedEntry, 4> cached_entries;
+
+        // Measure how much stream buffer memory the batch needs before writing anything, packing
+        // qualifying entries at the shared alignment.
+        std::size_t stream_size = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const SmallUploadEntry& entry = entries[i];
+            const std::optional<VAddr> cpu_addr = memory_manager.GpuToCpuAddress(entry.gpu_addr);
+            if (!cpu_addr) {
+                infos[i] = GetEmptyBuffer(entry.size);
+                continue;
             }
-            if (!map->is_written) {
-                map->is_written = true;
-                MarkRegionAsWritten(map->start, map->end - 1);
+            if (entry.size < MAX_STREAM_SIZE &&
+                !IsRegionWritten(*cpu_addr, *cpu_addr + entry.size - 1)) {
+                stream_size = Common::AlignUp(stream_size, alignment);
+                stream_entries.push_back({i, stream_size});
+                stream_size += entry.size;
+            } else {
+                cached_entries.push_back({i, *cpu_addr});
             }
         }
 
-        return BufferInfo{block->Handle(), block->Offset(cpu_addr), block->Address()};
+        if (stream_size > 0) {
+            AlignBuffer(alignment);
+            const std::size_t base_offset = buffer_offset;
+            u8* const base_ptr = buffer_ptr;
+            buffer_ptr += stream_size;
+            buffer_offset += stream_size;
+
+            for (const StreamEntry& stream_entry : stream_entries) {
+                const SmallUploadEntry& entry = entries[stream_entry.index];
+                u8* const dest = base_ptr + stream_entry.offset;
+                if (memory_manager.IsGranularRange(entry.gpu_addr, entry.size)) {
+                    std::memcpy(dest, memory_manager.GetPointer(entry.gpu_addr), entry.size);
+                } else {
+                    memory_manager.ReadBlockUnsafe(entry.gpu_addr, dest, entry.size);
+                }
+                infos[stream_entry.index] =
+                    BufferInfo{stream_buffer->Handle(), base_offset + stream_entry.offset,
+                               stream_buffer->Address()};
+            }
+        }
+
+        for (const CachedEntry& cached_entry : cached_entries) {
+            const SmallUploadEntry& entry = entries[cached_entry.index];
+            infos[cached_entry.index] =
+                CachedBufferUpload(entry.gpu_addr, cached_entry.cpu_addr, entry.size, false);
+        }
     }
 
     /// Uploads from a host memory. Returns the OpenGL buffer where it's located and its offset.
@@ -291,7 +355,11 @@ protected:
         }
         MapInterval* const storage = mapped_addresses_allocator.Allocate();
         *storage = new_map;
-        mapped_addresses.insert(*storage);
+
+        const VAddr page_end = (new_map.end - 1) >> REGISTRY_PAGE_BITS;
+        for (VAddr page = new_map.start >> REGISTRY_PAGE_BITS; page <= page_end; ++page) {
+            registry[page].push_back(storage);
+        }
         return storage;
     }
 
@@ -315,13 +383,39 @@ protected:
         if (map->is_written) {
             UnmarkRegionAsWritten(map->start, map->end - 1);
         }
-        const auto it = mapped_addresses.find(*map);
-        ASSERT(it != mapped_addresses.end());
-        mapped_addresses.erase(it);
+        const VAddr page_end = (map->end - 1) >> REGISTRY_PAGE_BITS;
+        for (VAddr page = map->start >> REGISTRY_PAGE_BITS; page <= page_end; ++page) {
+            auto& maps = registry[page];
+            const auto it = std::find(maps.begin(), maps.end(), map);
+            ASSERT(it != maps.end());
+            maps.erase(it);
+        }
         mapped_addresses_allocator.Release(map);
     }
 
 private:
+    /// Uploads a region through the cached path, registering its map interval.
+    BufferInfo CachedBufferUpload(GPUVAddr gpu_addr, VAddr cpu_addr, std::size_t size,
+                                  bool is_written) {
+        Buffer* const block = GetBlock(cpu_addr, size);
+        MapInterval* const map = MapAddress(block, gpu_addr, cpu_addr, size);
+        if (!map) {
+            return GetEmptyBuffer(size);
+        }
+        if (is_written) {
+            map->MarkAsModified(true, GetModifiedTicks());
+            if (Settings::IsGPULevelHigh() && Settings::values.use_asynchronous_gpu_emulation) {
+                MarkForAsyncFlush(map);
+            }
+            if (!map->is_written) {
+                map->is_written = true;
+                MarkRegionAsWritten(map->start, map->end - 1);
+            }
+        }
+
+        return BufferInfo{block->Handle(), block->Offset(cpu_addr), block->Address()};
+    }
+
     MapInterval* MapAddress(Buffer* block, GPUVAddr gpu_addr, VAddr cpu_addr, std::size_t size) {
         const VectorMapInterval overlaps = GetMapsInRange(cpu_addr, size);
         if (overlaps.empty()) {
@@ -402,15 +496,21 @@ private:
         }
 
         const VAddr addr_end = addr + size;
-        auto it = mapped_addresses.lower_bound(addr);
-        if (it != mapped_addresses.begin()) {
-            --it;
-        }
-        while (it != mapped_addresses.end() && it->start < addr_end) {
-            if (it->Overlaps(addr, addr_end)) {
-                result.push_back(&*it);
+        const VAddr page_end = (addr_end - 1) >> REGISTRY_PAGE_BITS;
+        for (VAddr page = addr >> REGISTRY_PAGE_BITS; page <= page_end; ++page) {
+            const auto it = registry.find(page);
+            if (it == registry.end()) {
+                continue;
+            }
+            for (MapInterval* const map : it->second) {
+                if (!map->Overlaps(addr, addr_end)) {
+                    continue;
+                }
+                // Maps spanning several pages are registered in each of them, drop duplicates
+                if (std::find(result.begin(), result.end(), map) == result.end()) {
+                    result.push_back(map);
+                }
             }
-            ++it;
         }
         return result;
     }
@@ -457,6 +557,7 @@ private:
         const VAddr cpu_addr = buffer->CpuAddr();
         std::shared_ptr<Buffer> new_buffer = CreateBlock(cpu_addr, new_size);
         new_buffer->CopyFrom(*buffer, 0, 0, old_size);
+        new_buffer->InheritWriteMask(*buffer, 0);
         QueueDestruction(std::move(buffer));
 
         const VAddr cpu_addr_end = cpu_addr + new_size - 1;
@@ -480,6 +581,8 @@ private:
         std::shared_ptr<Buffer> new_buffer = CreateBlock(new_addr, new_size);
         new_buffer->CopyFrom(*first, 0, new_buffer->Offset(first_addr), size_1);
         new_buffer->CopyFrom(*second, 0, new_buffer->Offset(second_addr), size_2);
+        new_buffer->InheritWriteMask(*first, new_buffer->Offset(first_addr));
+        new_buffer->InheritWriteMask(*second, new_buffer->Offset(second_addr));
         QueueDestruction(std::move(first));
         QueueDestruction(std::move(second));
 
@@ -519,38 +622,79 @@ private:
         return found.get();
     }
 
-    void MarkRegionAsWritten(VAddr start, VAddr end) {
-        const u64 page_end = end >> WRITE_PAGE_BIT;
-        for (u64 page_start = start >> WRITE_PAGE_BIT; page_start <= page_end; ++page_start) {
-            auto it = written_pages.find(page_start);
-            if (it != written_pages.end()) {
-                it->second = it->second + 1;
-            } else {
-                written_pages.insert_or_assign(page_start, 1);
+    /// Walks the blocks overlapping [start, end), invoking func with the block and the
+    /// block-local offset and size of the covered piece. Pages without a block are skipped.
+    template <typename Func>
+    void ForEachBlockInRange(VAddr start, VAddr end, Func&& func) {
+        VAddr addr = start;
+        while (addr < end) {
+            const auto it = blocks.find(addr >> BLOCK_PAGE_BITS);
+            if (it == blocks.end()) {
+                addr = ((addr >> BLOCK_PAGE_BITS) + 1) << BLOCK_PAGE_BITS;
+                continue;
             }
+            Buffer& block = *it->second;
+            const VAddr range_end = std::min(end, block.CpuAddrEnd());
+            func(block, block.Offset(addr), static_cast<std::size_t>(range_end - addr));
+            addr = range_end;
         }
     }
 
+    /// Returns true when a registered written map other than the one being unregistered covers
+    /// part of the mask word starting at word_addr.
+    bool IsWordSharedWithWrittenMap(VAddr word_addr) {
+        const VectorMapInterval maps =
+            GetMapsInRange(word_addr, BufferBlock::WRITTEN_BYTES_PER_BIT);
+        return std::any_of(maps.begin(), maps.end(), [](const MapInterval* map) {
+            return map->is_written && map->is_registered;
+        });
+    }
+
+    void MarkRegionAsWritten(VAddr start, VAddr end) {
+        ForEachBlockInRange(start, end + 1, [](Buffer& block, std::size_t offset,
+                                               std::size_t size) {
+            block.MarkWritten(offset, size);
+        });
+    }
+
     void UnmarkRegionAsWritten(VAddr start, VAddr end) {
-        const u64 page_end = end >> WRITE_PAGE_BIT;
-        for (u64 page_start = start >> WRITE_PAGE_BIT; page_start <= page_end; ++page_start) {
-            auto it = written_pages.find(page_start);
-            if (it != written_pages.end()) {
-                if (it->second > 1) {
-                    it->second = it->second - 1;
-                } else {
-                    written_pages.erase(it);
-                }
-            }
+        // Registered maps are byte-disjoint, but the mask words at the region's edges can be
+        // shared with a neighbouring written map; keep those bits set so the neighbour's writes
+        // stay tracked. Stale boundary bits only steer uploads to the cached path, they are
+        // never a correctness problem.
+        constexpr VAddr word_size = BufferBlock::WRITTEN_BYTES_PER_BIT;
+        VAddr clear_start = Common::AlignDown(start, word_size);
+        VAddr clear_end = Common::AlignUp(end + 1, word_size);
+        if (clear_start < start && IsWordSharedWithWrittenMap(clear_start)) {
+            clear_start += word_size;
+        }
+        if (clear_end > end + 1 && IsWordSharedWithWrittenMap(clear_end - word_size)) {
+            clear_end -= word_size;
+        }
+        if (clear_start >= clear_end) {
+            return;
         }
+        ForEachBlockInRange(clear_start, clear_end, [](Buffer& block, std::size_t offset,
+                                                       std::size_t size) {
+            block.UnmarkWritten(offset, size);
+        });
     }
 
     bool IsRegionWritten(VAddr start, VAddr end) const {
-        const u64 page_end = end >> WRITE_PAGE_BIT;
-        for (u64 page_start = start >> WRITE_PAGE_BIT; page_start <= page_end; ++page_start) {
-            if (written_pages.count(page_start) > 0) {
+        VAddr addr = start;
+        while (addr <= end) {
+            const auto it = blocks.find(addr >> BLOCK_PAGE_BITS);
+            if (it == blocks.end()) {
+                addr = ((addr >> BLOCK_PAGE_BITS) + 1) << BLOCK_PAGE_BITS;
+                continue;
+            }
+            const Buffer& block = *it->second;
+            const VAddr range_end = std::min(end + 1, block.CpuAddrEnd());
+            if (block.IsWrittenRegion(block.Offset(addr),
+                                      static_cast<std::size_t>(range_end - addr))) {
                 return true;
             }
+            addr = range_end;
         }
         return false;
     }
@@ -578,10 +722,8 @@ private:
     u64 buffer_offset_base = 0;
 
     MapIntervalAllocator mapped_addresses_allocator;
-    boost::intrusive::set<MapInterval, boost::intrusive::compare<MapIntervalCompare>>
-        mapped_addresses;
+    std::unordered_map<VAddr, std::vector<MapInterval*>> registry;
 
-    std::unordered_map<u64, u32> written_pages;
     std::unordered_map<u64, std::shared_ptr<Buffer>> blocks;
 
     std::queue<std::shared_ptr<Buffer>> pending_destruction;
@@ -9,18 +9,14 @@
 #include <memory>
 #include <vector>
 
-#include <boost/intrusive/set_hook.hpp>
-
 #include "common/common_types.h"
 #include "video_core/gpu.h"
 
 namespace VideoCommon {
 
-struct MapInterval : public boost::intrusive::set_base_hook<boost::intrusive::optimize_size<true>> {
+struct MapInterval {
     MapInterval() = default;
 
-    /*implicit*/ MapInterval(VAddr start_) noexcept : start{start_} {}
-
     explicit MapInterval(VAddr start_, VAddr end_, GPUVAddr gpu_addr_) noexcept
         : start{start_}, end{end_}, gpu_addr{gpu_addr_} {}
 
@@ -37,7 +33,6 @@ struct MapInterval : public boost::intrusive::set_base_hook<boost::intrusive::op
         ticks = ticks_;
     }
 
-    boost::intrusive::set_member_hook<> member_hook_;
     VAddr start = 0;
     VAddr end = 0;
     GPUVAddr gpu_addr = 0;
@@ -49,12 +44,6 @@ struct MapInterval : public boost::intrusive::set_base_hook<boost::intrusive::op
     bool is_sync_pending = false;
 };
 
-struct MapIntervalCompare {
-    constexpr bool operator()(const MapInterval& lhs, const MapInterval& rhs) const noexcept {
-        return lhs.start < rhs.start;
-    }
-};
-
 class MapIntervalAllocator {
 public:
     MapIntervalAllocator();
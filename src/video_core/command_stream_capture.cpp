@@ -0,0 +1,165 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstring>
+
+#include "common/file_util.h"
+#include "common/logging/log.h"
+#include "common/zstd_compression.h"
+#include "video_core/command_stream_capture.h"
+#include "video_core/dma_pusher.h"
+#include "video_core/gpu.h"
+
+namespace Tegra {
+
+namespace {
+constexpr u32 CAPTURE_MAGIC = 0x31434759; // 'YGC1'
+constexpr u32 CAPTURE_VERSION = 1;
+
+/// Pending records are compressed and written out once they exceed this size.
+constexpr std::size_t CHUNK_THRESHOLD = 1024 * 1024;
+
+struct MapPayload {
+    u64 gpu_addr;
+    u64 cpu_addr;
+    u64 size;
+};
+static_assert(sizeof(MapPayload) == 0x18, "MapPayload has incorrect size");
+
+struct UnmapPayload {
+    u64 gpu_addr;
+    u64 size;
+};
+static_assert(sizeof(UnmapPayload) == 0x10, "UnmapPayload has incorrect size");
+} // Anonymous namespace
+
+CommandStreamCapture::CommandStreamCapture(const std::string& path)
+    : file{std::make_unique<FileUtil::IOFile>(path, "wb")} {
+    if (!file->IsOpen()) {
+        LOG_ERROR(HW_GPU, "Failed to open GPU command stream capture file {}", path);
+        return;
+    }
+    file->WriteObject(CAPTURE_MAGIC);
+    file->WriteObject(CAPTURE_VERSION);
+    LOG_INFO(HW_GPU, "Recording GPU command stream to {}", path);
+}
+
+CommandStreamCapture::~CommandStreamCapture() {
+    if (IsOpen()) {
+        FlushChunk();
+    }
+}
+
+bool CommandStreamCapture::IsOpen() const {
+    return file->IsOpen();
+}
+
+void CommandStreamCapture::RecordCommands(const CommandHeader* commands, std::size_t num_words) {
+    AppendRecord(RecordType::Commands, commands, num_words * sizeof(CommandHeader));
+}
+
+void CommandStreamCapture::RecordMap(GPUVAddr gpu_addr, VAddr cpu_addr, u64 size) {
+    const MapPayload payload{gpu_addr, cpu_addr, size};
+    AppendRecord(RecordType::Map, &payload, sizeof(payload));
+}
+
+void CommandStreamCapture::RecordUnmap(GPUVAddr gpu_addr, u64 size) {
+    const UnmapPayload payload{gpu_addr, size};
+    AppendRecord(RecordType::Unmap, &payload, sizeof(payload));
+}
+
+void CommandStreamCapture::AppendRecord(RecordType type, const void* payload,
+                                        std::size_t payload_size) {
+    if (!IsOpen()) {
+        return;
+    }
+    const u32 type_word = static_cast<u32>(type);
+    const u32 size_word = static_cast<u32>(payload_size);
+    const std::size_t offset = pending.size();
+    pending.resize(offset + sizeof(u32) * 2 + payload_size);
+    std::memcpy(pending.data() + offset, &type_word, sizeof(u32));
+    std::memcpy(pending.data() + offset + sizeof(u32), &size_word, sizeof(u32));
+    std::memcpy(pending.data() + offset + sizeof(u32) * 2, payload, payload_size);
+
+    if (pending.size() >= CHUNK_THRESHOLD) {
+        FlushChunk();
+    }
+}
+
+void CommandStreamCapture::FlushChunk() {
+    if (pending.empty()) {
+        return;
+    }
+    const std::vector<u8> compressed =
+        Common::Compression::CompressDataZSTDDefault(pending.data(), pending.size());
+    file->WriteObject(static_cast<u32>(pending.size()));
+    file->WriteObject(static_cast<u32>(compressed.size()));
+    file->WriteBytes(compressed.data(), compressed.size());
+    pending.clear();
+}
+
+std::optional<u64> ReplayCommandStream(GPU& gpu, const std::string& path) {
+    FileUtil::IOFile file{path, "rb"};
+    if (!file.IsOpen()) {
+        LOG_ERROR(HW_GPU, "Failed to open GPU command stream capture file {}", path);
+        return std::nullopt;
+    }
+
+    u32 magic{};
+    u32 version{};
+    if (file.ReadBytes(&magic, sizeof(magic)) != sizeof(magic) ||
+        file.ReadBytes(&version, sizeof(version)) != sizeof(version) || magic != CAPTURE_MAGIC ||
+        version != CAPTURE_VERSION) {
+        LOG_ERROR(HW_GPU, "{} is not a version {} GPU command stream capture", path,
+                  CAPTURE_VERSION);
+        return std::nullopt;
+    }
+
+    u64 replayed_words = 0;
+    auto& dma_pusher = gpu.DmaPusher();
+    while (true) {
+        u32 uncompressed_size{};
+        u32 compressed_size{};
+        if (file.ReadBytes(&uncompressed_size, sizeof(uncompressed_size)) !=
+            sizeof(uncompressed_size)) {
+            break; // End of capture
+        }
+        if (file.ReadBytes(&compressed_size, sizeof(compressed_size)) != sizeof(compressed_size)) {
+            return std::nullopt;
+        }
+        std::vector<u8> compressed(compressed_size);
+        if (file.ReadBytes(compressed.data(), compressed_size) != compressed_size) {
+            return std::nullopt;
+        }
+        const std::vector<u8> chunk = Common::Compression::DecompressDataZSTD(compressed);
+        if (chunk.size() != uncompressed_size) {
+            return std::nullopt;
+        }
+
+        std::size_t offset = 0;
+        while (offset + sizeof(u32) * 2 <= chunk.size()) {
+            u32 type_word{};
+            u32 payload_size{};
+            std::memcpy(&type_word, chunk.data() + offset, sizeof(u32));
+            std::memcpy(&payload_size, chunk.data() + offset + sizeof(u32), sizeof(u32));
+            offset += sizeof(u32) * 2;
+            if (offset + payload_size > chunk.size()) {
+                return std::nullopt;
+            }
+            if (static_cast<CommandStreamCapture::RecordType>(type_word) ==
+                CommandStreamCapture::RecordType::Commands) {
+                const std::size_t num_words = payload_size / sizeof(CommandHeader);
+                std::vector<CommandHeader> commands(num_words);
+                std::memcpy(commands.data(), chunk.data() + offset, payload_size);
+                dma_pusher.ProcessCommands(commands.data(), num_words);
+                replayed_words += num_words;
+            }
+            offset += payload_size;
+        }
+    }
+    gpu.FlushCommands();
+    return replayed_words;
+}
+
+} // namespace Tegra
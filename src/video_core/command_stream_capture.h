@@ -0,0 +1,75 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace FileUtil {
+class IOFile;
+}
+
+namespace Tegra {
+
+class GPU;
+union CommandHeader;
+
+/**
+ * Records the GPU command stream of a session to a compact binary log for offline analysis and
+ * deterministic replay. Pushbuffer segments are captured after the DMA pusher has resolved them
+ * from guest memory, so a capture can be replayed without the guest address space that produced
+ * it; memory-manager map events are recorded alongside for analysis.
+ *
+ * On-disk layout: a header of {magic 'YGC1', version u32}, followed by chunks of
+ * {uncompressed_size u32, compressed_size u32, zstd data}. Each decompressed chunk holds records
+ * of {type u32, payload_size u32, payload}.
+ */
+class CommandStreamCapture {
+public:
+    enum class RecordType : u32 {
+        Commands = 0, ///< Payload is the resolved u32 words of one pushbuffer segment
+        Map = 1,      ///< Payload is {gpu_addr u64, cpu_addr u64, size u64}
+        Unmap = 2,    ///< Payload is {gpu_addr u64, size u64}
+    };
+
+    explicit CommandStreamCapture(const std::string& path);
+    ~CommandStreamCapture();
+
+    CommandStreamCapture(const CommandStreamCapture&) = delete;
+    CommandStreamCapture& operator=(const CommandStreamCapture&) = delete;
+
+    bool IsOpen() const;
+
+    /// Records the resolved words of one pushbuffer segment.
+    void RecordCommands(const CommandHeader* commands, std::size_t num_words);
+
+    /// Records a memory-manager map event.
+    void RecordMap(GPUVAddr gpu_addr, VAddr cpu_addr, u64 size);
+
+    /// Records a memory-manager unmap event.
+    void RecordUnmap(GPUVAddr gpu_addr, u64 size);
+
+private:
+    void AppendRecord(RecordType type, const void* payload, std::size_t payload_size);
+    void FlushChunk();
+
+    std::unique_ptr<FileUtil::IOFile> file;
+    std::vector<u8> pending;
+};
+
+/**
+ * Feeds a capture back through the DMA pusher of the given GPU, bypassing pushbuffer fetch since
+ * captures store resolved command words. Map events are skipped: they describe the producing
+ * session's address space and have no backing memory in the replaying one.
+ *
+ * @return the number of command words replayed, or std::nullopt if the file could not be parsed.
+ */
+std::optional<u64> ReplayCommandStream(GPU& gpu, const std::string& path);
+
+} // namespace Tegra
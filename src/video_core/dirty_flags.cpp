@@ -24,6 +24,9 @@ void SetupDirtyRenderTargets(Tegra::Engines::Maxwell3D::DirtyState::Tables& tabl
     }
     FillBlock(tables[1], begin, num, RenderTargets);
 
+    // The attachment count is part of the render target state too
+    tables[0][OFF(rt_control)] = RenderTargets;
+
     static constexpr std::array zeta_flags{ZetaBuffer, RenderTargets};
     for (std::size_t i = 0; i < std::size(zeta_flags); ++i) {
         const u8 flag = zeta_flags[i];
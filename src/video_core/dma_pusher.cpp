@@ -5,6 +5,7 @@
 #include "common/microprofile.h"
 #include "core/core.h"
 #include "core/memory.h"
+#include "video_core/command_stream_capture.h"
 #include "video_core/dma_pusher.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/gpu.h"
@@ -45,10 +46,11 @@ bool DmaPusher::Step() {
         return false;
     }
 
-    const CommandList& command_list{dma_pushbuffer.front()};
+    CommandList& command_list{dma_pushbuffer.front()};
     ASSERT_OR_EXECUTE(!command_list.empty(), {
         // Somehow the command_list is empty, in order to avoid a crash
         // We ignore it and assume its size is 0.
+        gpu.RecycleCommandList(std::move(command_list));
         dma_pushbuffer.pop();
         dma_pushbuffer_subindex = 0;
         return true;
@@ -57,7 +59,9 @@ bool DmaPusher::Step() {
     const GPUVAddr dma_get = command_list_header.addr;
 
     if (dma_pushbuffer_subindex >= command_list.size()) {
-        // We've gone through the current list, remove it from the queue
+        // We've gone through the current list, return its buffer to the pool and remove it from
+        // the queue
+        gpu.RecycleCommandList(std::move(command_list));
         dma_pushbuffer.pop();
         dma_pushbuffer_subindex = 0;
     }
@@ -70,16 +74,23 @@ bool DmaPusher::Step() {
     command_headers.resize(command_list_header.size);
     gpu.MemoryManager().ReadBlockUnsafe(dma_get, command_headers.data(),
                                         command_list_header.size * sizeof(u32));
+    if (auto* const capture = gpu.Capture()) {
+        capture->RecordCommands(command_headers.data(), command_headers.size());
+    }
+    ProcessCommands(command_headers.data(), command_headers.size());
+
+    return true;
+}
 
-    for (std::size_t index = 0; index < command_headers.size();) {
-        const CommandHeader& command_header = command_headers[index];
+void DmaPusher::ProcessCommands(const CommandHeader* commands, std::size_t num_words) {
+    for (std::size_t index = 0; index < num_words;) {
+        const CommandHeader& command_header = commands[index];
 
         if (dma_state.method_count) {
             // Data word of methods command
             if (dma_state.non_incrementing) {
                 const u32 max_write = static_cast<u32>(
-                    std::min<std::size_t>(index + dma_state.method_count, command_headers.size()) -
-                    index);
+                    std::min<std::size_t>(index + dma_state.method_count, num_words) - index);
                 CallMultiMethod(&command_header.argument, max_write);
                 dma_state.method_count -= max_write;
                 dma_state.is_last_call = true;
@@ -130,8 +141,6 @@ bool DmaPusher::Step() {
         }
         index++;
     }
-
-    return true;
 }
 
 void DmaPusher::SetState(const CommandHeader& command_header) {
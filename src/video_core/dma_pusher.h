@@ -71,6 +71,11 @@ public:
 
     void DispatchCalls();
 
+    /// Processes an already-resolved command stream. Used by Step once a pushbuffer segment has
+    /// been fetched from guest memory, and by command stream capture replay, which stores
+    /// resolved words.
+    void ProcessCommands(const CommandHeader* commands, std::size_t num_words);
+
     void BindSubchannel(Tegra::Engines::EngineInterface* engine, u32 subchannel_id) {
         subchannels[subchannel_id] = engine;
     }
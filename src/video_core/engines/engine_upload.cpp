@@ -30,6 +30,21 @@ void State::ProcessData(const u32 data, const bool is_last_call) {
     if (!is_last_call) {
         return;
     }
+    Finish();
+}
+
+void State::ProcessData(const u32* data, const std::size_t num_data, const bool is_last_call) {
+    const std::size_t sub_copy_size =
+        std::min(num_data * sizeof(u32), static_cast<std::size_t>(copy_size - write_offset));
+    std::memcpy(&inner_buffer[write_offset], data, sub_copy_size);
+    write_offset += static_cast<u32>(sub_copy_size);
+    if (!is_last_call) {
+        return;
+    }
+    Finish();
+}
+
+void State::Finish() {
     const GPUVAddr address{regs.dest.Address()};
     if (is_linear) {
         memory_manager.WriteBlock(address, inner_buffer.data(), copy_size);
@@ -60,7 +60,13 @@ public:
     void ProcessExec(bool is_linear);
     void ProcessData(u32 data, bool is_last_call);
 
+    /// Copies a whole run of data words into the upload buffer at once.
+    void ProcessData(const u32* data, std::size_t num_data, bool is_last_call);
+
 private:
+    /// Writes the completed upload buffer out to guest memory.
+    void Finish();
+
     u32 write_offset = 0;
     u32 copy_size = 0;
     std::vector<u8> inner_buffer;
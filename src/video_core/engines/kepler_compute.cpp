@@ -52,8 +52,23 @@ void KeplerCompute::CallMethod(u32 method, u32 method_argument, bool is_last_cal
 
 void KeplerCompute::CallMultiMethod(u32 method, const u32* base_start, u32 amount,
                                     u32 methods_pending) {
-    for (std::size_t i = 0; i < amount; i++) {
-        CallMethod(method, base_start[i], methods_pending - static_cast<u32>(i) <= 1);
+    switch (method) {
+    case KEPLER_COMPUTE_REG_INDEX(data_upload): {
+        // Non-incrementing inline data runs can be copied into the upload buffer as one span
+        // instead of dispatching each word separately.
+        const bool is_last_call = amount == methods_pending;
+        upload_state.ProcessData(base_start, amount, is_last_call);
+        regs.reg_array[method] = base_start[amount - 1];
+        if (is_last_call) {
+            system.GPU().Maxwell3D().OnMemoryWrite();
+        }
+        break;
+    }
+    default:
+        for (std::size_t i = 0; i < amount; i++) {
+            CallMethod(method, base_start[i], methods_pending - static_cast<u32>(i) <= 1);
+        }
+        break;
     }
 }
 
@@ -67,19 +82,44 @@ Texture::FullTextureInfo KeplerCompute::GetTexture(std::size_t offset) const {
     const GPUVAddr address = texinfo.Address() + offset * sizeof(Texture::TextureHandle);
     ASSERT(address < texinfo.Address() + texinfo.size);
 
-    const Texture::TextureHandle tex_handle{memory_manager.Read<u32>(address)};
+    const Texture::TextureHandle tex_handle{AccessConstBuffer32(
+        ShaderType::Compute, regs.tex_cb_index, offset * sizeof(Texture::TextureHandle))};
     return GetTextureInfo(tex_handle);
 }
 
 Texture::FullTextureInfo KeplerCompute::GetTextureInfo(Texture::TextureHandle tex_handle) const {
-    return Texture::FullTextureInfo{GetTICEntry(tex_handle.tic_id), GetTSCEntry(tex_handle.tsc_id)};
+    return Texture::FullTextureInfo{GetTICEntry(tex_handle.tic_id), GetTSCEntry(tex_handle.tsc_id),
+                                    tex_handle.tsc_id};
+}
+
+const KeplerCompute::ConstBufferSnapshot& KeplerCompute::GetConstBufferSnapshot(
+    std::size_t const_buffer) const {
+    const auto& buffer = launch_description.const_buffer_config[const_buffer];
+    const GPUVAddr address = buffer.Address();
+    auto& snapshot = const_buffer_snapshots[const_buffer];
+    if (snapshot.launch_index == launch_counter && snapshot.address == address &&
+        snapshot.size == buffer.size) {
+        return snapshot;
+    }
+    snapshot.address = address;
+    snapshot.size = buffer.size;
+    snapshot.launch_index = launch_counter;
+    snapshot.data.resize(buffer.size);
+    memory_manager.ReadBlockUnsafe(address, snapshot.data.data(), buffer.size);
+    return snapshot;
 }
 
 u32 KeplerCompute::AccessConstBuffer32(ShaderType stage, u64 const_buffer, u64 offset) const {
     ASSERT(stage == ShaderType::Compute);
-    const auto& buffer = launch_description.const_buffer_config[const_buffer];
+    const ConstBufferSnapshot& snapshot = GetConstBufferSnapshot(const_buffer);
     u32 result;
-    std::memcpy(&result, memory_manager.GetPointer(buffer.Address() + offset), sizeof(u32));
+    if (offset + sizeof(u32) > snapshot.size) {
+        // Reads past the bound range are rare enough to not be worth snapshotting.
+        const auto& buffer = launch_description.const_buffer_config[const_buffer];
+        std::memcpy(&result, memory_manager.GetPointer(buffer.Address() + offset), sizeof(u32));
+        return result;
+    }
+    std::memcpy(&result, snapshot.data.data() + offset, sizeof(u32));
     return result;
 }
 
@@ -89,10 +129,7 @@ SamplerDescriptor KeplerCompute::AccessBoundSampler(ShaderType stage, u64 offset
 
 SamplerDescriptor KeplerCompute::AccessBindlessSampler(ShaderType stage, u64 const_buffer,
                                                        u64 offset) const {
-    ASSERT(stage == ShaderType::Compute);
-    const auto& tex_info_buffer = launch_description.const_buffer_config[const_buffer];
-    const GPUVAddr tex_info_address = tex_info_buffer.Address() + offset;
-    return AccessSampler(memory_manager.Read<u32>(tex_info_address));
+    return AccessSampler(AccessConstBuffer32(stage, const_buffer, offset));
 }
 
 SamplerDescriptor KeplerCompute::AccessSampler(u32 handle) const {
@@ -119,6 +156,7 @@ void KeplerCompute::ProcessLaunch() {
     const GPUVAddr code_addr = regs.code_loc.Address() + launch_description.program_start;
     LOG_TRACE(HW_GPU, "Compute invocation launched at address 0x{:016x}", code_addr);
 
+    ++launch_counter;
     rasterizer.DispatchCompute(code_addr);
 }
 
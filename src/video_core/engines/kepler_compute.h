@@ -235,6 +235,26 @@ private:
     MemoryManager& memory_manager;
     Upload::State upload_state;
 
+    /// Copy of a bound const buffer range, read back in one block and served word by word to
+    /// shader specialization checks instead of translating every read through the MMU.
+    struct ConstBufferSnapshot {
+        GPUVAddr address{};
+        u32 size{};
+        u64 launch_index{};
+        std::vector<u8> data;
+    };
+
+    /// Per slot snapshots. Storage is retained across launches so steady state readbacks do
+    /// not allocate.
+    mutable std::array<ConstBufferSnapshot, NumConstBuffers> const_buffer_snapshots;
+
+    /// Monotonic launch counter used to expire const buffer snapshots between dispatches.
+    u64 launch_counter = 1;
+
+    /// Returns the current snapshot for a const buffer slot, reading the bound range back if
+    /// this launch has not accessed it yet.
+    const ConstBufferSnapshot& GetConstBufferSnapshot(std::size_t const_buffer) const;
+
     void ProcessLaunch();
 
     /// Retrieves information about a specific TIC entry from the TIC buffer.
@@ -6,6 +6,7 @@
 #include <cstring>
 #include <optional>
 #include "common/assert.h"
+#include "common/microprofile.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "video_core/engines/maxwell_3d.h"
@@ -15,6 +16,9 @@
 #include "video_core/rasterizer_interface.h"
 #include "video_core/textures/texture.h"
 
+MICROPROFILE_DEFINE(Maxwell3D_MethodDispatch, "GPU", "Maxwell3D side effect dispatch",
+                    MP_RGB(128, 192, 128));
+
 namespace Tegra::Engines {
 
 using VideoCore::QueryType;
@@ -22,6 +26,34 @@ using VideoCore::QueryType;
 /// First register id that is actually a Macro call.
 constexpr u32 MacroRegistersStart = 0xE00;
 
+/// Marks the registers whose writes trigger side effects, so the vast majority of writes that are
+/// pure state stores can skip the dispatch switch in ProcessMethodSideEffect entirely.
+constexpr auto side_effect_table = [] {
+    std::array<bool, Maxwell3D::Regs::NUM_REGS> table{};
+    table[MAXWELL3D_REG_INDEX(wait_for_idle)] = true;
+    table[MAXWELL3D_REG_INDEX(shadow_ram_control)] = true;
+    table[MAXWELL3D_REG_INDEX(macros.data)] = true;
+    table[MAXWELL3D_REG_INDEX(macros.bind)] = true;
+    table[MAXWELL3D_REG_INDEX(firmware[4])] = true;
+    for (std::size_t i = 0; i < Maxwell3D::Regs::NumCBData; ++i) {
+        table[MAXWELL3D_REG_INDEX(const_buffer.cb_data) + i] = true;
+    }
+    table[MAXWELL3D_REG_INDEX(cb_bind[0])] = true;
+    table[MAXWELL3D_REG_INDEX(cb_bind[1])] = true;
+    table[MAXWELL3D_REG_INDEX(cb_bind[2])] = true;
+    table[MAXWELL3D_REG_INDEX(cb_bind[3])] = true;
+    table[MAXWELL3D_REG_INDEX(cb_bind[4])] = true;
+    table[MAXWELL3D_REG_INDEX(draw.vertex_end_gl)] = true;
+    table[MAXWELL3D_REG_INDEX(clear_buffers)] = true;
+    table[MAXWELL3D_REG_INDEX(query.query_get)] = true;
+    table[MAXWELL3D_REG_INDEX(condition.mode)] = true;
+    table[MAXWELL3D_REG_INDEX(counter_reset)] = true;
+    table[MAXWELL3D_REG_INDEX(sync_info)] = true;
+    table[MAXWELL3D_REG_INDEX(exec_upload)] = true;
+    table[MAXWELL3D_REG_INDEX(data_upload)] = true;
+    return table;
+}();
+
 Maxwell3D::Maxwell3D(Core::System& system, VideoCore::RasterizerInterface& rasterizer,
                      MemoryManager& memory_manager)
     : system{system}, rasterizer{rasterizer}, memory_manager{memory_manager},
@@ -119,7 +151,7 @@ void Maxwell3D::InitializeRegisterDefaults() {
     mme_inline[MAXWELL3D_REG_INDEX(index_array.count)] = true;
 }
 
-void Maxwell3D::CallMacroMethod(u32 method, const std::vector<u32>& parameters) {
+void Maxwell3D::CallMacroMethod(u32 method, Macro::ParameterView parameters) {
     // Reset the current macro.
     executing_macro = 0;
 
@@ -185,11 +217,33 @@ void Maxwell3D::CallMethod(u32 method, u32 method_argument, bool is_last_call) {
     if (regs.reg_array[method] != arg) {
         regs.reg_array[method] = arg;
 
-        for (const auto& table : dirty.tables) {
-            dirty.flags[table[method]] = true;
+        if ((dirty.block_mask >> (method / DirtyState::block_size)) & 1) {
+            const u16 packed = dirty.packed_tables[method];
+            dirty.flags[static_cast<std::size_t>(packed & 0xFF)] = true;
+            dirty.flags[static_cast<std::size_t>(packed >> 8)] = true;
         }
     }
 
+    if (side_effect_table[method]) {
+        ProcessMethodSideEffect(method, arg, method_argument, is_last_call);
+    }
+}
+
+void Maxwell3D::PrepareDirtyTables() {
+    dirty.block_mask = 0;
+    for (std::size_t method = 0; method < Regs::NUM_REGS; ++method) {
+        const u16 packed =
+            static_cast<u16>(dirty.tables[0][method] | (dirty.tables[1][method] << 8));
+        dirty.packed_tables[method] = packed;
+        if (packed != 0) {
+            dirty.block_mask |= u64{1} << (method / DirtyState::block_size);
+        }
+    }
+}
+
+void Maxwell3D::ProcessMethodSideEffect(u32 method, u32 arg, u32 method_argument,
+                                        bool is_last_call) {
+    MICROPROFILE_SCOPE(Maxwell3D_MethodDispatch);
     switch (method) {
     case MAXWELL3D_REG_INDEX(wait_for_idle): {
         rasterizer.WaitForIdle();
@@ -401,6 +455,7 @@ void Maxwell3D::FlushMMEInlineDraw() {
                "Illegal combination of instancing parameters");
 
     const bool is_indexed = mme_draw.current_mode == MMEDrawMode::Indexed;
+    ++draw_counter;
     if (ShouldExecute()) {
         rasterizer.Draw(is_indexed, true);
     }
@@ -569,6 +624,7 @@ void Maxwell3D::DrawArrays() {
     }
 
     const bool is_indexed{regs.index_array.count && !regs.vertex_buffer.count};
+    ++draw_counter;
     if (ShouldExecute()) {
         rasterizer.Draw(is_indexed, false);
     }
@@ -689,7 +745,8 @@ Texture::TSCEntry Maxwell3D::GetTSCEntry(u32 tsc_index) const {
 }
 
 Texture::FullTextureInfo Maxwell3D::GetTextureInfo(Texture::TextureHandle tex_handle) const {
-    return Texture::FullTextureInfo{GetTICEntry(tex_handle.tic_id), GetTSCEntry(tex_handle.tsc_id)};
+    return Texture::FullTextureInfo{GetTICEntry(tex_handle.tic_id), GetTSCEntry(tex_handle.tsc_id),
+                                    tex_handle.tsc_id};
 }
 
 Texture::FullTextureInfo Maxwell3D::GetStageTexture(ShaderType stage, std::size_t offset) const {
@@ -703,7 +760,8 @@ Texture::FullTextureInfo Maxwell3D::GetStageTexture(ShaderType stage, std::size_
 
     ASSERT(tex_info_address < tex_info_buffer.address + tex_info_buffer.size);
 
-    const Texture::TextureHandle tex_handle{memory_manager.Read<u32>(tex_info_address)};
+    const Texture::TextureHandle tex_handle{
+        AccessConstBuffer32(stage, regs.tex_cb_index, offset * sizeof(Texture::TextureHandle))};
 
     return GetTextureInfo(tex_handle);
 }
@@ -721,12 +779,35 @@ void Maxwell3D::ProcessClearBuffers() {
     rasterizer.Clear();
 }
 
-u32 Maxwell3D::AccessConstBuffer32(ShaderType stage, u64 const_buffer, u64 offset) const {
-    ASSERT(stage != ShaderType::Compute);
+const Maxwell3D::ConstBufferSnapshot& Maxwell3D::GetConstBufferSnapshot(
+    ShaderType stage, std::size_t const_buffer) const {
     const auto& shader_stage = state.shader_stages[static_cast<std::size_t>(stage)];
     const auto& buffer = shader_stage.const_buffers[const_buffer];
+    auto& snapshot = const_buffer_snapshots[static_cast<std::size_t>(stage)][const_buffer];
+    if (snapshot.draw_index == draw_counter && snapshot.address == buffer.address &&
+        snapshot.size == buffer.size) {
+        return snapshot;
+    }
+    snapshot.address = buffer.address;
+    snapshot.size = buffer.size;
+    snapshot.draw_index = draw_counter;
+    snapshot.data.resize(buffer.size);
+    memory_manager.ReadBlockUnsafe(buffer.address, snapshot.data.data(), buffer.size);
+    return snapshot;
+}
+
+u32 Maxwell3D::AccessConstBuffer32(ShaderType stage, u64 const_buffer, u64 offset) const {
+    ASSERT(stage != ShaderType::Compute);
+    const ConstBufferSnapshot& snapshot = GetConstBufferSnapshot(stage, const_buffer);
     u32 result;
-    std::memcpy(&result, memory_manager.GetPointer(buffer.address + offset), sizeof(u32));
+    if (offset + sizeof(u32) > snapshot.size) {
+        // Reads past the bound range are rare enough to not be worth snapshotting.
+        const auto& shader_stage = state.shader_stages[static_cast<std::size_t>(stage)];
+        const auto& buffer = shader_stage.const_buffers[const_buffer];
+        std::memcpy(&result, memory_manager.GetPointer(buffer.address + offset), sizeof(u32));
+        return result;
+    }
+    std::memcpy(&result, snapshot.data.data() + offset, sizeof(u32));
     return result;
 }
 
@@ -736,11 +817,7 @@ SamplerDescriptor Maxwell3D::AccessBoundSampler(ShaderType stage, u64 offset) co
 
 SamplerDescriptor Maxwell3D::AccessBindlessSampler(ShaderType stage, u64 const_buffer,
                                                    u64 offset) const {
-    ASSERT(stage != ShaderType::Compute);
-    const auto& shader = state.shader_stages[static_cast<std::size_t>(stage)];
-    const auto& tex_info_buffer = shader.const_buffers[const_buffer];
-    const GPUVAddr tex_info_address = tex_info_buffer.address + offset;
-    return AccessSampler(memory_manager.Read<u32>(tex_info_address));
+    return AccessSampler(AccessConstBuffer32(stage, const_buffer, offset));
 }
 
 SamplerDescriptor Maxwell3D::AccessSampler(u32 handle) const {
@@ -1450,12 +1450,26 @@ public:
         using Flags = std::bitset<std::numeric_limits<u8>::max()>;
         using Table = std::array<u8, Regs::NUM_REGS>;
         using Tables = std::array<Table, 2>;
+        /// Both dirty tables packed into one array: the low byte holds the first table's flag and
+        /// the high byte the second's, so register writes perform a single load.
+        using PackedTable = std::array<u16, Regs::NUM_REGS>;
+
+        /// Number of registers covered by each bit of block_mask.
+        static constexpr std::size_t block_size = Regs::NUM_REGS / 64;
 
         Flags flags;
         Flags on_write_stores;
         Tables tables{};
+        PackedTable packed_tables{};
+        /// Bit N is set when any register in block N maps to a dirty flag. Writes to registers in
+        /// blocks with the bit clear skip dirty processing with a single test.
+        u64 block_mask = 0;
     } dirty;
 
+    /// Packs the dirty tables filled in by the state tracker; must be called after
+    /// RasterizerInterface::SetupDirtyFlags has registered every flag.
+    void PrepareDirtyTables();
+
 private:
     void InitializeRegisterDefaults();
 
@@ -1472,7 +1486,8 @@ private:
 
     /// Macro method that is currently being executed / being fed parameters.
     u32 executing_macro = 0;
-    /// Parameters that have been submitted to the macro call so far.
+    /// Parameters that have been submitted to the macro call so far. The macro engines read them
+    /// in place, and clearing keeps the capacity, so steady state does not allocate or copy.
     std::vector<u32> macro_params;
 
     /// Interpreter for the macro codes uploaded to the GPU.
@@ -1493,6 +1508,29 @@ private:
 
     std::array<u8, Regs::NUM_REGS> dirty_pointers{};
 
+    /// Copy of a bound const buffer range, read back in one block and served word by word to
+    /// shader specialization checks instead of translating every read through the MMU.
+    struct ConstBufferSnapshot {
+        GPUVAddr address{};
+        u32 size{};
+        u64 draw_index{};
+        std::vector<u8> data;
+    };
+
+    /// Per stage and slot snapshots. Storage is retained across draws so steady state
+    /// readbacks do not allocate.
+    mutable std::array<std::array<ConstBufferSnapshot, Regs::MaxConstBuffers>,
+                       Regs::MaxShaderStage>
+        const_buffer_snapshots;
+
+    /// Monotonic draw counter used to expire const buffer snapshots between draws.
+    u64 draw_counter = 1;
+
+    /// Returns the current snapshot for a stage's const buffer slot, reading the bound range
+    /// back if this draw has not accessed it yet.
+    const ConstBufferSnapshot& GetConstBufferSnapshot(ShaderType stage,
+                                                      std::size_t const_buffer) const;
+
     /// Retrieves information about a specific TIC entry from the TIC buffer.
     Texture::TICEntry GetTICEntry(u32 tic_index) const;
 
@@ -1502,10 +1540,9 @@ private:
     /**
      * Call a macro on this engine.
      * @param method Method to call
-     * @param num_parameters Number of arguments
-     * @param parameters Arguments to the method call
+     * @param parameters Arguments to the method call, read in place by the macro engine
      */
-    void CallMacroMethod(u32 method, const std::vector<u32>& parameters);
+    void CallMacroMethod(u32 method, Macro::ParameterView parameters);
 
     /// Handles writes to the macro uploading register.
     void ProcessMacroUpload(u32 data);
@@ -1534,6 +1571,10 @@ private:
     /// Handles writes to syncing register.
     void ProcessSyncPoint();
 
+    /// Handles a register write that has a side effect beyond the state store. Only called for
+    /// registers marked in the side effect table.
+    void ProcessMethodSideEffect(u32 method, u32 arg, u32 method_argument, bool is_last_call);
+
     /// Handles a write to the CB_DATA[i] register.
     void StartCBData(u32 method);
     void ProcessCBData(u32 value);
@@ -68,6 +68,13 @@ public:
     void SignalSyncPoint(u32 value) {
         TryReleasePendingFences();
         const bool should_flush = ShouldFlush();
+        if (!should_flush && fences.empty() && !Settings::IsGPULevelExtreme()) {
+            // Nothing guest-observable is queued behind this increment, so the host GPU does not
+            // have to be waited on before signaling it. Incrementing right away wakes guest
+            // threads blocked on this syncpoint without a round trip through the fence queue.
+            system.GPU().IncrementSyncPoint(value);
+            return;
+        }
         CommitAsyncFlushes();
         TFence new_fence = CreateFence(value, !should_flush);
         fences.push(new_fence);
@@ -97,6 +104,28 @@ public:
         }
     }
 
+    /// Releases all fences signaled by the host GPU without blocking on the driver. Returns true
+    /// when no fences are left pending.
+    bool TryReleasePendingFences() {
+        auto& gpu{system.GPU()};
+        auto& memory_manager{gpu.MemoryManager()};
+        while (!fences.empty()) {
+            TFence& current_fence = fences.front();
+            if (ShouldWait() && !IsFenceSignaled(current_fence)) {
+                return false;
+            }
+            PopAsyncFlushes();
+            if (current_fence->IsSemaphore()) {
+                memory_manager.template Write<u32>(current_fence->GetAddress(),
+                                                   current_fence->GetPayload());
+            } else {
+                gpu.IncrementSyncPoint(current_fence->GetPayload());
+            }
+            fences.pop();
+        }
+        return true;
+    }
+
 protected:
     FenceManager(Core::System& system, VideoCore::RasterizerInterface& rasterizer,
                  TTextureCache& texture_cache, TTBufferCache& buffer_cache,
@@ -125,25 +154,6 @@ protected:
     TQueryCache& query_cache;
 
 private:
-    void TryReleasePendingFences() {
-        auto& gpu{system.GPU()};
-        auto& memory_manager{gpu.MemoryManager()};
-        while (!fences.empty()) {
-            TFence& current_fence = fences.front();
-            if (ShouldWait() && !IsFenceSignaled(current_fence)) {
-                return;
-            }
-            PopAsyncFlushes();
-            if (current_fence->IsSemaphore()) {
-                memory_manager.template Write<u32>(current_fence->GetAddress(),
-                                                   current_fence->GetPayload());
-            } else {
-                gpu.IncrementSyncPoint(current_fence->GetPayload());
-            }
-            fences.pop();
-        }
-    }
-
     bool ShouldWait() const {
         return texture_cache.ShouldWaitAsyncFlushes() || buffer_cache.ShouldWaitAsyncFlushes() ||
                query_cache.ShouldWaitAsyncFlushes();
@@ -5,6 +5,7 @@
 #include <chrono>
 
 #include "common/assert.h"
+#include "common/file_util.h"
 #include "common/microprofile.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -16,6 +17,7 @@
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/engines/kepler_memory.h"
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/command_stream_capture.h"
 #include "video_core/engines/maxwell_dma.h"
 #include "video_core/gpu.h"
 #include "video_core/memory_manager.h"
@@ -34,8 +36,12 @@ GPU::GPU(Core::System& system, std::unique_ptr<VideoCore::RendererBase>&& render
     maxwell_3d = std::make_unique<Engines::Maxwell3D>(system, rasterizer, *memory_manager);
     fermi_2d = std::make_unique<Engines::Fermi2D>(rasterizer);
     kepler_compute = std::make_unique<Engines::KeplerCompute>(system, rasterizer, *memory_manager);
-    maxwell_dma = std::make_unique<Engines::MaxwellDMA>(system, *memory_manager);
+    maxwell_dma = std::make_unique<Engines::MaxwellDMA>(system, rasterizer, *memory_manager);
     kepler_memory = std::make_unique<Engines::KeplerMemory>(system, *memory_manager);
+    if (Settings::values.record_gpu_stream) {
+        capture = std::make_unique<Tegra::CommandStreamCapture>(
+            FileUtil::GetUserPath(FileUtil::UserPath::LogDir) + "gpu_stream.ygc");
+    }
 }
 
 GPU::~GPU() = default;
@@ -176,6 +182,32 @@ void GPU::SyncGuestHost() {
 void GPU::OnCommandListEnd() {
     renderer->Rasterizer().ReleaseFences();
 }
+
+Tegra::CommandList GPU::ObtainCommandList(std::size_t num_entries) {
+    Tegra::CommandList entries;
+    {
+        std::lock_guard lock{command_list_pool_mutex};
+        if (!command_list_pool.empty()) {
+            entries = std::move(command_list_pool.back());
+            command_list_pool.pop_back();
+        }
+    }
+    entries.resize(num_entries);
+    return entries;
+}
+
+void GPU::RecycleCommandList(Tegra::CommandList&& entries) {
+    // Keep a handful of buffers around; anything beyond that is an unusually large backlog and
+    // is better given back to the allocator.
+    static constexpr std::size_t max_retired_lists = 16;
+
+    entries.clear();
+
+    std::lock_guard lock{command_list_pool_mutex};
+    if (command_list_pool.size() < max_retired_lists) {
+        command_list_pool.push_back(std::move(entries));
+    }
+}
 // Note that, traditionally, methods are treated as 4-byte addressable locations, and hence
 // their numbers are written down multiplied by 4 in Docs. Here we are not multiply by 4.
 // So the values you see in docs might be multiplied by 4.
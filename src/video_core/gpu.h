@@ -129,6 +129,7 @@ enum class EngineID {
     MAXWELL_DMA_COPY_A = 0xB0B5,
 };
 
+class CommandStreamCapture;
 class MemoryManager;
 
 class GPU {
@@ -234,6 +235,11 @@ public:
     /// Returns a const reference to the GPU DMA pusher.
     const Tegra::DmaPusher& DmaPusher() const;
 
+    /// Returns the command stream capture when one is recording, or nullptr.
+    Tegra::CommandStreamCapture* Capture() {
+        return capture.get();
+    }
+
     struct Regs {
         static constexpr size_t NUM_REGS = 0x100;
 
@@ -293,6 +299,13 @@ public:
     /// Push GPU command entries to be processed
     virtual void PushGPUEntries(Tegra::CommandList&& entries) = 0;
 
+    /// Obtains a command list buffer with the given number of entries, reusing the storage of a
+    /// previously retired list when one is available so steady-state submissions do not allocate.
+    Tegra::CommandList ObtainCommandList(std::size_t num_entries);
+
+    /// Returns a processed command list's buffer to the recycling pool.
+    void RecycleCommandList(Tegra::CommandList&& entries);
+
     /// Swap buffers (render frame)
     virtual void SwapBuffers(const Tegra::FramebufferConfig* framebuffer) = 0;
 
@@ -369,6 +382,13 @@ private:
     u64 last_flush_fence{};
     std::mutex flush_request_mutex;
 
+    /// Retired command list buffers kept around for reuse by ObtainCommandList.
+    std::vector<Tegra::CommandList> command_list_pool;
+    std::mutex command_list_pool_mutex;
+
+    /// Command stream recording, created when Debugging.record_gpu_stream is set
+    std::unique_ptr<Tegra::CommandStreamCapture> capture;
+
     const bool is_async;
 };
 
@@ -2,7 +2,12 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+
 #include "common/assert.h"
+#include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/thread.h"
 #include "core/core.h"
@@ -21,8 +26,7 @@ static void RunThread(Core::System& system, VideoCore::RendererBase& renderer,
                       SynchState& state) {
     std::string name = "yuzu:GPU";
     MicroProfileOnThreadCreate(name.c_str());
-    Common::SetCurrentThreadName(name.c_str());
-    Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
+    Common::SetCurrentThreadRole(Common::ThreadRole::Gpu, name.c_str());
     system.RegisterHostThread();
 
     // Wait for first GPU command before acquiring the window context
@@ -36,28 +40,50 @@ static void RunThread(Core::System& system, VideoCore::RendererBase& renderer,
 
     auto current_context = context.Acquire();
 
-    CommandDataContainer next;
+    std::array<CommandDataContainer, 16> batch;
+    bool fences_pending = false;
     while (state.is_running) {
-        next = state.queue.PopWait();
-        if (const auto submit_list = std::get_if<SubmitListCommand>(&next.data)) {
-            dma_pusher.Push(std::move(submit_list->entries));
-            dma_pusher.DispatchCalls();
-        } else if (const auto data = std::get_if<SwapBuffersCommand>(&next.data)) {
-            renderer.SwapBuffers(data->framebuffer ? &*data->framebuffer : nullptr);
-        } else if (const auto data = std::get_if<OnCommandListEndCommand>(&next.data)) {
-            renderer.Rasterizer().ReleaseFences();
-        } else if (const auto data = std::get_if<GPUTickCommand>(&next.data)) {
-            system.GPU().TickWork();
-        } else if (const auto data = std::get_if<FlushRegionCommand>(&next.data)) {
-            renderer.Rasterizer().FlushRegion(data->addr, data->size);
-        } else if (const auto data = std::get_if<InvalidateRegionCommand>(&next.data)) {
-            renderer.Rasterizer().OnCPUWrite(data->addr, data->size);
-        } else if (std::holds_alternative<EndProcessingCommand>(next.data)) {
-            return;
-        } else {
-            UNREACHABLE();
+        // Drain a burst of commands per wakeup; the CPU side queues many commands per frame and
+        // paying a synchronization episode for each one of them adds up.
+        const std::size_t num_commands = state.queue.PopBatchWait(batch.data(), batch.size());
+        for (std::size_t i = 0; i < num_commands; ++i) {
+            CommandDataContainer& next = batch[i];
+            if (const auto submit_list = std::get_if<SubmitListCommand>(&next.data)) {
+                dma_pusher.Push(std::move(submit_list->entries));
+                dma_pusher.DispatchCalls();
+            } else if (const auto data = std::get_if<SwapBuffersCommand>(&next.data)) {
+                renderer.SwapBuffers(data->framebuffer ? &*data->framebuffer : nullptr);
+            } else if (const auto data = std::get_if<OnCommandListEndCommand>(&next.data)) {
+                // Release what the host GPU has already finished and defer the rest; blocking on
+                // the driver here would stall commands that are waiting in the queue.
+                fences_pending = !renderer.Rasterizer().TryReleaseFences();
+            } else if (const auto data = std::get_if<GPUTickCommand>(&next.data)) {
+                system.GPU().TickWork();
+            } else if (const auto data = std::get_if<FlushRegionCommand>(&next.data)) {
+                renderer.Rasterizer().FlushRegion(data->addr, data->size);
+            } else if (const auto data = std::get_if<InvalidateRegionCommand>(&next.data)) {
+                renderer.Rasterizer().OnCPUWrite(data->addr, data->size);
+            } else if (std::holds_alternative<EndProcessingCommand>(next.data)) {
+                LOG_INFO(HW_GPU, "GPU thread used {} ms of CPU time",
+                         std::chrono::duration_cast<std::chrono::milliseconds>(
+                             Common::GetCurrentThreadCpuTime())
+                             .count());
+                return;
+            } else {
+                UNREACHABLE();
+            }
+            state.signaled_fence.store(next.fence);
+        }
+        if (fences_pending) {
+            if (state.queue.Empty()) {
+                // No more commands to hide the wait behind, block until the deferred fences have
+                // been signaled so the guest does not spin on an unsignaled syncpoint.
+                renderer.Rasterizer().ReleaseFences();
+                fences_pending = false;
+            } else {
+                fences_pending = !renderer.Rasterizer().TryReleaseFences();
+            }
         }
-        state.signaled_fence.store(next.fence);
     }
 }
 
@@ -90,7 +116,7 @@ void ThreadManager::SwapBuffers(const Tegra::FramebufferConfig* framebuffer) {
 
 void ThreadManager::FlushRegion(VAddr addr, u64 size) {
     if (!Settings::IsGPULevelHigh()) {
-        PushCommand(FlushRegionCommand(addr, size));
+        DeferFlushRegion(addr, size);
         return;
     }
     if (!Settings::IsGPULevelExtreme()) {
@@ -105,6 +131,31 @@ void ThreadManager::FlushRegion(VAddr addr, u64 size) {
     }
 }
 
+void ThreadManager::DeferFlushRegion(VAddr addr, u64 size) {
+    // Games tend to flush many small adjacent regions per frame. Each deferred flush returns
+    // immediately, but a command per region still serializes the GPU thread on cache lookups, so
+    // coalesce them on submission instead of pushing one command each.
+    const VAddr begin = addr;
+    const VAddr end = addr + size;
+    const bool previous_pending =
+        last_flush_fence > state.signaled_fence.load(std::memory_order_relaxed);
+    if (previous_pending && begin >= last_flush_begin && end <= last_flush_end) {
+        // The previous command has not been executed yet and already covers this region.
+        return;
+    }
+    if (previous_pending && begin <= last_flush_end && end >= last_flush_begin) {
+        // Overlapping or contiguous with the still-queued command; push the union. The queued
+        // command becomes a subset and finishes early on the already flushed pages.
+        last_flush_begin = std::min(begin, last_flush_begin);
+        last_flush_end = std::max(end, last_flush_end);
+    } else {
+        last_flush_begin = begin;
+        last_flush_end = end;
+    }
+    last_flush_fence =
+        PushCommand(FlushRegionCommand(last_flush_begin, last_flush_end - last_flush_begin));
+}
+
 void ThreadManager::InvalidateRegion(VAddr addr, u64 size) {
     system.Renderer().Rasterizer().OnCPUWrite(addr, size);
 }
@@ -10,7 +10,7 @@
 #include <optional>
 #include <thread>
 #include <variant>
-#include "common/threadsafe_queue.h"
+#include "common/mpmc_queue.h"
 #include "video_core/gpu.h"
 
 namespace Tegra {
@@ -95,7 +95,7 @@ struct CommandDataContainer {
 struct SynchState final {
     std::atomic_bool is_running{true};
 
-    using CommandQueue = Common::MPSCQueue<CommandDataContainer>;
+    using CommandQueue = Common::MPMCQueue<CommandDataContainer, 0x400>;
     CommandQueue queue;
     u64 last_fence{};
     std::atomic<u64> signaled_fence{};
@@ -135,11 +135,19 @@ private:
     /// Pushes a command to be executed by the GPU thread
     u64 PushCommand(CommandData&& command_data);
 
+    /// Pushes a non-blocking flush, merging it with the last queued one when they are adjacent
+    void DeferFlushRegion(VAddr addr, u64 size);
+
 private:
     SynchState state;
     Core::System& system;
     std::thread thread;
     std::thread::id thread_id;
+
+    /// Region and fence of the last queued deferred flush, used for coalescing
+    VAddr last_flush_begin{};
+    VAddr last_flush_end{};
+    u64 last_flush_fence{};
 };
 
 } // namespace VideoCommon::GPUThread
@@ -24,6 +24,11 @@ public:
 
     void DeduceTextureHandlerSize(std::vector<u32> bound_offsets);
 
+    /// Seeds the profile with a texture handler size deduced on a previous session.
+    void SetTextureHandlerSize(u32 size) {
+        texture_handler_size = size;
+    }
+
     u32 GetTextureHandlerSize() const {
         return texture_handler_size.value_or(default_texture_handler_size);
     }
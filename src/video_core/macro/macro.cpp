@@ -2,10 +2,16 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <chrono>
 #include <optional>
 #include <boost/container_hash/hash.hpp>
+#include <fmt/format.h>
 #include "common/assert.h"
+#include "common/file_util.h"
 #include "common/logging/log.h"
+#include "core/core.h"
+#include "core/hle/kernel/process.h"
 #include "core/settings.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/macro/macro.h"
@@ -14,25 +20,47 @@
 #include "video_core/macro/macro_jit_x64.h"
 
 namespace Tegra {
+namespace {
+constexpr u32 MACRO_PROFILE_VERSION = 2;
+
+/// Execution counts at or above this mark a macro as worth a hand-written HLE replacement.
+constexpr u64 HLE_CANDIDATE_THRESHOLD = 0x1000;
+
+struct ProfileEntry {
+    u64 hash;
+    u64 execution_count;
+    u64 parameter_count;
+    u64 lle_time_ns;
+};
+static_assert(sizeof(ProfileEntry) == 0x20, "ProfileEntry has incorrect size.");
+} // Anonymous namespace
 
 MacroEngine::MacroEngine(Engines::Maxwell3D& maxwell3d)
     : hle_macros{std::make_unique<Tegra::HLEMacro>(maxwell3d)} {}
 
-MacroEngine::~MacroEngine() = default;
+MacroEngine::~MacroEngine() {
+    SaveProfile();
+}
 
 void MacroEngine::AddCode(u32 method, u32 data) {
     uploaded_macro_code[method].push_back(data);
 }
 
 void MacroEngine::Execute(Engines::Maxwell3D& maxwell3d, u32 method,
-                          const std::vector<u32>& parameters) {
+                          Macro::ParameterView parameters) {
+    if (!profile_loaded) {
+        LoadProfile();
+    }
+
     auto compiled_macro = macro_cache.find(method);
     if (compiled_macro != macro_cache.end()) {
-        const auto& cache_info = compiled_macro->second;
+        auto& cache_info = compiled_macro->second;
+        ++cache_info.execution_count;
+        cache_info.parameter_count += parameters.size();
         if (cache_info.has_hle_program) {
             cache_info.hle_program->Execute(parameters, method);
         } else {
-            cache_info.lle_program->Execute(parameters, method);
+            ExecuteLLE(cache_info, parameters, method);
         }
     } else {
         // Macro not compiled, check if it's uploaded and if so, compile it
@@ -66,17 +94,138 @@ void MacroEngine::Execute(Engines::Maxwell3D& maxwell3d, u32 method,
             cache_info.lle_program = Compile(code);
         }
 
+        cache_info.execution_count = 1;
+        cache_info.parameter_count = parameters.size();
+
         auto hle_program = hle_macros->GetHLEProgram(cache_info.hash);
         if (hle_program.has_value()) {
             cache_info.has_hle_program = true;
             cache_info.hle_program = std::move(hle_program.value());
             cache_info.hle_program->Execute(parameters, method);
         } else {
-            cache_info.lle_program->Execute(parameters, method);
+            ExecuteLLE(cache_info, parameters, method);
+        }
+    }
+}
+
+void MacroEngine::ExecuteLLE(CacheInfo& cache_info, Macro::ParameterView parameters, u32 method) {
+    if (profile_path.empty()) {
+        // No title id, no profile being collected; skip the clock reads.
+        cache_info.lle_program->Execute(parameters, method);
+        return;
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    cache_info.lle_program->Execute(parameters, method);
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    cache_info.lle_time_ns +=
+        static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+void MacroEngine::LoadProfile() {
+    profile_loaded = true;
+
+    const auto* const process = Core::System::GetInstance().CurrentProcess();
+    if (process == nullptr || process->GetTitleID() == 0) {
+        // Skip games without a title id, the profile would be shared between them.
+        return;
+    }
+    const auto base_dir = FileUtil::GetUserPath(FileUtil::UserPath::CacheDir) + DIR_SEP "macro";
+    profile_path = FileUtil::SanitizePath(
+        base_dir + DIR_SEP + fmt::format("{:016X}.bin", process->GetTitleID()));
+    report_path = FileUtil::SanitizePath(
+        base_dir + DIR_SEP + fmt::format("{:016X}_report.txt", process->GetTitleID()));
+
+    FileUtil::IOFile file(profile_path, "rb");
+    if (!file.IsOpen()) {
+        return;
+    }
+
+    u32 version{};
+    if (file.ReadBytes(&version, sizeof(version)) != sizeof(version) ||
+        version != MACRO_PROFILE_VERSION) {
+        LOG_INFO(HW_GPU, "Macro profile version mismatch, skipping it");
+        return;
+    }
+
+    const auto num_entries = (file.GetSize() - sizeof(version)) / sizeof(ProfileEntry);
+    std::vector<ProfileEntry> entries(num_entries);
+    if (file.ReadArray(entries.data(), entries.size()) != entries.size()) {
+        LOG_ERROR(HW_GPU, "Failed to read macro profile from path={}", profile_path);
+        return;
+    }
+
+    for (const auto& entry : entries) {
+        execution_profile.emplace(
+            entry.hash, ProfileStats{entry.execution_count, entry.parameter_count,
+                                     entry.lle_time_ns});
+
+        // Surface hot macros that still go through the generic engines so they can be given
+        // native implementations in macro_hle.cpp.
+        if (entry.execution_count >= HLE_CANDIDATE_THRESHOLD &&
+            !hle_macros->HasHLEProgram(entry.hash)) {
+            LOG_INFO(HW_GPU,
+                     "Macro {:016X} is an HLE candidate: {} executions, {:.1f} parameters on "
+                     "average, {:.2f} ms in the generic engines",
+                     entry.hash, entry.execution_count,
+                     static_cast<f64>(entry.parameter_count) /
+                         static_cast<f64>(entry.execution_count),
+                     static_cast<f64>(entry.lle_time_ns) / 1000000.0);
         }
     }
 }
 
+void MacroEngine::SaveProfile() const {
+    if (profile_path.empty()) {
+        return;
+    }
+
+    auto profile = execution_profile;
+    for (const auto& [method, cache_info] : macro_cache) {
+        auto& stats = profile[cache_info.hash];
+        stats.execution_count += cache_info.execution_count;
+        stats.parameter_count += cache_info.parameter_count;
+        stats.lle_time_ns += cache_info.lle_time_ns;
+    }
+    if (profile.empty()) {
+        return;
+    }
+
+    std::vector<ProfileEntry> entries;
+    entries.reserve(profile.size());
+    for (const auto& [hash, stats] : profile) {
+        entries.push_back({hash, stats.execution_count, stats.parameter_count, stats.lle_time_ns});
+    }
+
+    if (!FileUtil::CreateFullPath(profile_path)) {
+        LOG_ERROR(HW_GPU, "Failed to create macro profile directory for path={}", profile_path);
+        return;
+    }
+
+    FileUtil::IOFile file(profile_path, "wb");
+    if (!file.IsOpen() || file.WriteObject(MACRO_PROFILE_VERSION) != 1 ||
+        file.WriteArray(entries.data(), entries.size()) != entries.size()) {
+        LOG_ERROR(HW_GPU, "Failed to write macro profile to path={}", profile_path);
+    }
+
+    // Emit a human-readable hotness report alongside the binary profile, sorted by time spent in
+    // the generic engines so the best HLE candidates come first.
+    std::sort(entries.begin(), entries.end(), [](const ProfileEntry& a, const ProfileEntry& b) {
+        return a.lle_time_ns > b.lle_time_ns;
+    });
+
+    std::string report = fmt::format("{:<18} {:>12} {:>12} {:>12}  {}\n", "macro hash",
+                                     "executions", "avg params", "lle ms", "hle");
+    for (const auto& entry : entries) {
+        report += fmt::format("{:016X}   {:>12} {:>12.1f} {:>12.2f}  {}\n", entry.hash,
+                              entry.execution_count,
+                              static_cast<f64>(entry.parameter_count) /
+                                  static_cast<f64>(entry.execution_count),
+                              static_cast<f64>(entry.lle_time_ns) / 1000000.0,
+                              hle_macros->HasHLEProgram(entry.hash) ? "yes" : "no");
+    }
+    FileUtil::WriteStringToFile(true, report_path, report);
+}
+
 std::unique_ptr<MacroEngine> GetMacroEngine(Engines::Maxwell3D& maxwell3d) {
     if (Settings::values.disable_macro_jit) {
         return std::make_unique<MacroInterpreter>(maxwell3d);
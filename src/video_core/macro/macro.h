@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 #include "common/bit_field.h"
@@ -94,6 +95,35 @@ union MethodAddress {
     BitField<12, 6, u32> increment;
 };
 
+/**
+ * Non-owning view over the parameters of a macro invocation. The data lives in the method
+ * processor's persistent parameter buffer and is only valid for the duration of the call, so the
+ * view must not be stored by the executing macro.
+ */
+class ParameterView {
+public:
+    constexpr ParameterView() = default;
+    constexpr ParameterView(const u32* data, std::size_t size) : values{data}, count{size} {}
+    ParameterView(const std::vector<u32>& parameters)
+        : values{parameters.data()}, count{parameters.size()} {}
+
+    constexpr const u32* data() const {
+        return values;
+    }
+
+    constexpr std::size_t size() const {
+        return count;
+    }
+
+    constexpr u32 operator[](std::size_t index) const {
+        return values[index];
+    }
+
+private:
+    const u32* values{};
+    std::size_t count{};
+};
+
 } // namespace Macro
 
 class HLEMacro;
@@ -106,7 +136,7 @@ public:
      * @param code The macro byte code to execute
      * @param parameters The parameters of the macro
      */
-    virtual void Execute(const std::vector<u32>& parameters, u32 method) = 0;
+    virtual void Execute(Macro::ParameterView parameters, u32 method) = 0;
 };
 
 class MacroEngine {
@@ -118,7 +148,7 @@ public:
     void AddCode(u32 method, u32 data);
 
     // Compiles the macro if its not in the cache, and executes the compiled macro
-    void Execute(Engines::Maxwell3D& maxwell3d, u32 method, const std::vector<u32>& parameters);
+    void Execute(Engines::Maxwell3D& maxwell3d, u32 method, Macro::ParameterView parameters);
 
 protected:
     virtual std::unique_ptr<CachedMacro> Compile(const std::vector<u32>& code) = 0;
@@ -128,12 +158,36 @@ private:
         std::unique_ptr<CachedMacro> lle_program{};
         std::unique_ptr<CachedMacro> hle_program{};
         u64 hash{};
+        u64 execution_count{};
+        u64 parameter_count{};
+        u64 lle_time_ns{};
         bool has_hle_program{};
     };
 
+    /// Per-hash statistics aggregated across sessions.
+    struct ProfileStats {
+        u64 execution_count{};
+        u64 parameter_count{};
+        u64 lle_time_ns{};
+    };
+
+    // Runs the generic (interpreter or JIT) program, timing it when profiling is active.
+    void ExecuteLLE(CacheInfo& cache_info, Macro::ParameterView parameters, u32 method);
+
+    // Loads the per-title execution profile written by a previous session, if any.
+    void LoadProfile();
+
+    // Merges this session's statistics into the profile, writes it back to disk and emits a
+    // human-readable hotness report next to it.
+    void SaveProfile() const;
+
     std::unordered_map<u32, CacheInfo> macro_cache;
     std::unordered_map<u32, std::vector<u32>> uploaded_macro_code;
     std::unique_ptr<HLEMacro> hle_macros;
+    std::unordered_map<u64, ProfileStats> execution_profile;
+    std::string profile_path;
+    std::string report_path;
+    bool profile_loaded = false;
 };
 
 std::unique_ptr<MacroEngine> GetMacroEngine(Engines::Maxwell3D& maxwell3d);
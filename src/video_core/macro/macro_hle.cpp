@@ -3,7 +3,6 @@
 // Refer to the license.txt file included.
 
 #include <array>
-#include <vector>
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/macro/macro_hle.h"
 #include "video_core/rasterizer_interface.h"
@@ -12,8 +11,7 @@ namespace Tegra {
 
 namespace {
 // HLE'd functions
-static void HLE_771BB18C62444DA0(Engines::Maxwell3D& maxwell3d,
-                                 const std::vector<u32>& parameters) {
+static void HLE_771BB18C62444DA0(Engines::Maxwell3D& maxwell3d, Macro::ParameterView parameters) {
     const u32 instance_count = parameters[2] & maxwell3d.GetRegisterValue(0xD1B);
 
     maxwell3d.regs.draw.topology.Assign(
@@ -33,8 +31,7 @@ static void HLE_771BB18C62444DA0(Engines::Maxwell3D& maxwell3d,
     maxwell3d.mme_draw.current_mode = Engines::Maxwell3D::MMEDrawMode::Undefined;
 }
 
-static void HLE_0D61FC9FAAC9FCAD(Engines::Maxwell3D& maxwell3d,
-                                 const std::vector<u32>& parameters) {
+static void HLE_0D61FC9FAAC9FCAD(Engines::Maxwell3D& maxwell3d, Macro::ParameterView parameters) {
     const u32 count = (maxwell3d.GetRegisterValue(0xD1B) & parameters[2]);
 
     maxwell3d.regs.vertex_buffer.first = parameters[3];
@@ -52,8 +49,7 @@ static void HLE_0D61FC9FAAC9FCAD(Engines::Maxwell3D& maxwell3d,
     maxwell3d.mme_draw.current_mode = Engines::Maxwell3D::MMEDrawMode::Undefined;
 }
 
-static void HLE_0217920100488FF7(Engines::Maxwell3D& maxwell3d,
-                                 const std::vector<u32>& parameters) {
+static void HLE_0217920100488FF7(Engines::Maxwell3D& maxwell3d, Macro::ParameterView parameters) {
     const u32 instance_count = (maxwell3d.GetRegisterValue(0xD1B) & parameters[2]);
     const u32 element_base = parameters[4];
     const u32 base_instance = parameters[5];
@@ -101,12 +97,18 @@ std::optional<std::unique_ptr<CachedMacro>> HLEMacro::GetHLEProgram(u64 hash) co
     return std::make_unique<HLEMacroImpl>(maxwell3d, it->second);
 }
 
+bool HLEMacro::HasHLEProgram(u64 hash) const {
+    return std::find_if(hle_funcs.cbegin(), hle_funcs.cend(), [hash](const auto& pair) {
+               return pair.first == hash;
+           }) != hle_funcs.cend();
+}
+
 HLEMacroImpl::~HLEMacroImpl() = default;
 
 HLEMacroImpl::HLEMacroImpl(Engines::Maxwell3D& maxwell3d, HLEFunction func)
     : maxwell3d(maxwell3d), func(func) {}
 
-void HLEMacroImpl::Execute(const std::vector<u32>& parameters, u32 method) {
+void HLEMacroImpl::Execute(Macro::ParameterView parameters, u32 method) {
     func(maxwell3d, parameters);
 }
 
@@ -6,7 +6,6 @@
 
 #include <memory>
 #include <optional>
-#include <vector>
 #include "common/common_types.h"
 #include "video_core/macro/macro.h"
 
@@ -16,7 +15,7 @@ namespace Engines {
 class Maxwell3D;
 }
 
-using HLEFunction = void (*)(Engines::Maxwell3D& maxwell3d, const std::vector<u32>& parameters);
+using HLEFunction = void (*)(Engines::Maxwell3D& maxwell3d, Macro::ParameterView parameters);
 
 class HLEMacro {
 public:
@@ -25,6 +24,9 @@ public:
 
     std::optional<std::unique_ptr<CachedMacro>> GetHLEProgram(u64 hash) const;
 
+    /// Checks whether a native implementation exists for the given macro hash.
+    bool HasHLEProgram(u64 hash) const;
+
 private:
     Engines::Maxwell3D& maxwell3d;
 };
@@ -34,7 +36,7 @@ public:
     explicit HLEMacroImpl(Engines::Maxwell3D& maxwell3d, HLEFunction func);
     ~HLEMacroImpl();
 
-    void Execute(const std::vector<u32>& parameters, u32 method) override;
+    void Execute(Macro::ParameterView parameters, u32 method) override;
 
 private:
     Engines::Maxwell3D& maxwell3d;
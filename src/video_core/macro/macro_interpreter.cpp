@@ -22,20 +22,14 @@ MacroInterpreterImpl::MacroInterpreterImpl(Engines::Maxwell3D& maxwell3d,
                                            const std::vector<u32>& code)
     : maxwell3d(maxwell3d), code(code) {}
 
-void MacroInterpreterImpl::Execute(const std::vector<u32>& parameters, u32 method) {
+void MacroInterpreterImpl::Execute(Macro::ParameterView parameters, u32 method) {
     MICROPROFILE_SCOPE(MacroInterp);
     Reset();
 
     registers[1] = parameters[0];
+    this->parameters = parameters.data();
     num_parameters = parameters.size();
 
-    if (num_parameters > parameters_capacity) {
-        parameters_capacity = num_parameters;
-        this->parameters = std::make_unique<u32[]>(num_parameters);
-    }
-    std::memcpy(this->parameters.get(), parameters.data(), num_parameters * sizeof(u32));
-    this->num_parameters = num_parameters;
-
     // Execute the code until we hit an exit condition.
     bool keep_executing = true;
     while (keep_executing) {
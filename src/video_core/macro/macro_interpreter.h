@@ -29,7 +29,7 @@ private:
 class MacroInterpreterImpl : public CachedMacro {
 public:
     MacroInterpreterImpl(Engines::Maxwell3D& maxwell3d, const std::vector<u32>& code);
-    void Execute(const std::vector<u32>& parameters, u32 method) override;
+    void Execute(Macro::ParameterView parameters, u32 method) override;
 
 private:
     /// Resets the execution engine state, zeroing registers, etc.
@@ -88,10 +88,9 @@ private:
     /// Method address to use for the next Send instruction.
     Macro::MethodAddress method_address = {};
 
-    /// Input parameters of the current macro.
-    std::unique_ptr<u32[]> parameters;
+    /// Input parameters of the current macro, read in place from the method processor's buffer.
+    const u32* parameters = nullptr;
     std::size_t num_parameters = 0;
-    std::size_t parameters_capacity = 0;
     /// Index of the next parameter that will be fetched by the 'parm' instruction.
     u32 next_parameter_index = 0;
 
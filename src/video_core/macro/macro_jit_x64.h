@@ -37,7 +37,7 @@ public:
     MacroJITx64Impl(Engines::Maxwell3D& maxwell3d, const std::vector<u32>& code);
     ~MacroJITx64Impl();
 
-    void Execute(const std::vector<u32>& parameters, u32 method) override;
+    void Execute(Macro::ParameterView parameters, u32 method) override;
 
     void Compile_ALU(Macro::Opcode opcode);
     void Compile_AddImmediate(Macro::Opcode opcode);
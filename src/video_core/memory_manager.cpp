@@ -9,6 +9,7 @@
 #include "core/hle/kernel/memory/page_table.h"
 #include "core/hle/kernel/process.h"
 #include "core/memory.h"
+#include "video_core/command_stream_capture.h"
 #include "video_core/gpu.h"
 #include "video_core/memory_manager.h"
 #include "video_core/rasterizer_interface.h"
@@ -53,6 +54,9 @@ GPUVAddr MemoryManager::MapBufferEx(VAddr cpu_addr, u64 size) {
     MapBackingMemory(gpu_addr, system.Memory().GetPointer(cpu_addr), aligned_size, cpu_addr);
     ASSERT(
         system.CurrentProcess()->PageTable().LockForDeviceAddressSpace(cpu_addr, size).IsSuccess());
+    if (auto* const capture = system.GPU().Capture()) {
+        capture->RecordMap(gpu_addr, cpu_addr, aligned_size);
+    }
 
     return gpu_addr;
 }
@@ -65,6 +69,9 @@ GPUVAddr MemoryManager::MapBufferEx(VAddr cpu_addr, GPUVAddr gpu_addr, u64 size)
     MapBackingMemory(gpu_addr, system.Memory().GetPointer(cpu_addr), aligned_size, cpu_addr);
     ASSERT(
         system.CurrentProcess()->PageTable().LockForDeviceAddressSpace(cpu_addr, size).IsSuccess());
+    if (auto* const capture = system.GPU().Capture()) {
+        capture->RecordMap(gpu_addr, cpu_addr, aligned_size);
+    }
     return gpu_addr;
 }
 
@@ -83,6 +90,9 @@ GPUVAddr MemoryManager::UnmapBuffer(GPUVAddr gpu_addr, u64 size) {
                ->PageTable()
                .UnlockForDeviceAddressSpace(cpu_addr.value(), size)
                .IsSuccess());
+    if (auto* const capture = system.GPU().Capture()) {
+        capture->RecordUnmap(gpu_addr, aligned_size);
+    }
 
     return gpu_addr;
 }
@@ -201,6 +211,49 @@ const u8* MemoryManager::GetPointer(GPUVAddr addr) const {
     return {};
 }
 
+template <typename Func>
+void MemoryManager::ForEachContiguousRange(GPUVAddr addr, std::size_t size, Func&& func) const {
+    std::size_t remaining_size{size};
+    std::size_t page_index{addr >> page_bits};
+    std::size_t page_offset{addr & page_mask};
+
+    VAddr run_addr{};
+    std::size_t run_size{};
+    bool run_mapped{};
+    while (remaining_size > 0) {
+        const std::size_t copy_amount{
+            std::min(static_cast<std::size_t>(page_size) - page_offset, remaining_size)};
+        const bool is_mapped{page_table.pointers[page_index] != nullptr};
+        const VAddr cpu_addr{page_table.backing_addr[page_index] + page_offset};
+        if (run_size > 0 && cpu_addr == run_addr + run_size && is_mapped == run_mapped) {
+            run_size += copy_amount;
+        } else {
+            if (run_size > 0) {
+                func(run_addr, run_size, run_mapped);
+            }
+            run_addr = cpu_addr;
+            run_size = copy_amount;
+            run_mapped = is_mapped;
+        }
+        page_index++;
+        page_offset = 0;
+        remaining_size -= copy_amount;
+    }
+    if (run_size > 0) {
+        func(run_addr, run_size, run_mapped);
+    }
+}
+
+std::vector<MemoryManager::ContiguousRange> MemoryManager::TranslateRange(
+    GPUVAddr addr, const std::size_t size) const {
+    std::vector<ContiguousRange> ranges;
+    ForEachContiguousRange(
+        addr, size, [&ranges](VAddr cpu_addr, std::size_t range_size, bool mapped) {
+            ranges.push_back({mapped ? cpu_addr : 0, range_size});
+        });
+    return ranges;
+}
+
 bool MemoryManager::IsBlockContinuous(const GPUVAddr start, const std::size_t size) const {
     const std::size_t inner_size = size - 1;
     const GPUVAddr end = start + inner_size;
@@ -212,100 +265,59 @@ bool MemoryManager::IsBlockContinuous(const GPUVAddr start, const std::size_t si
 
 void MemoryManager::ReadBlock(GPUVAddr gpu_src_addr, void* dest_buffer,
                               const std::size_t size) const {
-    std::size_t remaining_size{size};
-    std::size_t page_index{gpu_src_addr >> page_bits};
-    std::size_t page_offset{gpu_src_addr & page_mask};
-
     auto& memory = system.Memory();
 
-    while (remaining_size > 0) {
-        const std::size_t copy_amount{
-            std::min(static_cast<std::size_t>(page_size) - page_offset, remaining_size)};
-
-        const VAddr src_addr{page_table.backing_addr[page_index] + page_offset};
-        // Flush must happen on the rasterizer interface, such that memory is always synchronous
-        // when it is read (even when in asynchronous GPU mode). Fixes Dead Cells title menu.
-        rasterizer.FlushRegion(src_addr, copy_amount);
-        memory.ReadBlockUnsafe(src_addr, dest_buffer, copy_amount);
-
-        page_index++;
-        page_offset = 0;
-        dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
-        remaining_size -= copy_amount;
-    }
+    ForEachContiguousRange(
+        gpu_src_addr, size, [&](VAddr src_addr, std::size_t copy_amount, bool) {
+            // Flush must happen on the rasterizer interface, such that memory is always
+            // synchronous when it is read (even when in asynchronous GPU mode). Fixes Dead Cells
+            // title menu.
+            rasterizer.FlushRegion(src_addr, copy_amount);
+            memory.ReadBlockUnsafe(src_addr, dest_buffer, copy_amount);
+            dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
+        });
 }
 
 void MemoryManager::ReadBlockUnsafe(GPUVAddr gpu_src_addr, void* dest_buffer,
                                     const std::size_t size) const {
-    std::size_t remaining_size{size};
-    std::size_t page_index{gpu_src_addr >> page_bits};
-    std::size_t page_offset{gpu_src_addr & page_mask};
-
     auto& memory = system.Memory();
 
-    while (remaining_size > 0) {
-        const std::size_t copy_amount{
-            std::min(static_cast<std::size_t>(page_size) - page_offset, remaining_size)};
-        const u8* page_pointer = page_table.pointers[page_index];
-        if (page_pointer) {
-            const VAddr src_addr{page_table.backing_addr[page_index] + page_offset};
-            memory.ReadBlockUnsafe(src_addr, dest_buffer, copy_amount);
-        } else {
-            std::memset(dest_buffer, 0, copy_amount);
-        }
-        page_index++;
-        page_offset = 0;
-        dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
-        remaining_size -= copy_amount;
-    }
+    ForEachContiguousRange(
+        gpu_src_addr, size, [&](VAddr src_addr, std::size_t copy_amount, bool mapped) {
+            if (mapped) {
+                memory.ReadBlockUnsafe(src_addr, dest_buffer, copy_amount);
+            } else {
+                std::memset(dest_buffer, 0, copy_amount);
+            }
+            dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
+        });
 }
 
 void MemoryManager::WriteBlock(GPUVAddr gpu_dest_addr, const void* src_buffer,
                                const std::size_t size) {
-    std::size_t remaining_size{size};
-    std::size_t page_index{gpu_dest_addr >> page_bits};
-    std::size_t page_offset{gpu_dest_addr & page_mask};
-
     auto& memory = system.Memory();
 
-    while (remaining_size > 0) {
-        const std::size_t copy_amount{
-            std::min(static_cast<std::size_t>(page_size) - page_offset, remaining_size)};
-
-        const VAddr dest_addr{page_table.backing_addr[page_index] + page_offset};
-        // Invalidate must happen on the rasterizer interface, such that memory is always
-        // synchronous when it is written (even when in asynchronous GPU mode).
-        rasterizer.InvalidateRegion(dest_addr, copy_amount);
-        memory.WriteBlockUnsafe(dest_addr, src_buffer, copy_amount);
-
-        page_index++;
-        page_offset = 0;
-        src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
-        remaining_size -= copy_amount;
-    }
+    ForEachContiguousRange(
+        gpu_dest_addr, size, [&](VAddr dest_addr, std::size_t copy_amount, bool) {
+            // Invalidate must happen on the rasterizer interface, such that memory is always
+            // synchronous when it is written (even when in asynchronous GPU mode).
+            rasterizer.InvalidateRegion(dest_addr, copy_amount);
+            memory.WriteBlockUnsafe(dest_addr, src_buffer, copy_amount);
+            src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
+        });
 }
 
 void MemoryManager::WriteBlockUnsafe(GPUVAddr gpu_dest_addr, const void* src_buffer,
                                      const std::size_t size) {
-    std::size_t remaining_size{size};
-    std::size_t page_index{gpu_dest_addr >> page_bits};
-    std::size_t page_offset{gpu_dest_addr & page_mask};
-
     auto& memory = system.Memory();
 
-    while (remaining_size > 0) {
-        const std::size_t copy_amount{
-            std::min(static_cast<std::size_t>(page_size) - page_offset, remaining_size)};
-        u8* page_pointer = page_table.pointers[page_index];
-        if (page_pointer) {
-            const VAddr dest_addr{page_table.backing_addr[page_index] + page_offset};
-            memory.WriteBlockUnsafe(dest_addr, src_buffer, copy_amount);
-        }
-        page_index++;
-        page_offset = 0;
-        src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
-        remaining_size -= copy_amount;
-    }
+    ForEachContiguousRange(
+        gpu_dest_addr, size, [&](VAddr dest_addr, std::size_t copy_amount, bool mapped) {
+            if (mapped) {
+                memory.WriteBlockUnsafe(dest_addr, src_buffer, copy_amount);
+            }
+            src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
+        });
 }
 
 void MemoryManager::CopyBlock(GPUVAddr gpu_dest_addr, GPUVAddr gpu_src_addr,
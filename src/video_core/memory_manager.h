@@ -6,6 +6,7 @@
 
 #include <map>
 #include <optional>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/page_table.h"
@@ -61,6 +62,19 @@ public:
     GPUVAddr UnmapBuffer(GPUVAddr addr, u64 size);
     std::optional<VAddr> GpuToCpuAddress(GPUVAddr addr) const;
 
+    /// A run of GPU memory that is contiguous in host CPU memory.
+    struct ContiguousRange {
+        VAddr cpu_addr;   ///< Start of the run in CPU memory, zero when the pages are unmapped.
+        std::size_t size; ///< Size of the run in bytes.
+    };
+
+    /**
+     * Translates a GPU virtual range into the minimal set of runs that are contiguous in CPU
+     * memory, coalescing neighbouring pages. Callers operating over whole mappings should prefer
+     * this over translating every page through GpuToCpuAddress.
+     */
+    std::vector<ContiguousRange> TranslateRange(GPUVAddr addr, std::size_t size) const;
+
     template <typename T>
     T Read(GPUVAddr addr) const;
 
@@ -108,6 +122,16 @@ private:
     using VMAIter = VMAMap::iterator;
 
     bool IsAddressValid(GPUVAddr addr) const;
+
+    /**
+     * Invokes func for each run of the given range that is contiguous in CPU memory, passing the
+     * run's CPU address, its size in bytes and whether its pages are mapped. Unmapped pages are
+     * reported with the raw backing address so callers can preserve their previous per-page
+     * behavior.
+     */
+    template <typename Func>
+    void ForEachContiguousRange(GPUVAddr addr, std::size_t size, Func&& func) const;
+
     void MapPages(GPUVAddr base, u64 size, u8* memory, Common::PageType type,
                   VAddr backing_addr = 0);
     void MapMemoryRegion(GPUVAddr base, u64 size, u8* target, VAddr backing_addr);
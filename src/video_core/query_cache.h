@@ -107,6 +107,14 @@ public:
 
     void FlushRegion(VAddr addr, std::size_t size) {
         std::unique_lock lock{mutex};
+        if (Settings::values.use_asynchronous_gpu_emulation) {
+            // Write back the last known values immediately instead of stalling on the host GPU.
+            // Queries recorded with asynchronous GPU emulation enabled are scheduled for an
+            // asynchronous flush in Query(), so the real values are reconciled when the fence
+            // manager pops that flush.
+            FlushStaleRegion(addr, size);
+            return;
+        }
         FlushAndRemoveRegion(addr, size);
     }
 
@@ -239,6 +247,31 @@ private:
         }
     }
 
+    /// Writes the last known value of every query in the region without waiting on the host GPU
+    /// or removing the queries from the cache.
+    void FlushStaleRegion(VAddr addr, std::size_t size) {
+        const u64 addr_begin = static_cast<u64>(addr);
+        const u64 addr_end = addr_begin + static_cast<u64>(size);
+        const auto in_range = [addr_begin, addr_end](const CachedQuery& query) {
+            const u64 cache_begin = query.GetCpuAddr();
+            const u64 cache_end = cache_begin + query.SizeInBytes();
+            return cache_begin < addr_end && addr_begin < cache_end;
+        };
+
+        const u64 page_end = addr_end >> PAGE_BITS;
+        for (u64 page = addr_begin >> PAGE_BITS; page <= page_end; ++page) {
+            const auto& it = cached_queries.find(page);
+            if (it == std::end(cached_queries)) {
+                continue;
+            }
+            for (auto& query : it->second) {
+                if (in_range(query)) {
+                    query.FlushStale();
+                }
+            }
+        }
+    }
+
     /// Registers the passed parameters as cached and returns a pointer to the stored cached query.
     CachedQuery* Register(VideoCore::QueryType type, VAddr cpu_addr, u8* host_ptr, bool timestamp) {
         rasterizer.UpdatePagesCachedCount(cpu_addr, CachedQuery::SizeInBytes(timestamp), 1);
@@ -352,6 +385,7 @@ public:
         // When counter is nullptr it means that it's just been reseted. We are supposed to write a
         // zero in these cases.
         const u64 value = counter ? counter->Query() : 0;
+        last_value = value;
         std::memcpy(host_ptr, &value, sizeof(u64));
 
         if (timestamp) {
@@ -359,6 +393,16 @@ public:
         }
     }
 
+    /// Writes the last known value to guest memory without waiting on the host GPU. The real
+    /// value has to be reconciled with a later call to Flush.
+    void FlushStale() {
+        std::memcpy(host_ptr, &last_value, sizeof(u64));
+
+        if (timestamp) {
+            std::memcpy(host_ptr + TIMESTAMP_OFFSET, &*timestamp, sizeof(u64));
+        }
+    }
+
     /// Binds a counter to this query.
     void BindCounter(std::shared_ptr<HostCounter> counter_, std::optional<u64> timestamp_) {
         if (counter) {
@@ -397,6 +441,7 @@ private:
     u8* host_ptr;                         ///< Writable host pointer.
     std::shared_ptr<HostCounter> counter; ///< Host counter to query, owns the dependency tree.
     std::optional<u64> timestamp;         ///< Timestamp to flush to guest memory.
+    u64 last_value = 0;                   ///< Last value written to guest memory.
 };
 
 } // namespace VideoCommon
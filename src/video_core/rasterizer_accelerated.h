@@ -4,9 +4,9 @@
 
 #pragma once
 
-#include <mutex>
-
-#include <boost/icl/interval_map.hpp>
+#include <array>
+#include <atomic>
+#include <memory>
 
 #include "common/common_types.h"
 #include "video_core/rasterizer_interface.h"
@@ -26,9 +26,29 @@ public:
     void UpdatePagesCachedCount(VAddr addr, u64 size, int delta) override;
 
 private:
-    using CachedPageMap = boost::icl::interval_map<u64, int>;
-    CachedPageMap cached_pages;
-    std::mutex pages_mutex;
+    /// Packs the cached counters of four consecutive pages into one 64-bit entry, so concurrent
+    /// updates from different caches only contend on the pages they actually share.
+    class CacheEntry final {
+    public:
+        CacheEntry() = default;
+
+        std::atomic_uint16_t& Count(std::size_t page) {
+            return values[page & 3];
+        }
+
+        const std::atomic_uint16_t& Count(std::size_t page) const {
+            return values[page & 3];
+        }
+
+    private:
+        std::array<std::atomic_uint16_t, 4> values{};
+    };
+    static_assert(sizeof(CacheEntry) == 8, "CacheEntry should be 8 bytes!");
+
+    /// One entry per four 4 KiB pages over the whole 39-bit guest address space. The backing
+    /// pages are only committed by the OS where counters are actually touched.
+    using CachedPages = std::array<CacheEntry, 0x2000000>;
+    std::unique_ptr<CachedPages> cached_pages;
 
     Core::Memory::Memory& cpu_memory;
 };
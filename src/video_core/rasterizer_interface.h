@@ -9,6 +9,7 @@
 #include <optional>
 #include "common/common_types.h"
 #include "video_core/engines/fermi_2d.h"
+#include "video_core/engines/maxwell_dma.h"
 #include "video_core/gpu.h"
 #include "video_core/guest_driver.h"
 
@@ -58,6 +59,10 @@ public:
     /// Release all pending fences.
     virtual void ReleaseFences() = 0;
 
+    /// Attempt to release pending fences without blocking on the host driver. Returns true when
+    /// no fences are left pending.
+    virtual bool TryReleaseFences() = 0;
+
     /// Notify rasterizer that all caches should be flushed to Switch memory
     virtual void FlushAll() = 0;
 
@@ -96,6 +101,14 @@ public:
         return false;
     }
 
+    /// Attempt to use a resident surface to perform a DMA engine tiled-to-linear copy
+    virtual bool AccelerateDMATiledToLinear(
+        GPUVAddr src_address, GPUVAddr dst_address,
+        const Tegra::Engines::MaxwellDMA::Regs::Parameters& src_params, u32 x_count, u32 y_count,
+        u32 dst_pitch) {
+        return false;
+    }
+
     /// Attempt to use a faster method to display the framebuffer to screen
     virtual bool AccelerateDisplay(const Tegra::FramebufferConfig& config, VAddr framebuffer_addr,
                                    u32 pixel_stride) {
@@ -2,11 +2,14 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 #include <glad/glad.h>
 
 #include "common/assert.h"
+#include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "video_core/buffer_cache/buffer_cache.h"
 #include "video_core/engines/maxwell_3d.h"
@@ -73,6 +76,7 @@ OGLBufferCache::OGLBufferCache(RasterizerOpenGL& rasterizer, Core::System& syste
     for (const GLuint cbuf : cbufs) {
         glNamedBufferData(cbuf, size, nullptr, GL_STREAM_DRAW);
     }
+    cbuf_shadow = std::make_unique<u8[]>(NUM_CBUFS * Maxwell::MaxConstBufferSize);
 }
 
 OGLBufferCache::~OGLBufferCache() {
@@ -90,10 +94,51 @@ OGLBufferCache::BufferInfo OGLBufferCache::GetEmptyBuffer(std::size_t) {
 OGLBufferCache::BufferInfo OGLBufferCache::ConstBufferUpload(const void* raw_pointer,
                                                              std::size_t size) {
     DEBUG_ASSERT(cbuf_cursor < std::size(cbufs));
-    const GLuint cbuf = cbufs[cbuf_cursor++];
-
-    glNamedBufferSubData(cbuf, 0, static_cast<GLsizeiptr>(size), raw_pointer);
+    const std::size_t slot = cbuf_cursor++;
+    const GLuint cbuf = cbufs[slot];
+    const u8* const data = static_cast<const u8*>(raw_pointer);
+    u8* const shadow = cbuf_shadow.get() + slot * Maxwell::MaxConstBufferSize;
+    cbuf_bound_bytes += size;
+
+    // Guest engines usually rewrite only a few words between draws, so diff the new contents
+    // against the shadow copy and upload only the chunks that changed. The fixed-size memcmp
+    // compiles down to vector compares.
+    const std::size_t compared_size = std::min(cbuf_shadow_valid[slot], size);
+    std::size_t run_begin = 0;
+    bool in_run = false;
+    const auto flush_run = [&](std::size_t run_end) {
+        glNamedBufferSubData(cbuf, static_cast<GLintptr>(run_begin),
+                             static_cast<GLsizeiptr>(run_end - run_begin), data + run_begin);
+        std::memcpy(shadow + run_begin, data + run_begin, run_end - run_begin);
+        cbuf_uploaded_bytes += run_end - run_begin;
+    };
+    for (std::size_t offset = 0; offset < size; offset += CBUF_CHUNK_SIZE) {
+        const std::size_t chunk_size = std::min(CBUF_CHUNK_SIZE, size - offset);
+        const bool dirty = offset + chunk_size > compared_size ||
+                           std::memcmp(shadow + offset, data + offset, chunk_size) != 0;
+        if (dirty && !in_run) {
+            run_begin = offset;
+            in_run = true;
+        } else if (!dirty && in_run) {
+            flush_run(offset);
+            in_run = false;
+        }
+    }
+    if (in_run) {
+        flush_run(size);
+    }
+    cbuf_shadow_valid[slot] = std::max(cbuf_shadow_valid[slot], size);
     return {cbuf, 0, 0};
 }
 
+void OGLBufferCache::TickFrame() {
+    if (cbuf_bound_bytes > 0) {
+        LOG_DEBUG(Render_OpenGL, "Const buffers this frame: {} KiB bound, {} KiB uploaded",
+                  cbuf_bound_bytes / 1024, cbuf_uploaded_bytes / 1024);
+    }
+    cbuf_bound_bytes = 0;
+    cbuf_uploaded_bytes = 0;
+    GenericBufferCache::TickFrame();
+}
+
 } // namespace OpenGL
@@ -62,6 +62,9 @@ public:
         cbuf_cursor = 0;
     }
 
+    /// Reports the per-frame const buffer counters and advances the generic cache's frame.
+    void TickFrame();
+
 protected:
     std::shared_ptr<Buffer> CreateBlock(VAddr cpu_addr, std::size_t size) override;
 
@@ -71,10 +74,23 @@ private:
     static constexpr std::size_t NUM_CBUFS = Tegra::Engines::Maxwell3D::Regs::MaxConstBuffers *
                                              Tegra::Engines::Maxwell3D::Regs::MaxShaderProgram;
 
+    /// Diffing granularity of the const buffer shadow copies.
+    static constexpr std::size_t CBUF_CHUNK_SIZE = 64;
+
     const Device& device;
 
     std::size_t cbuf_cursor = 0;
     std::array<GLuint, NUM_CBUFS> cbufs{};
+
+    /// Shadow copy of the contents of every const buffer slot, diffed against new data so only
+    /// the chunks that actually changed between draws are uploaded.
+    std::unique_ptr<u8[]> cbuf_shadow;
+    /// Number of leading bytes of each slot's shadow copy that match the GL buffer.
+    std::array<std::size_t, NUM_CBUFS> cbuf_shadow_valid{};
+
+    /// Const buffer traffic of the current frame, reset in TickFrame.
+    u64 cbuf_bound_bytes = 0;
+    u64 cbuf_uploaded_bytes = 0;
 };
 
 } // namespace OpenGL
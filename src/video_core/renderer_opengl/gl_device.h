@@ -100,6 +100,15 @@ public:
         return has_nv_viewport_array2;
     }
 
+    bool HasParallelShaderCompile() const {
+        return has_parallel_shader_compile;
+    }
+
+    /// Hints the driver to spawn as many background shader compiler threads as it sees fit so
+    /// that compilation and linking overlap with rendering. Affects the current context only, so
+    /// it has to be called again from worker threads that bind their own shared context.
+    void MaximizeShaderCompilerThreads() const;
+
     bool UseAssemblyShaders() const {
         return use_assembly_shaders;
     }
@@ -126,6 +135,7 @@ private:
     bool has_precise_bug{};
     bool has_fast_buffer_sub_data{};
     bool has_nv_viewport_array2{};
+    bool has_parallel_shader_compile{};
     bool use_assembly_shaders{};
 };
 
@@ -3,7 +3,6 @@
 // Refer to the license.txt file included.
 
 #include <tuple>
-#include <unordered_map>
 #include <utility>
 
 #include <glad/glad.h>
@@ -22,9 +21,8 @@ FramebufferCacheOpenGL::FramebufferCacheOpenGL() = default;
 FramebufferCacheOpenGL::~FramebufferCacheOpenGL() = default;
 
 GLuint FramebufferCacheOpenGL::GetFramebuffer(const FramebufferCacheKey& key) {
-    const auto [entry, is_cache_miss] = cache.try_emplace(key);
-    auto& framebuffer{entry->second};
-    if (is_cache_miss) {
+    OGLFramebuffer& framebuffer = cache[key];
+    if (framebuffer.handle == 0) {
         framebuffer = CreateFramebuffer(key);
     }
     return framebuffer.handle;
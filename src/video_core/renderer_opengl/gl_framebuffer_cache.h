@@ -6,11 +6,11 @@
 
 #include <array>
 #include <cstddef>
-#include <unordered_map>
 
 #include <glad/glad.h>
 
 #include "common/common_types.h"
+#include "common/open_hash_map.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_opengl/gl_resource_manager.h"
 #include "video_core/renderer_opengl/gl_texture_cache.h"
@@ -62,7 +62,7 @@ public:
 private:
     OGLFramebuffer CreateFramebuffer(const FramebufferCacheKey& key);
 
-    std::unordered_map<FramebufferCacheKey, OGLFramebuffer> cache;
+    Common::OpenHashMap<FramebufferCacheKey, OGLFramebuffer> cache{64};
 };
 
 } // namespace OpenGL
@@ -24,6 +24,8 @@ namespace {
 
 constexpr std::array<GLenum, VideoCore::NumQueryTypes> QueryTargets = {GL_SAMPLES_PASSED};
 
+constexpr GLsizei QueryPoolBatchSize = 64;
+
 constexpr GLenum GetTarget(VideoCore::QueryType type) {
     return QueryTargets[static_cast<std::size_t>(type)];
 }
@@ -41,13 +43,19 @@ QueryCache::~QueryCache() = default;
 
 OGLQuery QueryCache::AllocateQuery(VideoCore::QueryType type) {
     auto& reserve = query_pools[static_cast<std::size_t>(type)];
-    OGLQuery query;
     if (reserve.empty()) {
-        query.Create(GetTarget(type));
-        return query;
+        // Refill the pool in batches so steady-state allocation doesn't create host query objects
+        // one by one in the middle of a frame.
+        std::array<GLuint, QueryPoolBatchSize> handles;
+        glCreateQueries(GetTarget(type), QueryPoolBatchSize, handles.data());
+        for (const GLuint handle : handles) {
+            OGLQuery query;
+            query.handle = handle;
+            reserve.push_back(std::move(query));
+        }
     }
 
-    query = std::move(reserve.back());
+    OGLQuery query = std::move(reserve.back());
     reserve.pop_back();
     return query;
 }
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <bitset>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -20,6 +21,7 @@
 #include "core/core.h"
 #include "core/hle/kernel/process.h"
 #include "core/memory.h"
+#include "core/perf_stats.h"
 #include "core/settings.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/engines/maxwell_3d.h"
@@ -419,6 +421,7 @@ void RasterizerOpenGL::LoadDiskResources(const std::atomic_bool& stop_loading,
 
 void RasterizerOpenGL::SetupDirtyFlags() {
     state_tracker.Initialize();
+    system.GPU().Maxwell3D().PrepareDirtyTables();
 }
 
 void RasterizerOpenGL::ConfigureFramebuffers() {
@@ -555,6 +558,8 @@ void RasterizerOpenGL::Clear() {
         return;
     }
 
+    BeginGPUSpan();
+
     SyncRasterizeEnable();
     SyncStencilTestState();
 
@@ -581,6 +586,8 @@ void RasterizerOpenGL::Clear() {
         glClearBufferiv(GL_STENCIL, 0, &regs.clear_stencil);
     }
 
+    EndGPUSpan("OpenGL Clear");
+
     ++num_queued_commands;
 }
 
@@ -590,6 +597,8 @@ void RasterizerOpenGL::Draw(bool is_indexed, bool is_instanced) {
 
     query_cache.UpdateCounters();
 
+    BeginGPUSpan();
+
     SyncViewport();
     SyncRasterizeEnable();
     SyncPolygonModes();
@@ -721,12 +730,16 @@ void RasterizerOpenGL::Draw(bool is_indexed, bool is_instanced) {
 
     EndTransformFeedback();
 
+    EndGPUSpan("OpenGL Draw");
+
     ++num_queued_commands;
 
     system.GPU().TickWork();
 }
 
 void RasterizerOpenGL::DispatchCompute(GPUVAddr code_addr) {
+    BeginGPUSpan();
+
     buffer_cache.Acquire();
     current_cbuf = 0;
 
@@ -747,6 +760,9 @@ void RasterizerOpenGL::DispatchCompute(GPUVAddr code_addr) {
     const auto& launch_desc = system.GPU().KeplerCompute().launch_description;
     program_manager.BindCompute(kernel->GetHandle());
     glDispatchCompute(launch_desc.grid_dim_x, launch_desc.grid_dim_y, launch_desc.grid_dim_z);
+
+    EndGPUSpan("OpenGL Compute");
+
     ++num_queued_commands;
 }
 
@@ -833,6 +849,14 @@ void RasterizerOpenGL::ReleaseFences() {
     fence_manager.WaitPendingFences();
 }
 
+bool RasterizerOpenGL::TryReleaseFences() {
+    auto& gpu{system.GPU()};
+    if (!gpu.IsAsync()) {
+        return true;
+    }
+    return fence_manager.TryReleasePendingFences();
+}
+
 void RasterizerOpenGL::FlushAndInvalidateRegion(VAddr addr, u64 size) {
     if (Settings::IsGPULevelExtreme()) {
         FlushRegion(addr, size);
@@ -864,7 +888,62 @@ void RasterizerOpenGL::TickFrame() {
     // Ticking a frame means that buffers will be swapped, calling glFlush implicitly.
     num_queued_commands = 0;
 
+    CollectGPUSpans();
     buffer_cache.TickFrame();
+    texture_cache.TickFrame();
+}
+
+void RasterizerOpenGL::BeginGPUSpan() {
+    if (!Settings::values.record_frame_times) {
+        return;
+    }
+    if (free_gpu_span_queries.empty()) {
+        current_gpu_span.query.Create(GL_TIME_ELAPSED);
+    } else {
+        current_gpu_span.query = std::move(free_gpu_span_queries.back());
+        free_gpu_span_queries.pop_back();
+    }
+    current_gpu_span.issue_ns =
+        static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             Core::PerfStats::Clock::now().time_since_epoch())
+                             .count());
+    glBeginQuery(GL_TIME_ELAPSED, current_gpu_span.query.handle);
+}
+
+void RasterizerOpenGL::EndGPUSpan(const char* bucket) {
+    if (current_gpu_span.query.handle == 0) {
+        return;
+    }
+    glEndQuery(GL_TIME_ELAPSED);
+    current_gpu_span.bucket = bucket;
+    pending_gpu_spans.push_back(std::move(current_gpu_span));
+}
+
+void RasterizerOpenGL::CollectGPUSpans() {
+    auto& perf_stats = system.GetPerfStats();
+    while (!pending_gpu_spans.empty()) {
+        auto& span = pending_gpu_spans.front();
+        GLint available = 0;
+        glGetQueryObjectiv(span.query.handle, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available == 0) {
+            // Results land in submission order, so nothing after this one is ready either.
+            break;
+        }
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(span.query.handle, GL_QUERY_RESULT, &elapsed);
+        perf_stats.RecordGPUSpan(span.bucket, span.issue_ns, static_cast<u64>(elapsed));
+        free_gpu_span_queries.push_back(std::move(span.query));
+        pending_gpu_spans.pop_front();
+    }
+}
+
+bool RasterizerOpenGL::AccelerateDMATiledToLinear(
+    GPUVAddr src_address, GPUVAddr dst_address,
+    const Tegra::Engines::MaxwellDMA::Regs::Parameters& src_params, u32 x_count, u32 y_count,
+    u32 dst_pitch) {
+    MICROPROFILE_SCOPE(OpenGL_CacheManagement);
+    return texture_cache.AccelerateDMATiledToLinear(src_address, dst_address, src_params, x_count,
+                                                    y_count, dst_pitch);
 }
 
 bool RasterizerOpenGL::AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Regs::Surface& src,
@@ -918,13 +997,37 @@ void RasterizerOpenGL::SetupDrawConstBuffers(std::size_t stage_index, Shader* sh
     const bool use_unified = entries.use_unified_uniforms;
     const std::size_t base_unified_offset = stage_index * NUM_CONST_BUFFERS_BYTES_PER_STAGE;
 
+    // Pack every enabled buffer of the stage into a single stream buffer reservation instead of
+    // paying the upload overhead once per buffer. The fast constant buffer path uploads through
+    // glNamedBufferSubData and keeps the individual route.
+    const bool use_batch = use_unified || !device.HasFastBufferSubData();
+    std::array<OGLBufferCache::SmallUploadEntry, Maxwell::MaxConstBuffers> batch;
+    std::array<OGLBufferCache::BufferInfo, Maxwell::MaxConstBuffers> batch_infos;
+    std::size_t batch_count = 0;
+    if (use_batch) {
+        for (const auto& entry : entries.const_buffers) {
+            const auto& buffer = shader_stage.const_buffers[entry.GetIndex()];
+            if (!buffer.enabled) {
+                continue;
+            }
+            const std::size_t size =
+                Common::AlignUp(GetConstBufferSize(buffer, entry), sizeof(GLvec4));
+            batch[batch_count++] = {buffer.address, size};
+        }
+        const std::size_t alignment = use_unified ? 4 : device.GetUniformBufferAlignment();
+        buffer_cache.UploadMemoryBatch(batch.data(), batch_count, alignment, batch_infos.data());
+    }
+
     const auto base_bindings = device.GetBaseBindings(stage_index);
     u32 binding = device.UseAssemblyShaders() ? 0 : base_bindings.uniform_buffer;
+    std::size_t batch_index = 0;
     for (const auto& entry : entries.const_buffers) {
         const u32 index = entry.GetIndex();
         const auto& buffer = shader_stage.const_buffers[index];
+        const auto* const info =
+            use_batch && buffer.enabled ? &batch_infos[batch_index++] : nullptr;
         SetupConstBuffer(PARAMETER_LUT[stage_index], binding, buffer, entry, use_unified,
-                         base_unified_offset + index * Maxwell::MaxConstBufferSize);
+                         base_unified_offset + index * Maxwell::MaxConstBufferSize, info);
         ++binding;
     }
     if (use_unified) {
@@ -950,7 +1053,7 @@ void RasterizerOpenGL::SetupComputeConstBuffers(Shader* kernel) {
         buffer.size = config.size;
         buffer.enabled = mask[entry.GetIndex()];
         SetupConstBuffer(GL_COMPUTE_PROGRAM_PARAMETER_BUFFER_NV, binding, buffer, entry,
-                         use_unified, entry.GetIndex() * Maxwell::MaxConstBufferSize);
+                         use_unified, entry.GetIndex() * Maxwell::MaxConstBufferSize, nullptr);
         ++binding;
     }
     if (use_unified) {
@@ -963,7 +1066,8 @@ void RasterizerOpenGL::SetupComputeConstBuffers(Shader* kernel) {
 void RasterizerOpenGL::SetupConstBuffer(GLenum stage, u32 binding,
                                         const Tegra::Engines::ConstBufferInfo& buffer,
                                         const ConstBufferEntry& entry, bool use_unified,
-                                        std::size_t unified_offset) {
+                                        std::size_t unified_offset,
+                                        const OGLBufferCache::BufferInfo* batched_info) {
     if (!buffer.enabled) {
         // Set values to zero to unbind buffers
         if (device.UseAssemblyShaders()) {
@@ -982,7 +1086,9 @@ void RasterizerOpenGL::SetupConstBuffer(GLenum stage, u32 binding,
 
     const std::size_t alignment = use_unified ? 4 : device.GetUniformBufferAlignment();
     const GPUVAddr gpu_addr = buffer.address;
-    auto info = buffer_cache.UploadMemory(gpu_addr, size, alignment, false, fast_upload);
+    auto info = batched_info ? *batched_info
+                             : buffer_cache.UploadMemory(gpu_addr, size, alignment, false,
+                                                         fast_upload);
 
     if (device.UseAssemblyShaders()) {
         UNIMPLEMENTED_IF(use_unified);
@@ -1079,7 +1185,7 @@ void RasterizerOpenGL::SetupTexture(u32 binding, const Tegra::Texture::FullTextu
                                            texture.tic.z_source, texture.tic.w_source);
     glBindTextureUnit(binding, handle);
     if (!view->GetSurfaceParams().IsBuffer()) {
-        glBindSampler(binding, sampler_cache.GetSampler(texture.tsc));
+        glBindSampler(binding, sampler_cache.GetSampler(texture.tsc, texture.tsc_index));
     }
 }
 
@@ -1612,7 +1718,16 @@ void RasterizerOpenGL::SyncFramebufferSRGB() {
 void RasterizerOpenGL::SyncTransformFeedback() {
     // TODO(Rodrigo): Inject SKIP_COMPONENTS*_NV when required. An unimplemented message will signal
     // when this is required.
-    const auto& regs = system.GPU().Maxwell3D().regs;
+    auto& gpu = system.GPU().Maxwell3D();
+    auto& flags = gpu.dirty.flags;
+    if (!flags[Dirty::TransformFeedback]) {
+        // The attrib layout is rebuilt only when the TFB registers change; the driver retains the
+        // stream attribs between draws.
+        return;
+    }
+    flags[Dirty::TransformFeedback] = false;
+
+    const auto& regs = gpu.regs;
 
     static constexpr std::size_t STRIDE = 3;
     std::array<GLint, 128 * STRIDE * Maxwell::NumTransformFeedbackBuffers> attribs;
@@ -1687,16 +1802,22 @@ void RasterizerOpenGL::BeginTransformFeedback(GLenum primitive_mode) {
             enabled_transform_feedback_buffers[index] = false;
             continue;
         }
-        enabled_transform_feedback_buffers[index] = true;
-
         auto& tfb_buffer = transform_feedback_buffers[index];
         tfb_buffer.Create();
 
         const GLuint handle = tfb_buffer.handle;
-        const std::size_t size = binding.buffer_size;
-        glNamedBufferData(handle, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_COPY);
+        const auto size = static_cast<GLsizeiptr>(binding.buffer_size);
+        if (enabled_transform_feedback_buffers[index] &&
+            transform_feedback_buffer_sizes[index] == size) {
+            // The buffer is already bound with the right size, don't respecify it every draw
+            continue;
+        }
+        enabled_transform_feedback_buffers[index] = true;
+        transform_feedback_buffer_sizes[index] = size;
+
+        glNamedBufferData(handle, size, nullptr, GL_STREAM_COPY);
         glBindBufferRange(GL_TRANSFORM_FEEDBACK_BUFFER, static_cast<GLuint>(index), handle, 0,
-                          static_cast<GLsizeiptr>(size));
+                          size);
     }
 
     // We may have to call BeginTransformFeedbackNV here since they seem to call different
@@ -7,11 +7,13 @@
 #include <array>
 #include <atomic>
 #include <cstddef>
+#include <deque>
 #include <map>
 #include <memory>
 #include <optional>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <glad/glad.h>
 
@@ -73,10 +75,14 @@ public:
     void SignalSemaphore(GPUVAddr addr, u32 value) override;
     void SignalSyncPoint(u32 value) override;
     void ReleaseFences() override;
+    bool TryReleaseFences() override;
     void FlushAndInvalidateRegion(VAddr addr, u64 size) override;
     void WaitForIdle() override;
     void FlushCommands() override;
     void TickFrame() override;
+    bool AccelerateDMATiledToLinear(GPUVAddr src_address, GPUVAddr dst_address,
+                                    const Tegra::Engines::MaxwellDMA::Regs::Parameters& src_params,
+                                    u32 x_count, u32 y_count, u32 dst_pitch) override;
     bool AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Regs::Surface& src,
                                const Tegra::Engines::Fermi2D::Regs::Surface& dst,
                                const Tegra::Engines::Fermi2D::Config& copy_config) override;
@@ -104,10 +110,12 @@ private:
     /// Configures the current constbuffers to use for the kernel invocation.
     void SetupComputeConstBuffers(Shader* kernel);
 
-    /// Configures a constant buffer.
+    /// Configures a constant buffer. An already uploaded buffer info can be passed through
+    /// batched_info; otherwise the buffer contents are uploaded here.
     void SetupConstBuffer(GLenum stage, u32 binding, const Tegra::Engines::ConstBufferInfo& buffer,
                           const ConstBufferEntry& entry, bool use_unified,
-                          std::size_t unified_offset);
+                          std::size_t unified_offset,
+                          const OGLBufferCache::BufferInfo* batched_info);
 
     /// Configures the current global memory entries to use for the draw command.
     void SetupDrawGlobalMemory(std::size_t stage_index, Shader* shader);
@@ -228,6 +236,15 @@ private:
 
     void SetupShaders(GLenum primitive_mode);
 
+    /// Starts timing a GPU pass when frame time recording is enabled.
+    void BeginGPUSpan();
+
+    /// Finishes timing a GPU pass, attributing the result to the named bucket.
+    void EndGPUSpan(const char* bucket);
+
+    /// Collects finished GPU pass timings without stalling and reports them to PerfStats.
+    void CollectGPUSpans();
+
     const Device& device;
 
     TextureCacheOpenGL texture_cache;
@@ -249,6 +266,8 @@ private:
 
     std::array<OGLBuffer, Tegra::Engines::Maxwell3D::Regs::NumTransformFeedbackBuffers>
         transform_feedback_buffers;
+    std::array<GLsizeiptr, Tegra::Engines::Maxwell3D::Regs::NumTransformFeedbackBuffers>
+        transform_feedback_buffer_sizes{};
     std::bitset<Tegra::Engines::Maxwell3D::Regs::NumTransformFeedbackBuffers>
         enabled_transform_feedback_buffers;
 
@@ -263,6 +282,19 @@ private:
     std::size_t num_queued_commands = 0;
 
     u32 last_clip_distance_mask = 0;
+
+    /// A GPU pass being timed or waiting for its result.
+    struct GPUSpanQuery {
+        OGLQuery query;
+        const char* bucket = nullptr;
+        u64 issue_ns = 0;
+    };
+    /// Pass timing query in flight between BeginGPUSpan and EndGPUSpan.
+    GPUSpanQuery current_gpu_span;
+    /// Finished pass timing queries waiting for their results to become available.
+    std::deque<GPUSpanQuery> pending_gpu_spans;
+    /// Retired timing queries kept around for reuse.
+    std::vector<OGLQuery> free_gpu_span_queries;
 };
 
 } // namespace OpenGL
@@ -2,7 +2,9 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <mutex>
 #include <optional>
@@ -16,6 +18,7 @@
 #include "common/scope_exit.h"
 #include "core/core.h"
 #include "core/frontend/emu_window.h"
+#include "core/perf_stats.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/engines/shader_type.h"
@@ -149,8 +152,7 @@ ProgramSharedPtr BuildShader(const Device& device, ShaderType shader_type, u64 u
     auto program = std::make_shared<ProgramHandle>();
 
     if (device.UseAssemblyShaders()) {
-        const std::string arb =
-            DecompileAssemblyShader(device, ir, registry, shader_type, shader_id);
+        std::string arb = DecompileAssemblyShader(device, ir, registry, shader_type, shader_id);
 
         GLuint& arb_prog = program->assembly_program.handle;
 
@@ -170,6 +172,10 @@ ProgramSharedPtr BuildShader(const Device& device, ShaderType shader_type, u64 u
             LOG_CRITICAL(Render_OpenGL, "{}", err);
             LOG_INFO(Render_OpenGL, "\n{}", arb);
         }
+        if (hint_retrievable) {
+            // Keep the generated text around so it can be stored in the disk cache
+            program->assembly_source = std::move(arb);
+        }
     } else {
         const std::string glsl = DecompileShader(device, ir, registry, shader_type, shader_id);
         OGLShader shader;
@@ -291,10 +297,28 @@ void ShaderCacheOpenGL::LoadDiskCache(const std::atomic_bool& stop_loading,
         return;
     }
 
-    std::vector<ShaderDiskCachePrecompiled> gl_cache;
-    if (!device.UseAssemblyShaders()) {
-        // Only load precompiled cache when we are not using assembly shaders
-        gl_cache = disk_cache.LoadPrecompiled();
+    // The transferable entries store the texture handler size deduced on previous sessions. Seed
+    // the live guest driver profile from them so shaders built from now on use the optimal texture
+    // access code immediately instead of relearning it during the first frames.
+    const auto known_handler_size =
+        std::find_if(transferable->begin(), transferable->end(),
+                     [](const auto& entry) { return entry.texture_handler_size.has_value(); });
+    if (known_handler_size != transferable->end()) {
+        system.GPU().Maxwell3D().AccessGuestDriverProfile().SetTextureHandlerSize(
+            *known_handler_size->texture_handler_size);
+    }
+
+    std::vector<ShaderDiskCachePrecompiled> gl_cache = disk_cache.LoadPrecompiled();
+
+    // The precompiled file stores either driver binaries or assembly text. Remove it when it was
+    // generated by the other backend.
+    const bool use_assembly = device.UseAssemblyShaders();
+    if (std::any_of(gl_cache.begin(), gl_cache.end(), [use_assembly](const auto& precompiled) {
+            return precompiled.is_assembly != use_assembly;
+        })) {
+        LOG_INFO(Render_OpenGL, "Precompiled cache is from the other shader backend, removing");
+        disk_cache.InvalidatePrecompiled();
+        gl_cache.clear();
     }
     const auto supported_formats = GetSupportedFormats();
 
@@ -319,6 +343,7 @@ void ShaderCacheOpenGL::LoadDiskCache(const std::atomic_bool& stop_loading,
     const auto worker = [&](Core::Frontend::GraphicsContext* context, std::size_t begin,
                             std::size_t end) {
         const auto scope = context->Acquire();
+        device.MaximizeShaderCompilerThreads();
 
         for (std::size_t i = begin; i < end; ++i) {
             if (stop_loading) {
@@ -332,25 +357,30 @@ void ShaderCacheOpenGL::LoadDiskCache(const std::atomic_bool& stop_loading,
             const bool is_compute = entry.type == ShaderType::Compute;
             const u32 main_offset = is_compute ? KERNEL_MAIN_OFFSET : STAGE_MAIN_OFFSET;
             auto registry = MakeRegistry(entry);
-            const ShaderIR ir(entry.code, main_offset, COMPILER_SETTINGS, *registry);
 
             ProgramSharedPtr program;
+            std::optional<ShaderEntries> entries;
             if (precompiled_entry) {
                 // If the shader is precompiled, attempt to load it with
                 program = GeneratePrecompiledProgram(entry, *precompiled_entry, supported_formats);
-                if (!program) {
+                if (program) {
+                    // The cached analysis results let us skip decoding the IR entirely
+                    entries = precompiled_entry->entries;
+                } else {
                     gl_cache_failed = true;
                 }
             }
             if (!program) {
-                // Otherwise compile it from GLSL
+                // Otherwise decode and compile it from GLSL
+                const ShaderIR ir(entry.code, main_offset, COMPILER_SETTINGS, *registry);
                 program = BuildShader(device, entry.type, uid, ir, *registry, true);
+                entries = MakeEntries(device, ir, entry.type);
             }
 
             PrecompiledShader shader;
             shader.program = std::move(program);
             shader.registry = std::move(registry);
-            shader.entries = MakeEntries(device, ir, entry.type);
+            shader.entries = std::move(*entries);
 
             std::scoped_lock lock{mutex};
             if (callback) {
@@ -388,22 +418,30 @@ void ShaderCacheOpenGL::LoadDiskCache(const std::atomic_bool& stop_loading,
         return;
     }
 
-    if (device.UseAssemblyShaders()) {
-        // Don't store precompiled binaries for assembly shaders.
-        return;
-    }
-
     // TODO(Rodrigo): Do state tracking for transferable shaders and do a dummy draw
     // before precompiling them
 
     for (std::size_t i = 0; i < transferable->size(); ++i) {
         const u64 id = (*transferable)[i].unique_identifier;
         const auto it = find_precompiled(id);
-        if (it == gl_cache.end()) {
-            const GLuint program = runtime_cache.at(id).program->source_program.handle;
-            disk_cache.SavePrecompiled(id, program);
-            precompiled_cache_altered = true;
+        if (it != gl_cache.end()) {
+            continue;
         }
+        PrecompiledShader& shader = runtime_cache.at(id);
+        if (device.UseAssemblyShaders()) {
+            // Store the generated assembly text instead of a driver binary
+            std::string& code = shader.program->assembly_source;
+            if (code.empty()) {
+                continue;
+            }
+            disk_cache.SavePrecompiledAssembly(id, code, shader.entries);
+            code.clear();
+            code.shrink_to_fit();
+        } else {
+            const GLuint program = shader.program->source_program.handle;
+            disk_cache.SavePrecompiled(id, program, shader.entries);
+        }
+        precompiled_cache_altered = true;
     }
 
     if (precompiled_cache_altered) {
@@ -414,6 +452,22 @@ void ShaderCacheOpenGL::LoadDiskCache(const std::atomic_bool& stop_loading,
 ProgramSharedPtr ShaderCacheOpenGL::GeneratePrecompiledProgram(
     const ShaderDiskCacheEntry& entry, const ShaderDiskCachePrecompiled& precompiled_entry,
     const std::unordered_set<GLenum>& supported_formats) {
+    if (precompiled_entry.is_assembly) {
+        // Cached assembly text, load it skipping IR decode and string generation entirely
+        auto program = std::make_shared<ProgramHandle>();
+        GLuint& handle = program->assembly_program.handle;
+        glGenProgramsARB(1, &handle);
+        glNamedProgramStringEXT(handle, AssemblyEnum(entry.type), GL_PROGRAM_FORMAT_ASCII_ARB,
+                                static_cast<GLsizei>(precompiled_entry.binary.size()),
+                                precompiled_entry.binary.data());
+        const auto err = reinterpret_cast<const char*>(glGetString(GL_PROGRAM_ERROR_STRING_NV));
+        if (err && *err) {
+            LOG_INFO(Render_OpenGL, "Cached assembly program rejected by the driver, removing");
+            return {};
+        }
+        return program;
+    }
+
     if (supported_formats.find(precompiled_entry.binary_format) == supported_formats.end()) {
         LOG_INFO(Render_OpenGL, "Precompiled cache entry with unsupported format, removing");
         return {};
@@ -471,7 +525,10 @@ Shader* ShaderCacheOpenGL::GetStageProgram(Maxwell::ShaderProgram program) {
     std::unique_ptr<Shader> shader;
     const auto found = runtime_cache.find(unique_identifier);
     if (found == runtime_cache.end()) {
+        const auto start = Core::PerfStats::Clock::now();
         shader = Shader::CreateStageFromMemory(params, program, std::move(code), std::move(code_b));
+        system.GetPerfStats().RecordBlockingEvent("OpenGL shader compile",
+                                                  Core::PerfStats::Clock::now() - start);
     } else {
         shader = Shader::CreateFromCache(params, found->second);
     }
@@ -506,7 +563,10 @@ Shader* ShaderCacheOpenGL::GetComputeKernel(GPUVAddr code_addr) {
     std::unique_ptr<Shader> kernel;
     const auto found = runtime_cache.find(unique_identifier);
     if (found == runtime_cache.end()) {
+        const auto start = Core::PerfStats::Clock::now();
         kernel = Shader::CreateKernelFromMemory(params, std::move(code));
+        system.GetPerfStats().RecordBlockingEvent("OpenGL shader compile",
+                                                  Core::PerfStats::Clock::now() - start);
     } else {
         kernel = Shader::CreateFromCache(params, found->second);
     }
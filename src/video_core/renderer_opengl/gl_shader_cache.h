@@ -43,6 +43,8 @@ using Maxwell = Tegra::Engines::Maxwell3D::Regs;
 struct ProgramHandle {
     OGLProgram source_program;
     OGLAssemblyProgram assembly_program;
+    /// Generated assembly text, retained for disk-cache built shaders so it can be dumped.
+    std::string assembly_source;
 };
 using ProgramSharedPtr = std::shared_ptr<ProgramHandle>;
 
@@ -2,7 +2,10 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <future>
 
 #include <fmt/format.h>
 
@@ -12,6 +15,7 @@
 #include "common/file_util.h"
 #include "common/logging/log.h"
 #include "common/scm_rev.h"
+#include "common/thread_pool.h"
 #include "common/zstd_compression.h"
 #include "core/core.h"
 #include "core/hle/kernel/process.h"
@@ -58,7 +62,48 @@ struct BindlessSamplerEntry {
     Tegra::Engines::SamplerDescriptor sampler;
 };
 
-constexpr u32 NativeVersion = 21;
+constexpr u32 NativeVersion = 22;
+
+/// Size of the independently compressed chunks the precompiled file is split into
+constexpr std::size_t PrecompiledChunkSize = 8 * 1024 * 1024;
+
+/// Reject chunk counts that cannot come from a sane file (also catches the old single-blob format)
+constexpr u32 MaxPrecompiledChunks = 1 << 16;
+
+/// Number of workers RunDiskCacheWorkers uses for the given job count
+std::size_t NumDiskCacheWorkers(std::size_t num_jobs) {
+    return std::max<std::size_t>(
+        std::min(Common::ThreadPool::GetPool().NumWorkers(), num_jobs), 1);
+}
+
+/// Runs a job over the shared thread pool. The functor receives a dense worker index next to the
+/// job index, so callers can keep per-worker state such as reusable compression contexts.
+template <typename Func>
+void RunDiskCacheWorkers(std::size_t num_jobs, const Func& func) {
+    if (num_jobs <= 1) {
+        for (std::size_t i = 0; i < num_jobs; ++i) {
+            func(std::size_t{0}, i);
+        }
+        return;
+    }
+    auto& pool = Common::ThreadPool::GetPool();
+    std::atomic<std::size_t> next_job{0};
+    const auto worker = [&](std::size_t worker_index) {
+        for (std::size_t i; (i = next_job.fetch_add(1, std::memory_order_relaxed)) < num_jobs;) {
+            func(worker_index, i);
+        }
+    };
+    const std::size_t num_workers = NumDiskCacheWorkers(num_jobs);
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_workers - 1);
+    for (std::size_t index = 1; index < num_workers; ++index) {
+        futures.emplace_back(pool.Push([&worker, index] { worker(index); }));
+    }
+    worker(0);
+    for (auto& future : futures) {
+        future.wait();
+    }
+}
 
 ShaderCacheVersionHash GetShaderCacheVersionHash() {
     ShaderCacheVersionHash hash{};
@@ -280,10 +325,67 @@ std::vector<ShaderDiskCachePrecompiled> ShaderDiskCacheOpenGL::LoadPrecompiled()
 
 std::optional<std::vector<ShaderDiskCachePrecompiled>> ShaderDiskCacheOpenGL::LoadPrecompiledFile(
     FileUtil::IOFile& file) {
-    // Read compressed file from disk and decompress to virtual precompiled cache file
-    std::vector<u8> compressed(file.GetSize());
-    file.ReadBytes(compressed.data(), compressed.size());
-    const std::vector<u8> decompressed = Common::Compression::DecompressDataZSTD(compressed);
+    // Read the chunked file from disk and decompress the chunks in parallel to the virtual
+    // precompiled cache file. Chunks are length-prefixed and independent of each other.
+    std::vector<u8> file_data(file.GetSize());
+    if (file.ReadBytes(file_data.data(), file_data.size()) != file_data.size()) {
+        return {};
+    }
+
+    std::size_t file_offset = 0;
+    const auto ReadFileValue = [&](u32& value) {
+        if (file_offset + sizeof(u32) > file_data.size()) {
+            return false;
+        }
+        std::memcpy(&value, file_data.data() + file_offset, sizeof(u32));
+        file_offset += sizeof(u32);
+        return true;
+    };
+
+    u32 num_chunks;
+    if (!ReadFileValue(num_chunks) || num_chunks > MaxPrecompiledChunks) {
+        return {};
+    }
+
+    struct Chunk {
+        std::size_t compressed_offset = 0;
+        u32 compressed_size = 0;
+        u32 decompressed_size = 0;
+        std::size_t decompressed_offset = 0;
+    };
+    std::vector<Chunk> chunks(num_chunks);
+    std::size_t decompressed_size = 0;
+    for (auto& chunk : chunks) {
+        if (!ReadFileValue(chunk.compressed_size) || !ReadFileValue(chunk.decompressed_size)) {
+            return {};
+        }
+        chunk.compressed_offset = file_offset;
+        chunk.decompressed_offset = decompressed_size;
+        file_offset += chunk.compressed_size;
+        decompressed_size += chunk.decompressed_size;
+        if (file_offset > file_data.size()) {
+            return {};
+        }
+    }
+
+    std::vector<u8> decompressed(decompressed_size);
+    std::atomic_bool decompress_failed = false;
+    std::vector<Common::Compression::ZSTDDecompressionContext> contexts(
+        NumDiskCacheWorkers(chunks.size()));
+    RunDiskCacheWorkers(chunks.size(), [&](std::size_t worker, std::size_t index) {
+        const Chunk& chunk = chunks[index];
+        const std::vector<u8> result = contexts[worker].Decompress(
+            file_data.data() + chunk.compressed_offset, chunk.compressed_size);
+        if (result.size() != chunk.decompressed_size) {
+            decompress_failed = true;
+            return;
+        }
+        std::memcpy(decompressed.data() + chunk.decompressed_offset, result.data(), result.size());
+    });
+    if (decompress_failed) {
+        return {};
+    }
+
     SaveArrayToPrecompiled(decompressed.data(), decompressed.size());
     precompiled_cache_virtual_file_offset = 0;
 
@@ -300,18 +402,25 @@ std::optional<std::vector<ShaderDiskCachePrecompiled>> ShaderDiskCacheOpenGL::Lo
 
     std::vector<ShaderDiskCachePrecompiled> entries;
     while (precompiled_cache_virtual_file_offset < precompiled_cache_virtual_file.GetSize()) {
+        u8 is_assembly;
         u32 binary_size;
         auto& entry = entries.emplace_back();
         if (!LoadObjectFromPrecompiled(entry.unique_identifier) ||
+            !LoadObjectFromPrecompiled(is_assembly) ||
             !LoadObjectFromPrecompiled(entry.binary_format) ||
             !LoadObjectFromPrecompiled(binary_size)) {
             return {};
         }
+        entry.is_assembly = is_assembly != 0;
 
         entry.binary.resize(binary_size);
         if (!LoadArrayFromPrecompiled(entry.binary.data(), entry.binary.size())) {
             return {};
         }
+
+        if (!LoadEntriesFromPrecompiled(entry.entries)) {
+            return {};
+        }
     }
     return entries;
 }
@@ -358,7 +467,8 @@ void ShaderDiskCacheOpenGL::SaveEntry(const ShaderDiskCacheEntry& entry) {
     stored_transferable.insert(id);
 }
 
-void ShaderDiskCacheOpenGL::SavePrecompiled(u64 unique_identifier, GLuint program) {
+void ShaderDiskCacheOpenGL::SavePrecompiled(u64 unique_identifier, GLuint program,
+                                            const ShaderEntries& entries) {
     if (!is_usable) {
         return;
     }
@@ -377,15 +487,105 @@ void ShaderDiskCacheOpenGL::SavePrecompiled(u64 unique_identifier, GLuint progra
     std::vector<u8> binary(binary_length);
     glGetProgramBinary(program, binary_length, nullptr, &binary_format, binary.data());
 
-    if (!SaveObjectToPrecompiled(unique_identifier) || !SaveObjectToPrecompiled(binary_format) ||
+    if (!SaveObjectToPrecompiled(unique_identifier) || !SaveObjectToPrecompiled(false) ||
+        !SaveObjectToPrecompiled(binary_format) ||
         !SaveObjectToPrecompiled(static_cast<u32>(binary.size())) ||
-        !SaveArrayToPrecompiled(binary.data(), binary.size())) {
+        !SaveArrayToPrecompiled(binary.data(), binary.size()) ||
+        !SaveEntriesToPrecompiled(entries)) {
         LOG_ERROR(Render_OpenGL, "Failed to save binary program file in shader={:016X}, removing",
                   unique_identifier);
         InvalidatePrecompiled();
     }
 }
 
+void ShaderDiskCacheOpenGL::SavePrecompiledAssembly(u64 unique_identifier, std::string_view code,
+                                                    const ShaderEntries& entries) {
+    if (!is_usable) {
+        return;
+    }
+
+    if (precompiled_cache_virtual_file.GetSize() == 0) {
+        SavePrecompiledHeaderToVirtualPrecompiledCache();
+    }
+
+    if (!SaveObjectToPrecompiled(unique_identifier) || !SaveObjectToPrecompiled(true) ||
+        !SaveObjectToPrecompiled(GLenum{0}) ||
+        !SaveObjectToPrecompiled(static_cast<u32>(code.size())) ||
+        !SaveArrayToPrecompiled(code.data(), code.size()) || !SaveEntriesToPrecompiled(entries)) {
+        LOG_ERROR(Render_OpenGL,
+                  "Failed to save assembly program file in shader={:016X}, removing",
+                  unique_identifier);
+        InvalidatePrecompiled();
+    }
+}
+
+bool ShaderDiskCacheOpenGL::SaveEntriesToPrecompiled(const ShaderEntries& entries) {
+    return SaveObjectToPrecompiled(static_cast<u32>(entries.const_buffers.size())) &&
+           SaveArrayToPrecompiled(entries.const_buffers.data(), entries.const_buffers.size()) &&
+           SaveObjectToPrecompiled(static_cast<u32>(entries.global_memory_entries.size())) &&
+           SaveArrayToPrecompiled(entries.global_memory_entries.data(),
+                                  entries.global_memory_entries.size()) &&
+           SaveObjectToPrecompiled(static_cast<u32>(entries.samplers.size())) &&
+           SaveArrayToPrecompiled(entries.samplers.data(), entries.samplers.size()) &&
+           SaveObjectToPrecompiled(static_cast<u32>(entries.images.size())) &&
+           SaveArrayToPrecompiled(entries.images.data(), entries.images.size()) &&
+           SaveObjectToPrecompiled(static_cast<u64>(entries.shader_length)) &&
+           SaveObjectToPrecompiled(entries.clip_distances) &&
+           SaveObjectToPrecompiled(entries.use_unified_uniforms);
+}
+
+bool ShaderDiskCacheOpenGL::LoadEntriesFromPrecompiled(ShaderEntries& entries) {
+    u32 num_const_buffers;
+    u32 num_global_memory_entries;
+    u32 num_samplers;
+    u32 num_images;
+    if (!LoadObjectFromPrecompiled(num_const_buffers)) {
+        return false;
+    }
+    for (u32 i = 0; i < num_const_buffers; ++i) {
+        auto& object = entries.const_buffers.emplace_back(0, false, 0);
+        if (!LoadObjectFromPrecompiled(object)) {
+            return false;
+        }
+    }
+    if (!LoadObjectFromPrecompiled(num_global_memory_entries)) {
+        return false;
+    }
+    for (u32 i = 0; i < num_global_memory_entries; ++i) {
+        auto& object = entries.global_memory_entries.emplace_back(0, 0, false, false);
+        if (!LoadObjectFromPrecompiled(object)) {
+            return false;
+        }
+    }
+    if (!LoadObjectFromPrecompiled(num_samplers)) {
+        return false;
+    }
+    for (u32 i = 0; i < num_samplers; ++i) {
+        auto& object = entries.samplers.emplace_back(
+            0, 0, Tegra::Shader::TextureType::Texture2D, false, false, false, false);
+        if (!LoadObjectFromPrecompiled(object)) {
+            return false;
+        }
+    }
+    if (!LoadObjectFromPrecompiled(num_images)) {
+        return false;
+    }
+    for (u32 i = 0; i < num_images; ++i) {
+        auto& object = entries.images.emplace_back(0, 0, Tegra::Shader::ImageType{});
+        if (!LoadObjectFromPrecompiled(object)) {
+            return false;
+        }
+    }
+    u64 shader_length;
+    if (!LoadObjectFromPrecompiled(shader_length) ||
+        !LoadObjectFromPrecompiled(entries.clip_distances) ||
+        !LoadObjectFromPrecompiled(entries.use_unified_uniforms)) {
+        return false;
+    }
+    entries.shader_length = static_cast<std::size_t>(shader_length);
+    return true;
+}
+
 FileUtil::IOFile ShaderDiskCacheOpenGL::AppendTransferableFile() const {
     if (!EnsureDirectories()) {
         return {};
@@ -422,8 +622,20 @@ void ShaderDiskCacheOpenGL::SavePrecompiledHeaderToVirtualPrecompiledCache() {
 void ShaderDiskCacheOpenGL::SaveVirtualPrecompiledFile() {
     precompiled_cache_virtual_file_offset = 0;
     const std::vector<u8> uncompressed = precompiled_cache_virtual_file.ReadAllBytes();
-    const std::vector<u8> compressed =
-        Common::Compression::CompressDataZSTDDefault(uncompressed.data(), uncompressed.size());
+
+    // Compress fixed size chunks independently and in parallel so loads can decompress them the
+    // same way.
+    const std::size_t num_chunks =
+        (uncompressed.size() + PrecompiledChunkSize - 1) / PrecompiledChunkSize;
+    std::vector<std::vector<u8>> compressed_chunks(num_chunks);
+    std::vector<Common::Compression::ZSTDCompressionContext> contexts(
+        NumDiskCacheWorkers(num_chunks));
+    RunDiskCacheWorkers(num_chunks, [&](std::size_t worker, std::size_t index) {
+        const std::size_t offset = index * PrecompiledChunkSize;
+        const std::size_t size = std::min(PrecompiledChunkSize, uncompressed.size() - offset);
+        compressed_chunks[index] =
+            contexts[worker].CompressDefault(uncompressed.data() + offset, size);
+    });
 
     const auto precompiled_path{GetPrecompiledPath()};
     FileUtil::IOFile file(precompiled_path, "wb");
@@ -432,9 +644,20 @@ void ShaderDiskCacheOpenGL::SaveVirtualPrecompiledFile() {
         LOG_ERROR(Render_OpenGL, "Failed to open precompiled cache in path={}", precompiled_path);
         return;
     }
-    if (file.WriteBytes(compressed.data(), compressed.size()) != compressed.size()) {
-        LOG_ERROR(Render_OpenGL, "Failed to write precompiled cache version in path={}",
-                  precompiled_path);
+    const auto WriteValue = [&file](u32 value) {
+        return file.WriteBytes(&value, sizeof(value)) == sizeof(value);
+    };
+    bool success = WriteValue(static_cast<u32>(num_chunks));
+    for (std::size_t i = 0; success && i < num_chunks; ++i) {
+        const std::vector<u8>& chunk = compressed_chunks[i];
+        const std::size_t offset = i * PrecompiledChunkSize;
+        const std::size_t size = std::min(PrecompiledChunkSize, uncompressed.size() - offset);
+        success = WriteValue(static_cast<u32>(chunk.size())) &&
+                  WriteValue(static_cast<u32>(size)) &&
+                  file.WriteBytes(chunk.data(), chunk.size()) == chunk.size();
+    }
+    if (!success) {
+        LOG_ERROR(Render_OpenGL, "Failed to write precompiled cache in path={}", precompiled_path);
     }
 }
 
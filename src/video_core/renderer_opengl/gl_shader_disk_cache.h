@@ -6,6 +6,7 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -19,6 +20,7 @@
 #include "common/common_types.h"
 #include "core/file_sys/vfs_vector.h"
 #include "video_core/engines/shader_type.h"
+#include "video_core/renderer_opengl/gl_shader_decompiler.h"
 #include "video_core/shader/registry.h"
 
 namespace Core {
@@ -61,11 +63,14 @@ struct ShaderDiskCacheEntry {
     VideoCommon::Shader::BindlessSamplerMap bindless_samplers;
 };
 
-/// Contains an OpenGL dumped binary program
+/// Contains an OpenGL dumped binary program or the generated assembly text for the GLASM path,
+/// plus the IR analysis results needed to use it
 struct ShaderDiskCachePrecompiled {
     u64 unique_identifier = 0;
+    bool is_assembly = false;
     GLenum binary_format = 0;
     std::vector<u8> binary;
+    ShaderEntries entries;
 };
 
 class ShaderDiskCacheOpenGL {
@@ -89,7 +94,11 @@ public:
     void SaveEntry(const ShaderDiskCacheEntry& entry);
 
     /// Saves a dump entry to the precompiled file. Does not check for collisions.
-    void SavePrecompiled(u64 unique_identifier, GLuint program);
+    void SavePrecompiled(u64 unique_identifier, GLuint program, const ShaderEntries& entries);
+
+    /// Saves a generated assembly program to the precompiled file. Does not check for collisions.
+    void SavePrecompiledAssembly(u64 unique_identifier, std::string_view code,
+                                 const ShaderEntries& entries);
 
     /// Serializes virtual precompiled shader cache file to real file
     void SaveVirtualPrecompiledFile();
@@ -105,6 +114,12 @@ private:
     /// Save precompiled header to precompiled_cache_in_memory
     void SavePrecompiledHeaderToVirtualPrecompiledCache();
 
+    /// Saves the IR analysis results of a shader to the precompiled file
+    bool SaveEntriesToPrecompiled(const ShaderEntries& entries);
+
+    /// Loads the IR analysis results of a shader from the precompiled file
+    bool LoadEntriesFromPrecompiled(ShaderEntries& entries);
+
     /// Create shader disk cache directories. Returns true on success.
     bool EnsureDirectories() const;
 
@@ -34,6 +34,13 @@ GLuint LoadShader(const char* source, GLenum type) {
     LOG_DEBUG(Render_OpenGL, "Compiling {} shader...", debug_type);
     glCompileShader(shader_id);
 
+    if (GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile) {
+        // The driver compiles in background threads and querying the compile status here would
+        // stall until it finishes. Defer the wait to link time, where failures are still caught
+        // and logged through the program info log.
+        return shader_id;
+    }
+
     GLint result = GL_FALSE;
     GLint info_log_length;
     glGetShaderiv(shader_id, GL_COMPILE_STATUS, &result);
@@ -201,6 +201,12 @@ void SetupDirtyDepthClampEnabled(Tables& tables) {
     tables[0][OFF(view_volume_clip_control)] = DepthClampEnabled;
 }
 
+void SetupDirtyTransformFeedback(Tables& tables) {
+    auto& table = tables[0];
+    FillBlock(table, OFF(tfb_layouts), NUM(tfb_layouts), TransformFeedback);
+    FillBlock(table, OFF(tfb_varying_locs), NUM(tfb_varying_locs), TransformFeedback);
+}
+
 void SetupDirtyMisc(Tables& tables) {
     auto& table = tables[0];
 
@@ -242,6 +248,7 @@ void StateTracker::Initialize() {
     SetupDirtyLineWidth(tables);
     SetupDirtyClipControl(tables);
     SetupDirtyDepthClampEnabled(tables);
+    SetupDirtyTransformFeedback(tables);
     SetupDirtyMisc(tables);
 
     auto& store = dirty.on_write_stores;
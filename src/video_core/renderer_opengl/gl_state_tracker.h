@@ -81,6 +81,7 @@ enum : u8 {
     LineWidth,
     ClipControl,
     DepthClampEnabled,
+    TransformFeedback,
 
     Last
 };
@@ -2,8 +2,8 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <tuple>
-#include <vector>
 
 #include "common/alignment.h"
 #include "common/assert.h"
@@ -11,13 +11,12 @@
 #include "video_core/renderer_opengl/gl_device.h"
 #include "video_core/renderer_opengl/gl_stream_buffer.h"
 
-MICROPROFILE_DEFINE(OpenGL_StreamBuffer, "OpenGL", "Stream Buffer Orphaning",
-                    MP_RGB(128, 128, 192));
+MICROPROFILE_DEFINE(OpenGL_StreamBuffer, "OpenGL", "Stream Buffer Wait", MP_RGB(128, 128, 192));
 
 namespace OpenGL {
 
 OGLStreamBuffer::OGLStreamBuffer(const Device& device, GLsizeiptr size, bool vertex_data_usage)
-    : buffer_size(size) {
+    : buffer_size(size), region_size(size / static_cast<GLsizeiptr>(NUM_SYNC_REGIONS)) {
     gl_buffer.Create();
 
     GLsizeiptr allocate_size = size;
@@ -57,13 +56,20 @@ std::tuple<u8*, GLintptr, bool> OGLStreamBuffer::Map(GLsizeiptr size, GLintptr a
 
     bool invalidate = false;
     if (buffer_pos + size > buffer_size) {
-        MICROPROFILE_SCOPE(OpenGL_StreamBuffer);
-        glInvalidateBufferData(gl_buffer.handle);
+        // Wrap the ring. The rest of the pass that just ended is fenced so the wait below can
+        // block until the device has caught up with it, instead of orphaning the buffer.
+        FenceWrittenRegions(buffer_size);
+
+        // Make sure the fences we are about to wait on have been submitted to the device.
+        glFlush();
 
         buffer_pos = 0;
+        fenced_region = 0;
         invalidate = true;
     }
 
+    WaitPendingOperations(buffer_pos + size);
+
     return std::make_tuple(mapped_ptr + buffer_pos, buffer_pos, invalidate);
 }
 
@@ -75,6 +81,34 @@ void OGLStreamBuffer::Unmap(GLsizeiptr size) {
     }
 
     buffer_pos += size;
+    FenceWrittenRegions(buffer_pos);
+}
+
+void OGLStreamBuffer::FenceWrittenRegions(GLintptr upper_bound) {
+    const std::size_t last_region =
+        std::min(static_cast<std::size_t>(upper_bound / region_size), NUM_SYNC_REGIONS);
+    while (fenced_region < last_region) {
+        auto& sync = fences[fenced_region++];
+        sync.Release();
+        sync.Create();
+    }
+}
+
+void OGLStreamBuffer::WaitPendingOperations(GLintptr requested_upper_bound) {
+    const std::size_t begin_region = static_cast<std::size_t>(buffer_pos / region_size);
+    const std::size_t end_region = std::min(
+        static_cast<std::size_t>((requested_upper_bound + region_size - 1) / region_size),
+        NUM_SYNC_REGIONS);
+    for (std::size_t region = begin_region; region < end_region; ++region) {
+        auto& sync = fences[region];
+        if (sync.handle == 0) {
+            // Still on the first pass over this region, or already waited on.
+            continue;
+        }
+        MICROPROFILE_SCOPE(OpenGL_StreamBuffer);
+        glClientWaitSync(sync.handle, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        sync.Release();
+    }
 }
 
 } // namespace OpenGL
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <tuple>
 #include <glad/glad.h>
 #include "common/common_types.h"
@@ -30,6 +31,7 @@ public:
 
     void Unmap(GLsizeiptr size);
 
+
     GLuint Handle() const {
         return gl_buffer.handle;
     }
@@ -43,13 +45,27 @@ public:
     }
 
 private:
+    /// Number of fenced subdivisions of the ring. A region is fenced once it has been fully
+    /// written and waited on before it is written again on the next pass over the buffer.
+    static constexpr std::size_t NUM_SYNC_REGIONS = 16;
+
+    /// Fences every region fully written below upper_bound that hasn't been fenced yet.
+    void FenceWrittenRegions(GLintptr upper_bound);
+
+    /// Waits for the device to be done with the regions overlapping [buffer_pos, upper_bound).
+    void WaitPendingOperations(GLintptr requested_upper_bound);
+
     OGLBuffer gl_buffer;
 
     GLuint64EXT gpu_address = 0;
     GLintptr buffer_pos = 0;
     GLsizeiptr buffer_size = 0;
+    GLsizeiptr region_size = 0;
     GLsizeiptr mapped_size = 0;
     u8* mapped_ptr = nullptr;
+
+    std::array<OGLSync, NUM_SYNC_REGIONS> fences;
+    std::size_t fenced_region = 0;
 };
 
 } // namespace OpenGL
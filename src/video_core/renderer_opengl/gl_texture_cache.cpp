@@ -2,6 +2,9 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <cstring>
+
 #include "common/assert.h"
 #include "common/bit_util.h"
 #include "common/common_types.h"
@@ -302,10 +305,72 @@ void CachedSurface::DownloadTexture(std::vector<u8>& staging_buffer) {
     }
 }
 
+bool CachedSurface::DownloadTextureAsync() {
+    MICROPROFILE_SCOPE(OpenGL_Texture_Download);
+
+    if (params.IsBuffer()) {
+        // Buffer downloads are cheap enough to stay synchronous.
+        return false;
+    }
+
+    const auto host_size = static_cast<GLsizeiptr>(GetHostSizeInBytes());
+    if (download_buffer.handle == 0) {
+        constexpr GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        download_buffer.Create();
+        glNamedBufferStorage(download_buffer.handle, host_size, nullptr,
+                             flags | GL_CLIENT_STORAGE_BIT);
+        download_map = static_cast<u8*>(
+            glMapNamedBufferRange(download_buffer.handle, 0, host_size, flags));
+    }
+
+    SCOPE_EXIT({
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+    });
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, download_buffer.handle);
+
+    for (u32 level = 0; level < params.emulated_levels; ++level) {
+        glPixelStorei(GL_PACK_ALIGNMENT, std::min(8U, params.GetRowAlignment(level, is_converted)));
+        glPixelStorei(GL_PACK_ROW_LENGTH, static_cast<GLint>(params.GetMipWidth(level)));
+        const std::size_t mip_offset = params.GetHostMipmapLevelOffset(level, is_converted);
+
+        auto* const mip_data = reinterpret_cast<void*>(mip_offset);
+        const GLsizei size = static_cast<GLsizei>(params.GetHostMipmapSize(level));
+        if (is_compressed) {
+            glGetCompressedTextureImage(texture.handle, level, size, mip_data);
+        } else {
+            glGetTextureImage(texture.handle, level, format, type, size, mip_data);
+        }
+    }
+
+    download_sync.Release();
+    download_sync.Create();
+    download_tick = GetModificationTick();
+    return true;
+}
+
+bool CachedSurface::CompleteTextureDownload(std::vector<u8>& staging_buffer) {
+    if (download_sync.handle == nullptr) {
+        return false;
+    }
+    OGLSync sync = std::move(download_sync);
+    if (GetModificationTick() != download_tick) {
+        // The surface was written again after the download started, the data went stale.
+        return false;
+    }
+    glClientWaitSync(sync.handle, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    std::memcpy(staging_buffer.data(), download_map,
+                std::min(staging_buffer.size(), static_cast<std::size_t>(GetHostSizeInBytes())));
+    return true;
+}
+
 void CachedSurface::UploadTexture(const std::vector<u8>& staging_buffer) {
     MICROPROFILE_SCOPE(OpenGL_Texture_Upload);
     SCOPE_EXIT({ glPixelStorei(GL_UNPACK_ROW_LENGTH, 0); });
     for (u32 level = 0; level < params.emulated_levels; ++level) {
+        if (!ShouldUploadLevel(level)) {
+            continue;
+        }
         UploadTextureMipmap(level, staging_buffer);
     }
 }
@@ -409,7 +474,10 @@ View CachedSurface::CreateViewInner(const ViewParams& view_key, const bool is_pr
 
 CachedSurfaceView::CachedSurfaceView(CachedSurface& surface, const ViewParams& params,
                                      bool is_proxy)
-    : VideoCommon::ViewBase(params), surface{surface}, format{surface.internal_format},
+    : VideoCommon::ViewBase(params), surface{surface},
+      format{params.pixel_format == PixelFormat::Invalid
+                 ? surface.internal_format
+                 : GetFormatTuple(params.pixel_format).internal_format},
       target{GetTextureTarget(params.target)}, is_proxy{is_proxy} {
     if (!is_proxy) {
         main_view = CreateTextureView();
@@ -42,6 +42,8 @@ public:
 
     void UploadTexture(const std::vector<u8>& staging_buffer) override;
     void DownloadTexture(std::vector<u8>& staging_buffer) override;
+    bool DownloadTextureAsync() override;
+    bool CompleteTextureDownload(std::vector<u8>& staging_buffer) override;
 
     GLenum GetTarget() const {
         return target;
@@ -73,6 +75,13 @@ private:
 
     OGLTexture texture;
     OGLBuffer texture_buffer;
+
+    // Persistently mapped buffer for asynchronous downloads, filled by the GPU and consumed on
+    // the next flush of the surface.
+    OGLBuffer download_buffer;
+    OGLSync download_sync;
+    u8* download_map = nullptr;
+    u64 download_tick = 0;
 };
 
 class CachedSurfaceView final : public VideoCommon::ViewBase {
@@ -11,6 +11,7 @@
 #include <glad/glad.h>
 
 #include "common/assert.h"
+#include "common/fast_hash.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/telemetry.h"
@@ -177,20 +178,19 @@ const char* GetType(GLenum type) {
 
 void APIENTRY DebugHandler(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length,
                            const GLchar* message, const void* user_param) {
-    const char format[] = "{} {} {}: {}";
     const char* const str_source = GetSource(source);
     const char* const str_type = GetType(type);
 
     switch (severity) {
     case GL_DEBUG_SEVERITY_HIGH:
-        LOG_CRITICAL(Render_OpenGL, format, str_source, str_type, id, message);
+        LOG_CRITICAL(Render_OpenGL, "{} {} {}: {}", str_source, str_type, id, message);
         break;
     case GL_DEBUG_SEVERITY_MEDIUM:
-        LOG_WARNING(Render_OpenGL, format, str_source, str_type, id, message);
+        LOG_WARNING(Render_OpenGL, "{} {} {}: {}", str_source, str_type, id, message);
         break;
     case GL_DEBUG_SEVERITY_NOTIFICATION:
     case GL_DEBUG_SEVERITY_LOW:
-        LOG_DEBUG(Render_OpenGL, format, str_source, str_type, id, message);
+        LOG_DEBUG(Render_OpenGL, "{} {} {}: {}", str_source, str_type, id, message);
         break;
     }
 }
@@ -394,7 +394,7 @@ void RendererOpenGL::PrepareRendertarget(const Tegra::FramebufferConfig* framebu
         if (screen_info.texture.width != static_cast<GLsizei>(framebuffer->width) ||
             screen_info.texture.height != static_cast<GLsizei>(framebuffer->height) ||
             screen_info.texture.pixel_format != framebuffer->pixel_format ||
-            gl_framebuffer_data.empty()) {
+            !screen_upload_buffers.front().mapped_ptr) {
             // Reallocate texture if the framebuffer size has changed.
             // This is expected to not happen very often and hence should not be a
             // performance problem.
@@ -426,13 +426,32 @@ void RendererOpenGL::LoadFBToScreenInfo(const Tegra::FramebufferConfig& framebuf
     u8* const host_ptr{system.Memory().GetPointer(framebuffer_addr)};
     rasterizer->FlushRegion(ToCacheAddr(host_ptr), size_in_bytes);
 
+    // Menus resubmit identical frames at full rate; hashing the guest bytes is much cheaper than
+    // deswizzling and uploading them, so unchanged frames skip the upload entirely. The permanent
+    // texture keeps its contents across accelerated frames, making the skip valid even then.
+    const u64 hash = Common::FastHash64(host_ptr, size_in_bytes);
+    if (hash == last_uploaded_hash && framebuffer_addr == last_uploaded_addr) {
+        return;
+    }
+    last_uploaded_hash = hash;
+    last_uploaded_addr = framebuffer_addr;
+
+    auto& slot = screen_upload_buffers[screen_upload_index];
+    screen_upload_index = (screen_upload_index + 1) % NUM_SCREEN_UPLOAD_BUFFERS;
+    if (slot.fence.handle != 0) {
+        glClientWaitSync(slot.fence.handle, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        slot.fence.Release();
+    }
+
     // TODO(Rodrigo): Read this from HLE
     constexpr u32 block_height_log2 = 4;
     VideoCore::MortonSwizzle(VideoCore::MortonSwizzleMode::MortonToLinear, pixel_format,
                              framebuffer.stride, block_height_log2, framebuffer.height, 0, 1, 1,
-                             gl_framebuffer_data.data(), host_ptr);
+                             slot.mapped_ptr, host_ptr);
+    glFlushMappedNamedBufferRange(slot.buffer.handle, 0, static_cast<GLsizeiptr>(size_in_bytes));
 
     glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(framebuffer.stride));
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer.handle);
 
     // Update existing texture
     // TODO: Test what happens on hardware when you change the framebuffer dimensions so that
@@ -441,9 +460,11 @@ void RendererOpenGL::LoadFBToScreenInfo(const Tegra::FramebufferConfig& framebuf
     //       framebuffer sizes. We should make sure that this cannot happen.
     glTextureSubImage2D(screen_info.texture.resource.handle, 0, 0, 0, framebuffer.width,
                         framebuffer.height, screen_info.texture.gl_format,
-                        screen_info.texture.gl_type, gl_framebuffer_data.data());
+                        screen_info.texture.gl_type, nullptr);
 
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    slot.fence.Create();
 }
 
 void RendererOpenGL::LoadColorToActiveGLTexture(u8 color_r, u8 color_g, u8 color_b, u8 color_a,
@@ -531,7 +552,27 @@ void RendererOpenGL::ConfigureFramebufferTexture(TextureInfo& texture,
     const auto pixel_format{
         VideoCore::Surface::PixelFormatFromGPUPixelFormat(framebuffer.pixel_format)};
     const u32 bytes_per_pixel{VideoCore::Surface::GetBytesPerPixel(pixel_format)};
-    gl_framebuffer_data.resize(texture.width * texture.height * bytes_per_pixel);
+
+    // Recreate the persistent upload ring for the new dimensions. The deswizzle writes the full
+    // stride, which can exceed the visible width.
+    const std::size_t upload_size =
+        std::max(framebuffer.stride, framebuffer.width) * framebuffer.height * bytes_per_pixel;
+    for (auto& slot : screen_upload_buffers) {
+        if (slot.mapped_ptr) {
+            glUnmapNamedBuffer(slot.buffer.handle);
+        }
+        slot.fence.Release();
+        slot.buffer.Release();
+        slot.buffer.Create();
+        static constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT;
+        glNamedBufferStorage(slot.buffer.handle, static_cast<GLsizeiptr>(upload_size), nullptr,
+                             flags);
+        slot.mapped_ptr = static_cast<u8*>(glMapNamedBufferRange(
+            slot.buffer.handle, 0, static_cast<GLsizeiptr>(upload_size),
+            flags | GL_MAP_FLUSH_EXPLICIT_BIT));
+    }
+    last_uploaded_hash = 0;
+    last_uploaded_addr = 0;
 
     GLint internal_format;
     switch (framebuffer.pixel_format) {
@@ -719,6 +760,12 @@ bool RendererOpenGL::Present(int timeout_ms) {
     glBlitFramebuffer(0, 0, frame->width, frame->height, 0, 0, layout.width, layout.height,
                       GL_COLOR_BUFFER_BIT, GL_LINEAR);
 
+    // A frame can be presented more than once when the game runs below the display rate; delete
+    // the fence of the previous presentation so it does not leak.
+    if (frame->present_fence) {
+        glDeleteSync(frame->present_fence);
+    }
+
     // Insert fence for the main thread to block on
     frame->present_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
     glFlush();
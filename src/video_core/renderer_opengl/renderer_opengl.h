@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
 #include <glad/glad.h>
 #include "common/common_types.h"
@@ -116,8 +117,21 @@ private:
     /// Global dummy shader pipeline
     ProgramManager program_manager;
 
-    /// OpenGL framebuffer data
-    std::vector<u8> gl_framebuffer_data;
+    /// One slot of the persistent-mapped pixel unpack ring used to upload the guest framebuffer
+    struct ScreenUploadBuffer {
+        OGLBuffer buffer;
+        OGLSync fence;
+        u8* mapped_ptr = nullptr;
+    };
+
+    /// Ring of persistently mapped pixel unpack buffers, deswizzled into directly
+    static constexpr std::size_t NUM_SCREEN_UPLOAD_BUFFERS = 3;
+    std::array<ScreenUploadBuffer, NUM_SCREEN_UPLOAD_BUFFERS> screen_upload_buffers;
+    std::size_t screen_upload_index = 0;
+
+    /// Identity of the guest framebuffer last uploaded to the screen texture
+    u64 last_uploaded_hash = 0;
+    VAddr last_uploaded_addr = 0;
 
     /// Used for transforming the framebuffer orientation
     Tegra::FramebufferConfig::TransformFlags framebuffer_transform_flags;
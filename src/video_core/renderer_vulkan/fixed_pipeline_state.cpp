@@ -8,7 +8,7 @@
 
 #include <boost/functional/hash.hpp>
 
-#include "common/cityhash.h"
+#include "common/fast_hash.h"
 #include "common/common_types.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
 
@@ -155,7 +155,7 @@ void FixedPipelineState::Fill(const Maxwell& regs) {
 }
 
 std::size_t FixedPipelineState::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this);
+    const u64 hash = Common::FastHash64(this, sizeof *this);
     return static_cast<std::size_t>(hash);
 }
 
@@ -19,6 +19,7 @@
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/frontend/emu_window.h"
+#include "core/perf_stats.h"
 #include "core/settings.h"
 #include "core/telemetry_session.h"
 #include "video_core/gpu.h"
@@ -257,18 +258,26 @@ void RendererVulkan::SwapBuffers(const Tegra::FramebufferConfig* framebuffer) {
         const bool use_accelerated =
             rasterizer->AccelerateDisplay(*framebuffer, framebuffer_addr, framebuffer->stride);
         const bool is_srgb = use_accelerated && screen_info.is_srgb;
-        if (swapchain->HasFramebufferChanged(layout) || swapchain->GetSrgbState() != is_srgb) {
+        if (swapchain->HasFramebufferChanged(layout) || swapchain->GetSrgbState() != is_srgb ||
+            swapchain->NeedsPresentModeUpdate()) {
             swapchain->Create(layout.width, layout.height, is_srgb);
             blit_screen->Recreate();
         }
 
         scheduler->WaitWorker();
 
+        // Acquiring blocks when no image is ready under fifo; account the time as present latency
+        const auto acquire_start = Core::PerfStats::Clock::now();
         swapchain->AcquireNextImage();
+        system.GetPerfStats().RecordPresentLatency(Core::PerfStats::Clock::now() - acquire_start);
         const auto [fence, render_semaphore] = blit_screen->Draw(*framebuffer, use_accelerated);
 
         scheduler->Flush(false, render_semaphore);
 
+        // Queues are externally synchronized, so the worker thread has to be done submitting
+        // before presenting on this thread.
+        scheduler->WaitWorker();
+
         if (swapchain->Present(render_semaphore, fence)) {
             blit_screen->Recreate();
         }
@@ -304,7 +313,8 @@ bool RendererVulkan::Init() {
 
     state_tracker = std::make_unique<StateTracker>(system);
 
-    scheduler = std::make_unique<VKScheduler>(*device, *resource_manager, *state_tracker);
+    scheduler =
+        std::make_unique<VKScheduler>(*device, *resource_manager, *state_tracker, system);
 
     rasterizer = std::make_unique<RasterizerVulkan>(system, render_window, screen_info, *device,
                                                     *resource_manager, *memory_manager,
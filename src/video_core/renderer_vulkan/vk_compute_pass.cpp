@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <array>
 #include <cstring>
 #include <memory>
 #include <optional>
@@ -9,12 +10,13 @@
 
 #include "common/alignment.h"
 #include "common/assert.h"
+#include "common/cityhash.h"
 #include "common/common_types.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_device.h"
+#include "video_core/renderer_vulkan/vk_memory_manager.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
-#include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/renderer_vulkan/wrapper.h"
 
@@ -22,6 +24,27 @@ namespace Vulkan {
 
 namespace {
 
+/// Number of cached conversion outputs a pass holds before dropping them all.
+constexpr std::size_t MAX_CACHED_CONVERSIONS = 4096;
+
+VKBuffer CreateConversionBuffer(const VKDevice& device, VKMemoryManager& memory_manager,
+                                std::size_t size) {
+    VkBufferCreateInfo ci;
+    ci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    ci.pNext = nullptr;
+    ci.flags = 0;
+    ci.size = static_cast<VkDeviceSize>(size);
+    ci.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+    ci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    ci.queueFamilyIndexCount = 0;
+    ci.pQueueFamilyIndices = nullptr;
+
+    VKBuffer buffer;
+    buffer.handle = device.GetLogical().CreateBuffer(ci);
+    buffer.commit = memory_manager.Commit(buffer.handle, false);
+    return buffer;
+}
+
 // Quad array SPIR-V module. Generated from the "shaders/" directory, read the instructions there.
 constexpr u8 quad_array[] = {
     0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x08, 0x00, 0x54, 0x00, 0x00, 0x00,
@@ -455,21 +478,32 @@ VkDescriptorSet VKComputePass::CommitDescriptorSet(VKUpdateDescriptorQueue& upda
 }
 
 QuadArrayPass::QuadArrayPass(const VKDevice& device, VKScheduler& scheduler,
-                             VKDescriptorPool& descriptor_pool,
-                             VKStagingBufferPool& staging_buffer_pool,
+                             VKDescriptorPool& descriptor_pool, VKMemoryManager& memory_manager,
                              VKUpdateDescriptorQueue& update_descriptor_queue)
     : VKComputePass(device, descriptor_pool, BuildQuadArrayPassDescriptorSetLayoutBinding(),
                     BuildQuadArrayPassDescriptorUpdateTemplateEntry(),
                     BuildComputePushConstantRange(sizeof(u32)), std::size(quad_array), quad_array),
-      scheduler{scheduler}, staging_buffer_pool{staging_buffer_pool},
+      device{device}, scheduler{scheduler}, memory_manager{memory_manager},
       update_descriptor_queue{update_descriptor_queue} {}
 
 QuadArrayPass::~QuadArrayPass() = default;
 
 std::pair<VkBuffer, VkDeviceSize> QuadArrayPass::Assemble(u32 num_vertices, u32 first) {
+    const u64 key = (static_cast<u64>(first) << 32) | num_vertices;
+    if (const auto it = assembled_quads.find(key); it != assembled_quads.end()) {
+        // The compute to vertex input barrier recorded when the entry was assembled orders every
+        // later submission on the same queue, no extra synchronization is needed here.
+        return {*it->second.handle, 0};
+    }
+    if (assembled_quads.size() >= MAX_CACHED_CONVERSIONS) {
+        device.GetLogical().WaitIdle();
+        assembled_quads.clear();
+    }
     const u32 num_triangle_vertices = (num_vertices / 4) * 6;
     const std::size_t staging_size = num_triangle_vertices * sizeof(u32);
-    auto& buffer = staging_buffer_pool.GetUnusedBuffer(staging_size, false);
+    VKBuffer& buffer =
+        assembled_quads.emplace(key, CreateConversionBuffer(device, memory_manager, staging_size))
+            .first->second;
 
     update_descriptor_queue.Acquire();
     update_descriptor_queue.AddBuffer(*buffer.handle, 0, staging_size);
@@ -504,20 +538,31 @@ std::pair<VkBuffer, VkDeviceSize> QuadArrayPass::Assemble(u32 num_vertices, u32
 }
 
 Uint8Pass::Uint8Pass(const VKDevice& device, VKScheduler& scheduler,
-                     VKDescriptorPool& descriptor_pool, VKStagingBufferPool& staging_buffer_pool,
+                     VKDescriptorPool& descriptor_pool, VKMemoryManager& memory_manager,
                      VKUpdateDescriptorQueue& update_descriptor_queue)
     : VKComputePass(device, descriptor_pool, BuildInputOutputDescriptorSetBindings(),
                     BuildInputOutputDescriptorUpdateTemplate(), {}, std::size(uint8_pass),
                     uint8_pass),
-      scheduler{scheduler}, staging_buffer_pool{staging_buffer_pool},
+      device{device}, scheduler{scheduler}, memory_manager{memory_manager},
       update_descriptor_queue{update_descriptor_queue} {}
 
 Uint8Pass::~Uint8Pass() = default;
 
-std::pair<VkBuffer, u64> Uint8Pass::Assemble(u32 num_vertices, VkBuffer src_buffer,
-                                             u64 src_offset) {
+std::pair<VkBuffer, u64> Uint8Pass::Assemble(u32 num_vertices, VkBuffer src_buffer, u64 src_offset,
+                                             u64 src_hash) {
+    const u64 key = Common::CityHash64WithSeed(reinterpret_cast<const char*>(&num_vertices),
+                                               sizeof(num_vertices), src_hash);
+    if (const auto it = converted_indices.find(key); it != converted_indices.end()) {
+        return {*it->second.handle, 0};
+    }
+    if (converted_indices.size() >= MAX_CACHED_CONVERSIONS) {
+        device.GetLogical().WaitIdle();
+        converted_indices.clear();
+    }
     const auto staging_size = static_cast<u32>(num_vertices * sizeof(u16));
-    auto& buffer = staging_buffer_pool.GetUnusedBuffer(staging_size, false);
+    VKBuffer& buffer =
+        converted_indices.emplace(key, CreateConversionBuffer(device, memory_manager, staging_size))
+            .first->second;
 
     update_descriptor_queue.Acquire();
     update_descriptor_queue.AddBuffer(src_buffer, src_offset, num_vertices);
@@ -549,21 +594,20 @@ std::pair<VkBuffer, u64> Uint8Pass::Assemble(u32 num_vertices, VkBuffer src_buff
 }
 
 QuadIndexedPass::QuadIndexedPass(const VKDevice& device, VKScheduler& scheduler,
-                                 VKDescriptorPool& descriptor_pool,
-                                 VKStagingBufferPool& staging_buffer_pool,
+                                 VKDescriptorPool& descriptor_pool, VKMemoryManager& memory_manager,
                                  VKUpdateDescriptorQueue& update_descriptor_queue)
     : VKComputePass(device, descriptor_pool, BuildInputOutputDescriptorSetBindings(),
                     BuildInputOutputDescriptorUpdateTemplate(),
                     BuildComputePushConstantRange(sizeof(u32) * 2), std::size(QUAD_INDEXED_SPV),
                     QUAD_INDEXED_SPV),
-      scheduler{scheduler}, staging_buffer_pool{staging_buffer_pool},
+      device{device}, scheduler{scheduler}, memory_manager{memory_manager},
       update_descriptor_queue{update_descriptor_queue} {}
 
 QuadIndexedPass::~QuadIndexedPass() = default;
 
 std::pair<VkBuffer, u64> QuadIndexedPass::Assemble(
     Tegra::Engines::Maxwell3D::Regs::IndexFormat index_format, u32 num_vertices, u32 base_vertex,
-    VkBuffer src_buffer, u64 src_offset) {
+    VkBuffer src_buffer, u64 src_offset, u64 src_hash) {
     const u32 index_shift = [index_format] {
         switch (index_format) {
         case Tegra::Engines::Maxwell3D::Regs::IndexFormat::UnsignedByte:
@@ -579,8 +623,20 @@ std::pair<VkBuffer, u64> QuadIndexedPass::Assemble(
     const u32 input_size = num_vertices << index_shift;
     const u32 num_tri_vertices = (num_vertices / 4) * 6;
 
+    const std::array<u32, 3> key_data{num_vertices, base_vertex, index_shift};
+    const u64 key = Common::CityHash64WithSeed(reinterpret_cast<const char*>(key_data.data()),
+                                               sizeof(key_data), src_hash);
+    if (const auto it = converted_indices.find(key); it != converted_indices.end()) {
+        return {*it->second.handle, 0};
+    }
+    if (converted_indices.size() >= MAX_CACHED_CONVERSIONS) {
+        device.GetLogical().WaitIdle();
+        converted_indices.clear();
+    }
     const std::size_t staging_size = num_tri_vertices * sizeof(u32);
-    auto& buffer = staging_buffer_pool.GetUnusedBuffer(staging_size, false);
+    VKBuffer& buffer =
+        converted_indices.emplace(key, CreateConversionBuffer(device, memory_manager, staging_size))
+            .first->second;
 
     update_descriptor_queue.Acquire();
     update_descriptor_queue.AddBuffer(src_buffer, src_offset, input_size);
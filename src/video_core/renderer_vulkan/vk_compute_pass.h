@@ -5,11 +5,13 @@
 #pragma once
 
 #include <optional>
+#include <unordered_map>
 #include <utility>
 
 #include "common/common_types.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
+#include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
 #include "video_core/renderer_vulkan/wrapper.h"
 
 namespace Vulkan {
@@ -17,7 +19,6 @@ namespace Vulkan {
 class VKDevice;
 class VKFence;
 class VKScheduler;
-class VKStagingBufferPool;
 class VKUpdateDescriptorQueue;
 
 class VKComputePass {
@@ -46,50 +47,61 @@ private:
 class QuadArrayPass final : public VKComputePass {
 public:
     explicit QuadArrayPass(const VKDevice& device, VKScheduler& scheduler,
-                           VKDescriptorPool& descriptor_pool,
-                           VKStagingBufferPool& staging_buffer_pool,
+                           VKDescriptorPool& descriptor_pool, VKMemoryManager& memory_manager,
                            VKUpdateDescriptorQueue& update_descriptor_queue);
     ~QuadArrayPass();
 
     std::pair<VkBuffer, VkDeviceSize> Assemble(u32 num_vertices, u32 first);
 
 private:
+    const VKDevice& device;
     VKScheduler& scheduler;
-    VKStagingBufferPool& staging_buffer_pool;
+    VKMemoryManager& memory_manager;
     VKUpdateDescriptorQueue& update_descriptor_queue;
+
+    /// Assembled triangle indices only depend on the draw parameters, so entries never go stale.
+    std::unordered_map<u64, VKBuffer> assembled_quads;
 };
 
 class Uint8Pass final : public VKComputePass {
 public:
     explicit Uint8Pass(const VKDevice& device, VKScheduler& scheduler,
-                       VKDescriptorPool& descriptor_pool, VKStagingBufferPool& staging_buffer_pool,
+                       VKDescriptorPool& descriptor_pool, VKMemoryManager& memory_manager,
                        VKUpdateDescriptorQueue& update_descriptor_queue);
     ~Uint8Pass();
 
-    std::pair<VkBuffer, u64> Assemble(u32 num_vertices, VkBuffer src_buffer, u64 src_offset);
+    std::pair<VkBuffer, u64> Assemble(u32 num_vertices, VkBuffer src_buffer, u64 src_offset,
+                                      u64 src_hash);
 
 private:
+    const VKDevice& device;
     VKScheduler& scheduler;
-    VKStagingBufferPool& staging_buffer_pool;
+    VKMemoryManager& memory_manager;
     VKUpdateDescriptorQueue& update_descriptor_queue;
+
+    /// Promoted index buffers keyed by the hash of their guest contents.
+    std::unordered_map<u64, VKBuffer> converted_indices;
 };
 
 class QuadIndexedPass final : public VKComputePass {
 public:
     explicit QuadIndexedPass(const VKDevice& device, VKScheduler& scheduler,
-                             VKDescriptorPool& descriptor_pool,
-                             VKStagingBufferPool& staging_buffer_pool,
+                             VKDescriptorPool& descriptor_pool, VKMemoryManager& memory_manager,
                              VKUpdateDescriptorQueue& update_descriptor_queue);
     ~QuadIndexedPass();
 
     std::pair<VkBuffer, u64> Assemble(Tegra::Engines::Maxwell3D::Regs::IndexFormat index_format,
                                       u32 num_vertices, u32 base_vertex, VkBuffer src_buffer,
-                                      u64 src_offset);
+                                      u64 src_offset, u64 src_hash);
 
 private:
+    const VKDevice& device;
     VKScheduler& scheduler;
-    VKStagingBufferPool& staging_buffer_pool;
+    VKMemoryManager& memory_manager;
     VKUpdateDescriptorQueue& update_descriptor_queue;
+
+    /// Assembled triangle indices keyed by the hash of their guest contents and draw parameters.
+    std::unordered_map<u64, VKBuffer> converted_indices;
 };
 
 } // namespace Vulkan
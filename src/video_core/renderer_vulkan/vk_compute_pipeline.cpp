@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <cstring>
 #include <vector>
 
 #include "video_core/renderer_vulkan/vk_compute_pipeline.h"
@@ -18,13 +19,13 @@ namespace Vulkan {
 VKComputePipeline::VKComputePipeline(const VKDevice& device, VKScheduler& scheduler,
                                      VKDescriptorPool& descriptor_pool,
                                      VKUpdateDescriptorQueue& update_descriptor_queue,
-                                     const SPIRVShader& shader)
+                                     VkPipelineCache pipeline_cache, const SPIRVShader& shader)
     : device{device}, scheduler{scheduler}, entries{shader.entries},
       descriptor_set_layout{CreateDescriptorSetLayout()},
       descriptor_allocator{descriptor_pool, *descriptor_set_layout},
       update_descriptor_queue{update_descriptor_queue}, layout{CreatePipelineLayout()},
       descriptor_template{CreateDescriptorUpdateTemplate()},
-      shader_module{CreateShaderModule(shader.code)}, pipeline{CreatePipeline()} {}
+      shader_module{CreateShaderModule(shader.code)}, pipeline{CreatePipeline(pipeline_cache)} {}
 
 VKComputePipeline::~VKComputePipeline() = default;
 
@@ -32,8 +33,22 @@ VkDescriptorSet VKComputePipeline::CommitDescriptorSet() {
     if (!descriptor_template) {
         return {};
     }
-    const auto set = descriptor_allocator.Commit(scheduler.GetFence());
+    VKFence& fence = scheduler.GetFence();
+
+    // When the payload recorded for this draw is identical to the last committed set, rebind the
+    // old set with zero descriptor writes. Its contents are immutable while it stays protected.
+    const auto [payload_data, payload_size] = update_descriptor_queue.CurrentPayload();
+    if (payload_size == last_payload.size() &&
+        std::memcmp(payload_data, last_payload.data(),
+                    payload_size * sizeof(DescriptorUpdateEntry)) == 0) {
+        if (const VkDescriptorSet set = descriptor_allocator.TryCommitLast(fence); set) {
+            return set;
+        }
+    }
+
+    const auto set = descriptor_allocator.Commit(fence);
     update_descriptor_queue.Send(*descriptor_template, set);
+    last_payload.assign(payload_data, payload_data + payload_size);
     return set;
 }
 
@@ -115,7 +130,7 @@ vk::ShaderModule VKComputePipeline::CreateShaderModule(const std::vector<u32>& c
     return device.GetLogical().CreateShaderModule(ci);
 }
 
-vk::Pipeline VKComputePipeline::CreatePipeline() const {
+vk::Pipeline VKComputePipeline::CreatePipeline(VkPipelineCache pipeline_cache) const {
     VkComputePipelineCreateInfo ci;
     VkPipelineShaderStageCreateInfo& stage_ci = ci.stage;
     stage_ci.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
@@ -142,7 +157,7 @@ vk::Pipeline VKComputePipeline::CreatePipeline() const {
     ci.layout = *layout;
     ci.basePipelineHandle = nullptr;
     ci.basePipelineIndex = 0;
-    return device.GetLogical().CreateComputePipeline(ci);
+    return device.GetLogical().CreateComputePipeline(ci, pipeline_cache);
 }
 
 } // namespace Vulkan
@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <vector>
+
 #include "common/common_types.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_shader_decompiler.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/renderer_vulkan/wrapper.h"
 
 namespace Vulkan {
@@ -20,7 +23,7 @@ public:
     explicit VKComputePipeline(const VKDevice& device, VKScheduler& scheduler,
                                VKDescriptorPool& descriptor_pool,
                                VKUpdateDescriptorQueue& update_descriptor_queue,
-                               const SPIRVShader& shader);
+                               VkPipelineCache pipeline_cache, const SPIRVShader& shader);
     ~VKComputePipeline();
 
     VkDescriptorSet CommitDescriptorSet();
@@ -46,7 +49,7 @@ private:
 
     vk::ShaderModule CreateShaderModule(const std::vector<u32>& code) const;
 
-    vk::Pipeline CreatePipeline() const;
+    vk::Pipeline CreatePipeline(VkPipelineCache pipeline_cache) const;
 
     const VKDevice& device;
     VKScheduler& scheduler;
@@ -54,6 +57,7 @@ private:
 
     vk::DescriptorSetLayout descriptor_set_layout;
     DescriptorAllocator descriptor_allocator;
+    std::vector<DescriptorUpdateEntry> last_payload;
     VKUpdateDescriptorQueue& update_descriptor_queue;
     vk::PipelineLayout layout;
     vk::DescriptorUpdateTemplateKHR descriptor_template;
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <limits>
 #include <vector>
 
 #include "common/common_types.h"
@@ -22,8 +23,16 @@ DescriptorAllocator::DescriptorAllocator(VKDescriptorPool& descriptor_pool,
 DescriptorAllocator::~DescriptorAllocator() = default;
 
 VkDescriptorSet DescriptorAllocator::Commit(VKFence& fence) {
-    const std::size_t index = CommitResource(fence);
-    return descriptors_allocations[index / SETS_GROW_RATE][index % SETS_GROW_RATE];
+    last_index = CommitResource(fence);
+    return descriptors_allocations[last_index / SETS_GROW_RATE][last_index % SETS_GROW_RATE];
+}
+
+VkDescriptorSet DescriptorAllocator::TryCommitLast(VKFence& fence) {
+    if (last_index == std::numeric_limits<std::size_t>::max() ||
+        !TryCommitResource(last_index, fence)) {
+        return {};
+    }
+    return descriptors_allocations[last_index / SETS_GROW_RATE][last_index % SETS_GROW_RATE];
 }
 
 void DescriptorAllocator::Allocate(std::size_t begin, std::size_t end) {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <limits>
 #include <vector>
 
 #include "video_core/renderer_vulkan/vk_resource_manager.h"
@@ -22,6 +23,13 @@ public:
 
     VkDescriptorSet Commit(VKFence& fence);
 
+    /**
+     * Tries to protect the last committed set with a new fence so it can be bound again without
+     * any descriptor writes. The caller must guarantee the payload is unchanged.
+     * @returns The last set, or null when it's in flight under another fence.
+     */
+    VkDescriptorSet TryCommitLast(VKFence& fence);
+
 protected:
     void Allocate(std::size_t begin, std::size_t end) override;
 
@@ -30,6 +38,7 @@ private:
     const VkDescriptorSetLayout layout;
 
     std::vector<vk::DescriptorSets> descriptors_allocations;
+    std::size_t last_index = std::numeric_limits<std::size_t>::max();
 };
 
 class VKDescriptorPool final {
@@ -122,6 +122,11 @@ public:
         return properties.limits.maxPushConstantsSize;
     }
 
+    /// Returns the number of nanoseconds a GPU timestamp tick covers.
+    float GetTimestampPeriod() const {
+        return properties.limits.timestampPeriod;
+    }
+
     /// Returns true if ASTC is natively supported.
     bool IsOptimalAstcSupported() const {
         return is_optimal_astc_supported;
@@ -74,6 +74,7 @@ VKGraphicsPipeline::VKGraphicsPipeline(const VKDevice& device, VKScheduler& sche
                                        VKDescriptorPool& descriptor_pool,
                                        VKUpdateDescriptorQueue& update_descriptor_queue,
                                        VKRenderPassCache& renderpass_cache,
+                                       VkPipelineCache pipeline_cache,
                                        const GraphicsPipelineCacheKey& key,
                                        vk::Span<VkDescriptorSetLayoutBinding> bindings,
                                        const SPIRVProgram& program)
@@ -83,9 +84,8 @@ VKGraphicsPipeline::VKGraphicsPipeline(const VKDevice& device, VKScheduler& sche
       update_descriptor_queue{update_descriptor_queue}, layout{CreatePipelineLayout()},
       descriptor_template{CreateDescriptorUpdateTemplate(program)}, modules{CreateShaderModules(
                                                                         program)},
-      renderpass{renderpass_cache.GetRenderPass(key.renderpass_params)}, pipeline{CreatePipeline(
-                                                                             key.renderpass_params,
-                                                                             program)} {}
+      renderpass{renderpass_cache.GetRenderPass(key.renderpass_params)},
+      pipeline{CreatePipeline(key.renderpass_params, program, pipeline_cache)} {}
 
 VKGraphicsPipeline::~VKGraphicsPipeline() = default;
 
@@ -93,8 +93,22 @@ VkDescriptorSet VKGraphicsPipeline::CommitDescriptorSet() {
     if (!descriptor_template) {
         return {};
     }
-    const auto set = descriptor_allocator.Commit(scheduler.GetFence());
+    VKFence& fence = scheduler.GetFence();
+
+    // When the payload recorded for this draw is identical to the last committed set, rebind the
+    // old set with zero descriptor writes. Its contents are immutable while it stays protected.
+    const auto [payload_data, payload_size] = update_descriptor_queue.CurrentPayload();
+    if (payload_size == last_payload.size() &&
+        std::memcmp(payload_data, last_payload.data(),
+                    payload_size * sizeof(DescriptorUpdateEntry)) == 0) {
+        if (const VkDescriptorSet set = descriptor_allocator.TryCommitLast(fence); set) {
+            return set;
+        }
+    }
+
+    const auto set = descriptor_allocator.Commit(fence);
     update_descriptor_queue.Send(*descriptor_template, set);
+    last_payload.assign(payload_data, payload_data + payload_size);
     return set;
 }
 
@@ -175,7 +189,8 @@ std::vector<vk::ShaderModule> VKGraphicsPipeline::CreateShaderModules(
 }
 
 vk::Pipeline VKGraphicsPipeline::CreatePipeline(const RenderPassParams& renderpass_params,
-                                                const SPIRVProgram& program) const {
+                                                const SPIRVProgram& program,
+                                                VkPipelineCache pipeline_cache) const {
     const auto& vi = fixed_state.vertex_input;
     const auto& ds = fixed_state.depth_stencil;
     const auto& cd = fixed_state.color_blending;
@@ -413,7 +428,7 @@ vk::Pipeline VKGraphicsPipeline::CreatePipeline(const RenderPassParams& renderpa
     ci.subpass = 0;
     ci.basePipelineHandle = nullptr;
     ci.basePipelineIndex = 0;
-    return device.GetLogical().CreateGraphicsPipeline(ci);
+    return device.GetLogical().CreateGraphicsPipeline(ci, pipeline_cache);
 }
 
 } // namespace Vulkan
@@ -13,6 +13,7 @@
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_renderpass_cache.h"
 #include "video_core/renderer_vulkan/vk_shader_decompiler.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/renderer_vulkan/wrapper.h"
 
 namespace Vulkan {
@@ -35,6 +36,7 @@ public:
                                 VKDescriptorPool& descriptor_pool,
                                 VKUpdateDescriptorQueue& update_descriptor_queue,
                                 VKRenderPassCache& renderpass_cache,
+                                VkPipelineCache pipeline_cache,
                                 const GraphicsPipelineCacheKey& key,
                                 vk::Span<VkDescriptorSetLayoutBinding> bindings,
                                 const SPIRVProgram& program);
@@ -66,7 +68,8 @@ private:
     std::vector<vk::ShaderModule> CreateShaderModules(const SPIRVProgram& program) const;
 
     vk::Pipeline CreatePipeline(const RenderPassParams& renderpass_params,
-                                const SPIRVProgram& program) const;
+                                const SPIRVProgram& program,
+                                VkPipelineCache pipeline_cache) const;
 
     const VKDevice& device;
     VKScheduler& scheduler;
@@ -75,6 +78,7 @@ private:
 
     vk::DescriptorSetLayout descriptor_set_layout;
     DescriptorAllocator descriptor_allocator;
+    std::vector<DescriptorUpdateEntry> last_payload;
     VKUpdateDescriptorQueue& update_descriptor_queue;
     vk::PipelineLayout layout;
     vk::DescriptorUpdateTemplateKHR descriptor_template;
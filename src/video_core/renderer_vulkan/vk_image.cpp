@@ -38,11 +38,26 @@ void VKImage::Transition(u32 base_layer, u32 num_layers, u32 base_level, u32 num
 
     std::size_t cursor = 0;
     for (u32 layer_it = 0; layer_it < num_layers; ++layer_it) {
-        for (u32 level_it = 0; level_it < num_levels; ++level_it, ++cursor) {
+        for (u32 level_it = 0; level_it < num_levels; ++level_it) {
             const u32 layer = base_layer + layer_it;
             const u32 level = base_level + level_it;
             auto& state = GetSubrangeState(layer, level);
-            auto& barrier = barriers[cursor];
+
+            // Coalesce levels of this layer going through the same transition into one barrier.
+            if (cursor > 0) {
+                auto& previous = barriers[cursor - 1];
+                auto& range = previous.subresourceRange;
+                if (previous.srcAccessMask == state.access &&
+                    previous.oldLayout == state.layout && range.baseArrayLayer == layer &&
+                    range.baseMipLevel + range.levelCount == level) {
+                    ++range.levelCount;
+                    state.access = new_access;
+                    state.layout = new_layout;
+                    continue;
+                }
+            }
+
+            auto& barrier = barriers[cursor++];
             barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
             barrier.pNext = nullptr;
             barrier.srcAccessMask = state.access;
@@ -62,6 +77,27 @@ void VKImage::Transition(u32 base_layer, u32 num_layers, u32 base_level, u32 num
         }
     }
 
+    // Merge adjacent layers whose level runs came out identical. On the common path where the
+    // whole image shares one state, the transition collapses to a single barrier instead of one
+    // per (layer, level).
+    std::size_t num_merged = 0;
+    for (std::size_t i = 0; i < cursor; ++i) {
+        if (num_merged > 0) {
+            auto& previous = barriers[num_merged - 1].subresourceRange;
+            const auto& current = barriers[i].subresourceRange;
+            if (barriers[num_merged - 1].srcAccessMask == barriers[i].srcAccessMask &&
+                barriers[num_merged - 1].oldLayout == barriers[i].oldLayout &&
+                previous.baseMipLevel == current.baseMipLevel &&
+                previous.levelCount == current.levelCount &&
+                previous.baseArrayLayer + previous.layerCount == current.baseArrayLayer) {
+                previous.layerCount += current.layerCount;
+                continue;
+            }
+        }
+        barriers[num_merged++] = barriers[i];
+    }
+    cursor = num_merged;
+
     scheduler.RequestOutsideRenderPassOperationContext();
 
     scheduler.Record([barriers = barriers, cursor](vk::CommandBuffer cmdbuf) {
@@ -5,69 +5,120 @@
 #include <algorithm>
 #include <optional>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include "common/alignment.h"
 #include "common/assert.h"
+#include "common/bit_util.h"
 #include "common/common_types.h"
 #include "common/logging/log.h"
+#include "common/microprofile.h"
 #include "video_core/renderer_vulkan/vk_device.h"
 #include "video_core/renderer_vulkan/vk_memory_manager.h"
 #include "video_core/renderer_vulkan/wrapper.h"
 
 namespace Vulkan {
 
+MICROPROFILE_DEFINE(Vulkan_DeviceAlloc, "Vulkan", "Device memory allocation",
+                    MP_RGB(192, 128, 192));
+
 namespace {
 
+/// Size in bytes of the smallest buddy block. All Vulkan alignments up to this size are honored
+/// implicitly since buddy blocks are naturally aligned to their own size.
+constexpr u64 MinBlockSize = 1ULL << 10;
+constexpr u32 MinBlockShift = 10;
+
+/// Commits of this size or larger get a dedicated device allocation. Freeing them returns the
+/// whole chunk to the driver, so large render targets never fragment the shared chunks.
+constexpr u64 DedicatedThreshold = 32ULL << 20;
+
 u64 GetAllocationChunkSize(u64 required_size) {
     static constexpr u64 sizes[] = {16ULL << 20, 32ULL << 20, 64ULL << 20, 128ULL << 20};
     auto it = std::lower_bound(std::begin(sizes), std::end(sizes), required_size);
-    return it != std::end(sizes) ? *it : Common::AlignUp(required_size, 256ULL << 20);
+    // Chunks have to be a power of two for the buddy allocator to work.
+    return it != std::end(sizes) ? *it : 1ULL << Common::Log2Ceil64(required_size);
 }
 
 } // Anonymous namespace
 
 class VKMemoryAllocation final {
 public:
-    explicit VKMemoryAllocation(const VKDevice& device, vk::DeviceMemory memory,
-                                VkMemoryPropertyFlags properties, u64 allocation_size, u32 type)
-        : device{device}, memory{std::move(memory)}, properties{properties},
-          allocation_size{allocation_size}, shifted_type{ShiftType(type)} {}
+    explicit VKMemoryAllocation(VKMemoryManager& manager, const VKDevice& device,
+                                vk::DeviceMemory memory, VkMemoryPropertyFlags properties,
+                                u64 allocation_size, u32 type, bool is_dedicated)
+        : manager{manager}, device{device}, memory{std::move(memory)}, properties{properties},
+          allocation_size{allocation_size}, shifted_type{ShiftType(type)}, is_dedicated{
+                                                                               is_dedicated} {
+        if (is_dedicated) {
+            return;
+        }
+        ASSERT_MSG((allocation_size & (allocation_size - 1)) == 0,
+                   "Chunk size has to be a power of two");
+        num_orders = Common::Log2Ceil64(allocation_size) - MinBlockShift + 1;
+        free_blocks.resize(num_orders);
+        free_blocks.back().push_back(0);
+    }
 
     VKMemoryCommit Commit(VkDeviceSize commit_size, VkDeviceSize alignment) {
-        auto found = TryFindFreeSection(free_iterator, allocation_size,
-                                        static_cast<u64>(commit_size), static_cast<u64>(alignment));
-        if (!found) {
-            found = TryFindFreeSection(0, free_iterator, static_cast<u64>(commit_size),
-                                       static_cast<u64>(alignment));
-            if (!found) {
-                // Signal out of memory, it'll try to do more allocations.
+        if (is_dedicated) {
+            if (is_committed || static_cast<u64>(commit_size) > allocation_size) {
                 return nullptr;
             }
+            is_committed = true;
+            return std::make_unique<VKMemoryCommitImpl>(device, this, memory, 0, commit_size);
         }
-        auto commit = std::make_unique<VKMemoryCommitImpl>(device, this, memory, *found,
-                                                           *found + commit_size);
-        commits.push_back(commit.get());
-
-        // Last commit's address is highly probable to be free.
-        free_iterator = *found + commit_size;
 
-        return commit;
+        // Allocating the aligned size as a single buddy block guarantees the offset satisfies
+        // the alignment, since blocks are naturally aligned to their own size.
+        const u64 aligned_size = std::max(
+            {static_cast<u64>(commit_size), static_cast<u64>(alignment), MinBlockSize});
+        const u32 order = Common::Log2Ceil64(aligned_size) - MinBlockShift;
+        if (order >= num_orders) {
+            return nullptr;
+        }
+        const std::optional<u64> offset = AllocateBlock(order);
+        if (!offset) {
+            // Signal out of memory, it'll try to do more allocations.
+            return nullptr;
+        }
+        commit_orders.emplace(*offset, order);
+        return std::make_unique<VKMemoryCommitImpl>(device, this, memory, *offset,
+                                                    *offset + commit_size);
     }
 
     void Free(const VKMemoryCommitImpl* commit) {
         ASSERT(commit);
 
-        const auto it = std::find(std::begin(commits), std::end(commits), commit);
-        if (it == commits.end()) {
+        if (is_dedicated) {
+            // Dedicated allocations return the whole chunk to the driver. This destroys *this,
+            // nothing can be accessed afterwards.
+            manager.ReleaseDedicatedAllocation(this);
+            return;
+        }
+
+        const u64 offset = commit->interval.first;
+        const auto it = commit_orders.find(offset);
+        if (it == commit_orders.end()) {
             UNREACHABLE_MSG("Freeing unallocated commit!");
             return;
         }
-        commits.erase(it);
+        FreeBlock(offset, it->second);
+        commit_orders.erase(it);
+    }
+
+    /// Returns the size in bytes of the backing device memory.
+    u64 AllocationSize() const {
+        return allocation_size;
     }
 
     /// Returns whether this allocation is compatible with the arguments.
     bool IsCompatible(VkMemoryPropertyFlags wanted_properties, u32 type_mask) const {
+        if (is_dedicated) {
+            // Dedicated allocations are never shared.
+            return false;
+        }
         return (wanted_properties & properties) && (type_mask & shifted_type) != 0;
     }
 
@@ -76,45 +127,61 @@ private:
         return 1U << type;
     }
 
-    /// A memory allocator, it may return a free region between "start" and "end" with the solicited
-    /// requirements.
-    std::optional<u64> TryFindFreeSection(u64 start, u64 end, u64 size, u64 alignment) const {
-        u64 iterator = Common::AlignUp(start, alignment);
-        while (iterator + size <= end) {
-            const u64 try_left = iterator;
-            const u64 try_right = try_left + size;
-
-            bool overlap = false;
-            for (const auto& commit : commits) {
-                const auto [commit_left, commit_right] = commit->interval;
-                if (try_left < commit_right && commit_left < try_right) {
-                    // There's an overlap, continue the search where the overlapping commit ends.
-                    iterator = Common::AlignUp(commit_right, alignment);
-                    overlap = true;
-                    break;
-                }
-            }
-            if (!overlap) {
-                // A free address has been found.
-                return try_left;
-            }
+    static constexpr u64 BlockBytes(u32 order) {
+        return MinBlockSize << order;
+    }
+
+    /// Pops a free block of the given order, splitting larger blocks as needed.
+    std::optional<u64> AllocateBlock(u32 order) {
+        u32 search = order;
+        while (search < num_orders && free_blocks[search].empty()) {
+            ++search;
+        }
+        if (search >= num_orders) {
+            return std::nullopt;
         }
+        u64 offset = free_blocks[search].back();
+        free_blocks[search].pop_back();
+        while (search > order) {
+            --search;
+            // Keep the lower half and release the upper buddy.
+            free_blocks[search].push_back(offset + BlockBytes(search));
+        }
+        return offset;
+    }
 
-        // No free regions where found, return an empty optional.
-        return std::nullopt;
+    /// Returns a block to the free lists, coalescing it with its buddy as far as possible.
+    void FreeBlock(u64 offset, u32 order) {
+        while (order + 1 < num_orders) {
+            const u64 buddy = offset ^ BlockBytes(order);
+            auto& list = free_blocks[order];
+            const auto it = std::find(list.begin(), list.end(), buddy);
+            if (it == list.end()) {
+                break;
+            }
+            list.erase(it);
+            offset = std::min(offset, buddy);
+            ++order;
+        }
+        free_blocks[order].push_back(offset);
     }
 
+    VKMemoryManager& manager;               ///< Memory manager that owns this allocation.
     const VKDevice& device;                 ///< Vulkan device.
     const vk::DeviceMemory memory;          ///< Vulkan memory allocation handler.
     const VkMemoryPropertyFlags properties; ///< Vulkan properties.
     const u64 allocation_size;              ///< Size of this allocation.
     const u32 shifted_type;                 ///< Stored Vulkan type of this allocation, shifted.
+    const bool is_dedicated;                ///< Whether this allocation serves a single commit.
 
-    /// Hints where the next free region is likely going to be.
-    u64 free_iterator{};
+    bool is_committed = false; ///< Whether a dedicated allocation is in use.
+    u32 num_orders = 0;        ///< Number of buddy orders in this chunk.
 
-    /// Stores all commits done from this allocation.
-    std::vector<const VKMemoryCommitImpl*> commits;
+    /// Free block offsets indexed by buddy order.
+    std::vector<std::vector<u64>> free_blocks;
+
+    /// Buddy order of every live commit, keyed by its offset.
+    std::unordered_map<u64, u32> commit_orders;
 };
 
 VKMemoryManager::VKMemoryManager(const VKDevice& device)
@@ -124,20 +191,30 @@ VKMemoryManager::~VKMemoryManager() = default;
 
 VKMemoryCommit VKMemoryManager::Commit(const VkMemoryRequirements& requirements,
                                        bool host_visible) {
-    const u64 chunk_size = GetAllocationChunkSize(requirements.size);
-
     // When a host visible commit is asked, search for host visible and coherent, otherwise search
     // for a fast device local type.
     const VkMemoryPropertyFlags wanted_properties =
         host_visible ? VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
                      : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
 
+    if (requirements.size >= DedicatedThreshold) {
+        // Large commits, e.g. high resolution render targets, get their own device allocation
+        // instead of going through the shared chunks.
+        if (AllocMemory(wanted_properties, requirements.memoryTypeBits, requirements.size, true)) {
+            auto commit = allocations.back()->Commit(requirements.size, requirements.alignment);
+            ASSERT(commit);
+            return commit;
+        }
+        // Dedicated allocation failed, fall back to the shared chunks.
+    }
+
     if (auto commit = TryAllocCommit(requirements, wanted_properties)) {
         return commit;
     }
 
     // Commit has failed, allocate more memory.
-    if (!AllocMemory(wanted_properties, requirements.memoryTypeBits, chunk_size)) {
+    const u64 chunk_size = GetAllocationChunkSize(requirements.size);
+    if (!AllocMemory(wanted_properties, requirements.memoryTypeBits, chunk_size, false)) {
         // TODO(Rodrigo): Handle these situations in some way like flushing to guest memory.
         // Allocation has failed, panic.
         UNREACHABLE_MSG("Ran out of VRAM!");
@@ -163,8 +240,18 @@ VKMemoryCommit VKMemoryManager::Commit(const vk::Image& image, bool host_visible
     return commit;
 }
 
-bool VKMemoryManager::AllocMemory(VkMemoryPropertyFlags wanted_properties, u32 type_mask,
-                                  u64 size) {
+void VKMemoryManager::ReleaseDedicatedAllocation(VKMemoryAllocation* allocation) {
+    const auto it =
+        std::find_if(allocations.begin(), allocations.end(),
+                     [allocation](const auto& entry) { return entry.get() == allocation; });
+    ASSERT(it != allocations.end());
+    allocated_bytes -= allocation->AllocationSize();
+    allocations.erase(it);
+}
+
+bool VKMemoryManager::AllocMemory(VkMemoryPropertyFlags wanted_properties, u32 type_mask, u64 size,
+                                  bool is_dedicated) {
+    MICROPROFILE_SCOPE(Vulkan_DeviceAlloc);
     const u32 type = [&] {
         for (u32 type_index = 0; type_index < properties.memoryTypeCount; ++type_index) {
             const auto flags = properties.memoryTypes[type_index].propertyFlags;
@@ -190,8 +277,11 @@ bool VKMemoryManager::AllocMemory(VkMemoryPropertyFlags wanted_properties, u32 t
         return false;
     }
 
-    allocations.push_back(std::make_unique<VKMemoryAllocation>(device, std::move(memory),
-                                                               wanted_properties, size, type));
+    allocations.push_back(std::make_unique<VKMemoryAllocation>(
+        *this, device, std::move(memory), wanted_properties, size, type, is_dedicated));
+    allocated_bytes += size;
+    LOG_DEBUG(Render_Vulkan, "Allocated {} bytes of device memory ({} total, {} chunks)", size,
+              allocated_bytes, allocations.size());
     return true;
 }
 
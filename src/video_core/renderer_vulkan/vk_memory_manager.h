@@ -40,9 +40,14 @@ public:
     /// Commits memory required by the image and binds it.
     VKMemoryCommit Commit(const vk::Image& image, bool host_visible);
 
+    /// Releases a dedicated allocation when its only commit is freed, returning the device
+    /// memory to the driver. Called from the allocation itself.
+    void ReleaseDedicatedAllocation(VKMemoryAllocation* allocation);
+
 private:
     /// Allocates a chunk of memory.
-    bool AllocMemory(VkMemoryPropertyFlags wanted_properties, u32 type_mask, u64 size);
+    bool AllocMemory(VkMemoryPropertyFlags wanted_properties, u32 type_mask, u64 size,
+                     bool is_dedicated);
 
     /// Tries to allocate a memory commit.
     VKMemoryCommit TryAllocCommit(const VkMemoryRequirements& requirements,
@@ -51,6 +56,7 @@ private:
     const VKDevice& device;                                       ///< Device handler.
     const VkPhysicalDeviceMemoryProperties properties;            ///< Physical device properties.
     std::vector<std::unique_ptr<VKMemoryAllocation>> allocations; ///< Current allocations.
+    u64 allocated_bytes = 0;                                      ///< Total device memory in use.
 };
 
 class VKMemoryCommitImpl final {
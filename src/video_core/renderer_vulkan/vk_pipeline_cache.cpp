@@ -3,13 +3,25 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstring>
 #include <memory>
+#include <string>
 #include <vector>
 
+#include <fmt/format.h>
+
+#include "common/common_paths.h"
+#include "common/fast_hash.h"
+#include "common/file_util.h"
+#include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "core/core.h"
+#include "core/hle/kernel/process.h"
 #include "core/memory.h"
+#include "core/perf_stats.h"
+#include "core/settings.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/memory_manager.h"
@@ -116,7 +128,7 @@ u32 FillDescriptorLayout(const ShaderEntries& entries,
 } // Anonymous namespace
 
 std::size_t GraphicsPipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this);
+    const u64 hash = Common::FastHash64(this, sizeof *this);
     return static_cast<std::size_t>(hash);
 }
 
@@ -125,7 +137,7 @@ bool GraphicsPipelineCacheKey::operator==(const GraphicsPipelineCacheKey& rhs) c
 }
 
 std::size_t ComputePipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this);
+    const u64 hash = Common::FastHash64(this, sizeof *this);
     return static_cast<std::size_t>(hash);
 }
 
@@ -160,7 +172,9 @@ VKPipelineCache::VKPipelineCache(Core::System& system, RasterizerVulkan& rasteri
       scheduler{scheduler}, descriptor_pool{descriptor_pool},
       update_descriptor_queue{update_descriptor_queue}, renderpass_cache{renderpass_cache} {}
 
-VKPipelineCache::~VKPipelineCache() = default;
+VKPipelineCache::~VKPipelineCache() {
+    SaveDriverPipelineCache();
+}
 
 std::array<Shader*, Maxwell::MaxShaderProgram> VKPipelineCache::GetShaders() {
     const auto& gpu = system.GPU().Maxwell3D();
@@ -216,10 +230,14 @@ VKGraphicsPipeline& VKPipelineCache::GetGraphicsPipeline(const GraphicsPipelineC
     auto& entry = pair->second;
     if (is_cache_miss) {
         LOG_INFO(Render_Vulkan, "Compile 0x{:016X}", key.Hash());
+        const auto start = Core::PerfStats::Clock::now();
         const auto [program, bindings] = DecompileShaders(key);
         entry = std::make_unique<VKGraphicsPipeline>(device, scheduler, descriptor_pool,
-                                                     update_descriptor_queue, renderpass_cache, key,
-                                                     bindings, program);
+                                                     update_descriptor_queue, renderpass_cache,
+                                                     EnsureDriverPipelineCache(), key, bindings,
+                                                     program);
+        system.GetPerfStats().RecordBlockingEvent("Vulkan pipeline build",
+                                                  Core::PerfStats::Clock::now() - start);
     }
     return *(last_graphics_pipeline = entry.get());
 }
@@ -227,12 +245,18 @@ VKGraphicsPipeline& VKPipelineCache::GetGraphicsPipeline(const GraphicsPipelineC
 VKComputePipeline& VKPipelineCache::GetComputePipeline(const ComputePipelineCacheKey& key) {
     MICROPROFILE_SCOPE(Vulkan_PipelineCache);
 
+    if (last_compute_pipeline && last_compute_key == key) {
+        return *last_compute_pipeline;
+    }
+    last_compute_key = key;
+
     const auto [pair, is_cache_miss] = compute_cache.try_emplace(key);
     auto& entry = pair->second;
     if (!is_cache_miss) {
-        return *entry;
+        return *(last_compute_pipeline = entry.get());
     }
     LOG_INFO(Render_Vulkan, "Compile 0x{:016X}", key.Hash());
+    const auto start = Core::PerfStats::Clock::now();
 
     auto& memory_manager = system.GPU().MemoryManager();
     const auto program_addr = key.shader;
@@ -267,8 +291,84 @@ VKComputePipeline& VKPipelineCache::GetComputePipeline(const ComputePipelineCach
                                              shader->GetRegistry(), specialization),
                                    shader->GetEntries()};
     entry = std::make_unique<VKComputePipeline>(device, scheduler, descriptor_pool,
-                                                update_descriptor_queue, spirv_shader);
-    return *entry;
+                                                update_descriptor_queue,
+                                                EnsureDriverPipelineCache(), spirv_shader);
+    system.GetPerfStats().RecordBlockingEvent("Vulkan pipeline build",
+                                              Core::PerfStats::Clock::now() - start);
+    return *(last_compute_pipeline = entry.get());
+}
+
+VkPipelineCache VKPipelineCache::EnsureDriverPipelineCache() {
+    if (driver_pipeline_cache_initialized) {
+        return *driver_pipeline_cache;
+    }
+    driver_pipeline_cache_initialized = true;
+
+    std::vector<u8> initial_data;
+    if (Settings::values.use_disk_shader_cache) {
+        if (FileUtil::IOFile file{GetDriverPipelineCachePath(), "rb"}; file.IsOpen()) {
+            initial_data.resize(file.GetSize());
+            if (file.ReadBytes(initial_data.data(), initial_data.size()) != initial_data.size()) {
+                initial_data.clear();
+            }
+        }
+    }
+
+    // Reject blobs written by a different driver or GPU before handing them to the driver.
+    static constexpr std::size_t header_size = 16 + VK_UUID_SIZE;
+    if (initial_data.size() >= header_size) {
+        const VkPhysicalDeviceProperties properties = device.GetPhysical().GetProperties();
+        u32 vendor_id;
+        u32 device_id;
+        std::memcpy(&vendor_id, initial_data.data() + 8, sizeof(vendor_id));
+        std::memcpy(&device_id, initial_data.data() + 12, sizeof(device_id));
+        if (vendor_id != properties.vendorID || device_id != properties.deviceID) {
+            initial_data.clear();
+        }
+    } else {
+        initial_data.clear();
+    }
+
+    VkPipelineCacheCreateInfo ci;
+    ci.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    ci.pNext = nullptr;
+    ci.flags = 0;
+    ci.initialDataSize = initial_data.size();
+    ci.pInitialData = initial_data.data();
+    driver_pipeline_cache = device.GetLogical().CreatePipelineCache(ci);
+    return *driver_pipeline_cache;
+}
+
+void VKPipelineCache::SaveDriverPipelineCache() {
+    if (!driver_pipeline_cache || !Settings::values.use_disk_shader_cache) {
+        return;
+    }
+    const auto& dev = device.GetLogical();
+    std::size_t size = 0;
+    if (dev.GetPipelineCacheData(*driver_pipeline_cache, &size, nullptr) != VK_SUCCESS ||
+        size == 0) {
+        return;
+    }
+    std::vector<u8> data(size);
+    if (dev.GetPipelineCacheData(*driver_pipeline_cache, &size, data.data()) != VK_SUCCESS) {
+        return;
+    }
+    const std::string path = GetDriverPipelineCachePath();
+    if (!FileUtil::CreateFullPath(path)) {
+        LOG_ERROR(Render_Vulkan, "Failed to create pipeline cache directories");
+        return;
+    }
+    FileUtil::IOFile file(path, "wb");
+    if (!file.IsOpen() || file.WriteBytes(data.data(), size) != size) {
+        LOG_ERROR(Render_Vulkan, "Failed to save driver pipeline cache");
+    }
+}
+
+std::string VKPipelineCache::GetDriverPipelineCachePath() const {
+    const u64 title_id = system.CurrentProcess()->GetTitleID();
+    return FileUtil::GetUserPath(FileUtil::UserPath::ShaderDir) + DIR_SEP "vulkan" DIR_SEP
+           "driver" DIR_SEP +
+           fmt::format("{:016X}.bin", title_id);
 }
 
 void VKPipelineCache::OnShaderRemoval(Shader* shader) {
@@ -292,6 +392,9 @@ void VKPipelineCache::OnShaderRemoval(Shader* shader) {
             continue;
         }
         Finish();
+        if (it->second.get() == last_graphics_pipeline) {
+            last_graphics_pipeline = nullptr;
+        }
         it = graphics_cache.erase(it);
     }
     for (auto it = compute_cache.begin(); it != compute_cache.end();) {
@@ -301,6 +404,9 @@ void VKPipelineCache::OnShaderRemoval(Shader* shader) {
             continue;
         }
         Finish();
+        if (it->second.get() == last_compute_pipeline) {
+            last_compute_pipeline = nullptr;
+        }
         it = compute_cache.erase(it);
     }
 }
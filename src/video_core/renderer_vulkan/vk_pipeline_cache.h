@@ -7,6 +7,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -159,6 +160,14 @@ private:
     std::pair<SPIRVProgram, std::vector<VkDescriptorSetLayoutBinding>> DecompileShaders(
         const GraphicsPipelineCacheKey& key);
 
+    /// Lazily creates the driver pipeline cache, seeding it from disk when enabled.
+    VkPipelineCache EnsureDriverPipelineCache();
+
+    /// Serializes the driver pipeline cache blob back to disk.
+    void SaveDriverPipelineCache();
+
+    std::string GetDriverPipelineCachePath() const;
+
     Core::System& system;
     const VKDevice& device;
     VKScheduler& scheduler;
@@ -169,11 +178,17 @@ private:
     std::unique_ptr<Shader> null_shader;
     std::unique_ptr<Shader> null_kernel;
 
+    vk::PipelineCache driver_pipeline_cache;
+    bool driver_pipeline_cache_initialized = false;
+
     std::array<Shader*, Maxwell::MaxShaderProgram> last_shaders{};
 
     GraphicsPipelineCacheKey last_graphics_key;
     VKGraphicsPipeline* last_graphics_pipeline = nullptr;
 
+    ComputePipelineCacheKey last_compute_key;
+    VKComputePipeline* last_compute_pipeline = nullptr;
+
     std::unordered_map<GraphicsPipelineCacheKey, std::unique_ptr<VKGraphicsPipeline>>
         graphics_cache;
     std::unordered_map<ComputePipelineCacheKey, std::unique_ptr<VKComputePipeline>> compute_cache;
@@ -12,6 +12,7 @@
 
 #include "common/alignment.h"
 #include "common/assert.h"
+#include "common/cityhash.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "core/core.h"
@@ -60,7 +61,7 @@ namespace {
 
 constexpr auto ComputeShaderIndex = static_cast<std::size_t>(Tegra::Engines::ShaderType::Compute);
 
-VkViewport GetViewportState(const VKDevice& device, const Maxwell& regs, std::size_t index) {
+VkViewport GetViewportState(bool unrestricted_depth, const Maxwell& regs, std::size_t index) {
     const auto& src = regs.viewport_transform[index];
     const float width = src.scale_x * 2.0f;
     const float height = src.scale_y * 2.0f;
@@ -74,7 +75,7 @@ VkViewport GetViewportState(const VKDevice& device, const Maxwell& regs, std::si
     const float reduce_z = regs.depth_mode == Maxwell::DepthMode::MinusOneToOne ? 1.0f : 0.0f;
     viewport.minDepth = src.translate_z - src.scale_z * reduce_z;
     viewport.maxDepth = src.translate_z + src.scale_z;
-    if (!device.IsExtDepthRangeUnrestrictedSupported()) {
+    if (!unrestricted_depth) {
         viewport.minDepth = std::clamp(viewport.minDepth, 0.0f, 1.0f);
         viewport.maxDepth = std::clamp(viewport.maxDepth, 0.0f, 1.0f);
     }
@@ -342,11 +343,15 @@ RasterizerVulkan::RasterizerVulkan(Core::System& system, Core::Frontend::EmuWind
     : RasterizerAccelerated{system.Memory()}, system{system}, render_window{renderer},
       screen_info{screen_info}, device{device}, resource_manager{resource_manager},
       memory_manager{memory_manager}, state_tracker{state_tracker}, scheduler{scheduler},
+      has_depth_range_unrestricted{device.IsExtDepthRangeUnrestrictedSupported()},
+      has_transform_feedback{device.IsExtTransformFeedbackSupported()},
+      has_index_type_uint8{device.IsExtIndexTypeUint8Supported()},
       staging_pool(device, memory_manager, scheduler), descriptor_pool(device),
       update_descriptor_queue(device, scheduler), renderpass_cache(device),
-      quad_array_pass(device, scheduler, descriptor_pool, staging_pool, update_descriptor_queue),
-      quad_indexed_pass(device, scheduler, descriptor_pool, staging_pool, update_descriptor_queue),
-      uint8_pass(device, scheduler, descriptor_pool, staging_pool, update_descriptor_queue),
+      quad_array_pass(device, scheduler, descriptor_pool, memory_manager, update_descriptor_queue),
+      quad_indexed_pass(device, scheduler, descriptor_pool, memory_manager,
+                        update_descriptor_queue),
+      uint8_pass(device, scheduler, descriptor_pool, memory_manager, update_descriptor_queue),
       texture_cache(system, *this, device, resource_manager, memory_manager, scheduler,
                     staging_pool),
       pipeline_cache(system, *this, device, scheduler, descriptor_pool, update_descriptor_queue,
@@ -624,6 +629,14 @@ void RasterizerVulkan::ReleaseFences() {
     fence_manager.WaitPendingFences();
 }
 
+bool RasterizerVulkan::TryReleaseFences() {
+    auto& gpu{system.GPU()};
+    if (!gpu.IsAsync()) {
+        return true;
+    }
+    return fence_manager.TryReleasePendingFences();
+}
+
 void RasterizerVulkan::FlushAndInvalidateRegion(VAddr addr, u64 size) {
     if (Settings::IsGPULevelExtreme()) {
         FlushRegion(addr, size);
@@ -640,7 +653,7 @@ void RasterizerVulkan::WaitForIdle() {
         VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT |
         VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
-    if (device.IsExtTransformFeedbackSupported()) {
+    if (has_transform_feedback) {
         flags |= VK_PIPELINE_STAGE_TRANSFORM_FEEDBACK_BIT_EXT;
     }
 
@@ -662,9 +675,18 @@ void RasterizerVulkan::TickFrame() {
     draw_counter = 0;
     update_descriptor_queue.TickFrame();
     buffer_cache.TickFrame();
+    texture_cache.TickFrame();
     staging_pool.TickFrame();
 }
 
+bool RasterizerVulkan::AccelerateDMATiledToLinear(
+    GPUVAddr src_address, GPUVAddr dst_address,
+    const Tegra::Engines::MaxwellDMA::Regs::Parameters& src_params, u32 x_count, u32 y_count,
+    u32 dst_pitch) {
+    return texture_cache.AccelerateDMATiledToLinear(src_address, dst_address, src_params, x_count,
+                                                    y_count, dst_pitch);
+}
+
 bool RasterizerVulkan::AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Regs::Surface& src,
                                              const Tegra::Engines::Fermi2D::Regs::Surface& dst,
                                              const Tegra::Engines::Fermi2D::Config& copy_config) {
@@ -697,6 +719,7 @@ bool RasterizerVulkan::AccelerateDisplay(const Tegra::FramebufferConfig& config,
 
 void RasterizerVulkan::SetupDirtyFlags() {
     state_tracker.Initialize();
+    system.GPU().Maxwell3D().PrepareDirtyTables();
 }
 
 void RasterizerVulkan::FlushWork() {
@@ -752,9 +775,60 @@ RasterizerVulkan::Texceptions RasterizerVulkan::UpdateAttachments(bool is_clear)
 
     texture_cache.GuardRenderTargets(false);
 
+    if (update_rendertargets) {
+        UpdateRenderPassState();
+    }
+
     return texceptions;
 }
 
+void RasterizerVulkan::UpdateRenderPassState() {
+    const auto& regs = system.GPU().Maxwell3D().regs;
+    const std::size_t num_attachments = static_cast<std::size_t>(regs.rt_control.count);
+
+    renderpass_params.color_formats = {};
+    std::size_t index = 0;
+    for (std::size_t rt = 0; rt < num_attachments; ++rt) {
+        const auto& rendertarget = regs.rt[rt];
+        if (rendertarget.Address() == 0 || rendertarget.format == Tegra::RenderTargetFormat::NONE) {
+            continue;
+        }
+        renderpass_params.color_formats[index] = static_cast<u8>(rendertarget.format);
+        renderpass_color_map[index] = static_cast<u8>(rt);
+        ++index;
+    }
+    renderpass_params.num_color_attachments = static_cast<u8>(index);
+    renderpass_params.texceptions = 0;
+
+    renderpass_params.zeta_format = regs.zeta_enable ? static_cast<u8>(regs.zeta.format) : 0;
+    renderpass_params.zeta_texception = 0;
+
+    framebuffer_key.views.clear();
+    framebuffer_key.width = std::numeric_limits<u32>::max();
+    framebuffer_key.height = std::numeric_limits<u32>::max();
+    framebuffer_key.layers = std::numeric_limits<u32>::max();
+    framebuffer_color_buffers.clear();
+    framebuffer_zeta = false;
+
+    const auto try_push = [this](const View& view) {
+        if (!view) {
+            return false;
+        }
+        framebuffer_key.views.push_back(view->GetAttachment());
+        framebuffer_key.width = std::min(framebuffer_key.width, view->GetWidth());
+        framebuffer_key.height = std::min(framebuffer_key.height, view->GetHeight());
+        framebuffer_key.layers = std::min(framebuffer_key.layers, view->GetNumLayers());
+        return true;
+    };
+    for (std::size_t rt = 0; rt < num_attachments; ++rt) {
+        if (try_push(color_attachments[rt])) {
+            framebuffer_color_buffers.push_back(static_cast<u8>(rt));
+        }
+    }
+    framebuffer_zeta = try_push(zeta_attachment);
+    framebuffer_key.UpdateBaseHash();
+}
+
 bool RasterizerVulkan::WalkAttachmentOverlaps(const CachedSurfaceView& attachment) {
     bool overlap = false;
     for (auto& [view, layout] : sampled_views) {
@@ -769,34 +843,18 @@ bool RasterizerVulkan::WalkAttachmentOverlaps(const CachedSurfaceView& attachmen
 
 std::tuple<VkFramebuffer, VkExtent2D> RasterizerVulkan::ConfigureFramebuffers(
     VkRenderPass renderpass) {
-    FramebufferCacheKey key{renderpass, std::numeric_limits<u32>::max(),
-                            std::numeric_limits<u32>::max(), std::numeric_limits<u32>::max()};
-
-    const auto try_push = [&key](const View& view) {
-        if (!view) {
-            return false;
-        }
-        key.views.push_back(view->GetAttachment());
-        key.width = std::min(key.width, view->GetWidth());
-        key.height = std::min(key.height, view->GetHeight());
-        key.layers = std::min(key.layers, view->GetNumLayers());
-        return true;
-    };
-
-    const auto& regs = system.GPU().Maxwell3D().regs;
-    const std::size_t num_attachments = static_cast<std::size_t>(regs.rt_control.count);
-    for (std::size_t index = 0; index < num_attachments; ++index) {
-        if (try_push(color_attachments[index])) {
-            texture_cache.MarkColorBufferInUse(index);
-        }
+    for (const u8 rt : framebuffer_color_buffers) {
+        texture_cache.MarkColorBufferInUse(rt);
     }
-    if (try_push(zeta_attachment)) {
+    if (framebuffer_zeta) {
         texture_cache.MarkDepthBufferInUse();
     }
 
-    const auto [fbentry, is_cache_miss] = framebuffer_cache.try_emplace(key);
-    auto& framebuffer = fbentry->second;
-    if (is_cache_miss) {
+    FramebufferCacheKey& key = framebuffer_key;
+    key.renderpass = renderpass;
+
+    vk::Framebuffer& framebuffer = framebuffer_cache[key];
+    if (!framebuffer) {
         VkFramebufferCreateInfo framebuffer_ci;
         framebuffer_ci.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
         framebuffer_ci.pNext = nullptr;
@@ -900,7 +958,7 @@ void RasterizerVulkan::BeginTransformFeedback() {
     if (regs.tfb_enabled == 0) {
         return;
     }
-    if (!device.IsExtTransformFeedbackSupported()) {
+    if (!has_transform_feedback) {
         LOG_ERROR(Render_Vulkan, "Transform feedbacks used but not supported");
         return;
     }
@@ -932,7 +990,7 @@ void RasterizerVulkan::EndTransformFeedback() {
     if (regs.tfb_enabled == 0) {
         return;
     }
-    if (!device.IsExtTransformFeedbackSupported()) {
+    if (!has_transform_feedback) {
         return;
     }
 
@@ -999,8 +1057,12 @@ void RasterizerVulkan::SetupIndexBuffer(BufferBindings& buffer_bindings, DrawPar
         const auto info = buffer_cache.UploadMemory(gpu_addr, CalculateIndexBufferSize());
         VkBuffer buffer = info.handle;
         u64 offset = info.offset;
-        std::tie(buffer, offset) = quad_indexed_pass.Assemble(
-            regs.index_array.format, params.num_vertices, params.base_vertex, buffer, offset);
+        const std::size_t input_size =
+            static_cast<std::size_t>(params.num_vertices) * regs.index_array.FormatSizeInBytes();
+        std::tie(buffer, offset) =
+            quad_indexed_pass.Assemble(regs.index_array.format, params.num_vertices,
+                                       params.base_vertex, buffer, offset,
+                                       HashIndexRange(gpu_addr, input_size));
 
         buffer_bindings.SetIndexBinding(buffer, offset, VK_INDEX_TYPE_UINT32);
         params.num_vertices = (params.num_vertices / 4) * 6;
@@ -1018,8 +1080,9 @@ void RasterizerVulkan::SetupIndexBuffer(BufferBindings& buffer_bindings, DrawPar
 
         auto format = regs.index_array.format;
         const bool is_uint8 = format == Maxwell::IndexFormat::UnsignedByte;
-        if (is_uint8 && !device.IsExtIndexTypeUint8Supported()) {
-            std::tie(buffer, offset) = uint8_pass.Assemble(params.num_vertices, buffer, offset);
+        if (is_uint8 && !has_index_type_uint8) {
+            std::tie(buffer, offset) = uint8_pass.Assemble(
+                params.num_vertices, buffer, offset, HashIndexRange(gpu_addr, params.num_vertices));
             format = Maxwell::IndexFormat::UnsignedShort;
         }
 
@@ -1029,12 +1092,39 @@ void RasterizerVulkan::SetupIndexBuffer(BufferBindings& buffer_bindings, DrawPar
     }
 }
 
+u64 RasterizerVulkan::HashIndexRange(GPUVAddr gpu_addr, std::size_t size) {
+    index_hash_scratch.resize(size);
+    system.GPU().MemoryManager().ReadBlockUnsafe(gpu_addr, index_hash_scratch.data(), size);
+    return Common::CityHash64(reinterpret_cast<const char*>(index_hash_scratch.data()), size);
+}
+
 void RasterizerVulkan::SetupGraphicsConstBuffers(const ShaderEntries& entries, std::size_t stage) {
     MICROPROFILE_SCOPE(Vulkan_ConstBuffers);
     const auto& gpu = system.GPU().Maxwell3D();
     const auto& shader_stage = gpu.state.shader_stages[stage];
+
+    // Pack every enabled buffer of the stage into a single stream buffer reservation instead of
+    // paying the upload overhead once per buffer.
+    std::array<VKBufferCache::SmallUploadEntry, Maxwell::MaxConstBuffers> batch;
+    std::array<VKBufferCache::BufferInfo, Maxwell::MaxConstBuffers> batch_infos;
+    std::size_t batch_count = 0;
     for (const auto& entry : entries.const_buffers) {
-        SetupConstBuffer(entry, shader_stage.const_buffers[entry.GetIndex()]);
+        const auto& buffer = shader_stage.const_buffers[entry.GetIndex()];
+        if (!buffer.enabled) {
+            continue;
+        }
+        const std::size_t size =
+            Common::AlignUp(CalculateConstBufferSize(entry, buffer), 4 * sizeof(float));
+        batch[batch_count++] = {buffer.address, size};
+    }
+    buffer_cache.UploadMemoryBatch(batch.data(), batch_count, device.GetUniformBufferAlignment(),
+                                   batch_infos.data());
+
+    std::size_t batch_index = 0;
+    for (const auto& entry : entries.const_buffers) {
+        const auto& buffer = shader_stage.const_buffers[entry.GetIndex()];
+        const auto* const info = buffer.enabled ? &batch_infos[batch_index++] : nullptr;
+        SetupConstBuffer(entry, buffer, info);
     }
 }
 
@@ -1097,7 +1187,7 @@ void RasterizerVulkan::SetupComputeConstBuffers(const ShaderEntries& entries) {
         buffer.address = config.Address();
         buffer.size = config.size;
         buffer.enabled = mask[entry.GetIndex()];
-        SetupConstBuffer(entry, buffer);
+        SetupConstBuffer(entry, buffer, nullptr);
     }
 }
 
@@ -1149,7 +1239,8 @@ void RasterizerVulkan::SetupComputeImages(const ShaderEntries& entries) {
 }
 
 void RasterizerVulkan::SetupConstBuffer(const ConstBufferEntry& entry,
-                                        const Tegra::Engines::ConstBufferInfo& buffer) {
+                                        const Tegra::Engines::ConstBufferInfo& buffer,
+                                        const VKBufferCache::BufferInfo* batched_info) {
     if (!buffer.enabled) {
         // Set values to zero to unbind buffers
         update_descriptor_queue.AddBuffer(DefaultBuffer(), 0, DEFAULT_BUFFER_SIZE);
@@ -1161,8 +1252,14 @@ void RasterizerVulkan::SetupConstBuffer(const ConstBufferEntry& entry,
         Common::AlignUp(CalculateConstBufferSize(entry, buffer), 4 * sizeof(float));
     ASSERT(size <= MaxConstbufferSize);
 
-    const auto info =
-        buffer_cache.UploadMemory(buffer.address, size, device.GetUniformBufferAlignment());
+    // Only compute dispatches reach the upload here; graphics stages batch their buffers.
+    // Back-to-back dispatches tend to rebind identical buffers, so prefer the cached path to
+    // skip re-reading guest memory that has not been written since the last dispatch.
+    const auto info = batched_info
+                          ? *batched_info
+                          : buffer_cache.UploadMemory(buffer.address, size,
+                                                      device.GetUniformBufferAlignment(), false,
+                                                      false, true);
     update_descriptor_queue.AddBuffer(info.handle, info.offset, size);
 }
 
@@ -1202,7 +1299,7 @@ void RasterizerVulkan::SetupTexture(const Tegra::Texture::FullTextureInfo& textu
 
     const VkImageView image_view = view->GetImageView(texture.tic.x_source, texture.tic.y_source,
                                                       texture.tic.z_source, texture.tic.w_source);
-    const auto sampler = sampler_cache.GetSampler(texture.tsc);
+    const auto sampler = sampler_cache.GetSampler(texture.tsc, texture.tsc_index);
     update_descriptor_queue.AddSampledImage(sampler, image_view);
 
     VkImageLayout* const image_layout = update_descriptor_queue.LastImageLayout();
@@ -1240,30 +1337,66 @@ void RasterizerVulkan::UpdateViewportsState(Tegra::Engines::Maxwell3D::Regs& reg
     if (!state_tracker.TouchViewports()) {
         return;
     }
-    const std::array viewports{
-        GetViewportState(device, regs, 0),  GetViewportState(device, regs, 1),
-        GetViewportState(device, regs, 2),  GetViewportState(device, regs, 3),
-        GetViewportState(device, regs, 4),  GetViewportState(device, regs, 5),
-        GetViewportState(device, regs, 6),  GetViewportState(device, regs, 7),
-        GetViewportState(device, regs, 8),  GetViewportState(device, regs, 9),
-        GetViewportState(device, regs, 10), GetViewportState(device, regs, 11),
-        GetViewportState(device, regs, 12), GetViewportState(device, regs, 13),
-        GetViewportState(device, regs, 14), GetViewportState(device, regs, 15)};
-    scheduler.Record([viewports](vk::CommandBuffer cmdbuf) { cmdbuf.SetViewport(0, viewports); });
+    // The viewport transform toggle affects every slot at once
+    const bool all_dirty = state_tracker.TouchViewportTransform();
+    std::array<bool, Maxwell::NumViewports> dirty_slots;
+    for (std::size_t index = 0; index < Maxwell::NumViewports; ++index) {
+        // Consume the slot flags even on a full update so they don't go stale
+        dirty_slots[index] = state_tracker.TouchViewport(index) || all_dirty;
+    }
+
+    // Record contiguous runs of dirty slots so single-slot changes cost single-slot updates
+    std::size_t first = 0;
+    while (first < Maxwell::NumViewports) {
+        if (!dirty_slots[first]) {
+            ++first;
+            continue;
+        }
+        std::size_t last = first + 1;
+        while (last < Maxwell::NumViewports && dirty_slots[last]) {
+            ++last;
+        }
+        std::array<VkViewport, Maxwell::NumViewports> viewports;
+        for (std::size_t index = first; index < last; ++index) {
+            viewports[index - first] = GetViewportState(has_depth_range_unrestricted, regs, index);
+        }
+        const std::size_t count = last - first;
+        scheduler.Record([viewports, first, count](vk::CommandBuffer cmdbuf) {
+            cmdbuf.SetViewport(static_cast<u32>(first), vk::Span(viewports.data(), count));
+        });
+        first = last;
+    }
 }
 
 void RasterizerVulkan::UpdateScissorsState(Tegra::Engines::Maxwell3D::Regs& regs) {
     if (!state_tracker.TouchScissors()) {
         return;
     }
-    const std::array scissors = {
-        GetScissorState(regs, 0),  GetScissorState(regs, 1),  GetScissorState(regs, 2),
-        GetScissorState(regs, 3),  GetScissorState(regs, 4),  GetScissorState(regs, 5),
-        GetScissorState(regs, 6),  GetScissorState(regs, 7),  GetScissorState(regs, 8),
-        GetScissorState(regs, 9),  GetScissorState(regs, 10), GetScissorState(regs, 11),
-        GetScissorState(regs, 12), GetScissorState(regs, 13), GetScissorState(regs, 14),
-        GetScissorState(regs, 15)};
-    scheduler.Record([scissors](vk::CommandBuffer cmdbuf) { cmdbuf.SetScissor(0, scissors); });
+    std::array<bool, Maxwell::NumViewports> dirty_slots;
+    for (std::size_t index = 0; index < Maxwell::NumViewports; ++index) {
+        dirty_slots[index] = state_tracker.TouchScissor(index);
+    }
+
+    std::size_t first = 0;
+    while (first < Maxwell::NumViewports) {
+        if (!dirty_slots[first]) {
+            ++first;
+            continue;
+        }
+        std::size_t last = first + 1;
+        while (last < Maxwell::NumViewports && dirty_slots[last]) {
+            ++last;
+        }
+        std::array<VkRect2D, Maxwell::NumViewports> scissors;
+        for (std::size_t index = first; index < last; ++index) {
+            scissors[index - first] = GetScissorState(regs, index);
+        }
+        const std::size_t count = last - first;
+        scheduler.Record([scissors, first, count](vk::CommandBuffer cmdbuf) {
+            cmdbuf.SetScissor(static_cast<u32>(first), vk::Span(scissors.data(), count));
+        });
+        first = last;
+    }
 }
 
 void RasterizerVulkan::UpdateDepthBias(Tegra::Engines::Maxwell3D::Regs& regs) {
@@ -1373,27 +1506,14 @@ std::size_t RasterizerVulkan::CalculateConstBufferSize(
 }
 
 RenderPassParams RasterizerVulkan::GetRenderPassParams(Texceptions texceptions) const {
-    const auto& regs = system.GPU().Maxwell3D().regs;
-    const std::size_t num_attachments = static_cast<std::size_t>(regs.rt_control.count);
-
-    RenderPassParams params;
-    params.color_formats = {};
+    // The texception-independent parameters are cached and only rebuilt when the render target
+    // registers are dirty, so here only the per-draw texceptions have to be folded in.
+    RenderPassParams params = renderpass_params;
     std::size_t color_texceptions = 0;
-
-    std::size_t index = 0;
-    for (std::size_t rt = 0; rt < num_attachments; ++rt) {
-        const auto& rendertarget = regs.rt[rt];
-        if (rendertarget.Address() == 0 || rendertarget.format == Tegra::RenderTargetFormat::NONE) {
-            continue;
-        }
-        params.color_formats[index] = static_cast<u8>(rendertarget.format);
-        color_texceptions |= (texceptions[rt] ? 1ULL : 0ULL) << index;
-        ++index;
+    for (std::size_t index = 0; index < params.num_color_attachments; ++index) {
+        color_texceptions |= (texceptions[renderpass_color_map[index]] ? 1ULL : 0ULL) << index;
     }
-    params.num_color_attachments = static_cast<u8>(index);
     params.texceptions = static_cast<u8>(color_texceptions);
-
-    params.zeta_format = regs.zeta_enable ? static_cast<u8>(regs.zeta.format) : 0;
     params.zeta_texception = texceptions[ZETA_TEXCEPTION_INDEX];
     return params;
 }
@@ -14,6 +14,7 @@
 #include <boost/functional/hash.hpp>
 
 #include "common/common_types.h"
+#include "common/open_hash_map.h"
 #include "video_core/rasterizer_accelerated.h"
 #include "video_core/rasterizer_interface.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
@@ -57,16 +58,24 @@ struct FramebufferCacheKey {
     u32 height = 0;
     u32 layers = 0;
     ImageViewsPack views;
+    /// Hash over everything but the renderpass, precomputed with UpdateBaseHash when the
+    /// attachments change so per-draw lookups only have to fold the renderpass in.
+    std::size_t base_hash = 0;
 
-    std::size_t Hash() const noexcept {
+    void UpdateBaseHash() noexcept {
         std::size_t hash = 0;
-        boost::hash_combine(hash, static_cast<VkRenderPass>(renderpass));
         for (const auto& view : views) {
             boost::hash_combine(hash, static_cast<VkImageView>(view));
         }
         boost::hash_combine(hash, width);
         boost::hash_combine(hash, height);
         boost::hash_combine(hash, layers);
+        base_hash = hash;
+    }
+
+    std::size_t Hash() const noexcept {
+        std::size_t hash = base_hash;
+        boost::hash_combine(hash, static_cast<VkRenderPass>(renderpass));
         return hash;
     }
 
@@ -125,10 +134,14 @@ public:
     void SignalSemaphore(GPUVAddr addr, u32 value) override;
     void SignalSyncPoint(u32 value) override;
     void ReleaseFences() override;
+    bool TryReleaseFences() override;
     void FlushAndInvalidateRegion(VAddr addr, u64 size) override;
     void WaitForIdle() override;
     void FlushCommands() override;
     void TickFrame() override;
+    bool AccelerateDMATiledToLinear(GPUVAddr src_address, GPUVAddr dst_address,
+                                    const Tegra::Engines::MaxwellDMA::Regs::Parameters& src_params,
+                                    u32 x_count, u32 y_count, u32 dst_pitch) override;
     bool AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Regs::Surface& src,
                                const Tegra::Engines::Fermi2D::Regs::Surface& dst,
                                const Tegra::Engines::Fermi2D::Config& copy_config) override;
@@ -164,6 +177,10 @@ private:
     /// @return Bitfield of attachments being used as sampled textures
     Texceptions UpdateAttachments(bool is_clear);
 
+    /// Rebuilds the cached renderpass parameters and framebuffer key from the current render
+    /// targets. Only called when the render target registers are dirty.
+    void UpdateRenderPassState();
+
     std::tuple<VkFramebuffer, VkExtent2D> ConfigureFramebuffers(VkRenderPass renderpass);
 
     /// Setups geometry buffers and state.
@@ -190,6 +207,9 @@ private:
 
     void SetupIndexBuffer(BufferBindings& buffer_bindings, DrawParameters& params, bool is_indexed);
 
+    /// Hashes the guest contents of an index buffer range to key converted index caches.
+    u64 HashIndexRange(GPUVAddr gpu_addr, std::size_t size);
+
     /// Setup constant buffers in the graphics pipeline.
     void SetupGraphicsConstBuffers(const ShaderEntries& entries, std::size_t stage);
 
@@ -226,8 +246,11 @@ private:
     /// Setup images in the compute pipeline.
     void SetupComputeImages(const ShaderEntries& entries);
 
+    /// An already uploaded buffer info can be passed through batched_info; otherwise the buffer
+    /// contents are uploaded here.
     void SetupConstBuffer(const ConstBufferEntry& entry,
-                          const Tegra::Engines::ConstBufferInfo& buffer);
+                          const Tegra::Engines::ConstBufferInfo& buffer,
+                          const VKBufferCache::BufferInfo* batched_info);
 
     void SetupGlobalBuffer(const GlobalBufferEntry& entry, GPUVAddr address);
 
@@ -270,6 +293,12 @@ private:
     StateTracker& state_tracker;
     VKScheduler& scheduler;
 
+    /// Device capabilities never change after startup; they are mirrored here once so the
+    /// per-draw paths branch on plain members instead of re-probing the device.
+    const bool has_depth_range_unrestricted;
+    const bool has_transform_feedback;
+    const bool has_index_type_uint8;
+
     VKStagingBufferPool staging_pool;
     VKDescriptorPool descriptor_pool;
     VKUpdateDescriptorQueue update_descriptor_queue;
@@ -292,13 +321,26 @@ private:
     std::array<View, Maxwell::NumRenderTargets> color_attachments;
     View zeta_attachment;
 
+    /// Renderpass parameters without texceptions folded in, rebuilt by UpdateRenderPassState.
+    RenderPassParams renderpass_params{};
+    /// Render target index for each valid color attachment, used to fold per-draw texceptions.
+    std::array<u8, Maxwell::NumRenderTargets> renderpass_color_map{};
+    /// Framebuffer key with everything but the renderpass filled in and its base hash computed.
+    FramebufferCacheKey framebuffer_key;
+    /// Render target indices attached to the framebuffer, marked in use on each draw.
+    boost::container::static_vector<u8, Maxwell::NumRenderTargets> framebuffer_color_buffers;
+    bool framebuffer_zeta = false;
+
     std::vector<ImageView> sampled_views;
     std::vector<ImageView> image_views;
 
+    /// Scratch memory to read back index buffers into when hashing them.
+    std::vector<u8> index_hash_scratch;
+
     u32 draw_counter = 0;
 
     // TODO(Rodrigo): Invalidate on image destruction
-    std::unordered_map<FramebufferCacheKey, vk::Framebuffer> framebuffer_cache;
+    Common::OpenHashMap<FramebufferCacheKey, vk::Framebuffer> framebuffer_cache{64};
 };
 
 } // namespace Vulkan
@@ -6,7 +6,7 @@
 #include <memory>
 #include <vector>
 
-#include "common/cityhash.h"
+#include "common/fast_hash.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/vk_device.h"
@@ -16,7 +16,7 @@
 namespace Vulkan {
 
 std::size_t RenderPassParams::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this);
+    const u64 hash = Common::FastHash64(this, sizeof *this);
     return static_cast<std::size_t>(hash);
 }
 
@@ -29,9 +29,8 @@ VKRenderPassCache::VKRenderPassCache(const VKDevice& device) : device{device} {}
 VKRenderPassCache::~VKRenderPassCache() = default;
 
 VkRenderPass VKRenderPassCache::GetRenderPass(const RenderPassParams& params) {
-    const auto [pair, is_cache_miss] = cache.try_emplace(params);
-    auto& entry = pair->second;
-    if (is_cache_miss) {
+    vk::RenderPass& entry = cache[params];
+    if (!entry) {
         entry = CreateRenderPass(params);
     }
     return *entry;
@@ -5,11 +5,11 @@
 #pragma once
 
 #include <type_traits>
-#include <unordered_map>
 
 #include <boost/container/static_vector.hpp>
 #include <boost/functional/hash.hpp>
 
+#include "common/open_hash_map.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/wrapper.h"
 #include "video_core/surface.h"
@@ -64,7 +64,7 @@ private:
     vk::RenderPass CreateRenderPass(const RenderPassParams& params) const;
 
     const VKDevice& device;
-    std::unordered_map<RenderPassParams, vk::RenderPass> cache;
+    Common::OpenHashMap<RenderPassParams, vk::RenderPass> cache{64};
 };
 
 } // namespace Vulkan
@@ -234,6 +234,11 @@ std::size_t VKFencedPool::CommitResource(VKFence& fence) {
     return *found;
 }
 
+bool VKFencedPool::TryCommitResource(std::size_t index, VKFence& fence) {
+    auto& watch = *watches[index];
+    return watch.IsWatchedBy(fence) || watch.TryWatch(fence);
+}
+
 std::size_t VKFencedPool::ManageOverflow() {
     const std::size_t old_capacity = watches.size();
     Grow();
@@ -259,42 +264,33 @@ VKResourceManager::VKResourceManager(const VKDevice& device) : device{device} {
 VKResourceManager::~VKResourceManager() = default;
 
 VKFence& VKResourceManager::CommitFence() {
-    const auto StepFences = [&](bool gpu_wait, bool owner_wait) -> VKFence* {
-        const auto Tick = [=](auto& fence) { return fence->Tick(gpu_wait, owner_wait); };
-        const auto hinted = fences.begin() + fences_iterator;
-
-        auto it = std::find_if(hinted, fences.end(), Tick);
-        if (it == fences.end()) {
-            it = std::find_if(fences.begin(), hinted, Tick);
-            if (it == hinted) {
-                return nullptr;
-            }
+    // Fences are recycled in tick order. Submissions to the queue complete in submission order,
+    // so only the oldest committed fences have to be polled instead of scanning the whole pool.
+    while (!commited_fences.empty() && commited_fences.front()->Tick(false, false)) {
+        free_fences.push_back(commited_fences.front());
+        commited_fences.pop_front();
+    }
+    if (free_fences.empty() && !commited_fences.empty()) {
+        // No free fence is available, wait for the oldest committed one. This can still fail when
+        // the oldest fence has not been released yet.
+        if (commited_fences.front()->Tick(true, false)) {
+            free_fences.push_back(commited_fences.front());
+            commited_fences.pop_front();
         }
-        fences_iterator = std::distance(fences.begin(), it) + 1;
-        if (fences_iterator >= fences.size())
-            fences_iterator = 0;
-
-        auto& fence = *it;
-        fence->Commit();
-        return fence.get();
-    };
-
-    VKFence* found_fence = StepFences(false, false);
-    if (!found_fence) {
-        // Try again, this time waiting.
-        found_fence = StepFences(true, false);
+    }
+    if (free_fences.empty()) {
+        LOG_INFO(Render_Vulkan, "Allocating new fences {} -> {} at tick {}", fences.size(),
+                 fences.size() + FENCES_GROW_STEP, next_fence_tick);
+        GrowFences(FENCES_GROW_STEP);
+    }
 
-        if (!found_fence) {
-            // Allocate new fences and try again.
-            LOG_INFO(Render_Vulkan, "Allocating new fences {} -> {}", fences.size(),
-                     fences.size() + FENCES_GROW_STEP);
+    VKFence* const fence = free_fences.back();
+    free_fences.pop_back();
 
-            GrowFences(FENCES_GROW_STEP);
-            found_fence = StepFences(true, false);
-            ASSERT(found_fence != nullptr);
-        }
-    }
-    return *found_fence;
+    fence->Commit();
+    fence->tick = next_fence_tick++;
+    commited_fences.push_back(fence);
+    return *fence;
 }
 
 VkCommandBuffer VKResourceManager::CommitCommandBuffer(VKFence& fence) {
@@ -307,6 +303,8 @@ void VKResourceManager::GrowFences(std::size_t new_fences_count) {
 
     std::generate(fences.begin() + previous_size, fences.end(),
                   [this] { return std::make_unique<VKFence>(device); });
+    std::for_each(fences.begin() + previous_size, fences.end(),
+                  [this](auto& fence) { free_fences.push_back(fence.get()); });
 }
 
 } // namespace Vulkan
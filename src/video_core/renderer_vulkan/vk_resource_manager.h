@@ -5,8 +5,10 @@
 #pragma once
 
 #include <cstddef>
+#include <deque>
 #include <memory>
 #include <vector>
+#include "common/common_types.h"
 #include "video_core/renderer_vulkan/wrapper.h"
 
 namespace Vulkan {
@@ -73,6 +75,12 @@ public:
         return *handle;
     }
 
+    /// Returns the tick this fence was committed at. Ticks increase monotonically with each
+    /// commit, giving every fence a position on the submission timeline.
+    u64 GetTick() const {
+        return tick;
+    }
+
 private:
     /// Take ownership of the fence.
     void Commit();
@@ -89,6 +97,7 @@ private:
     const VKDevice& device;                       ///< Device handler
     vk::Fence handle;                             ///< Vulkan fence
     std::vector<VKResource*> protected_resources; ///< List of resources protected by this fence
+    u64 tick = 0;          ///< Monotonic counter stamped by the resource manager on commit.
     bool is_owned = false; ///< The fence has been commited but not released yet.
     bool is_used = false;  ///< The fence has been commited but it has not been checked to be free.
 };
@@ -132,6 +141,11 @@ public:
         return fence != nullptr;
     }
 
+    /// Returns true when the resource is being watched by the given fence.
+    bool IsWatchedBy(const VKFence& new_fence) const {
+        return fence == &new_fence;
+    }
+
 private:
     VKFence* fence{}; ///< Fence watching this resource. nullptr when the watch is free.
 };
@@ -153,6 +167,13 @@ protected:
      */
     std::size_t CommitResource(VKFence& fence);
 
+    /**
+     * Tries to protect an already committed resource with a new fence. The caller must guarantee
+     * the contents of the resource are left untouched while it's reused.
+     * @returns True when the resource is protected, false when it's in flight under another fence.
+     */
+    bool TryCommitResource(std::size_t index, VKFence& fence);
+
     /// Called when a chunk of resources have to be allocated.
     virtual void Allocate(std::size_t begin, std::size_t end) = 0;
 
@@ -187,9 +208,11 @@ private:
     /// Allocates new fences.
     void GrowFences(std::size_t new_fences_count);
 
-    const VKDevice& device;          ///< Device handler.
-    std::size_t fences_iterator = 0; ///< Index where a free fence is likely to be found.
-    std::vector<std::unique_ptr<VKFence>> fences;           ///< Pool of fences.
+    const VKDevice& device; ///< Device handler.
+    u64 next_fence_tick = 1; ///< Monotonic counter stamped on each committed fence.
+    std::vector<std::unique_ptr<VKFence>> fences;           ///< Storage of all allocated fences.
+    std::vector<VKFence*> free_fences;                      ///< Fences ready to be committed.
+    std::deque<VKFence*> commited_fences;                   ///< Committed fences in tick order.
     std::unique_ptr<CommandBufferPool> command_buffer_pool; ///< Pool of command buffers.
 };
 
@@ -2,14 +2,20 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <array>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <thread>
 #include <utility>
 
+#include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/thread.h"
+#include "core/core.h"
+#include "core/perf_stats.h"
+#include "core/settings.h"
 #include "video_core/renderer_vulkan/vk_device.h"
 #include "video_core/renderer_vulkan/vk_query_cache.h"
 #include "video_core/renderer_vulkan/vk_resource_manager.h"
@@ -21,12 +27,13 @@ namespace Vulkan {
 
 MICROPROFILE_DECLARE(Vulkan_WaitForWorker);
 
-void VKScheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf) {
+void VKScheduler::CommandChunk::ExecuteAll(const vk::CommandBuffer& cmdbuf,
+                                           std::size_t& num_executed) {
     auto command = first;
     while (command != nullptr) {
         auto next = command->GetNext();
-        command->Execute(cmdbuf);
-        command->~Command();
+        ++num_executed;
+        command->ExecuteAndDestroy(cmdbuf);
         command = next;
     }
 
@@ -36,9 +43,21 @@ void VKScheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf) {
 }
 
 VKScheduler::VKScheduler(const VKDevice& device, VKResourceManager& resource_manager,
-                         StateTracker& state_tracker)
+                         StateTracker& state_tracker, Core::System& system)
     : device{device}, resource_manager{resource_manager}, state_tracker{state_tracker},
-      next_fence{&resource_manager.CommitFence()} {
+      system{system}, next_fence{&resource_manager.CommitFence()} {
+    timestamps_enabled =
+        Settings::values.record_frame_times && device.GetTimestampPeriod() > 0.0f;
+    if (timestamps_enabled) {
+        VkQueryPoolCreateInfo query_pool_ci;
+        query_pool_ci.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        query_pool_ci.pNext = nullptr;
+        query_pool_ci.flags = 0;
+        query_pool_ci.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        query_pool_ci.queryCount = static_cast<u32>(NUM_TIMESTAMP_SLOTS * 2);
+        query_pool_ci.pipelineStatistics = 0;
+        timestamp_pool = device.GetLogical().CreateQueryPool(query_pool_ci);
+    }
     AcquireNewChunk();
     AllocateNewContext();
     worker_thread = std::thread(&VKScheduler::WorkerThread, this);
@@ -60,6 +79,8 @@ void VKScheduler::Flush(bool release_fence, VkSemaphore semaphore) {
 
 void VKScheduler::Finish(bool release_fence, VkSemaphore semaphore) {
     SubmitExecution(semaphore);
+    // Make sure the worker thread has performed the submission before blocking on the fence.
+    WaitWorker();
     current_fence->Wait();
     if (release_fence) {
         current_fence->Release();
@@ -134,7 +155,7 @@ void VKScheduler::BindGraphicsPipeline(VkPipeline pipeline) {
 }
 
 void VKScheduler::WorkerThread() {
-    Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
+    Common::SetCurrentThreadRole(Common::ThreadRole::Renderer, "yuzu:VKScheduler");
     std::unique_lock lock{mutex};
     do {
         cv.wait(lock, [this] { return !chunk_queue.Empty() || quit; });
@@ -143,7 +164,7 @@ void VKScheduler::WorkerThread() {
         }
         auto extracted_chunk = std::move(chunk_queue.Front());
         chunk_queue.Pop();
-        extracted_chunk->ExecuteAll(current_cmdbuf);
+        extracted_chunk->ExecuteAll(current_cmdbuf, executed_command_count);
         chunk_reserve.Push(std::move(extracted_chunk));
     } while (!quit);
 }
@@ -151,49 +172,91 @@ void VKScheduler::WorkerThread() {
 void VKScheduler::SubmitExecution(VkSemaphore semaphore) {
     EndPendingOperations();
     InvalidateState();
-    WaitWorker();
-
-    std::unique_lock lock{mutex};
 
-    current_cmdbuf.End();
-
-    VkSubmitInfo submit_info;
-    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submit_info.pNext = nullptr;
-    submit_info.waitSemaphoreCount = 0;
-    submit_info.pWaitSemaphores = nullptr;
-    submit_info.pWaitDstStageMask = nullptr;
-    submit_info.commandBufferCount = 1;
-    submit_info.pCommandBuffers = current_cmdbuf.address();
-    submit_info.signalSemaphoreCount = semaphore ? 1 : 0;
-    submit_info.pSignalSemaphores = &semaphore;
-    switch (const VkResult result = device.GetGraphicsQueue().Submit(submit_info, *current_fence)) {
-    case VK_SUCCESS:
-        break;
-    case VK_ERROR_DEVICE_LOST:
-        device.ReportLoss();
-        [[fallthrough]];
-    default:
-        vk::Check(result);
+    if (timestamps_enabled) {
+        const u32 query = current_timestamp_slot * 2 + 1;
+        Record([this, query](vk::CommandBuffer cmdbuf) {
+            cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, *timestamp_pool, query);
+        });
+        const u64 issue_ns =
+            static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 Core::PerfStats::Clock::now().time_since_epoch())
+                                 .count());
+        pending_timestamps.push_back({current_timestamp_slot, issue_ns});
     }
+
+    // Submission is recorded as a regular command, so the main thread can keep recording the next
+    // execution context while the worker thread ends and submits this one.
+    VKFence* const fence = current_fence;
+    Record([this, fence, semaphore](vk::CommandBuffer cmdbuf) {
+        // This runs on the worker thread after every command of the context has executed, so the
+        // counter covers the whole submission.
+        LOG_TRACE(Render_Vulkan, "Submitting command buffer after {} recorded commands",
+                  executed_command_count);
+        executed_command_count = 0;
+
+        cmdbuf.End();
+
+        VkSubmitInfo submit_info;
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.pNext = nullptr;
+        submit_info.waitSemaphoreCount = 0;
+        submit_info.pWaitSemaphores = nullptr;
+        submit_info.pWaitDstStageMask = nullptr;
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = cmdbuf.address();
+        submit_info.signalSemaphoreCount = semaphore ? 1 : 0;
+        submit_info.pSignalSemaphores = &semaphore;
+        switch (const VkResult result = device.GetGraphicsQueue().Submit(submit_info, *fence)) {
+        case VK_SUCCESS:
+            break;
+        case VK_ERROR_DEVICE_LOST:
+            device.ReportLoss();
+            [[fallthrough]];
+        default:
+            vk::Check(result);
+        }
+    });
+    DispatchWork();
 }
 
 void VKScheduler::AllocateNewContext() {
     ++ticks;
 
-    VkCommandBufferBeginInfo cmdbuf_bi;
-    cmdbuf_bi.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    cmdbuf_bi.pNext = nullptr;
-    cmdbuf_bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-    cmdbuf_bi.pInheritanceInfo = nullptr;
-
-    std::unique_lock lock{mutex};
     current_fence = next_fence;
     next_fence = &resource_manager.CommitFence();
 
-    current_cmdbuf = vk::CommandBuffer(resource_manager.CommitCommandBuffer(*current_fence),
-                                       device.GetDispatchLoader());
-    current_cmdbuf.Begin(cmdbuf_bi);
+    // The new command buffer is committed here, but the switch to it is deferred to the worker
+    // thread. Command pools are externally synchronized, so the worker has to be the only thread
+    // recording into buffers of the pool.
+    const vk::CommandBuffer cmdbuf(resource_manager.CommitCommandBuffer(*current_fence),
+                                   device.GetDispatchLoader());
+    Record([this, cmdbuf](vk::CommandBuffer) {
+        VkCommandBufferBeginInfo cmdbuf_bi;
+        cmdbuf_bi.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        cmdbuf_bi.pNext = nullptr;
+        cmdbuf_bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        cmdbuf_bi.pInheritanceInfo = nullptr;
+
+        current_cmdbuf = cmdbuf;
+        current_cmdbuf.Begin(cmdbuf_bi);
+    });
+
+    if (timestamps_enabled) {
+        PollTimestamps();
+        current_timestamp_slot = static_cast<u32>(ticks % NUM_TIMESTAMP_SLOTS);
+        if (!pending_timestamps.empty() &&
+            pending_timestamps.front().slot == current_timestamp_slot) {
+            // The slot ring wrapped around before this result became available; drop it rather
+            // than read from a reused slot.
+            pending_timestamps.pop_front();
+        }
+        const u32 query = current_timestamp_slot * 2;
+        Record([this, query](vk::CommandBuffer cmdbuf) {
+            cmdbuf.ResetQueryPool(*timestamp_pool, query, 2);
+            cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, *timestamp_pool, query);
+        });
+    }
 
     // Enable counters once again. These are disabled when a command buffer is finished.
     if (query_cache) {
@@ -219,6 +282,25 @@ void VKScheduler::EndRenderPass() {
     Record([](vk::CommandBuffer cmdbuf) { cmdbuf.EndRenderPass(); });
 }
 
+void VKScheduler::PollTimestamps() {
+    while (!pending_timestamps.empty()) {
+        const PendingTimestamp pending = pending_timestamps.front();
+        // Results with their availability bit, interleaved as [value, available] pairs.
+        std::array<u64, 4> values;
+        const VkResult result = device.GetLogical().GetQueryResults(
+            *timestamp_pool, pending.slot * 2, 2, sizeof(values), values.data(), sizeof(u64) * 2,
+            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+        if (result == VK_NOT_READY || values[1] == 0 || values[3] == 0) {
+            // Timestamps are written in submission order, so nothing newer is ready either.
+            break;
+        }
+        const u64 duration = static_cast<u64>(static_cast<double>(values[2] - values[0]) *
+                                              static_cast<double>(device.GetTimestampPeriod()));
+        system.GetPerfStats().RecordGPUSpan("Vulkan command buffer", pending.issue_ns, duration);
+        pending_timestamps.pop_front();
+    }
+}
+
 void VKScheduler::AcquireNewChunk() {
     if (chunk_reserve.Empty()) {
         chunk = std::make_unique<CommandChunk>();
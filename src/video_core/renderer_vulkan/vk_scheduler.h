@@ -6,6 +6,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <stack>
 #include <thread>
@@ -14,6 +15,10 @@
 #include "common/threadsafe_queue.h"
 #include "video_core/renderer_vulkan/wrapper.h"
 
+namespace Core {
+class System;
+}
+
 namespace Vulkan {
 
 class StateTracker;
@@ -44,10 +49,11 @@ private:
 class VKScheduler {
 public:
     explicit VKScheduler(const VKDevice& device, VKResourceManager& resource_manager,
-                         StateTracker& state_tracker);
+                         StateTracker& state_tracker, Core::System& system);
     ~VKScheduler();
 
-    /// Sends the current execution context to the GPU.
+    /// Sends the current execution context to the GPU. Command buffer submission happens on the
+    /// worker thread, so this does not wait for previously recorded work to finish.
     void Flush(bool release_fence = true, VkSemaphore semaphore = nullptr);
 
     /// Sends the current execution context to the GPU and waits for it to complete.
@@ -99,9 +105,12 @@ public:
 private:
     class Command {
     public:
-        virtual ~Command() = default;
-
-        virtual void Execute(vk::CommandBuffer cmdbuf) const = 0;
+        /// Executes the command and runs its destructor. Commands are dispatched through a plain
+        /// function pointer instead of a vtable, since the worker thread walks tens of thousands
+        /// of them per frame and the destructor can be folded into the same indirect call.
+        void ExecuteAndDestroy(vk::CommandBuffer cmdbuf) {
+            execute_and_destroy(this, cmdbuf);
+        }
 
         Command* GetNext() const {
             return next;
@@ -111,30 +120,41 @@ private:
             next = next_;
         }
 
+    protected:
+        using ExecuteAndDestroyFn = void (*)(Command*, vk::CommandBuffer);
+
+        explicit Command(ExecuteAndDestroyFn execute_and_destroy_)
+            : execute_and_destroy{execute_and_destroy_} {}
+
     private:
+        ExecuteAndDestroyFn execute_and_destroy;
         Command* next = nullptr;
     };
 
     template <typename T>
     class TypedCommand final : public Command {
     public:
-        explicit TypedCommand(T&& command) : command{std::move(command)} {}
-        ~TypedCommand() override = default;
+        explicit TypedCommand(T&& command)
+            : Command{&TypedCommand::Invoke}, command{std::move(command)} {}
 
         TypedCommand(TypedCommand&&) = delete;
         TypedCommand& operator=(TypedCommand&&) = delete;
 
-        void Execute(vk::CommandBuffer cmdbuf) const override {
-            command(cmdbuf);
+    private:
+        static void Invoke(Command* base, vk::CommandBuffer cmdbuf) {
+            auto* const typed = static_cast<TypedCommand*>(base);
+            typed->command(cmdbuf);
+            typed->~TypedCommand();
         }
 
-    private:
         T command;
     };
 
     class CommandChunk final {
     public:
-        void ExecuteAll(vk::CommandBuffer cmdbuf);
+        /// Executes every recorded command, bumping num_executed as each one runs so a command
+        /// reading the counter sees everything recorded before itself.
+        void ExecuteAll(const vk::CommandBuffer& cmdbuf, std::size_t& num_executed);
 
         template <typename T>
         bool Record(T& command) {
@@ -185,9 +205,13 @@ private:
 
     void AcquireNewChunk();
 
+    /// Reads back finished command buffer timestamps without stalling and reports them.
+    void PollTimestamps();
+
     const VKDevice& device;
     VKResourceManager& resource_manager;
     StateTracker& state_tracker;
+    Core::System& system;
 
     VKQueryCache* query_cache = nullptr;
 
@@ -202,9 +226,28 @@ private:
         VkPipeline graphics_pipeline = nullptr;
     } state;
 
+    /// Number of command buffer timestamp slots; each slot holds a start/end query pair.
+    static constexpr std::size_t NUM_TIMESTAMP_SLOTS = 64;
+
+    /// A submitted command buffer whose timestamp pair has not been read back yet.
+    struct PendingTimestamp {
+        u32 slot;
+        u64 issue_ns;
+    };
+
+    /// Timestamp query pool, only created while frame time recording is enabled.
+    vk::QueryPool timestamp_pool;
+    std::deque<PendingTimestamp> pending_timestamps;
+    u32 current_timestamp_slot = 0;
+    bool timestamps_enabled = false;
+
     std::unique_ptr<CommandChunk> chunk;
     std::thread worker_thread;
 
+    /// Number of commands executed since the last submission. Only touched by the worker thread,
+    /// logged and reset when the submission command runs.
+    std::size_t executed_command_count = 0;
+
     Common::SPSCQueue<std::unique_ptr<CommandChunk>> chunk_queue;
     Common::SPSCQueue<std::unique_ptr<CommandChunk>> chunk_reserve;
     std::mutex mutex;
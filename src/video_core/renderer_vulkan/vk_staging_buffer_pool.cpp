@@ -56,16 +56,37 @@ void VKStagingBufferPool::TickFrame() {
 
     ReleaseCache(true);
     ReleaseCache(false);
+
+    // Asset streaming titles can queue up gigabytes of staging memory in a burst that the
+    // round-robin deletion above only reclaims slowly. When a cache exceeds the watermark, trim
+    // the least recently used buffers back to the driver until it fits again.
+    TrimToWatermark(true);
+    TrimToWatermark(false);
 }
 
 VKBuffer* VKStagingBufferPool::TryGetReservedBuffer(std::size_t size, bool host_visible) {
-    for (auto& entry : GetCache(host_visible)[Common::Log2Ceil64(size)].entries) {
-        if (entry.watch.TryWatch(scheduler.GetFence())) {
-            entry.last_epoch = epoch;
-            return &*entry.buffer;
+    auto& staging = GetCache(host_visible)[Common::Log2Ceil64(size)];
+    auto& entries = staging.entries;
+    const auto search = [&](std::size_t begin, std::size_t end) -> VKBuffer* {
+        for (std::size_t index = begin; index < end; ++index) {
+            auto& entry = entries[index];
+            if (entry.watch.TryWatch(scheduler.GetFence())) {
+                entry.last_epoch = epoch;
+                staging.free_index = index + 1;
+                return &*entry.buffer;
+            }
         }
+        return nullptr;
+    };
+    // Buffers are released in fence order, so the entry after the last commit is highly likely
+    // to be free. Search from there and wrap around.
+    if (staging.free_index >= entries.size()) {
+        staging.free_index = 0;
     }
-    return nullptr;
+    if (VKBuffer* const buffer = search(staging.free_index, entries.size())) {
+        return buffer;
+    }
+    return search(0, staging.free_index);
 }
 
 VKBuffer& VKStagingBufferPool::CreateStagingBuffer(std::size_t size, bool host_visible) {
@@ -103,6 +124,55 @@ void VKStagingBufferPool::ReleaseCache(bool host_visible) {
     }
 }
 
+void VKStagingBufferPool::TrimToWatermark(bool host_visible) {
+    static constexpr u64 watermark_size = 256ULL << 20;
+
+    auto& cache = GetCache(host_visible);
+    u64 total_size = 0;
+    for (std::size_t log2 = 0; log2 < NumLevels; ++log2) {
+        total_size += (1ULL << log2) * cache[log2].entries.size();
+    }
+    if (total_size <= watermark_size) {
+        return;
+    }
+
+    // Gather the age and size of every buffer not in flight and find the epoch cutoff that
+    // brings the cache back under the watermark when everything at least that old is released.
+    std::vector<std::pair<u64, u64>> candidates;
+    for (std::size_t log2 = 0; log2 < NumLevels; ++log2) {
+        for (const auto& entry : cache[log2].entries) {
+            if (!entry.watch.IsUsed()) {
+                candidates.emplace_back(entry.last_epoch, 1ULL << log2);
+            }
+        }
+    }
+    if (candidates.empty()) {
+        return;
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    u64 cutoff_epoch = 0;
+    for (const auto& [candidate_epoch, size] : candidates) {
+        cutoff_epoch = candidate_epoch;
+        total_size -= size;
+        if (total_size <= watermark_size) {
+            break;
+        }
+    }
+
+    for (std::size_t log2 = 0; log2 < NumLevels; ++log2) {
+        auto& staging = cache[log2];
+        auto& entries = staging.entries;
+        const auto is_trimmable = [this, cutoff_epoch](const StagingBuffer& entry) {
+            return !entry.watch.IsUsed() && entry.last_epoch <= cutoff_epoch;
+        };
+        entries.erase(std::remove_if(entries.begin(), entries.end(), is_trimmable), entries.end());
+        if (staging.delete_index >= entries.size()) {
+            staging.delete_index = 0;
+        }
+    }
+}
+
 u64 VKStagingBufferPool::ReleaseLevel(StagingBuffersCache& cache, std::size_t log2) {
     static constexpr std::size_t deletions_per_tick = 16;
 
@@ -51,6 +51,7 @@ private:
     struct StagingBuffers final {
         std::vector<StagingBuffer> entries;
         std::size_t delete_index = 0;
+        std::size_t free_index = 0;
     };
 
     static constexpr std::size_t NumLevels = sizeof(std::size_t) * CHAR_BIT;
@@ -64,6 +65,8 @@ private:
 
     void ReleaseCache(bool host_visible);
 
+    void TrimToWatermark(bool host_visible);
+
     u64 ReleaseLevel(StagingBuffersCache& cache, std::size_t log2);
 
     const VKDevice& device;
@@ -31,22 +31,41 @@ using Flags = Maxwell3D::DirtyState::Flags;
 Flags MakeInvalidationFlags() {
     Flags flags{};
     flags[Viewports] = true;
+    flags[ViewportTransform] = true;
     flags[Scissors] = true;
     flags[DepthBias] = true;
     flags[BlendConstants] = true;
     flags[DepthBounds] = true;
     flags[StencilProperties] = true;
+    for (std::size_t i = 0; i < Regs::NumViewports; ++i) {
+        flags[Viewport0 + i] = true;
+        flags[Scissor0 + i] = true;
+    }
     return flags;
 }
 
 void SetupDirtyViewports(Tables& tables) {
-    FillBlock(tables[0], OFF(viewport_transform), NUM(viewport_transform), Viewports);
-    FillBlock(tables[0], OFF(viewports), NUM(viewports), Viewports);
-    tables[0][OFF(viewport_transform_enabled)] = Viewports;
+    for (std::size_t i = 0; i < Regs::NumViewports; ++i) {
+        const std::size_t transf_offset = OFF(viewport_transform) + i * NUM(viewport_transform[0]);
+        const std::size_t viewport_offset = OFF(viewports) + i * NUM(viewports[0]);
+
+        FillBlock(tables[0], transf_offset, NUM(viewport_transform[0]), Viewport0 + i);
+        FillBlock(tables[0], viewport_offset, NUM(viewports[0]), Viewport0 + i);
+    }
+
+    FillBlock(tables[1], OFF(viewport_transform), NUM(viewport_transform), Viewports);
+    FillBlock(tables[1], OFF(viewports), NUM(viewports), Viewports);
+
+    tables[0][OFF(viewport_transform_enabled)] = ViewportTransform;
+    tables[1][OFF(viewport_transform_enabled)] = Viewports;
 }
 
 void SetupDirtyScissors(Tables& tables) {
-    FillBlock(tables[0], OFF(scissor_test), NUM(scissor_test), Scissors);
+    for (std::size_t i = 0; i < Regs::NumViewports; ++i) {
+        const std::size_t offset = OFF(scissor_test) + i * NUM(scissor_test[0]);
+        FillBlock(tables[0], offset, NUM(scissor_test[0]), Scissor0 + i);
+    }
+    FillBlock(tables[1], OFF(scissor_test), NUM(scissor_test), Scissors);
 }
 
 void SetupDirtyDepthBias(Tables& tables) {
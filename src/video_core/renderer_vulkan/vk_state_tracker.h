@@ -20,7 +20,14 @@ enum : u8 {
     First = VideoCommon::Dirty::LastCommonEntry,
 
     Viewports,
+    ViewportTransform,
+    Viewport0,
+    Viewport15 = Viewport0 + 15,
+
     Scissors,
+    Scissor0,
+    Scissor15 = Scissor0 + 15,
+
     DepthBias,
     BlendConstants,
     DepthBounds,
@@ -44,10 +51,23 @@ public:
         return Exchange(Dirty::Viewports, false);
     }
 
+    /// Signals that the viewport transform toggle changed, forcing all slots to be updated.
+    bool TouchViewportTransform() {
+        return Exchange(Dirty::ViewportTransform, false);
+    }
+
+    bool TouchViewport(std::size_t index) {
+        return Exchange(Dirty::Viewport0 + index, false);
+    }
+
     bool TouchScissors() {
         return Exchange(Dirty::Scissors, false);
     }
 
+    bool TouchScissor(std::size_t index) {
+        return Exchange(Dirty::Scissor0 + index, false);
+    }
+
     bool TouchDepthBias() {
         return Exchange(Dirty::DepthBias, false);
     }
@@ -10,6 +10,7 @@
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "core/core.h"
+#include "core/settings.h"
 #include "core/frontend/framebuffer_layout.h"
 #include "video_core/renderer_vulkan/vk_device.h"
 #include "video_core/renderer_vulkan/vk_resource_manager.h"
@@ -36,9 +37,19 @@ VkSurfaceFormatKHR ChooseSwapSurfaceFormat(vk::Span<VkSurfaceFormatKHR> formats,
 }
 
 VkPresentModeKHR ChooseSwapPresentMode(vk::Span<VkPresentModeKHR> modes) {
-    // Mailbox doesn't lock the application like fifo (vsync), prefer it
-    const auto found = std::find(modes.begin(), modes.end(), VK_PRESENT_MODE_MAILBOX_KHR);
-    return found != modes.end() ? *found : VK_PRESENT_MODE_FIFO_KHR;
+    if (!Settings::values.use_vsync) {
+        // Mailbox doesn't lock the application like fifo (vsync), prefer it when the user asked
+        // for vsync to be disabled
+        if (std::find(modes.begin(), modes.end(), VK_PRESENT_MODE_MAILBOX_KHR) != modes.end()) {
+            return VK_PRESENT_MODE_MAILBOX_KHR;
+        }
+        // Immediate can tear, but it's the only unlocked mode left on this driver
+        if (std::find(modes.begin(), modes.end(), VK_PRESENT_MODE_IMMEDIATE_KHR) != modes.end()) {
+            return VK_PRESENT_MODE_IMMEDIATE_KHR;
+        }
+    }
+    // Fifo is always available
+    return VK_PRESENT_MODE_FIFO_KHR;
 }
 
 VkExtent2D ChooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabilities, u32 width, u32 height) {
@@ -133,6 +144,11 @@ bool VKSwapchain::HasFramebufferChanged(const Layout::FramebufferLayout& framebu
     return framebuffer.width != current_width || framebuffer.height != current_height;
 }
 
+bool VKSwapchain::NeedsPresentModeUpdate() const {
+    // Toggling vsync at runtime moves the preference between fifo and mailbox/immediate
+    return present_mode != ChooseSwapPresentMode(available_present_modes);
+}
+
 void VKSwapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities, u32 width,
                                   u32 height, bool srgb) {
     const auto physical_device{device.GetPhysical()};
@@ -140,7 +156,9 @@ void VKSwapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities,
     const auto present_modes{physical_device.GetSurfacePresentModesKHR(surface)};
 
     const VkSurfaceFormatKHR surface_format{ChooseSwapSurfaceFormat(formats, srgb)};
-    const VkPresentModeKHR present_mode{ChooseSwapPresentMode(present_modes)};
+    present_mode = ChooseSwapPresentMode(present_modes);
+    available_present_modes.assign(present_modes.begin(), present_modes.end());
+    LOG_INFO(Render_Vulkan, "Presenting with mode {}", static_cast<u32>(present_mode));
 
     u32 requested_image_count{capabilities.minImageCount + 1};
     if (capabilities.maxImageCount > 0 && requested_image_count > capabilities.maxImageCount) {
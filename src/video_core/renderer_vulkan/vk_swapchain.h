@@ -36,6 +36,9 @@ public:
     /// Returns true when the framebuffer layout has changed.
     bool HasFramebufferChanged(const Layout::FramebufferLayout& framebuffer) const;
 
+    /// Returns true when the vsync setting no longer matches the swapchain's present mode.
+    bool NeedsPresentModeUpdate() const;
+
     VkExtent2D GetSize() const {
         return extent;
     }
@@ -93,6 +96,9 @@ private:
     u32 current_width{};
     u32 current_height{};
     bool current_srgb{};
+
+    VkPresentModeKHR present_mode{};
+    std::vector<VkPresentModeKHR> available_present_modes;
 };
 
 } // namespace Vulkan
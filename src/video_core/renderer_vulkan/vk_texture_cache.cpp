@@ -134,6 +134,10 @@ VkImageCreateInfo GenerateImageCreateInfo(const VKDevice& device, const SurfaceP
     ci.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
     ci.pNext = nullptr;
     ci.flags = 0;
+    if (!params.IsPixelFormatZeta()) {
+        // Color formats can be reinterpreted by views within their compatibility class.
+        ci.flags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
+    }
     ci.imageType = SurfaceTargetToImage(params.target);
     ci.format = format;
     ci.mipLevels = params.num_levels;
@@ -267,6 +271,9 @@ View CachedSurface::CreateView(const ViewParams& params) {
 }
 
 void CachedSurface::UploadBuffer(const std::vector<u8>& staging_buffer) {
+    if (!ShouldUploadLevel(0)) {
+        return;
+    }
     const auto& src_buffer = staging_pool.GetUnusedBuffer(host_memory_size, true);
     std::memcpy(src_buffer.commit->Map(host_memory_size), staging_buffer.data(), host_memory_size);
 
@@ -303,6 +310,9 @@ void CachedSurface::UploadImage(const std::vector<u8>& staging_buffer) {
                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
     for (u32 level = 0; level < params.num_levels; ++level) {
+        if (!ShouldUploadLevel(level)) {
+            continue;
+        }
         const VkBufferImageCopy copy = GetBufferImageCopy(level);
         if (image->GetAspectMask() == (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) {
             scheduler.Record([buffer = *src_buffer.handle, image = *image->GetHandle(),
@@ -352,6 +362,11 @@ CachedSurfaceView::CachedSurfaceView(const VKDevice& device, CachedSurface& surf
       image{surface.GetImageHandle()}, buffer_view{surface.GetBufferViewHandle()},
       aspect_mask{surface.GetAspectMask()}, device{device}, surface{surface},
       base_level{params.base_level}, num_levels{params.num_levels},
+      format_override{params.pixel_format == VideoCore::Surface::PixelFormat::Invalid
+                          ? VK_FORMAT_UNDEFINED
+                          : MaxwellToVK::SurfaceFormat(device, FormatType::Optimal,
+                                                       params.pixel_format)
+                                .format},
       image_view_type{image ? GetImageViewType(params.target) : VK_IMAGE_VIEW_TYPE_1D} {
     if (image_view_type == VK_IMAGE_VIEW_TYPE_3D) {
         base_layer = 0;
@@ -424,7 +439,8 @@ VkImageView CachedSurfaceView::GetImageView(SwizzleSource x_source, SwizzleSourc
     ci.flags = 0;
     ci.image = surface.GetImageHandle();
     ci.viewType = image_view_type;
-    ci.format = surface.GetImage().GetFormat();
+    ci.format =
+        format_override != VK_FORMAT_UNDEFINED ? format_override : surface.GetImage().GetFormat();
     ci.components = {swizzle[0], swizzle[1], swizzle[2], swizzle[3]};
     ci.subresourceRange.aspectMask = aspect;
     ci.subresourceRange.baseMipLevel = base_level;
@@ -446,7 +462,8 @@ VkImageView CachedSurfaceView::GetAttachment() {
     ci.pNext = nullptr;
     ci.flags = 0;
     ci.image = surface.GetImageHandle();
-    ci.format = surface.GetImage().GetFormat();
+    ci.format =
+        format_override != VK_FORMAT_UNDEFINED ? format_override : surface.GetImage().GetFormat();
     ci.components = {VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY,
                      VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY};
     ci.subresourceRange.aspectMask = aspect_mask;
@@ -568,9 +585,92 @@ void VKTextureCache::ImageBlit(View& src_view, View& dst_view,
 }
 
 void VKTextureCache::BufferCopy(Surface& src_surface, Surface& dst_surface) {
-    // Currently unimplemented. PBO copies should be dropped and we should use a render pass to
-    // convert from color to depth and viceversa.
-    LOG_WARNING(Render_Vulkan, "Unimplemented");
+    // Reinterpretation copies can't go through vkCmdCopyImage when the formats are incompatible
+    // (e.g. between color and depth). Route the raw bytes through a device local staging buffer,
+    // mirroring what the OpenGL backend does with a pixel buffer object; the copy never leaves
+    // the device.
+    const auto& src_params = src_surface->GetSurfaceParams();
+    const auto& dst_params = dst_surface->GetSurfaceParams();
+    UNIMPLEMENTED_IF(src_params.num_levels > 1 || dst_params.num_levels > 1);
+    UNIMPLEMENTED_IF(src_params.IsBuffer() || dst_params.IsBuffer());
+
+    // We can't copy images to buffers inside a renderpass
+    scheduler.RequestOutsideRenderPassOperationContext();
+
+    src_surface->FullTransition(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+                                VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    dst_surface->FullTransition(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    const std::size_t buffer_size =
+        std::max(src_surface->GetHostSizeInBytes(), dst_surface->GetHostSizeInBytes());
+    const auto& buffer = staging_pool.GetUnusedBuffer(buffer_size, false);
+
+    const auto make_copy = [](const Surface& surface) {
+        const auto& params = surface->GetSurfaceParams();
+        VkBufferImageCopy copy;
+        copy.bufferOffset = 0;
+        copy.bufferRowLength = 0;
+        copy.bufferImageHeight = 0;
+        copy.imageSubresource.aspectMask = surface->GetAspectMask();
+        copy.imageSubresource.mipLevel = 0;
+        copy.imageSubresource.baseArrayLayer = 0;
+        copy.imageSubresource.layerCount = static_cast<u32>(params.GetNumLayers());
+        copy.imageOffset.x = 0;
+        copy.imageOffset.y = 0;
+        copy.imageOffset.z = 0;
+        copy.imageExtent.width = params.GetMipWidth(0);
+        copy.imageExtent.height = params.GetMipHeight(0);
+        copy.imageExtent.depth =
+            params.target == SurfaceTarget::Texture3D ? params.GetMipDepth(0) : 1;
+        return copy;
+    };
+
+    scheduler.Record([src_image = src_surface->GetImageHandle(), buffer = *buffer.handle,
+                      copy = make_copy(src_surface)](vk::CommandBuffer cmdbuf) {
+        if (copy.imageSubresource.aspectMask ==
+            (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) {
+            std::array<VkBufferImageCopy, 2> copies = {copy, copy};
+            copies[0].imageSubresource.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+            copies[1].imageSubresource.aspectMask = VK_IMAGE_ASPECT_STENCIL_BIT;
+            for (const VkBufferImageCopy& aspect_copy : copies) {
+                cmdbuf.CopyImageToBuffer(src_image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer,
+                                         aspect_copy);
+            }
+        } else {
+            cmdbuf.CopyImageToBuffer(src_image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer,
+                                     copy);
+        }
+    });
+
+    scheduler.Record([dst_image = dst_surface->GetImageHandle(), buffer = *buffer.handle,
+                      size = buffer_size,
+                      copy = make_copy(dst_surface)](vk::CommandBuffer cmdbuf) {
+        VkBufferMemoryBarrier barrier;
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.pNext = nullptr;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = buffer;
+        barrier.offset = 0;
+        barrier.size = size;
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                               {}, barrier, {});
+
+        if (copy.imageSubresource.aspectMask ==
+            (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) {
+            std::array<VkBufferImageCopy, 2> copies = {copy, copy};
+            copies[0].imageSubresource.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+            copies[1].imageSubresource.aspectMask = VK_IMAGE_ASPECT_STENCIL_BIT;
+            cmdbuf.CopyBufferToImage(buffer, dst_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                     copies);
+        } else {
+            cmdbuf.CopyBufferToImage(buffer, dst_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                     copy);
+        }
+    });
 }
 
 } // namespace Vulkan
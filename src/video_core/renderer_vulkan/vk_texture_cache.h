@@ -186,6 +186,8 @@ private:
     CachedSurface& surface;
     const u32 base_level;
     const u32 num_levels;
+    /// Format the view reinterprets the image with, VK_FORMAT_UNDEFINED to use the image format.
+    const VkFormat format_override;
     const VkImageViewType image_view_type;
     u32 base_layer = 0;
     u32 num_layers = 0;
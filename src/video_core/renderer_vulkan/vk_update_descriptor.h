@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <utility>
 #include <variant>
 #include <boost/container/static_vector.hpp>
 
@@ -40,6 +41,11 @@ public:
 
     void Send(VkDescriptorUpdateTemplateKHR update_template, VkDescriptorSet set);
 
+    /// Returns the entries recorded since the last call to Acquire.
+    std::pair<const DescriptorUpdateEntry*, std::size_t> CurrentPayload() const {
+        return {upload_start, static_cast<std::size_t>(&*payload.end() - upload_start)};
+    }
+
     void AddSampledImage(VkSampler sampler, VkImageView image_view) {
         payload.emplace_back(VkDescriptorImageInfo{sampler, image_view, {}});
     }
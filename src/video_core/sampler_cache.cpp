@@ -2,7 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
-#include "common/cityhash.h"
+#include "common/fast_hash.h"
 #include "common/common_types.h"
 #include "video_core/sampler_cache.h"
 
@@ -11,7 +11,7 @@ namespace VideoCommon {
 std::size_t SamplerCacheKey::Hash() const {
     static_assert(sizeof(raw) % sizeof(u64) == 0);
     return static_cast<std::size_t>(
-        Common::CityHash64(reinterpret_cast<const char*>(raw.data()), sizeof(raw) / sizeof(u64)));
+        Common::FastHash64(raw.data(), sizeof(raw) / sizeof(u64)));
 }
 
 bool SamplerCacheKey::operator==(const SamplerCacheKey& rhs) const {
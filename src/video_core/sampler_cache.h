@@ -5,8 +5,11 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
 #include <unordered_map>
+#include <vector>
 
+#include "common/common_types.h"
 #include "video_core/textures/texture.h"
 
 namespace VideoCommon {
@@ -48,13 +51,48 @@ public:
         return ToSamplerType(sampler);
     }
 
+    /// Returns the sampler for a TSC entry through a handle table indexed by its index in the
+    /// sampler pool. Table hits validate the raw TSC bytes the caller already fetched and skip
+    /// the hash and map lookup of GetSampler; sampler churn is near zero after warmup, so this
+    /// is the common path for per-draw bindings.
+    SamplerType GetSampler(const Tegra::Texture::TSCEntry& tsc, u32 tsc_index) {
+        if (tsc_index >= table.size()) {
+            table.resize(tsc_index + 1);
+        }
+        TableEntry& entry = table[tsc_index];
+        if (entry.generation == generation &&
+            std::memcmp(&entry.tsc, &tsc, sizeof(tsc)) == 0) {
+            return entry.sampler;
+        }
+        const SamplerType sampler = GetSampler(tsc);
+        entry.generation = generation;
+        entry.tsc = tsc;
+        entry.sampler = sampler;
+        return sampler;
+    }
+
+    /// Invalidates every handle table slot in constant time. Cached samplers stay valid; only
+    /// the index-to-sampler associations are dropped. Required if a backend ever releases its
+    /// sampler storage, since table hits would otherwise return the freed handles.
+    void InvalidateSamplerTable() {
+        ++generation;
+    }
+
 protected:
     virtual SamplerStorageType CreateSampler(const Tegra::Texture::TSCEntry& tsc) const = 0;
 
     virtual SamplerType ToSamplerType(const SamplerStorageType& sampler) const = 0;
 
 private:
+    struct TableEntry {
+        Tegra::Texture::TSCEntry tsc{};
+        SamplerType sampler{};
+        u64 generation = 0;
+    };
+
     std::unordered_map<SamplerCacheKey, SamplerStorageType> cache;
+    std::vector<TableEntry> table;
+    u64 generation = 1;
 };
 
 } // namespace VideoCommon
\ No newline at end of file
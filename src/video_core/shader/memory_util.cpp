@@ -5,9 +5,8 @@
 #include <algorithm>
 #include <cstddef>
 
-#include <boost/container_hash/hash.hpp>
-
 #include "common/common_types.h"
+#include "common/fast_hash.h"
 #include "core/core.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/memory_manager.h"
@@ -66,12 +65,13 @@ ProgramCode GetShaderCode(Tegra::MemoryManager& memory_manager, GPUVAddr gpu_add
 
 u64 GetUniqueIdentifier(Tegra::Engines::ShaderType shader_type, bool is_a, const ProgramCode& code,
                         const ProgramCode& code_b) {
-    size_t unique_identifier = boost::hash_value(code);
+    u64 unique_identifier = Common::FastHash64(code.data(), code.size() * sizeof(u64));
     if (is_a) {
         // VertexA programs include two programs
-        boost::hash_combine(unique_identifier, boost::hash_value(code_b));
+        unique_identifier =
+            Common::FastHash64(code_b.data(), code_b.size() * sizeof(u64), unique_identifier);
     }
-    return static_cast<u64>(unique_identifier);
+    return unique_identifier;
 }
 
 } // namespace VideoCommon::Shader
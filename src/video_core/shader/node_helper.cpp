@@ -3,14 +3,51 @@
 // Refer to the license.txt file included.
 
 #include <cstring>
+#include <memory>
 #include <vector>
 
+#include "common/alignment.h"
 #include "common/common_types.h"
 #include "video_core/shader/node_helper.h"
 #include "video_core/shader/shader_ir.h"
 
 namespace VideoCommon::Shader {
 
+namespace {
+thread_local NodeArena* current_arena = nullptr;
+} // Anonymous namespace
+
+NodeArena::NodeArena() = default;
+
+NodeArena::~NodeArena() = default;
+
+void* NodeArena::Allocate(std::size_t size, std::size_t alignment) {
+    page_offset = Common::AlignUp(page_offset, alignment);
+    if (page_offset + size > PageSize) {
+        if (size > PageSize) {
+            // Oversized allocations get a dedicated page, keeping the bump page usable
+            return pages.insert(pages.begin(), std::make_unique<u8[]>(size))->get();
+        }
+        pages.push_back(std::make_unique<u8[]>(PageSize));
+        page_offset = 0;
+    }
+    u8* const result = pages.back().get() + page_offset;
+    page_offset += size;
+    return result;
+}
+
+NodeArena* NodeArena::Current() {
+    return current_arena;
+}
+
+NodeArena::Scope::Scope(NodeArena& arena) : previous{current_arena} {
+    current_arena = &arena;
+}
+
+NodeArena::Scope::~Scope() {
+    current_arena = previous;
+}
+
 Node Conditional(Node condition, std::vector<Node> code) {
     return MakeNode<ConditionalNode>(std::move(condition), std::move(code));
 }
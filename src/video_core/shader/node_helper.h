@@ -16,6 +16,82 @@
 
 namespace VideoCommon::Shader {
 
+/**
+ * Page based arena that backs node allocations while a ShaderIR is being decoded. Nodes keep
+ * their shared_ptr semantics, but all of them live in pages owned by the arena and deallocation
+ * is a no-op, so decoding skips one heap round trip per node and the whole graph is released in
+ * one shot when the arena dies. The arena must outlive every node allocated from it.
+ */
+class NodeArena {
+public:
+    explicit NodeArena();
+    ~NodeArena();
+
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    /// Allocates uninitialized storage. Memory is released when the arena is destroyed.
+    void* Allocate(std::size_t size, std::size_t alignment);
+
+    /// Returns the arena active in the current thread, or nullptr when there is none.
+    static NodeArena* Current();
+
+    /// Makes an arena the active one in the current thread while in scope.
+    class Scope {
+    public:
+        explicit Scope(NodeArena& arena);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        NodeArena* previous;
+    };
+
+private:
+    static constexpr std::size_t PageSize = 64 * 1024;
+
+    std::vector<std::unique_ptr<u8[]>> pages;
+    std::size_t page_offset = PageSize;
+};
+
+/// Standard allocator adaptor handing out memory from a node arena.
+template <typename T>
+class NodeArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit NodeArenaAllocator(NodeArena& arena) : arena{&arena} {}
+
+    template <typename U>
+    NodeArenaAllocator(const NodeArenaAllocator<U>& rhs) : arena{rhs.arena} {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) noexcept {
+        // Memory is released when the arena is destroyed
+    }
+
+    template <typename U>
+    bool operator==(const NodeArenaAllocator<U>& rhs) const noexcept {
+        return arena == rhs.arena;
+    }
+
+    template <typename U>
+    bool operator!=(const NodeArenaAllocator<U>& rhs) const noexcept {
+        return !operator==(rhs);
+    }
+
+private:
+    template <typename U>
+    friend class NodeArenaAllocator;
+
+    NodeArena* arena;
+};
+
 /// This arithmetic operation cannot be constraint
 inline constexpr MetaArithmetic PRECISE = {true};
 /// This arithmetic operation can be optimized away
@@ -42,6 +118,10 @@ OperationCode SignedToUnsignedCode(OperationCode operation_code, bool is_signed)
 template <typename T, typename... Args>
 Node MakeNode(Args&&... args) {
     static_assert(std::is_convertible_v<T, NodeData>);
+    if (NodeArena* const arena = NodeArena::Current()) {
+        return std::allocate_shared<NodeData>(NodeArenaAllocator<NodeData>{*arena},
+                                              T(std::forward<Args>(args)...));
+    }
     return std::make_shared<NodeData>(T(std::forward<Args>(args)...));
 }
 
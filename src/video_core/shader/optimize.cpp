@@ -0,0 +1,238 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <optional>
+#include <variant>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/shader/node.h"
+#include "video_core/shader/optimize.h"
+
+namespace VideoCommon::Shader {
+
+namespace {
+
+f32 BitsToFloat(u32 value) {
+    f32 result;
+    std::memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+u32 FloatToBits(f32 value) {
+    u32 result;
+    std::memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+/// Returns the value of an immediate node, or nullopt for any other node.
+std::optional<u32> GetImmediate(const Node& node) {
+    if (const auto immediate = std::get_if<ImmediateNode>(node.get())) {
+        return immediate->GetValue();
+    }
+    return std::nullopt;
+}
+
+bool IsPrecise(const OperationNode& operation) {
+    if (const auto arithmetic = std::get_if<MetaArithmetic>(&operation.GetMeta())) {
+        return arithmetic->precise;
+    }
+    return false;
+}
+
+/// Evaluates an operation whose operands are all immediates. Only side effect free operations
+/// with well defined results are folded; everything else returns nullopt.
+std::optional<u32> FoldOperation(const OperationNode& operation, const std::vector<u32>& imms) {
+    const auto Signed = [](u32 value) { return static_cast<s32>(value); };
+    switch (operation.GetCode()) {
+    case OperationCode::IAdd:
+    case OperationCode::UAdd:
+        return imms[0] + imms[1];
+    case OperationCode::IMul:
+    case OperationCode::UMul:
+        return imms[0] * imms[1];
+    case OperationCode::UDiv:
+        return imms[1] == 0 ? std::optional<u32>{} : std::optional<u32>{imms[0] / imms[1]};
+    case OperationCode::INegate:
+        return static_cast<u32>(-Signed(imms[0]));
+    case OperationCode::IAbsolute:
+        return static_cast<u32>(std::abs(Signed(imms[0])));
+    case OperationCode::IMin:
+        return static_cast<u32>(std::min(Signed(imms[0]), Signed(imms[1])));
+    case OperationCode::IMax:
+        return static_cast<u32>(std::max(Signed(imms[0]), Signed(imms[1])));
+    case OperationCode::UMin:
+        return std::min(imms[0], imms[1]);
+    case OperationCode::UMax:
+        return std::max(imms[0], imms[1]);
+    case OperationCode::ILogicalShiftLeft:
+    case OperationCode::ULogicalShiftLeft:
+        return imms[0] << (imms[1] & 31);
+    case OperationCode::ILogicalShiftRight:
+    case OperationCode::ULogicalShiftRight:
+        return imms[0] >> (imms[1] & 31);
+    case OperationCode::IArithmeticShiftRight:
+    case OperationCode::UArithmeticShiftRight:
+        return static_cast<u32>(Signed(imms[0]) >> (imms[1] & 31));
+    case OperationCode::IBitwiseAnd:
+    case OperationCode::UBitwiseAnd:
+        return imms[0] & imms[1];
+    case OperationCode::IBitwiseOr:
+    case OperationCode::UBitwiseOr:
+        return imms[0] | imms[1];
+    case OperationCode::IBitwiseXor:
+    case OperationCode::UBitwiseXor:
+        return imms[0] ^ imms[1];
+    case OperationCode::IBitwiseNot:
+    case OperationCode::UBitwiseNot:
+        return ~imms[0];
+    case OperationCode::FAdd:
+        if (IsPrecise(operation)) {
+            return std::nullopt;
+        }
+        return FloatToBits(BitsToFloat(imms[0]) + BitsToFloat(imms[1]));
+    case OperationCode::FMul:
+        if (IsPrecise(operation)) {
+            return std::nullopt;
+        }
+        return FloatToBits(BitsToFloat(imms[0]) * BitsToFloat(imms[1]));
+    case OperationCode::FNegate:
+        return imms[0] ^ 0x80000000U;
+    case OperationCode::FAbsolute:
+        return imms[0] & 0x7FFFFFFFU;
+    default:
+        return std::nullopt;
+    }
+}
+
+/// Returns the index of the operand the operation collapses to when one operand is a neutral
+/// immediate (e.g. x+0 or x*1), or nullopt when no algebraic identity applies.
+std::optional<std::size_t> FindIdentityOperand(const OperationNode& operation) {
+    if (operation.GetOperandsCount() != 2) {
+        return std::nullopt;
+    }
+    const std::optional lhs = GetImmediate(operation[0]);
+    const std::optional rhs = GetImmediate(operation[1]);
+    const auto Matches = [&](u32 neutral) -> std::optional<std::size_t> {
+        if (rhs == neutral) {
+            return 0;
+        }
+        if (lhs == neutral) {
+            return 1;
+        }
+        return std::nullopt;
+    };
+    switch (operation.GetCode()) {
+    case OperationCode::IAdd:
+    case OperationCode::UAdd:
+    case OperationCode::IBitwiseOr:
+    case OperationCode::UBitwiseOr:
+    case OperationCode::IBitwiseXor:
+    case OperationCode::UBitwiseXor:
+        return Matches(0);
+    case OperationCode::IMul:
+    case OperationCode::UMul:
+        return Matches(1);
+    case OperationCode::IBitwiseAnd:
+    case OperationCode::UBitwiseAnd:
+        return Matches(0xFFFFFFFF);
+    case OperationCode::ILogicalShiftLeft:
+    case OperationCode::ULogicalShiftLeft:
+    case OperationCode::ILogicalShiftRight:
+    case OperationCode::ULogicalShiftRight:
+    case OperationCode::IArithmeticShiftRight:
+    case OperationCode::UArithmeticShiftRight:
+        // Only a zero shift amount (always the second operand) is neutral
+        if (rhs == 0) {
+            return 0;
+        }
+        return std::nullopt;
+    default:
+        return std::nullopt;
+    }
+}
+
+/// Folds and simplifies a node tree in place, recursing into operands and conditional code.
+void OptimizeNode(const Node& node) {
+    if (const auto conditional = std::get_if<ConditionalNode>(node.get())) {
+        OptimizeNode(conditional->GetCondition());
+        for (const auto& code : conditional->GetCode()) {
+            OptimizeNode(code);
+        }
+        return;
+    }
+    const auto operation = std::get_if<OperationNode>(node.get());
+    if (!operation) {
+        return;
+    }
+    const std::size_t operand_count = operation->GetOperandsCount();
+    for (std::size_t i = 0; i < operand_count; ++i) {
+        OptimizeNode((*operation)[i]);
+    }
+    if (operation->GetAmendIndex()) {
+        // Rebuilding the node would lose the amend index; leave amended operations untouched.
+        return;
+    }
+
+    std::vector<u32> imms;
+    imms.reserve(operand_count);
+    for (std::size_t i = 0; i < operand_count; ++i) {
+        const std::optional imm = GetImmediate((*operation)[i]);
+        if (!imm) {
+            break;
+        }
+        imms.push_back(*imm);
+    }
+    if (imms.size() == operand_count && operand_count > 0) {
+        if (const std::optional result = FoldOperation(*operation, imms)) {
+            // Assigning through the node pointer updates every block sharing it
+            *node = ImmediateNode(*result);
+            return;
+        }
+    }
+
+    if (const std::optional identity = FindIdentityOperand(*operation)) {
+        *node = *(*operation)[*identity];
+    }
+}
+
+/// Returns true when a node is a register move with no visible effect.
+bool IsRedundantAssign(const Node& node) {
+    const auto operation = std::get_if<OperationNode>(node.get());
+    if (!operation || operation->GetCode() != OperationCode::Assign ||
+        operation->GetOperandsCount() != 2 || operation->GetAmendIndex()) {
+        return false;
+    }
+    const auto dest = std::get_if<GprNode>((*operation)[0].get());
+    const auto src = std::get_if<GprNode>((*operation)[1].get());
+    return dest && src && dest->GetIndex() == src->GetIndex();
+}
+
+void RemoveRedundantAssigns(NodeBlock& code) {
+    code.erase(std::remove_if(code.begin(), code.end(), IsRedundantAssign), code.end());
+}
+
+} // Anonymous namespace
+
+void RunOptimizationPasses(std::map<u32, NodeBlock>& basic_blocks, NodeBlock& global_code) {
+    // Constant folding and algebraic simplification. Nodes are shared between the global code
+    // and the basic blocks, so mutating them through the basic blocks covers both.
+    for (auto& [address, block] : basic_blocks) {
+        for (const auto& node : block) {
+            OptimizeNode(node);
+        }
+    }
+
+    // Dead move elimination. Self-assigns surviving macro expanded code are dropped from both
+    // node lists; moves inside conditional nodes are kept since their code is immutable.
+    for (auto& [address, block] : basic_blocks) {
+        RemoveRedundantAssigns(block);
+    }
+    RemoveRedundantAssigns(global_code);
+}
+
+} // namespace VideoCommon::Shader
@@ -0,0 +1,18 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <map>
+
+#include "common/common_types.h"
+#include "video_core/shader/node.h"
+
+namespace VideoCommon::Shader {
+
+/// Runs the optimization pass pipeline over decoded code. Nodes are mutated in place so the
+/// pointers shared between the global code and the basic blocks stay consistent.
+void RunOptimizationPasses(std::map<u32, NodeBlock>& basic_blocks, NodeBlock& global_code);
+
+} // namespace VideoCommon::Shader
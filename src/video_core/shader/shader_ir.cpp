@@ -12,6 +12,7 @@
 #include "video_core/engines/shader_bytecode.h"
 #include "video_core/shader/node.h"
 #include "video_core/shader/node_helper.h"
+#include "video_core/shader/optimize.h"
 #include "video_core/shader/registry.h"
 #include "video_core/shader/shader_ir.h"
 
@@ -28,7 +29,10 @@ using Tegra::Shader::Register;
 ShaderIR::ShaderIR(const ProgramCode& program_code, u32 main_offset, CompilerSettings settings,
                    Registry& registry)
     : program_code{program_code}, main_offset{main_offset}, settings{settings}, registry{registry} {
+    // Route node allocations through this IR's arena while decoding
+    NodeArena::Scope arena_scope{node_arena};
     Decode();
+    RunOptimizationPasses(basic_blocks, global_code);
     PostDecode();
 }
 
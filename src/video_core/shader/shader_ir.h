@@ -20,6 +20,7 @@
 #include "video_core/shader/compiler_settings.h"
 #include "video_core/shader/memory_util.h"
 #include "video_core/shader/node.h"
+#include "video_core/shader/node_helper.h"
 #include "video_core/shader/registry.h"
 
 namespace VideoCommon::Shader {
@@ -432,6 +433,10 @@ private:
 
     u32 NewCustomVariable();
 
+    /// Backs every node allocation of this IR; declared first so it outlives the node holders
+    /// below when members are destroyed in reverse order.
+    NodeArena node_arena;
+
     const ProgramCode& program_code;
     const u32 main_offset;
     const CompilerSettings settings;
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -21,6 +23,19 @@ template <class T>
 class ShaderCache {
     static constexpr u64 PAGE_BITS = 14;
 
+    /// Number of direct-mapped fast lookup slots. Must be a power of two.
+    static constexpr std::size_t FAST_CACHE_SIZE = 1024;
+
+    /// Direct-mapped lookup slot readable without taking lookup_mutex. Slots are written under
+    /// the lock with a seqlock so readers can detect a concurrent refill, and carry the global
+    /// generation so removals invalidate every slot at once.
+    struct FastEntry {
+        std::atomic<u64> sequence{0}; ///< Odd while a fill is in flight, changes on every fill
+        std::atomic<u64> generation{0};
+        std::atomic<VAddr> addr{0};
+        std::atomic<T*> data{nullptr};
+    };
+
     struct Entry {
         VAddr addr_start;
         VAddr addr_end;
@@ -65,13 +80,32 @@ public:
     /// @param addr Start address of the shader, this doesn't cache for region
     /// @return Pointer to a valid shader, nullptr when nothing is found
     T* TryGet(VAddr addr) const {
+        // All-hits steady state resolves from the direct-mapped slot with a couple of loads.
+        FastEntry& entry = fast_cache[FastIndex(addr)];
+        const u64 sequence = entry.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1) == 0) {
+            const u64 generation = entry.generation.load(std::memory_order_relaxed);
+            const VAddr entry_addr = entry.addr.load(std::memory_order_relaxed);
+            T* const data = entry.data.load(std::memory_order_relaxed);
+            // Pairs with the release store closing a fill: if the sequence is unchanged, the
+            // values above belong to one coherent fill.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (entry.sequence.load(std::memory_order_relaxed) == sequence &&
+                entry_addr == addr &&
+                generation == fast_generation.load(std::memory_order_acquire)) {
+                return data;
+            }
+        }
+
         std::scoped_lock lock{lookup_mutex};
 
         const auto it = lookup_cache.find(addr);
         if (it == lookup_cache.end()) {
             return nullptr;
         }
-        return it->second->data;
+        T* const data = it->second->data;
+        FillFastEntry(entry, addr, data);
+        return data;
     }
 
 protected:
@@ -144,6 +178,8 @@ private:
         marked_for_removal.clear();
 
         if (!removed_shaders.empty()) {
+            // Expire every fast slot at once; removals are rare and refills are cheap.
+            fast_generation.fetch_add(1, std::memory_order_release);
             RemoveShadersFromStorage(std::move(removed_shaders));
         }
     }
@@ -204,6 +240,24 @@ private:
         storage.erase(std::remove_if(storage.begin(), storage.end(), is_removed), storage.end());
     }
 
+    /// @brief Returns the fast lookup slot a shader address maps to
+    static std::size_t FastIndex(VAddr addr) noexcept {
+        return static_cast<std::size_t>(addr >> 4) & (FAST_CACHE_SIZE - 1);
+    }
+
+    /// @brief Publishes a lookup result in its direct-mapped slot
+    /// @pre lookup_mutex is locked, serializing fills against each other and generation bumps
+    void FillFastEntry(FastEntry& entry, VAddr addr, T* data) const {
+        const u64 sequence = entry.sequence.load(std::memory_order_relaxed);
+        entry.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        entry.generation.store(fast_generation.load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+        entry.addr.store(addr, std::memory_order_relaxed);
+        entry.data.store(data, std::memory_order_relaxed);
+        entry.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
     /// @brief Creates a new entry in the lookup cache and returns its pointer
     /// @pre lookup_mutex is locked
     Entry* NewEntry(VAddr addr, VAddr addr_end, T* data) {
@@ -219,6 +273,9 @@ private:
     mutable std::mutex lookup_mutex;
     std::mutex invalidation_mutex;
 
+    mutable std::array<FastEntry, FAST_CACHE_SIZE> fast_cache{};
+    std::atomic<u64> fast_generation{1};
+
     std::unordered_map<u64, std::unique_ptr<Entry>> lookup_cache;
     std::unordered_map<u64, std::vector<Entry*>> invalidation_cache;
     std::vector<std::unique_ptr<T>> storage;
@@ -129,89 +129,110 @@ enum class SurfaceTarget {
     TextureCubeArray,
 };
 
-constexpr std::array<u32, MaxPixelFormat> compression_factor_shift_table = {{
-    0, // ABGR8U
-    0, // ABGR8S
-    0, // ABGR8UI
-    0, // B5G6R5U
-    0, // A2B10G10R10U
-    0, // A1B5G5R5U
-    0, // R8U
-    0, // R8UI
-    0, // RGBA16F
-    0, // RGBA16U
-    0, // RGBA16S
-    0, // RGBA16UI
-    0, // R11FG11FB10F
-    0, // RGBA32UI
-    2, // DXT1
-    2, // DXT23
-    2, // DXT45
-    2, // DXN1
-    2, // DXN2UNORM
-    2, // DXN2SNORM
-    2, // BC7U
-    2, // BC6H_UF16
-    2, // BC6H_SF16
-    2, // ASTC_2D_4X4
-    0, // BGRA8
-    0, // RGBA32F
-    0, // RG32F
-    0, // R32F
-    0, // R16F
-    0, // R16U
-    0, // R16S
-    0, // R16UI
-    0, // R16I
-    0, // RG16
-    0, // RG16F
-    0, // RG16UI
-    0, // RG16I
-    0, // RG16S
-    0, // RGB32F
-    0, // RGBA8_SRGB
-    0, // RG8U
-    0, // RG8S
-    0, // RG8UI
-    0, // RG32UI
-    0, // RGBX16F
-    0, // R32UI
-    0, // R32I
-    2, // ASTC_2D_8X8
-    2, // ASTC_2D_8X5
-    2, // ASTC_2D_5X4
-    0, // BGRA8_SRGB
-    2, // DXT1_SRGB
-    2, // DXT23_SRGB
-    2, // DXT45_SRGB
-    2, // BC7U_SRGB
-    0, // R4G4B4A4U
-    2, // ASTC_2D_4X4_SRGB
-    2, // ASTC_2D_8X8_SRGB
-    2, // ASTC_2D_8X5_SRGB
-    2, // ASTC_2D_5X4_SRGB
-    2, // ASTC_2D_5X5
-    2, // ASTC_2D_5X5_SRGB
-    2, // ASTC_2D_10X8
-    2, // ASTC_2D_10X8_SRGB
-    2, // ASTC_2D_6X6
-    2, // ASTC_2D_6X6_SRGB
-    2, // ASTC_2D_10X10
-    2, // ASTC_2D_10X10_SRGB
-    2, // ASTC_2D_12X12
-    2, // ASTC_2D_12X12_SRGB
-    2, // ASTC_2D_8X6
-    2, // ASTC_2D_8X6_SRGB
-    2, // ASTC_2D_6X5
-    2, // ASTC_2D_6X5_SRGB
-    0, // E5B9G9R9F
-    0, // Z32F
-    0, // Z16
-    0, // Z24S8
-    0, // S8Z24
-    0, // Z32FS8
+/**
+ * Static properties of a PixelFormat. The surface parameter and swizzle math looks these up for
+ * every surface, so all per-format metadata lives in one row per format: a query is a single
+ * indexed load instead of a walk over several parallel tables.
+ */
+struct FormatInfo {
+    u8 bpp;                      ///< Bits per pixel, or per compression block when compressed
+    u8 block_width;              ///< Default compression block width in pixels
+    u8 block_height;             ///< Default compression block height in pixels
+    u8 compression_factor_shift; ///< log2 of the dimension reduction of compressed surfaces
+    bool is_astc;                ///< Whether this is an ASTC compressed format
+    bool is_srgb;                ///< Whether this format uses the sRGB transfer function
+    bool is_bcn;                 ///< Whether this is a BCn (DXT or DXN) compressed format
+};
+
+/// Per-format properties, indexed by PixelFormat.
+constexpr std::array<FormatInfo, MaxPixelFormat> format_info_table = {{
+    {32,  1,  1,  0, false, false, false}, // ABGR8U
+    {32,  1,  1,  0, false, false, false}, // ABGR8S
+    {32,  1,  1,  0, false, false, false}, // ABGR8UI
+    {16,  1,  1,  0, false, false, false}, // B5G6R5U
+    {32,  1,  1,  0, false, false, false}, // A2B10G10R10U
+    {16,  1,  1,  0, false, false, false}, // A1B5G5R5U
+    {8,   1,  1,  0, false, false, false}, // R8U
+    {8,   1,  1,  0, false, false, false}, // R8UI
+    {64,  1,  1,  0, false, false, false}, // RGBA16F
+    {64,  1,  1,  0, false, false, false}, // RGBA16U
+    {64,  1,  1,  0, false, false, false}, // RGBA16S
+    {64,  1,  1,  0, false, false, false}, // RGBA16UI
+    {32,  1,  1,  0, false, false, false}, // R11FG11FB10F
+    {128, 1,  1,  0, false, false, false}, // RGBA32UI
+    {64,  4,  4,  2, false, false, true}, // DXT1
+    {128, 4,  4,  2, false, false, true}, // DXT23
+    {128, 4,  4,  2, false, false, true}, // DXT45
+    {64,  4,  4,  2, false, false, true}, // DXN1
+    {128, 4,  4,  2, false, false, true}, // DXN2UNORM
+    {128, 4,  4,  2, false, false, true}, // DXN2SNORM
+    {128, 4,  4,  2, false, false, true}, // BC7U
+    {128, 4,  4,  2, false, false, true}, // BC6H_UF16
+    {128, 4,  4,  2, false, false, true}, // BC6H_SF16
+    {128, 4,  4,  2, true,  false, false}, // ASTC_2D_4X4
+    {32,  1,  1,  0, false, false, false}, // BGRA8
+    {128, 1,  1,  0, false, false, false}, // RGBA32F
+    {64,  1,  1,  0, false, false, false}, // RG32F
+    {32,  1,  1,  0, false, false, false}, // R32F
+    {16,  1,  1,  0, false, false, false}, // R16F
+    {16,  1,  1,  0, false, false, false}, // R16U
+    {16,  1,  1,  0, false, false, false}, // R16S
+    {16,  1,  1,  0, false, false, false}, // R16UI
+    {16,  1,  1,  0, false, false, false}, // R16I
+    {32,  1,  1,  0, false, false, false}, // RG16
+    {32,  1,  1,  0, false, false, false}, // RG16F
+    {32,  1,  1,  0, false, false, false}, // RG16UI
+    {32,  1,  1,  0, false, false, false}, // RG16I
+    {32,  1,  1,  0, false, false, false}, // RG16S
+    {96,  1,  1,  0, false, false, false}, // RGB32F
+    {32,  1,  1,  0, false, true,  false}, // RGBA8_SRGB
+    {16,  1,  1,  0, false, false, false}, // RG8U
+    {16,  1,  1,  0, false, false, false}, // RG8S
+    {16,  1,  1,  0, false, false, false}, // RG8UI
+    {64,  1,  1,  0, false, false, false}, // RG32UI
+    {64,  1,  1,  0, false, false, false}, // RGBX16F
+    {32,  1,  1,  0, false, false, false}, // R32UI
+    {32,  1,  1,  0, false, false, false}, // R32I
+    {128, 8,  8,  2, true,  false, false}, // ASTC_2D_8X8
+    {128, 8,  5,  2, true,  false, false}, // ASTC_2D_8X5
+    {128, 5,  4,  2, true,  false, false}, // ASTC_2D_5X4
+    {32,  1,  1,  0, false, true,  false}, // BGRA8_SRGB
+    {64,  4,  4,  2, false, true,  true}, // DXT1_SRGB
+    {128, 4,  4,  2, false, true,  true}, // DXT23_SRGB
+    {128, 4,  4,  2, false, true,  true}, // DXT45_SRGB
+    {128, 4,  4,  2, false, true,  true}, // BC7U_SRGB
+    {16,  1,  1,  0, false, false, false}, // R4G4B4A4U
+    {128, 4,  4,  2, true,  true,  false}, // ASTC_2D_4X4_SRGB
+    {128, 8,  8,  2, true,  true,  false}, // ASTC_2D_8X8_SRGB
+    {128, 8,  5,  2, true,  true,  false}, // ASTC_2D_8X5_SRGB
+    {128, 5,  4,  2, true,  true,  false}, // ASTC_2D_5X4_SRGB
+    {128, 5,  5,  2, true,  false, false}, // ASTC_2D_5X5
+    {128, 5,  5,  2, true,  true,  false}, // ASTC_2D_5X5_SRGB
+    {128, 10, 8,  2, true,  false, false}, // ASTC_2D_10X8
+    {128, 10, 8,  2, true,  true,  false}, // ASTC_2D_10X8_SRGB
+    {128, 6,  6,  2, true,  false, false}, // ASTC_2D_6X6
+    {128, 6,  6,  2, true,  true,  false}, // ASTC_2D_6X6_SRGB
+    {128, 10, 10, 2, true,  false, false}, // ASTC_2D_10X10
+    {128, 10, 10, 2, true,  true,  false}, // ASTC_2D_10X10_SRGB
+    {128, 12, 12, 2, true,  false, false}, // ASTC_2D_12X12
+    {128, 12, 12, 2, true,  true,  false}, // ASTC_2D_12X12_SRGB
+    {128, 8,  6,  2, true,  false, false}, // ASTC_2D_8X6
+    {128, 8,  6,  2, true,  true,  false}, // ASTC_2D_8X6_SRGB
+    {128, 6,  5,  2, true,  false, false}, // ASTC_2D_6X5
+    {128, 6,  5,  2, true,  true,  false}, // ASTC_2D_6X5_SRGB
+    {32,  1,  1,  0, false, false, false}, // E5B9G9R9F
+    {32,  1,  1,  0, false, false, false}, // Z32F
+    {16,  1,  1,  0, false, false, false}, // Z16
+    {32,  1,  1,  0, false, false, false}, // Z24S8
+    {32,  1,  1,  0, false, false, false}, // S8Z24
+    {64,  1,  1,  0, false, false, false}, // Z32FS8
 }};
 
+inline constexpr const FormatInfo& GetFormatInfo(PixelFormat format) {
+    DEBUG_ASSERT(static_cast<std::size_t>(format) < format_info_table.size());
+    return format_info_table[static_cast<std::size_t>(format)];
+}
+
 /**
  * Gets the compression factor for the specified PixelFormat. This applies to just the
  * "compressed width" and "compressed height", not the overall compression factor of a
@@ -220,285 +241,32 @@ constexpr std::array<u32, MaxPixelFormat> compression_factor_shift_table = {{
  */
 inline constexpr u32 GetCompressionFactorShift(PixelFormat format) {
     DEBUG_ASSERT(format != PixelFormat::Invalid);
-    DEBUG_ASSERT(static_cast<std::size_t>(format) < compression_factor_shift_table.size());
-    return compression_factor_shift_table[static_cast<std::size_t>(format)];
+    return GetFormatInfo(format).compression_factor_shift;
 }
 
 inline constexpr u32 GetCompressionFactor(PixelFormat format) {
     return 1U << GetCompressionFactorShift(format);
 }
 
-constexpr std::array<u32, MaxPixelFormat> block_width_table = {{
-    1,  // ABGR8U
-    1,  // ABGR8S
-    1,  // ABGR8UI
-    1,  // B5G6R5U
-    1,  // A2B10G10R10U
-    1,  // A1B5G5R5U
-    1,  // R8U
-    1,  // R8UI
-    1,  // RGBA16F
-    1,  // RGBA16U
-    1,  // RGBA16S
-    1,  // RGBA16UI
-    1,  // R11FG11FB10F
-    1,  // RGBA32UI
-    4,  // DXT1
-    4,  // DXT23
-    4,  // DXT45
-    4,  // DXN1
-    4,  // DXN2UNORM
-    4,  // DXN2SNORM
-    4,  // BC7U
-    4,  // BC6H_UF16
-    4,  // BC6H_SF16
-    4,  // ASTC_2D_4X4
-    1,  // BGRA8
-    1,  // RGBA32F
-    1,  // RG32F
-    1,  // R32F
-    1,  // R16F
-    1,  // R16U
-    1,  // R16S
-    1,  // R16UI
-    1,  // R16I
-    1,  // RG16
-    1,  // RG16F
-    1,  // RG16UI
-    1,  // RG16I
-    1,  // RG16S
-    1,  // RGB32F
-    1,  // RGBA8_SRGB
-    1,  // RG8U
-    1,  // RG8S
-    1,  // RG8UI
-    1,  // RG32UI
-    1,  // RGBX16F
-    1,  // R32UI
-    1,  // R32I
-    8,  // ASTC_2D_8X8
-    8,  // ASTC_2D_8X5
-    5,  // ASTC_2D_5X4
-    1,  // BGRA8_SRGB
-    4,  // DXT1_SRGB
-    4,  // DXT23_SRGB
-    4,  // DXT45_SRGB
-    4,  // BC7U_SRGB
-    1,  // R4G4B4A4U
-    4,  // ASTC_2D_4X4_SRGB
-    8,  // ASTC_2D_8X8_SRGB
-    8,  // ASTC_2D_8X5_SRGB
-    5,  // ASTC_2D_5X4_SRGB
-    5,  // ASTC_2D_5X5
-    5,  // ASTC_2D_5X5_SRGB
-    10, // ASTC_2D_10X8
-    10, // ASTC_2D_10X8_SRGB
-    6,  // ASTC_2D_6X6
-    6,  // ASTC_2D_6X6_SRGB
-    10, // ASTC_2D_10X10
-    10, // ASTC_2D_10X10_SRGB
-    12, // ASTC_2D_12X12
-    12, // ASTC_2D_12X12_SRGB
-    8,  // ASTC_2D_8X6
-    8,  // ASTC_2D_8X6_SRGB
-    6,  // ASTC_2D_6X5
-    6,  // ASTC_2D_6X5_SRGB
-    1,  // E5B9G9R9F
-    1,  // Z32F
-    1,  // Z16
-    1,  // Z24S8
-    1,  // S8Z24
-    1,  // Z32FS8
-}};
-
 static constexpr u32 GetDefaultBlockWidth(PixelFormat format) {
     if (format == PixelFormat::Invalid)
         return 0;
 
-    ASSERT(static_cast<std::size_t>(format) < block_width_table.size());
-    return block_width_table[static_cast<std::size_t>(format)];
+    return GetFormatInfo(format).block_width;
 }
 
-constexpr std::array<u32, MaxPixelFormat> block_height_table = {{
-    1,  // ABGR8U
-    1,  // ABGR8S
-    1,  // ABGR8UI
-    1,  // B5G6R5U
-    1,  // A2B10G10R10U
-    1,  // A1B5G5R5U
-    1,  // R8U
-    1,  // R8UI
-    1,  // RGBA16F
-    1,  // RGBA16U
-    1,  // RGBA16S
-    1,  // RGBA16UI
-    1,  // R11FG11FB10F
-    1,  // RGBA32UI
-    4,  // DXT1
-    4,  // DXT23
-    4,  // DXT45
-    4,  // DXN1
-    4,  // DXN2UNORM
-    4,  // DXN2SNORM
-    4,  // BC7U
-    4,  // BC6H_UF16
-    4,  // BC6H_SF16
-    4,  // ASTC_2D_4X4
-    1,  // BGRA8
-    1,  // RGBA32F
-    1,  // RG32F
-    1,  // R32F
-    1,  // R16F
-    1,  // R16U
-    1,  // R16S
-    1,  // R16UI
-    1,  // R16I
-    1,  // RG16
-    1,  // RG16F
-    1,  // RG16UI
-    1,  // RG16I
-    1,  // RG16S
-    1,  // RGB32F
-    1,  // RGBA8_SRGB
-    1,  // RG8U
-    1,  // RG8S
-    1,  // RG8UI
-    1,  // RG32UI
-    1,  // RGBX16F
-    1,  // R32UI
-    1,  // R32I
-    8,  // ASTC_2D_8X8
-    5,  // ASTC_2D_8X5
-    4,  // ASTC_2D_5X4
-    1,  // BGRA8_SRGB
-    4,  // DXT1_SRGB
-    4,  // DXT23_SRGB
-    4,  // DXT45_SRGB
-    4,  // BC7U_SRGB
-    1,  // R4G4B4A4U
-    4,  // ASTC_2D_4X4_SRGB
-    8,  // ASTC_2D_8X8_SRGB
-    5,  // ASTC_2D_8X5_SRGB
-    4,  // ASTC_2D_5X4_SRGB
-    5,  // ASTC_2D_5X5
-    5,  // ASTC_2D_5X5_SRGB
-    8,  // ASTC_2D_10X8
-    8,  // ASTC_2D_10X8_SRGB
-    6,  // ASTC_2D_6X6
-    6,  // ASTC_2D_6X6_SRGB
-    10, // ASTC_2D_10X10
-    10, // ASTC_2D_10X10_SRGB
-    12, // ASTC_2D_12X12
-    12, // ASTC_2D_12X12_SRGB
-    6,  // ASTC_2D_8X6
-    6,  // ASTC_2D_8X6_SRGB
-    5,  // ASTC_2D_6X5
-    5,  // ASTC_2D_6X5_SRGB
-    1,  // E5B9G9R9F
-    1,  // Z32F
-    1,  // Z16
-    1,  // Z24S8
-    1,  // S8Z24
-    1,  // Z32FS8
-}};
-
 static constexpr u32 GetDefaultBlockHeight(PixelFormat format) {
     if (format == PixelFormat::Invalid)
         return 0;
 
-    ASSERT(static_cast<std::size_t>(format) < block_height_table.size());
-    return block_height_table[static_cast<std::size_t>(format)];
+    return GetFormatInfo(format).block_height;
 }
 
-constexpr std::array<u32, MaxPixelFormat> bpp_table = {{
-    32,  // ABGR8U
-    32,  // ABGR8S
-    32,  // ABGR8UI
-    16,  // B5G6R5U
-    32,  // A2B10G10R10U
-    16,  // A1B5G5R5U
-    8,   // R8U
-    8,   // R8UI
-    64,  // RGBA16F
-    64,  // RGBA16U
-    64,  // RGBA16S
-    64,  // RGBA16UI
-    32,  // R11FG11FB10F
-    128, // RGBA32UI
-    64,  // DXT1
-    128, // DXT23
-    128, // DXT45
-    64,  // DXN1
-    128, // DXN2UNORM
-    128, // DXN2SNORM
-    128, // BC7U
-    128, // BC6H_UF16
-    128, // BC6H_SF16
-    128, // ASTC_2D_4X4
-    32,  // BGRA8
-    128, // RGBA32F
-    64,  // RG32F
-    32,  // R32F
-    16,  // R16F
-    16,  // R16U
-    16,  // R16S
-    16,  // R16UI
-    16,  // R16I
-    32,  // RG16
-    32,  // RG16F
-    32,  // RG16UI
-    32,  // RG16I
-    32,  // RG16S
-    96,  // RGB32F
-    32,  // RGBA8_SRGB
-    16,  // RG8U
-    16,  // RG8S
-    16,  // RG8UI
-    64,  // RG32UI
-    64,  // RGBX16F
-    32,  // R32UI
-    32,  // R32I
-    128, // ASTC_2D_8X8
-    128, // ASTC_2D_8X5
-    128, // ASTC_2D_5X4
-    32,  // BGRA8_SRGB
-    64,  // DXT1_SRGB
-    128, // DXT23_SRGB
-    128, // DXT45_SRGB
-    128, // BC7U
-    16,  // R4G4B4A4U
-    128, // ASTC_2D_4X4_SRGB
-    128, // ASTC_2D_8X8_SRGB
-    128, // ASTC_2D_8X5_SRGB
-    128, // ASTC_2D_5X4_SRGB
-    128, // ASTC_2D_5X5
-    128, // ASTC_2D_5X5_SRGB
-    128, // ASTC_2D_10X8
-    128, // ASTC_2D_10X8_SRGB
-    128, // ASTC_2D_6X6
-    128, // ASTC_2D_6X6_SRGB
-    128, // ASTC_2D_10X10
-    128, // ASTC_2D_10X10_SRGB
-    128, // ASTC_2D_12X12
-    128, // ASTC_2D_12X12_SRGB
-    128, // ASTC_2D_8X6
-    128, // ASTC_2D_8X6_SRGB
-    128, // ASTC_2D_6X5
-    128, // ASTC_2D_6X5_SRGB
-    32,  // E5B9G9R9F
-    32,  // Z32F
-    16,  // Z16
-    32,  // Z24S8
-    32,  // S8Z24
-    64,  // Z32FS8
-}};
-
 static constexpr u32 GetFormatBpp(PixelFormat format) {
     if (format == PixelFormat::Invalid)
         return 0;
 
-    ASSERT(static_cast<std::size_t>(format) < bpp_table.size());
-    return bpp_table[static_cast<std::size_t>(format)];
+    return GetFormatInfo(format).bpp;
 }
 
 /// Returns the sizer in bytes of the specified pixel format
@@ -521,15 +289,43 @@ PixelFormat PixelFormatFromRenderTargetFormat(Tegra::RenderTargetFormat format);
 
 PixelFormat PixelFormatFromGPUPixelFormat(Tegra::FramebufferConfig::PixelFormat format);
 
-SurfaceType GetFormatType(PixelFormat pixel_format);
+inline constexpr SurfaceType GetFormatType(PixelFormat pixel_format) {
+    if (static_cast<std::size_t>(pixel_format) <
+        static_cast<std::size_t>(PixelFormat::MaxColorFormat)) {
+        return SurfaceType::ColorTexture;
+    }
+
+    if (static_cast<std::size_t>(pixel_format) <
+        static_cast<std::size_t>(PixelFormat::MaxDepthFormat)) {
+        return SurfaceType::Depth;
+    }
+
+    if (static_cast<std::size_t>(pixel_format) <
+        static_cast<std::size_t>(PixelFormat::MaxDepthStencilFormat)) {
+        return SurfaceType::DepthStencil;
+    }
+
+    // TODO(Subv): Implement the other formats
+    ASSERT(false);
 
-bool IsPixelFormatASTC(PixelFormat format);
+    return SurfaceType::Invalid;
+}
+
+inline constexpr bool IsPixelFormatASTC(PixelFormat format) {
+    return format != PixelFormat::Invalid && GetFormatInfo(format).is_astc;
+}
 
-bool IsPixelFormatSRGB(PixelFormat format);
+inline constexpr bool IsPixelFormatSRGB(PixelFormat format) {
+    return format != PixelFormat::Invalid && GetFormatInfo(format).is_srgb;
+}
 
-std::pair<u32, u32> GetASTCBlockSize(PixelFormat format);
+inline constexpr std::pair<u32, u32> GetASTCBlockSize(PixelFormat format) {
+    return {GetDefaultBlockWidth(format), GetDefaultBlockHeight(format)};
+}
 
 /// Returns true if the specified PixelFormat is a BCn format, e.g. DXT or DXN
-bool IsFormatBCn(PixelFormat format);
+inline constexpr bool IsFormatBCn(PixelFormat format) {
+    return format != PixelFormat::Invalid && GetFormatInfo(format).is_bcn;
+}
 
 } // namespace VideoCore::Surface
@@ -9,6 +9,7 @@
 #include "video_core/memory_manager.h"
 #include "video_core/texture_cache/surface_base.h"
 #include "video_core/texture_cache/surface_params.h"
+#include "video_core/texture_cache/texture_disk_cache.h"
 #include "video_core/textures/convert.h"
 
 namespace VideoCommon {
@@ -133,6 +134,37 @@ std::optional<std::pair<u32, u32>> SurfaceBaseImpl::GetLayerMipmap(
     return std::make_pair(layer, level);
 }
 
+void SurfaceBaseImpl::MarkDirtyRange(VAddr addr, std::size_t size) {
+    const VAddr begin = std::max(addr, cpu_addr);
+    const VAddr end = std::min(addr + size, cpu_addr_end);
+    if (begin >= end) {
+        return;
+    }
+    const std::size_t rel_begin = static_cast<std::size_t>(begin - cpu_addr);
+    const std::size_t rel_end = static_cast<std::size_t>(end - cpu_addr);
+    if (dirty_begin == dirty_end) {
+        dirty_begin = rel_begin;
+        dirty_end = rel_end;
+    } else {
+        dirty_begin = std::min(dirty_begin, rel_begin);
+        dirty_end = std::max(dirty_end, rel_end);
+    }
+}
+
+bool SurfaceBaseImpl::IsLevelDirty(u32 level) const {
+    if (dirty_begin == dirty_end) {
+        return false;
+    }
+    const std::size_t num_layers = params.is_layered ? params.depth : 1;
+    for (std::size_t layer = 0; layer < num_layers; ++layer) {
+        const std::size_t begin = layer * layer_size + mipmap_offsets[level];
+        if (begin < dirty_end && begin + mipmap_sizes[level] > dirty_begin) {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::vector<CopyParams> SurfaceBaseImpl::BreakDownLayered(const SurfaceParams& in_params) const {
     const u32 layers{params.depth};
     const u32 mipmaps{params.num_levels};
@@ -189,20 +221,59 @@ void SurfaceBaseImpl::SwizzleFunc(MortonSwizzleMode mode, u8* memory, const Surf
 }
 
 void SurfaceBaseImpl::LoadBuffer(Tegra::MemoryManager& memory_manager,
-                                 StagingCache& staging_cache) {
+                                 StagingCache& staging_cache, TextureDiskCache& disk_cache) {
     MICROPROFILE_SCOPE(GPU_Load_Texture);
     auto& staging_buffer = staging_cache.GetBuffer(0);
     u8* host_ptr;
+
+    // When the host copy is still valid, only read back and deswizzle the span of guest memory
+    // covering the levels that were written since the last upload.
+    const bool partial_load = CanLoadPartially();
+    std::size_t read_begin = 0;
+    std::size_t read_end = guest_memory_size;
+    if (partial_load) {
+        read_begin = guest_memory_size;
+        read_end = 0;
+        const std::size_t num_layers = params.is_layered ? params.depth : 1;
+        for (u32 level = 0; level < params.num_levels; ++level) {
+            if (!IsLevelDirty(level)) {
+                continue;
+            }
+            read_begin = std::min(read_begin, mipmap_offsets[level]);
+            read_end = std::max(read_end, (num_layers - 1) * layer_size + mipmap_offsets[level] +
+                                              mipmap_sizes[level]);
+        }
+        if (read_begin >= read_end) {
+            return;
+        }
+    }
+
     // Use an extra temporal buffer
     auto& tmp_buffer = staging_cache.GetBuffer(1);
     tmp_buffer.resize(guest_memory_size);
     host_ptr = tmp_buffer.data();
-    memory_manager.ReadBlockUnsafe(gpu_addr, host_ptr, guest_memory_size);
+    memory_manager.ReadBlockUnsafe(gpu_addr + read_begin, host_ptr + read_begin,
+                                   read_end - read_begin);
+
+    // Decoding ASTC in software is expensive. Stream previously decoded surfaces from disk when
+    // possible, skipping both the deswizzle and the conversion below.
+    bool save_decoded = false;
+    u64 decoded_key = 0;
+    if (is_converted && disk_cache.IsUsable()) {
+        decoded_key = disk_cache.CalculateKey(host_ptr, guest_memory_size, params);
+        if (disk_cache.LoadDecodedSurface(decoded_key, staging_buffer.data(), host_memory_size)) {
+            return;
+        }
+        save_decoded = true;
+    }
 
     if (params.is_tiled) {
         ASSERT_MSG(params.block_width == 0, "Block width is defined as {} on texture target {}",
                    params.block_width, static_cast<u32>(params.target));
         for (u32 level = 0; level < params.num_levels; ++level) {
+            if (partial_load && !IsLevelDirty(level)) {
+                continue;
+            }
             const std::size_t host_offset{params.GetHostMipmapLevelOffset(level, false)};
             SwizzleFunc(MortonSwizzleMode::MortonToLinear, host_ptr, params,
                         staging_buffer.data() + host_offset, level);
@@ -233,6 +304,9 @@ void SurfaceBaseImpl::LoadBuffer(Tegra::MemoryManager& memory_manager,
     }
 
     for (u32 level = params.num_levels; level--;) {
+        if (partial_load && !IsLevelDirty(level)) {
+            continue;
+        }
         const std::size_t in_host_offset{params.GetHostMipmapLevelOffset(level, false)};
         const std::size_t out_host_offset{params.GetHostMipmapLevelOffset(level, is_converted)};
         u8* const in_buffer = staging_buffer.data() + in_host_offset;
@@ -241,6 +315,10 @@ void SurfaceBaseImpl::LoadBuffer(Tegra::MemoryManager& memory_manager,
                                params.GetMipWidth(level), params.GetMipHeight(level),
                                params.GetMipDepth(level), true, true);
     }
+
+    if (save_decoded) {
+        disk_cache.SaveDecodedSurface(decoded_key, staging_buffer.data(), host_memory_size);
+    }
 }
 
 void SurfaceBaseImpl::FlushBuffer(Tegra::MemoryManager& memory_manager,
@@ -22,6 +22,8 @@ class MemoryManager;
 
 namespace VideoCommon {
 
+class TextureDiskCache;
+
 using VideoCore::MortonSwizzleMode;
 using VideoCore::Surface::SurfaceTarget;
 
@@ -60,7 +62,8 @@ private:
 
 class SurfaceBaseImpl {
 public:
-    void LoadBuffer(Tegra::MemoryManager& memory_manager, StagingCache& staging_cache);
+    void LoadBuffer(Tegra::MemoryManager& memory_manager, StagingCache& staging_cache,
+                    TextureDiskCache& disk_cache);
 
     void FlushBuffer(Tegra::MemoryManager& memory_manager, StagingCache& staging_cache);
 
@@ -143,6 +146,39 @@ public:
 
     std::optional<std::pair<u32, u32>> GetLayerMipmap(const GPUVAddr candidate_gpu_addr) const;
 
+    /// Accumulates a guest write over [addr, addr + size) so the next reload can be limited to
+    /// the levels it touched. Only meaningful while the surface keeps receiving write
+    /// notifications; see InvalidateHostContent.
+    void MarkDirtyRange(VAddr addr, std::size_t size);
+
+    /// Returns true when the accumulated dirty range overlaps the given level in any layer.
+    bool IsLevelDirty(u32 level) const;
+
+    /// Returns true when host memory still holds this surface's guest data, so a reload can skip
+    /// the levels not flagged by IsLevelDirty.
+    bool CanLoadPartially() const {
+        return has_host_content && content_addr == cpu_addr && !is_converted;
+    }
+
+    /// Returns true when the host data of a level is outdated and has to be uploaded again.
+    bool ShouldUploadLevel(u32 level) const {
+        return !CanLoadPartially() || IsLevelDirty(level);
+    }
+
+    /// Flags the host copy as matching guest memory, clearing the accumulated dirty range.
+    void MarkHostContentValid() {
+        has_host_content = true;
+        content_addr = cpu_addr;
+        dirty_begin = 0;
+        dirty_end = 0;
+    }
+
+    /// Drops partial reload tracking; the next load touches every level. Called when guest writes
+    /// can no longer be observed or the host copy diverges from guest memory.
+    void InvalidateHostContent() {
+        has_host_content = false;
+    }
+
     std::vector<CopyParams> BreakDown(const SurfaceParams& in_params) const {
         return params.is_layered ? BreakDownLayered(in_params) : BreakDownNonLayered(in_params);
     }
@@ -167,6 +203,13 @@ protected:
     std::vector<std::size_t> mipmap_offsets;
 
 private:
+    /// Dirty guest span in bytes relative to cpu_addr, empty when dirty_begin == dirty_end.
+    std::size_t dirty_begin{};
+    std::size_t dirty_end{};
+    /// Address the host copy was uploaded from; a mismatch with cpu_addr voids the copy.
+    VAddr content_addr{};
+    bool has_host_content{};
+
     void SwizzleFunc(MortonSwizzleMode mode, u8* memory, const SurfaceParams& params, u8* buffer,
                      u32 level);
 
@@ -182,8 +225,25 @@ public:
 
     virtual void DownloadTexture(std::vector<u8>& staging_buffer) = 0;
 
+    /// Begins an asynchronous download of the surface contents into backend-owned memory,
+    /// returning false when the backend has no asynchronous download path.
+    virtual bool DownloadTextureAsync() {
+        return false;
+    }
+
+    /// Copies the data of a download started with DownloadTextureAsync into the staging buffer,
+    /// waiting for the GPU when it has not finished yet. Returns false when there is no pending
+    /// download or its data went stale, in which case the caller has to download synchronously.
+    virtual bool CompleteTextureDownload(std::vector<u8>& staging_buffer) {
+        return false;
+    }
+
     void MarkAsModified(bool is_modified_, u64 tick) {
         is_modified = is_modified_ || is_target;
+        if (is_modified) {
+            // The host copy diverges from guest memory, partial reloads are off the table.
+            InvalidateHostContent();
+        }
         modification_tick = tick;
     }
 
@@ -208,6 +268,14 @@ public:
         return is_sync_pending;
     }
 
+    void SetReloadPending(bool is_reload_pending_) {
+        is_reload_pending = is_reload_pending_;
+    }
+
+    bool IsReloadPending() const {
+        return is_reload_pending;
+    }
+
     void MarkAsPicked(bool is_picked_) {
         is_picked = is_picked_;
     }
@@ -250,6 +318,14 @@ public:
         return GetView(ViewParams(overview_params.target, 0, num_layers, 0, params.num_levels));
     }
 
+    /// Returns a view reinterpreting the surface data with the candidate's pixel format. Only
+    /// valid when both formats are in the same view compatibility class.
+    TView EmplaceReinterpretedView(const SurfaceParams& view_params) {
+        const u32 num_layers{(params.is_layered && !view_params.is_layered) ? 1 : params.depth};
+        return GetView(ViewParams(view_params.target, 0, num_layers, 0, params.num_levels,
+                                  view_params.pixel_format));
+    }
+
     TView Emplace3DView(u32 slice, u32 depth, u32 base_level, u32 num_levels) {
         return GetView(ViewParams(VideoCore::Surface::SurfaceTarget::Texture3D, slice, depth,
                                   base_level, num_levels));
@@ -326,6 +402,7 @@ private:
     bool is_picked{};
     bool is_memory_marked{};
     bool is_sync_pending{};
+    bool is_reload_pending{};
     u32 index{NO_RT};
     u64 modification_tick{};
 };
@@ -8,7 +8,7 @@
 
 #include "common/alignment.h"
 #include "common/bit_util.h"
-#include "common/cityhash.h"
+#include "common/fast_hash.h"
 #include "common/common_types.h"
 #include "video_core/engines/fermi_2d.h"
 #include "video_core/engines/maxwell_3d.h"
@@ -52,7 +52,7 @@ public:
 
     std::size_t Hash() const {
         return static_cast<std::size_t>(
-            Common::CityHash64(reinterpret_cast<const char*>(this), sizeof(*this)));
+            Common::FastHash64(this, sizeof(*this)));
     }
 
     bool operator==(const SurfaceParams& rhs) const;
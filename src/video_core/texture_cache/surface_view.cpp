@@ -12,12 +12,14 @@ namespace VideoCommon {
 std::size_t ViewParams::Hash() const {
     return static_cast<std::size_t>(base_layer) ^ (static_cast<std::size_t>(num_layers) << 16) ^
            (static_cast<std::size_t>(base_level) << 24) ^
-           (static_cast<std::size_t>(num_levels) << 32) ^ (static_cast<std::size_t>(target) << 36);
+           (static_cast<std::size_t>(num_levels) << 32) ^ (static_cast<std::size_t>(target) << 36) ^
+           (static_cast<std::size_t>(pixel_format) << 40);
 }
 
 bool ViewParams::operator==(const ViewParams& rhs) const {
-    return std::tie(base_layer, num_layers, base_level, num_levels, target) ==
-           std::tie(rhs.base_layer, rhs.num_layers, rhs.base_level, rhs.num_levels, rhs.target);
+    return std::tie(base_layer, num_layers, base_level, num_levels, target, pixel_format) ==
+           std::tie(rhs.base_layer, rhs.num_layers, rhs.base_level, rhs.num_levels, rhs.target,
+                    rhs.pixel_format);
 }
 
 bool ViewParams::operator!=(const ViewParams& rhs) const {
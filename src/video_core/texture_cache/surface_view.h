@@ -13,10 +13,12 @@
 namespace VideoCommon {
 
 struct ViewParams {
-    constexpr explicit ViewParams(VideoCore::Surface::SurfaceTarget target, u32 base_layer,
-                                  u32 num_layers, u32 base_level, u32 num_levels)
+    constexpr explicit ViewParams(
+        VideoCore::Surface::SurfaceTarget target, u32 base_layer, u32 num_layers, u32 base_level,
+        u32 num_levels,
+        VideoCore::Surface::PixelFormat pixel_format = VideoCore::Surface::PixelFormat::Invalid)
         : target{target}, base_layer{base_layer}, num_layers{num_layers}, base_level{base_level},
-          num_levels{num_levels} {}
+          num_levels{num_levels}, pixel_format{pixel_format} {}
 
     std::size_t Hash() const;
 
@@ -40,6 +42,8 @@ struct ViewParams {
     u32 num_layers{};
     u32 base_level{};
     u32 num_levels{};
+    /// Format the view reinterprets the surface data with, Invalid to use the surface format.
+    VideoCore::Surface::PixelFormat pixel_format{VideoCore::Surface::PixelFormat::Invalid};
 };
 
 class ViewBase {
@@ -6,9 +6,12 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <tuple>
 #include <unordered_map>
@@ -20,14 +23,18 @@
 
 #include "common/assert.h"
 #include "common/common_types.h"
+#include "common/hash.h"
 #include "common/math_util.h"
+#include "common/open_hash_map.h"
 #include "core/core.h"
 #include "core/memory.h"
+#include "core/perf_stats.h"
 #include "core/settings.h"
 #include "video_core/compatible_formats.h"
 #include "video_core/dirty_flags.h"
 #include "video_core/engines/fermi_2d.h"
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/engines/maxwell_dma.h"
 #include "video_core/gpu.h"
 #include "video_core/memory_manager.h"
 #include "video_core/rasterizer_interface.h"
@@ -37,6 +44,7 @@
 #include "video_core/texture_cache/surface_base.h"
 #include "video_core/texture_cache/surface_params.h"
 #include "video_core/texture_cache/surface_view.h"
+#include "video_core/texture_cache/texture_disk_cache.h"
 
 namespace Tegra::Texture {
 struct FullTextureInfo;
@@ -59,17 +67,31 @@ class TextureCache {
 
 public:
     void InvalidateRegion(VAddr addr, std::size_t size) {
+        // Write notifications mostly target regions without any surface; filter them through the
+        // presence bitmap before taking the cache mutex.
+        if (size == 0 || !IsRegionRegistered(addr, size)) {
+            return;
+        }
         std::lock_guard lock{mutex};
 
         for (const auto& surface : GetSurfacesInRegion(addr, size)) {
+            if (TryMarkDirtyRange(surface, addr, size)) {
+                continue;
+            }
             Unregister(surface);
         }
     }
 
     void OnCPUWrite(VAddr addr, std::size_t size) {
+        if (size == 0 || !IsRegionRegistered(addr, size)) {
+            return;
+        }
         std::lock_guard lock{mutex};
 
         for (const auto& surface : GetSurfacesInRegion(addr, size)) {
+            if (TryMarkDirtyRange(surface, addr, size)) {
+                continue;
+            }
             if (surface->IsMemoryMarked()) {
                 UnmarkMemory(surface);
                 surface->SetSyncPending(true);
@@ -90,6 +112,28 @@ public:
         marked_for_unregister.clear();
     }
 
+    /// Ticks the frame count and releases reserved surfaces that have not been reused for a
+    /// while. Scene transitions can retire hundreds of surfaces in one frame; holding their
+    /// device allocations for a few frames lets the rebuilt scene reuse them instead of
+    /// re-creating images, while still returning memory once a shape genuinely goes unused.
+    void TickFrame() {
+        std::lock_guard lock{mutex};
+        ++frame_tick;
+        for (auto it = surface_reserve.begin(); it != surface_reserve.end();) {
+            auto& entries = it->second;
+            const auto is_expired = [this](const ReservedSurface& entry) {
+                return frame_tick - entry.frame_tick > RESERVE_LIFETIME_FRAMES;
+            };
+            entries.erase(std::remove_if(entries.begin(), entries.end(), is_expired),
+                          entries.end());
+            if (entries.empty()) {
+                it = surface_reserve.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
     /**
      * Guarantees that rendertargets don't unregister themselves if the
      * collide. Protection is currently only done on 3D slices.
@@ -103,6 +147,9 @@ public:
     }
 
     void FlushRegion(VAddr addr, std::size_t size) {
+        if (size == 0 || !IsRegionRegistered(addr, size)) {
+            return;
+        }
         std::lock_guard lock{mutex};
 
         auto surfaces = GetSurfacesInRegion(addr, size);
@@ -120,6 +167,9 @@ public:
     }
 
     bool MustFlushRegion(VAddr addr, std::size_t size) {
+        if (size == 0 || !IsRegionRegistered(addr, size)) {
+            return false;
+        }
         std::lock_guard lock{mutex};
 
         const auto surfaces = GetSurfacesInRegion(addr, size);
@@ -129,24 +179,36 @@ public:
 
     TView GetTextureSurface(const Tegra::Texture::TICEntry& tic,
                             const VideoCommon::Shader::Sampler& entry) {
-        std::lock_guard lock{mutex};
         const auto gpu_addr{tic.Address()};
         if (!gpu_addr) {
+            std::lock_guard lock{mutex};
             return GetNullSurface(SurfaceParams::ExpectedTarget(entry));
         }
 
         const std::optional<VAddr> cpu_addr =
             system.GPU().MemoryManager().GpuToCpuAddress(gpu_addr);
         if (!cpu_addr) {
+            std::lock_guard lock{mutex};
             return GetNullSurface(SurfaceParams::ExpectedTarget(entry));
         }
 
         if (!IsTypeCompatible(tic.texture_type, entry)) {
+            std::lock_guard lock{mutex};
             return GetNullSurface(SurfaceParams::ExpectedTarget(entry));
         }
 
         const auto params{SurfaceParams::CreateForTexture(format_lookup_table, tic, entry)};
+        const std::size_t params_hash = params.Hash();
+        if (const auto hit = TryFastSurfaceView(gpu_addr, params_hash)) {
+            if (guard_samplers) {
+                sampled_textures.push_back(hit->first);
+            }
+            return hit->second;
+        }
+
+        std::lock_guard lock{mutex};
         const auto [surface, view] = GetSurface(gpu_addr, *cpu_addr, params, true, false);
+        FillFastSurfaceView(gpu_addr, params_hash, surface, view);
         if (guard_samplers) {
             sampled_textures.push_back(surface);
         }
@@ -155,18 +217,29 @@ public:
 
     TView GetImageSurface(const Tegra::Texture::TICEntry& tic,
                           const VideoCommon::Shader::Image& entry) {
-        std::lock_guard lock{mutex};
         const auto gpu_addr{tic.Address()};
         if (!gpu_addr) {
+            std::lock_guard lock{mutex};
             return GetNullSurface(SurfaceParams::ExpectedTarget(entry));
         }
         const std::optional<VAddr> cpu_addr =
             system.GPU().MemoryManager().GpuToCpuAddress(gpu_addr);
         if (!cpu_addr) {
+            std::lock_guard lock{mutex};
             return GetNullSurface(SurfaceParams::ExpectedTarget(entry));
         }
         const auto params{SurfaceParams::CreateForImage(format_lookup_table, tic, entry)};
+        const std::size_t params_hash = params.Hash();
+        if (const auto hit = TryFastSurfaceView(gpu_addr, params_hash)) {
+            if (guard_samplers) {
+                sampled_textures.push_back(hit->first);
+            }
+            return hit->second;
+        }
+
+        std::lock_guard lock{mutex};
         const auto [surface, view] = GetSurface(gpu_addr, *cpu_addr, params, true, false);
+        FillFastSurfaceView(gpu_addr, params_hash, surface, view);
         if (guard_samplers) {
             sampled_textures.push_back(surface);
         }
@@ -309,16 +382,70 @@ public:
         dst_surface.first->MarkAsModified(true, Tick());
     }
 
+    /**
+     * Attempts to service a DMA engine tiled-to-linear copy with the host data of an already
+     * modified surface, writing the deswizzled rows straight to the destination. This skips the
+     * round trip of flushing the surface to guest memory just to deswizzle it again on the CPU.
+     * Returns false when no compatible surface is resident and the caller has to fall back to
+     * the guest memory path.
+     */
+    bool AccelerateDMATiledToLinear(GPUVAddr src_gpu_addr, GPUVAddr dst_gpu_addr,
+                                    const Tegra::Engines::MaxwellDMA::Regs::Parameters& src_params,
+                                    u32 x_count, u32 y_count, u32 dst_pitch) {
+        std::lock_guard lock{mutex};
+        auto& memory_manager = system.GPU().MemoryManager();
+        const std::optional<VAddr> cpu_addr = memory_manager.GpuToCpuAddress(src_gpu_addr);
+        if (!cpu_addr) {
+            return false;
+        }
+        const TSurface* const l1_entry = l1_cache.Find(*cpu_addr);
+        if (!l1_entry) {
+            return false;
+        }
+        const TSurface& surface = *l1_entry;
+        if (!surface->IsModified() || surface->IsConverted()) {
+            // When the surface is not modified the guest copy is already up to date, making the
+            // CPU deswizzle cheaper than a host readback.
+            return false;
+        }
+        const SurfaceParams& params = surface->GetSurfaceParams();
+        const u32 bytes_per_pixel = dst_pitch / x_count;
+        if (!params.is_tiled || params.IsCompressed() || params.num_levels != 1 ||
+            params.depth != 1 || params.GetBytesPerPixel() != bytes_per_pixel) {
+            return false;
+        }
+        const u32 pos_x = src_params.pos_x;
+        const u32 pos_y = src_params.pos_y;
+        if (params.width != src_params.size_x || params.height != src_params.size_y ||
+            params.block_height != src_params.BlockHeight() || src_params.pos_z != 0 ||
+            pos_x + x_count > params.width || pos_y + y_count > params.height) {
+            return false;
+        }
+        auto& staging_buffer = staging_cache.GetBuffer(0);
+        staging_buffer.resize(surface->GetHostSizeInBytes());
+        surface->DownloadTexture(staging_buffer);
+
+        const std::size_t host_pitch = std::size_t{params.width} * bytes_per_pixel;
+        const std::size_t row_size = std::size_t{x_count} * bytes_per_pixel;
+        for (u32 line = 0; line < y_count; ++line) {
+            const std::size_t host_offset =
+                std::size_t{pos_y + line} * host_pitch + std::size_t{pos_x} * bytes_per_pixel;
+            memory_manager.WriteBlock(dst_gpu_addr + std::size_t{line} * dst_pitch,
+                                      staging_buffer.data() + host_offset, row_size);
+        }
+        return true;
+    }
+
     TSurface TryFindFramebufferSurface(VAddr addr) const {
         if (!addr) {
             return nullptr;
         }
         const VAddr page = addr >> registry_page_bits;
-        const auto it = registry.find(page);
-        if (it == registry.end()) {
+        const auto* const page_list = registry.Find(page);
+        if (!page_list) {
             return nullptr;
         }
-        const auto& list = it->second;
+        const auto& list = *page_list;
         const auto found = std::find_if(list.begin(), list.end(), [addr](const auto& surface) {
             return surface->GetCpuAddr() == addr;
         });
@@ -360,7 +487,8 @@ public:
 protected:
     explicit TextureCache(Core::System& system, VideoCore::RasterizerInterface& rasterizer,
                           bool is_astc_supported)
-        : system{system}, is_astc_supported{is_astc_supported}, rasterizer{rasterizer} {
+        : system{system}, is_astc_supported{is_astc_supported}, rasterizer{rasterizer},
+          texture_disk_cache{system} {
         for (std::size_t i = 0; i < Tegra::Engines::Maxwell3D::Regs::NumRenderTargets; i++) {
             SetEmptyColorBuffer(i);
         }
@@ -417,6 +545,9 @@ protected:
         }
         surface->SetCpuAddr(*cpu_addr);
         RegisterInnerCache(surface);
+        // A new registration can shadow entries in the lock-free hit table (e.g. the same
+        // cpu_addr now resolves to this surface), invalidate it.
+        fast_hit_generation_counter.fetch_add(1, std::memory_order_release);
         surface->MarkAsRegistered(true);
         surface->SetMemoryMarked(true);
         rasterizer.UpdatePagesCachedCount(*cpu_addr, size, 1);
@@ -440,12 +571,17 @@ protected:
             ManageRenderTargetUnregister(surface);
         }
         UnmarkMemory(surface);
+        // Past this point guest writes are no longer notified, so the host copy can never be
+        // trusted for a partial reload again.
+        surface->InvalidateHostContent();
+        surface->SetReloadPending(false);
         if (surface->IsSyncPending()) {
             marked_for_unregister.remove(surface);
             surface->SetSyncPending(false);
         }
         UnregisterInnerCache(surface);
         surface->MarkAsRegistered(false);
+        fast_hit_generation_counter.fetch_add(1, std::memory_order_release);
         ReserveSurface(surface->GetSurfaceParams(), surface);
     }
 
@@ -639,6 +775,12 @@ private:
         if (!is_render && GetSiblingFormat(current_surface->GetFormat()) == params.pixel_format) {
             return match_check();
         }
+        if (!is_render && !current_surface->IsConverted() &&
+            format_compatibility.TestView(params.pixel_format, current_surface->GetFormat())) {
+            // Same view compatibility class; reinterpret the bits through a format view instead
+            // of copying the surface into a rebuilt one.
+            return {current_surface, current_surface->EmplaceReinterpretedView(params)};
+        }
         return RebuildSurface(current_surface, params, is_render);
     }
 
@@ -833,8 +975,11 @@ private:
         // Step 1
         // Check Level 1 Cache for a fast structural match. If candidate surface
         // matches at certain level we are pretty much done.
-        if (const auto iter = l1_cache.find(cpu_addr); iter != l1_cache.end()) {
-            TSurface& current_surface = iter->second;
+        if (TSurface* const l1_entry = l1_cache.Find(cpu_addr)) {
+            TSurface& current_surface = *l1_entry;
+            if (current_surface->IsReloadPending()) {
+                ReloadSurface(current_surface);
+            }
             const auto topological_result = current_surface->MatchesTopology(params);
             if (topological_result != MatchTopologyResult::FullMatch) {
                 VectorSurface overlaps{current_surface};
@@ -867,6 +1012,14 @@ private:
             return InitializeSurface(gpu_addr, params, preserve_contents);
         }
 
+        // Bring surfaces with pending guest writes up to date before they are matched against or
+        // used as a copy source below.
+        for (const auto& surface : overlaps) {
+            if (surface->IsReloadPending()) {
+                ReloadSurface(surface);
+            }
+        }
+
         // Step 3
         // Now we need to figure the relationship between the texture and its overlaps
         // we do a topological test to ensure we can find some relationship. If it fails
@@ -963,8 +1116,8 @@ private:
             return result;
         }
 
-        if (const auto iter = l1_cache.find(*cpu_addr); iter != l1_cache.end()) {
-            TSurface& current_surface = iter->second;
+        if (TSurface* const l1_entry = l1_cache.Find(*cpu_addr)) {
+            TSurface& current_surface = *l1_entry;
             const auto topological_result = current_surface->MatchesTopology(params);
             if (topological_result != MatchTopologyResult::FullMatch) {
                 Deduction result{};
@@ -1112,27 +1265,105 @@ private:
 
     void LoadSurface(const TSurface& surface) {
         staging_cache.GetBuffer(0).resize(surface->GetHostSizeInBytes());
-        surface->LoadBuffer(system.GPU().MemoryManager(), staging_cache);
+        const bool decodes_astc =
+            !is_astc_supported &&
+            VideoCore::Surface::IsPixelFormatASTC(surface->GetSurfaceParams().pixel_format);
+        const auto start = Core::PerfStats::Clock::now();
+        surface->LoadBuffer(system.GPU().MemoryManager(), staging_cache, texture_disk_cache);
+        if (decodes_astc) {
+            system.GetPerfStats().RecordBlockingEvent("ASTC decode",
+                                                      Core::PerfStats::Clock::now() - start);
+        }
         surface->UploadTexture(staging_cache.GetBuffer(0));
+        surface->MarkHostContentValid();
         surface->MarkAsModified(false, Tick());
     }
 
+    /**
+     * Tries to absorb a guest write into an existing surface so its next use reloads only the
+     * touched levels instead of destroying and rebuilding the whole surface. Render targets and
+     * surfaces with unflushed GPU modifications have to go through the regular invalidation path.
+     */
+    bool TryMarkDirtyRange(const TSurface& surface, VAddr addr, std::size_t size) {
+        if (!surface->IsMemoryMarked() || surface->IsRenderTarget() || surface->IsModified() ||
+            !surface->CanLoadPartially()) {
+            return false;
+        }
+        surface->MarkDirtyRange(addr, size);
+        surface->SetReloadPending(true);
+        // The hit table hands out views of this surface without taking the mutex; force those
+        // lookups back through GetSurface so the reload happens first.
+        fast_hit_generation_counter.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+    /// Reloads the levels written by the guest since the surface was last uploaded.
+    void ReloadSurface(const TSurface& surface) {
+        const auto& params = surface->GetSurfaceParams();
+        std::size_t uploaded_bytes = 0;
+        for (u32 level = 0; level < params.num_levels; ++level) {
+            if (surface->ShouldUploadLevel(level)) {
+                uploaded_bytes += params.GetHostMipmapSize(level);
+            }
+        }
+        surface->SetReloadPending(false);
+        LoadSurface(surface);
+        LOG_DEBUG(HW_GPU, "Partial reload uploaded {}/{} bytes at 0x{:016x}", uploaded_bytes,
+                  surface->GetHostSizeInBytes(), surface->GetGpuAddr());
+    }
+
     void FlushSurface(const TSurface& surface) {
         if (!surface->IsModified()) {
             return;
         }
         staging_cache.GetBuffer(0).resize(surface->GetHostSizeInBytes());
-        surface->DownloadTexture(staging_cache.GetBuffer(0));
+        if (!surface->CompleteTextureDownload(staging_cache.GetBuffer(0))) {
+            surface->DownloadTexture(staging_cache.GetBuffer(0));
+        }
         surface->FlushBuffer(system.GPU().MemoryManager(), staging_cache);
         surface->MarkAsModified(false, Tick());
     }
 
+    /**
+     * Read-mostly fast path for draw-call surface binding. The hit table is only touched by the
+     * thread that binds surfaces, so lookups never take the cache mutex; validity is checked
+     * against a generation counter that every registry mutation bumps while holding the mutex.
+     * A stale generation simply drops the table and falls back to the locked lookup.
+     */
+    std::optional<std::pair<TSurface, TView>> TryFastSurfaceView(GPUVAddr gpu_addr,
+                                                                 std::size_t params_hash) {
+        const u64 generation = fast_hit_generation_counter.load(std::memory_order_acquire);
+        if (generation != fast_hit_generation) {
+            fast_hit_cache.clear();
+            fast_hit_generation = generation;
+            return std::nullopt;
+        }
+        const auto it = fast_hit_cache.find({gpu_addr, params_hash});
+        if (it == fast_hit_cache.end()) {
+            return std::nullopt;
+        }
+        return std::make_pair(it->second.surface, it->second.view);
+    }
+
+    /// Fills the lock-free hit table after a locked lookup. Must be called with the mutex held,
+    /// so the generation counter cannot move underneath us.
+    void FillFastSurfaceView(GPUVAddr gpu_addr, std::size_t params_hash, TSurface surface,
+                             TView view) {
+        const u64 generation = fast_hit_generation_counter.load(std::memory_order_relaxed);
+        if (generation != fast_hit_generation || fast_hit_cache.size() >= fast_hit_cache_limit) {
+            fast_hit_cache.clear();
+            fast_hit_generation = generation;
+        }
+        fast_hit_cache[{gpu_addr, params_hash}] = {std::move(surface), std::move(view)};
+    }
+
     void RegisterInnerCache(TSurface& surface) {
         const VAddr cpu_addr = surface->GetCpuAddr();
         VAddr start = cpu_addr >> registry_page_bits;
         const VAddr end = (surface->GetCpuAddrEnd() - 1) >> registry_page_bits;
         l1_cache[cpu_addr] = surface;
         while (start <= end) {
+            MarkPagePresent(start);
             registry[start].push_back(surface);
             start++;
         }
@@ -1142,14 +1373,66 @@ private:
         const VAddr cpu_addr = surface->GetCpuAddr();
         VAddr start = cpu_addr >> registry_page_bits;
         const VAddr end = (surface->GetCpuAddrEnd() - 1) >> registry_page_bits;
-        l1_cache.erase(cpu_addr);
+        l1_cache.Erase(cpu_addr);
         while (start <= end) {
             auto& reg{registry[start]};
             reg.erase(std::find(reg.begin(), reg.end(), surface));
+            if (reg.empty()) {
+                ClearPagePresent(start);
+            }
             start++;
         }
     }
 
+    /// Sets the presence bit of a registry page. Must be called with the cache mutex held.
+    void MarkPagePresent(VAddr page) {
+        if (page >= presence_num_pages) {
+            return;
+        }
+        presence_bottom[page / 64].fetch_or(1ULL << (page % 64), std::memory_order_release);
+        presence_top[page / (64 * 64)].fetch_or(1ULL << ((page / 64) % 64),
+                                                std::memory_order_release);
+    }
+
+    /// Clears the presence bit of a now empty registry page. Must be called with the cache mutex
+    /// held.
+    void ClearPagePresent(VAddr page) {
+        if (page >= presence_num_pages) {
+            return;
+        }
+        const u64 bottom_bit = 1ULL << (page % 64);
+        if ((presence_bottom[page / 64].fetch_and(~bottom_bit, std::memory_order_release) &
+             ~bottom_bit) == 0) {
+            presence_top[page / (64 * 64)].fetch_and(~(1ULL << ((page / 64) % 64)),
+                                                     std::memory_order_release);
+        }
+    }
+
+    /// Lock-free check for whether any surface is registered over the given range. False
+    /// positives fall back to the locked interval walk; surfaces registered past the tracked
+    /// address range are conservatively reported as present.
+    bool IsRegionRegistered(VAddr addr, std::size_t size) const {
+        const VAddr end_page = (addr + size - 1) >> registry_page_bits;
+        VAddr page = addr >> registry_page_bits;
+        while (page <= end_page) {
+            if (page >= presence_num_pages) {
+                return true;
+            }
+            const u64 top_word = presence_top[page / (64 * 64)].load(std::memory_order_acquire);
+            if (((top_word >> ((page / 64) % 64)) & 1) == 0) {
+                // No page of this 64-page group holds a surface, skip the whole group.
+                page = (page / 64 + 1) * 64;
+                continue;
+            }
+            const u64 bottom_word = presence_bottom[page / 64].load(std::memory_order_acquire);
+            if (((bottom_word >> (page % 64)) & 1) != 0) {
+                return true;
+            }
+            ++page;
+        }
+        return false;
+    }
+
     VectorSurface GetSurfacesInRegion(const VAddr cpu_addr, const std::size_t size) {
         if (size == 0) {
             return {};
@@ -1158,11 +1441,11 @@ private:
         const VAddr end = (cpu_addr_end - 1) >> registry_page_bits;
         VectorSurface surfaces;
         for (VAddr start = cpu_addr >> registry_page_bits; start <= end; ++start) {
-            const auto it = registry.find(start);
-            if (it == registry.end()) {
+            auto* const page_list = registry.Find(start);
+            if (!page_list) {
                 continue;
             }
-            for (auto& surface : it->second) {
+            for (auto& surface : *page_list) {
                 if (surface->IsPicked() || !surface->Overlaps(cpu_addr, cpu_addr_end)) {
                     continue;
                 }
@@ -1177,15 +1460,20 @@ private:
     }
 
     void ReserveSurface(const SurfaceParams& params, TSurface surface) {
-        surface_reserve[params].push_back(std::move(surface));
+        surface_reserve[params].push_back({std::move(surface), frame_tick});
     }
 
     TSurface TryGetReservedSurface(const SurfaceParams& params) {
-        auto search{surface_reserve.find(params)};
+        const auto search{surface_reserve.find(params)};
         if (search == surface_reserve.end()) {
             return {};
         }
-        for (auto& surface : search->second) {
+        // Entries are taken out of the pool while in use and re-reserved on unregister, so
+        // anything still registered here is a stale duplicate and can be dropped.
+        auto& entries = search->second;
+        while (!entries.empty()) {
+            TSurface surface = std::move(entries.back().surface);
+            entries.pop_back();
             if (!surface->IsRegistered()) {
                 return surface;
             }
@@ -1250,6 +1538,12 @@ private:
             uncommitted_flushes = std::make_shared<std::list<TSurface>>();
         }
         uncommitted_flushes->push_back(surface);
+
+        // Start moving the data to the host early, so that by the time the guest demands it in
+        // FlushSurface the copy has finished and the pipeline is not drained.
+        if (surface->IsModified()) {
+            surface->DownloadTextureAsync();
+        }
     }
 
     VideoCore::RasterizerInterface& rasterizer;
@@ -1273,19 +1567,45 @@ private:
     // large in size.
     static constexpr u64 registry_page_bits{20};
     static constexpr u64 registry_page_size{1 << registry_page_bits};
-    std::unordered_map<VAddr, std::vector<TSurface>> registry;
+    Common::OpenHashMap<VAddr, std::vector<TSurface>> registry{1024};
+
+    // Two-level page presence bitmap over the registry, consulted lock-free before any locked
+    // interval walk. Each bottom bit covers one registry page and each top bit summarizes one
+    // bottom word, so sparse invalidations skip 64 pages at a time. Bits are only mutated while
+    // holding the cache mutex; a stale set bit just falls back to the locked walk.
+    static constexpr u64 presence_address_bits{39};
+    static constexpr u64 presence_num_pages{1ULL << (presence_address_bits - registry_page_bits)};
+    std::vector<std::atomic<u64>> presence_bottom =
+        std::vector<std::atomic<u64>>(presence_num_pages / 64);
+    std::vector<std::atomic<u64>> presence_top =
+        std::vector<std::atomic<u64>>(presence_num_pages / (64 * 64));
 
     static constexpr u32 DEPTH_RT = 8;
     static constexpr u32 NO_RT = 0xFFFFFFFF;
 
     // The L1 Cache is used for fast texture lookup before checking the overlaps
     // This avoids calculating size and other stuffs.
-    std::unordered_map<VAddr, TSurface> l1_cache;
+    // Sized for the populations games keep resident, about four thousand live surfaces
+    Common::OpenHashMap<VAddr, TSurface> l1_cache{4096};
+
+    struct ReservedSurface {
+        TSurface surface;
+        /// Frame the surface was reserved on, for expiry in TickFrame
+        u64 frame_tick;
+    };
+
+    /// How many frames a reserved surface survives without being reused before its device
+    /// allocation is returned
+    static constexpr u64 RESERVE_LIFETIME_FRAMES = 60;
+
+    /// Frame counter advanced by TickFrame, used to expire the surface reserve
+    u64 frame_tick{};
 
     /// The surface reserve is a "backup" cache, this is where we put unique surfaces that have
     /// previously been used. This is to prevent surfaces from being constantly created and
-    /// destroyed when used with different surface parameters.
-    std::unordered_map<SurfaceParams, std::vector<TSurface>> surface_reserve;
+    /// destroyed when used with different surface parameters. Entries expire after
+    /// RESERVE_LIFETIME_FRAMES frames without reuse.
+    std::unordered_map<SurfaceParams, std::vector<ReservedSurface>> surface_reserve;
     std::array<FramebufferTargetInfo, Tegra::Engines::Maxwell3D::Regs::NumRenderTargets>
         render_targets;
     FramebufferTargetInfo depth_buffer;
@@ -1303,7 +1623,21 @@ private:
     std::list<std::shared_ptr<std::list<TSurface>>> committed_flushes;
 
     StagingCache staging_cache;
+    TextureDiskCache texture_disk_cache;
     std::recursive_mutex mutex;
+
+    static constexpr std::size_t fast_hit_cache_limit{1024};
+
+    struct FastHitEntry {
+        TSurface surface;
+        TView view;
+    };
+
+    // Owned by the surface binding thread; see TryFastSurfaceView.
+    std::unordered_map<std::pair<GPUVAddr, std::size_t>, FastHitEntry, Common::PairHash>
+        fast_hit_cache;
+    u64 fast_hit_generation = 0;
+    std::atomic<u64> fast_hit_generation_counter{0};
 };
 
 } // namespace VideoCommon
@@ -0,0 +1,134 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/common_paths.h"
+#include "common/file_util.h"
+#include "common/logging/log.h"
+#include "core/core.h"
+#include "core/hle/kernel/process.h"
+#include "core/settings.h"
+#include "video_core/texture_cache/surface_params.h"
+#include "video_core/texture_cache/texture_disk_cache.h"
+
+namespace VideoCommon {
+
+namespace {
+
+constexpr u32 NativeVersion = 1;
+
+struct EntryHeader {
+    u32 version = 0;
+    u32 reserved = 0;
+    u64 key = 0;
+    u64 size = 0;
+};
+static_assert(sizeof(EntryHeader) == 0x18, "EntryHeader is an invalid size");
+
+} // Anonymous namespace
+
+TextureDiskCache::TextureDiskCache(Core::System& system) : system{system} {}
+
+TextureDiskCache::~TextureDiskCache() = default;
+
+bool TextureDiskCache::IsUsable() {
+    if (state == State::Untried) {
+        const bool has_title_id = system.CurrentProcess()->GetTitleID() != 0;
+        const bool usable =
+            Settings::values.use_disk_shader_cache && has_title_id && EnsureDirectories();
+        state = usable ? State::Usable : State::Unusable;
+    }
+    return state == State::Usable;
+}
+
+u64 TextureDiskCache::CalculateKey(const u8* guest_data, std::size_t guest_size,
+                                   const SurfaceParams& params) const {
+    // Seed with the surface parameters so the same guest data decoded with different parameters
+    // (e.g. another block size) maps to a different entry.
+    return Common::CityHash64WithSeed(reinterpret_cast<const char*>(guest_data), guest_size,
+                                      static_cast<u64>(params.Hash()));
+}
+
+bool TextureDiskCache::LoadDecodedSurface(u64 key, u8* out_data, std::size_t out_size) {
+    if (!IsUsable()) {
+        return false;
+    }
+
+    FileUtil::IOFile file(GetEntryPath(key), "rb");
+    if (!file.IsOpen()) {
+        return false;
+    }
+
+    EntryHeader header;
+    if (file.ReadBytes(&header, sizeof(header)) != sizeof(header) ||
+        header.version != NativeVersion || header.key != key || header.size != out_size) {
+        LOG_INFO(HW_GPU, "Decoded texture entry {:016X} is stale, removing", key);
+        file.Close();
+        FileUtil::Delete(GetEntryPath(key));
+        return false;
+    }
+
+    return file.ReadBytes(out_data, out_size) == out_size;
+}
+
+void TextureDiskCache::SaveDecodedSurface(u64 key, const u8* data, std::size_t size) {
+    if (!IsUsable()) {
+        return;
+    }
+
+    const std::string path = GetEntryPath(key);
+    if (FileUtil::Exists(path)) {
+        return;
+    }
+
+    FileUtil::IOFile file(path, "wb");
+    if (!file.IsOpen()) {
+        LOG_ERROR(HW_GPU, "Failed to open decoded texture entry {:016X} for writing", key);
+        return;
+    }
+
+    EntryHeader header;
+    header.version = NativeVersion;
+    header.key = key;
+    header.size = size;
+    if (file.WriteBytes(&header, sizeof(header)) != sizeof(header) ||
+        file.WriteBytes(data, size) != size) {
+        LOG_ERROR(HW_GPU, "Failed to save decoded texture entry {:016X}, removing", key);
+        file.Close();
+        FileUtil::Delete(path);
+    }
+}
+
+bool TextureDiskCache::EnsureDirectories() const {
+    const auto CreateDir = [](const std::string& dir) {
+        if (!FileUtil::CreateDir(dir)) {
+            LOG_ERROR(HW_GPU, "Failed to create directory={}", dir);
+            return false;
+        }
+        return true;
+    };
+
+    return CreateDir(FileUtil::GetUserPath(FileUtil::UserPath::ShaderDir)) &&
+           CreateDir(GetBaseDir()) && CreateDir(GetTitleDir());
+}
+
+std::string TextureDiskCache::GetEntryPath(u64 key) const {
+    return FileUtil::SanitizePath(GetTitleDir() + DIR_SEP_CHR + fmt::format("{:016X}.bin", key));
+}
+
+std::string TextureDiskCache::GetTitleDir() const {
+    return GetBaseDir() + DIR_SEP_CHR + GetTitleID();
+}
+
+std::string TextureDiskCache::GetBaseDir() const {
+    return FileUtil::GetUserPath(FileUtil::UserPath::ShaderDir) + DIR_SEP "textures";
+}
+
+std::string TextureDiskCache::GetTitleID() const {
+    return fmt::format("{:016X}", system.CurrentProcess()->GetTitleID());
+}
+
+} // namespace VideoCommon
@@ -0,0 +1,69 @@
+// Copyright 2020 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+#include "common/common_types.h"
+
+namespace Core {
+class System;
+}
+
+namespace VideoCommon {
+
+class SurfaceParams;
+
+/**
+ * On-disk cache for surfaces that require expensive software conversion on upload, most notably
+ * ASTC decompression on hosts without native ASTC support. Entries are stored pre-converted, one
+ * file per surface, under the shader cache directory layout so they share the per-title wipe
+ * semantics of the disk shader cache.
+ */
+class TextureDiskCache {
+public:
+    explicit TextureDiskCache(Core::System& system);
+    ~TextureDiskCache();
+
+    /// Returns whether the cache can be used. Lazily creates the on-disk directories.
+    bool IsUsable();
+
+    /// Calculates the cache key for a guest texture and the parameters it is decoded with.
+    u64 CalculateKey(const u8* guest_data, std::size_t guest_size,
+                     const SurfaceParams& params) const;
+
+    /// Streams a previously decoded surface into out_data. Returns true on a cache hit.
+    bool LoadDecodedSurface(u64 key, u8* out_data, std::size_t out_size);
+
+    /// Stores a decoded surface. Does nothing if an entry for the key already exists.
+    void SaveDecodedSurface(u64 key, const u8* data, std::size_t size);
+
+private:
+    enum class State {
+        Untried,
+        Usable,
+        Unusable,
+    };
+
+    /// Creates the cache directories. Returns true on success.
+    bool EnsureDirectories() const;
+
+    /// Gets the path of the entry for a given key
+    std::string GetEntryPath(u64 key) const;
+
+    /// Gets the current game's entry directory path
+    std::string GetTitleDir() const;
+
+    /// Gets the decoded texture directory path
+    std::string GetBaseDir() const;
+
+    /// Get current game's title id
+    std::string GetTitleID() const;
+
+    Core::System& system;
+    State state = State::Untried;
+};
+
+} // namespace VideoCommon
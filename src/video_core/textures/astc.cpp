@@ -16,13 +16,19 @@
 // <http://gamma.cs.unc.edu/FasTC/>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <cstring>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include <boost/container/static_vector.hpp>
 
 #include "common/common_types.h"
+#include "common/thread.h"
 
 #include "video_core/textures/astc.h"
 
@@ -60,20 +66,27 @@ public:
     }
 
     constexpr u32 ReadBits(std::size_t nBits) {
+        // Extract whole runs per byte instead of looping bit by bit.
         u32 ret = 0;
-        for (std::size_t i = 0; i < nBits; ++i) {
-            ret |= (ReadBit() & 1) << i;
+        std::size_t read = 0;
+        while (read < nBits) {
+            const std::size_t take = std::min(nBits - read, 8 - next_bit);
+            const u32 mask = (1U << take) - 1;
+            ret |= ((static_cast<u32>(*cur_byte) >> next_bit) & mask) << read;
+            next_bit += take;
+            if (next_bit >= 8) {
+                next_bit = 0;
+                cur_byte++;
+            }
+            read += take;
         }
+        bits_read += nBits;
         return ret;
     }
 
     template <std::size_t nBits>
     constexpr u32 ReadBits() {
-        u32 ret = 0;
-        for (std::size_t i = 0; i < nBits; ++i) {
-            ret |= (ReadBit() & 1) << i;
-        }
-        return ret;
+        return ReadBits(nBits);
     }
 
 private:
@@ -98,8 +111,21 @@ public:
     }
 
     constexpr void WriteBits(u32 val, u32 nBits) {
-        for (u32 i = 0; i < nBits; i++) {
-            WriteBit((val >> i) & 1);
+        // Insert whole runs per byte instead of looping bit by bit.
+        u32 written = 0;
+        while (written < nBits && bits_written < num_bits) {
+            const u32 take = static_cast<u32>(
+                std::min<std::size_t>({nBits - written, 8 - next_bit, num_bits - bits_written}));
+            const u8 mask = static_cast<u8>(((1U << take) - 1) << next_bit);
+            *cur_byte = static_cast<u8>((*cur_byte & ~mask) |
+                                        ((static_cast<u32>(val >> written) << next_bit) & mask));
+            next_bit += take;
+            bits_written += take;
+            if (next_bit >= 8) {
+                next_bit = 0;
+                cur_byte++;
+            }
+            written += take;
         }
     }
 
@@ -197,10 +223,103 @@ using IntegerEncodedVector = boost::container::static_vector<
         boost::container::inplace_alignment<alignof(IntegerEncodedValue)>,
         boost::container::throw_on_overflow<false>>::type>;
 
+// Unpacks the five trits packed into T as described by the algorithm in section C.2.12,
+// following table C.2.14. Mirrors the Bits<>-based decoder it replaces, but in a constexpr
+// friendly form so the 256 possible packings can be precomputed below.
+static constexpr std::array<u32, 5> UnpackTrits(u32 T) {
+    std::array<u32, 5> t{};
+    u32 C = 0;
+
+    if (((T >> 2) & 7) == 7) {
+        C = (((T >> 5) & 7) << 2) | (T & 3);
+        t[4] = t[3] = 2;
+    } else {
+        C = T & 0x1F;
+        if (((T >> 5) & 3) == 3) {
+            t[4] = 2;
+            t[3] = (T >> 7) & 1;
+        } else {
+            t[4] = (T >> 7) & 1;
+            t[3] = (T >> 5) & 3;
+        }
+    }
+
+    const u32 c0 = C & 1;
+    const u32 c1 = (C >> 1) & 1;
+    const u32 c2 = (C >> 2) & 1;
+    const u32 c3 = (C >> 3) & 1;
+    const u32 c4 = (C >> 4) & 1;
+    if ((C & 3) == 3) {
+        t[2] = 2;
+        t[1] = c4;
+        t[0] = (c3 << 1) | (c2 & ~c3 & 1);
+    } else if (((C >> 2) & 3) == 3) {
+        t[2] = 2;
+        t[1] = 2;
+        t[0] = C & 3;
+    } else {
+        t[2] = c4;
+        t[1] = (C >> 2) & 3;
+        t[0] = (c1 << 1) | (c0 & ~c1 & 1);
+    }
+    return t;
+}
+
+static constexpr std::array<std::array<u32, 5>, 256> MakeTritEncodings() {
+    std::array<std::array<u32, 5>, 256> encodings{};
+    for (u32 T = 0; T < 256; ++T) {
+        encodings[T] = UnpackTrits(T);
+    }
+    return encodings;
+}
+
+static constexpr std::array TritEncodings = MakeTritEncodings();
+
+// Unpacks the three quints packed into Q following table C.2.15, constexpr friendly for the
+// same reason as UnpackTrits.
+static constexpr std::array<u32, 3> UnpackQuints(u32 Q) {
+    std::array<u32, 3> q{};
+
+    const u32 q0 = Q & 1;
+    const u32 q3 = (Q >> 3) & 1;
+    const u32 q4 = (Q >> 4) & 1;
+    if (((Q >> 1) & 3) == 3 && ((Q >> 5) & 3) == 0) {
+        q[0] = q[1] = 4;
+        q[2] = (q0 << 2) | ((q4 & ~q0 & 1) << 1) | (q3 & ~q0 & 1);
+    } else {
+        u32 C = 0;
+        if (((Q >> 1) & 3) == 3) {
+            q[2] = 4;
+            C = (((Q >> 3) & 3) << 3) | ((~(Q >> 5) & 3) << 1) | q0;
+        } else {
+            q[2] = (Q >> 5) & 3;
+            C = Q & 0x1F;
+        }
+
+        if ((C & 7) == 5) {
+            q[1] = 4;
+            q[0] = (C >> 3) & 3;
+        } else {
+            q[1] = (C >> 3) & 3;
+            q[0] = C & 7;
+        }
+    }
+    return q;
+}
+
+static constexpr std::array<std::array<u32, 3>, 128> MakeQuintEncodings() {
+    std::array<std::array<u32, 3>, 128> encodings{};
+    for (u32 Q = 0; Q < 128; ++Q) {
+        encodings[Q] = UnpackQuints(Q);
+    }
+    return encodings;
+}
+
+static constexpr std::array QuintEncodings = MakeQuintEncodings();
+
 static void DecodeTritBlock(InputBitStream& bits, IntegerEncodedVector& result, u32 nBitsPerValue) {
     // Implement the algorithm in section C.2.12
     u32 m[5];
-    u32 t[5];
     u32 T;
 
     // Read the trit encoded block according to
@@ -216,37 +335,7 @@ static void DecodeTritBlock(InputBitStream& bits, IntegerEncodedVector& result,
     m[4] = bits.ReadBits(nBitsPerValue);
     T |= bits.ReadBit() << 7;
 
-    u32 C = 0;
-
-    Bits<u32> Tb(T);
-    if (Tb(2, 4) == 7) {
-        C = (Tb(5, 7) << 2) | Tb(0, 1);
-        t[4] = t[3] = 2;
-    } else {
-        C = Tb(0, 4);
-        if (Tb(5, 6) == 3) {
-            t[4] = 2;
-            t[3] = Tb[7];
-        } else {
-            t[4] = Tb[7];
-            t[3] = Tb(5, 6);
-        }
-    }
-
-    Bits<u32> Cb(C);
-    if (Cb(0, 1) == 3) {
-        t[2] = 2;
-        t[1] = Cb[4];
-        t[0] = (Cb[3] << 1) | (Cb[2] & ~Cb[3]);
-    } else if (Cb(2, 3) == 3) {
-        t[2] = 2;
-        t[1] = 2;
-        t[0] = Cb(0, 1);
-    } else {
-        t[2] = Cb[4];
-        t[1] = Cb(2, 3);
-        t[0] = (Cb[1] << 1) | (Cb[0] & ~Cb[1]);
-    }
+    const std::array<u32, 5>& t = TritEncodings[T];
 
     for (std::size_t i = 0; i < 5; ++i) {
         IntegerEncodedValue& val = result.emplace_back(IntegerEncoding::Trit, nBitsPerValue);
@@ -259,7 +348,6 @@ static void DecodeQus32Block(InputBitStream& bits, IntegerEncodedVector& result,
                              u32 nBitsPerValue) {
     // Implement the algorithm in section C.2.12
     u32 m[3];
-    u32 q[3];
     u32 Q;
 
     // Read the trit encoded block according to
@@ -271,29 +359,7 @@ static void DecodeQus32Block(InputBitStream& bits, IntegerEncodedVector& result,
     m[2] = bits.ReadBits(nBitsPerValue);
     Q |= bits.ReadBits<2>() << 5;
 
-    Bits<u32> Qb(Q);
-    if (Qb(1, 2) == 3 && Qb(5, 6) == 0) {
-        q[0] = q[1] = 4;
-        q[2] = (Qb[0] << 2) | ((Qb[4] & ~Qb[0]) << 1) | (Qb[3] & ~Qb[0]);
-    } else {
-        u32 C = 0;
-        if (Qb(1, 2) == 3) {
-            q[2] = 4;
-            C = (Qb(3, 4) << 3) | ((~Qb(5, 6) & 3) << 1) | Qb[0];
-        } else {
-            q[2] = Qb(5, 6);
-            C = Qb(0, 4);
-        }
-
-        Bits<u32> Cb(C);
-        if (Cb(0, 2) == 5) {
-            q[1] = 4;
-            q[0] = Cb(3, 4);
-        } else {
-            q[1] = Cb(3, 4);
-            q[0] = Cb(0, 2);
-        }
-    }
+    const std::array<u32, 3>& q = QuintEncodings[Q];
 
     for (std::size_t i = 0; i < 3; ++i) {
         IntegerEncodedValue& val = result.emplace_back(IntegerEncoding::Qus32, nBitsPerValue);
@@ -1672,35 +1738,150 @@ static void DecompressBlock(const u8 inBuf[16], const u32 blockWidth, const u32
 
 namespace Tegra::Texture::ASTC {
 
-std::vector<u8> Decompress(const u8* data, u32 width, u32 height, u32 depth, u32 block_width,
-                           u32 block_height) {
-    u32 blockIdx = 0;
-    std::size_t depth_offset = 0;
-    std::vector<u8> outData(height * width * depth * 4);
-    for (u32 k = 0; k < depth; k++) {
-        for (u32 j = 0; j < height; j += block_height) {
-            for (u32 i = 0; i < width; i += block_width) {
+namespace {
+
+/**
+ * Persistent pool of worker threads used to decode block rows in parallel. ASTC blocks are
+ * independent, so a texture can be split by rows of blocks across all host cores; the pool
+ * outlives individual textures so per-upload thread spawning is avoided.
+ */
+class DecompressionPool {
+public:
+    static DecompressionPool& GetInstance() {
+        static DecompressionPool pool;
+        return pool;
+    }
+
+    /// Invokes func(index) for every index in [0, count), distributing the indices over the
+    /// worker threads and the calling thread. Returns once every call has completed.
+    void ParallelFor(u32 count, const std::function<void(u32)>& func) {
+        if (count <= 1 || workers.empty()) {
+            for (u32 index = 0; index < count; ++index) {
+                func(index);
+            }
+            return;
+        }
+        std::scoped_lock submit_lock{submission_mutex};
+        {
+            std::scoped_lock lock{mutex};
+            task = &func;
+            task_count = count;
+            pending.store(count, std::memory_order_relaxed);
+            // The release store pairs with the acquire claim in Work: a worker that wins an
+            // index is guaranteed to observe the task state written above, even if it raced in
+            // from a previous generation without taking the mutex.
+            next_index.store(0, std::memory_order_release);
+            ++generation;
+        }
+        work_cv.notify_all();
+        Work();
+        std::unique_lock lock{mutex};
+        done_cv.wait(lock, [this] { return pending.load(std::memory_order_relaxed) == 0; });
+        task = nullptr;
+    }
 
-                const u8* blockPtr = data + blockIdx * 16;
+private:
+    DecompressionPool() {
+        const u32 hardware_threads = std::max(std::thread::hardware_concurrency(), 2U);
+        const u32 num_workers = std::min(hardware_threads - 1, 8U);
+        for (u32 i = 0; i < num_workers; ++i) {
+            workers.emplace_back([this] {
+                Common::SetCurrentThreadName("yuzu:ASTCDecodePool");
+                WorkerLoop();
+            });
+        }
+    }
 
-                // Blocks can be at most 12x12
-                u32 uncompData[144];
-                ASTCC::DecompressBlock(blockPtr, block_width, block_height, uncompData);
+    ~DecompressionPool() {
+        {
+            std::scoped_lock lock{mutex};
+            stop = true;
+        }
+        work_cv.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
 
-                u32 decompWidth = std::min(block_width, width - i);
-                u32 decompHeight = std::min(block_height, height - j);
+    void Work() {
+        while (true) {
+            const u32 index = next_index.fetch_add(1, std::memory_order_acquire);
+            if (index >= task_count) {
+                return;
+            }
+            (*task)(index);
+            if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::scoped_lock lock{mutex};
+                done_cv.notify_one();
+            }
+        }
+    }
 
-                u8* outRow = depth_offset + outData.data() + (j * width + i) * 4;
-                for (u32 jj = 0; jj < decompHeight; jj++) {
-                    memcpy(outRow + jj * width * 4, uncompData + jj * block_width, decompWidth * 4);
+    void WorkerLoop() {
+        u64 seen_generation = 0;
+        while (true) {
+            {
+                std::unique_lock lock{mutex};
+                work_cv.wait(lock, [&] { return stop || generation != seen_generation; });
+                if (stop) {
+                    return;
                 }
-
-                blockIdx++;
+                seen_generation = generation;
             }
+            Work();
         }
-        depth_offset += height * width * 4;
     }
 
+    std::vector<std::thread> workers;
+    std::mutex submission_mutex;
+    std::mutex mutex;
+    std::condition_variable work_cv;
+    std::condition_variable done_cv;
+    const std::function<void(u32)>* task = nullptr;
+    u32 task_count = 0;
+    u64 generation = 0;
+    std::atomic<u32> next_index{0};
+    std::atomic<u32> pending{0};
+    bool stop = false;
+};
+
+} // Anonymous namespace
+
+std::vector<u8> Decompress(const u8* data, u32 width, u32 height, u32 depth, u32 block_width,
+                           u32 block_height) {
+    std::vector<u8> outData(height * width * depth * 4);
+
+    const u32 rows = (height + block_height - 1) / block_height;
+    const u32 cols = (width + block_width - 1) / block_width;
+
+    // Each task decodes one row of blocks of one layer; rows write disjoint output ranges.
+    const auto decode_row = [&](u32 task_index) {
+        const u32 k = task_index / rows;
+        const u32 row = task_index % rows;
+        const u32 j = row * block_height;
+        const std::size_t depth_offset = static_cast<std::size_t>(k) * height * width * 4;
+        u32 blockIdx = (k * rows + row) * cols;
+        for (u32 i = 0; i < width; i += block_width) {
+            const u8* blockPtr = data + blockIdx * 16;
+
+            // Blocks can be at most 12x12
+            u32 uncompData[144];
+            ASTCC::DecompressBlock(blockPtr, block_width, block_height, uncompData);
+
+            u32 decompWidth = std::min(block_width, width - i);
+            u32 decompHeight = std::min(block_height, height - j);
+
+            u8* outRow = depth_offset + outData.data() + (j * width + i) * 4;
+            for (u32 jj = 0; jj < decompHeight; jj++) {
+                memcpy(outRow + jj * width * 4, uncompData + jj * block_width, decompWidth * 4);
+            }
+
+            blockIdx++;
+        }
+    };
+
+    DecompressionPool::GetInstance().ParallelFor(depth * rows, decode_row);
+
     return outData;
 }
 
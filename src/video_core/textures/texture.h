@@ -373,6 +373,8 @@ static_assert(sizeof(TSCEntry) == 0x20, "TSCEntry has wrong size");
 struct FullTextureInfo {
     TICEntry tic;
     TSCEntry tsc;
+    /// Index of the TSC entry in the sampler pool, used to index the sampler handle table.
+    u32 tsc_index = 0;
 };
 
 /// Returns the number of bytes per pixel of the input texture format.
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <chrono>
 #include <nlohmann/json.hpp>
 #include "common/detached_tasks.h"
 #include "common/web_result.h"
@@ -108,7 +109,13 @@ void TelemetryJson::Complete() {
     auto content = impl->TopSection().dump();
     // Send the telemetry async but don't handle the errors since they were written to the log
     Common::DetachedTasks::AddTask([host{impl->host}, content]() {
-        Client{host, "", ""}.PostJson("/telemetry", content, true);
+        // The shared client keeps the connection and JWT alive between submissions. Telemetry
+        // gets a short deadline so a stalled proxy cannot pin the worker past the bounded
+        // shutdown wait.
+        constexpr std::chrono::seconds telemetry_deadline{10};
+        const auto client = GetSharedClient(host, "", "");
+        client->SetTimeout(telemetry_deadline);
+        client->PostJson("/telemetry", content, true);
     });
 }
 
@@ -120,8 +127,8 @@ bool TelemetryJson::SubmitTestcase() {
     impl->SerializeSection(Telemetry::FieldType::UserConfig, "UserConfig");
 
     auto content = impl->TopSection().dump();
-    Client client(impl->host, impl->username, impl->token);
-    auto value = client.PostJson("/gamedb/testcase", content, false);
+    const auto client = GetSharedClient(impl->host, impl->username, impl->token);
+    const auto value = client->PostJson("/gamedb/testcase", content, false);
 
     return value.result_code == Common::WebResult::Code::Success;
 }
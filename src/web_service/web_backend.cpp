@@ -4,6 +4,7 @@
 
 #include <array>
 #include <cstdlib>
+#include <map>
 #include <mutex>
 #include <string>
 #include <LUrlParser.h>
@@ -36,6 +37,9 @@ struct Client::Impl {
     Common::WebResult GenericRequest(const std::string& method, const std::string& path,
                                      const std::string& data, bool allow_anonymous,
                                      const std::string& accept) {
+        // Requests through one client are serialized so it can be shared between threads.
+        std::lock_guard lock{request_mutex};
+
         if (jwt.empty()) {
             UpdateJWT();
         }
@@ -66,6 +70,24 @@ struct Client::Impl {
                                      const std::string& data, const std::string& accept,
                                      const std::string& jwt = "", const std::string& username = "",
                                      const std::string& token = "") {
+        if (!EnsureClient()) {
+            LOG_ERROR(WebService, "Invalid URL {}", host + path);
+            return Common::WebResult{Common::WebResult::Code::InvalidURL, "Invalid URL", ""};
+        }
+
+        const httplib::Request request = MakeRequest(method, path, data, jwt, username, token);
+        httplib::Response response;
+
+        if (!cli->send(request, response)) {
+            LOG_ERROR(WebService, "{} to {} returned null", method, host + path);
+            return Common::WebResult{Common::WebResult::Code::LibError, "Null response", ""};
+        }
+
+        return TranslateResponse(method, path, accept, response);
+    }
+
+    /// Creates the underlying httplib client on first use; returns false for bad URLs.
+    bool EnsureClient() {
         if (cli == nullptr) {
             auto parsedUrl = LUrlParser::clParseURL::ParseURL(host);
             int port;
@@ -81,15 +103,19 @@ struct Client::Impl {
                 cli = std::make_unique<httplib::SSLClient>(parsedUrl.m_Host.c_str(), port);
             } else {
                 LOG_ERROR(WebService, "Bad URL scheme {}", parsedUrl.m_Scheme);
-                return Common::WebResult{Common::WebResult::Code::InvalidURL, "Bad URL scheme", ""};
+                return false;
             }
         }
         if (cli == nullptr) {
-            LOG_ERROR(WebService, "Invalid URL {}", host + path);
-            return Common::WebResult{Common::WebResult::Code::InvalidURL, "Invalid URL", ""};
+            return false;
         }
-        cli->set_timeout_sec(TIMEOUT_SECONDS);
+        cli->set_timeout_sec(static_cast<time_t>(timeout.count()));
+        return true;
+    }
 
+    httplib::Request MakeRequest(const std::string& method, const std::string& path,
+                                 const std::string& data, const std::string& jwt,
+                                 const std::string& username, const std::string& token) const {
         httplib::Headers params;
         if (!jwt.empty()) {
             params = {
@@ -106,21 +132,19 @@ struct Client::Impl {
                        std::string(API_VERSION.begin(), API_VERSION.end()));
         if (method != "GET") {
             params.emplace(std::string("Content-Type"), std::string("application/json"));
-        };
+        }
 
         httplib::Request request;
         request.method = method;
         request.path = path;
-        request.headers = params;
+        request.headers = std::move(params);
         request.body = data;
+        return request;
+    }
 
-        httplib::Response response;
-
-        if (!cli->send(request, response)) {
-            LOG_ERROR(WebService, "{} to {} returned null", method, host + path);
-            return Common::WebResult{Common::WebResult::Code::LibError, "Null response", ""};
-        }
-
+    Common::WebResult TranslateResponse(const std::string& method, const std::string& path,
+                                        const std::string& accept,
+                                        const httplib::Response& response) const {
         if (response.status >= 400) {
             LOG_ERROR(WebService, "{} to {} returned error status code: {}", method, host + path,
                       response.status);
@@ -143,6 +167,52 @@ struct Client::Impl {
         return Common::WebResult{Common::WebResult::Code::Success, "", response.body};
     }
 
+    /// Posts several documents over one connection instead of re-establishing it per document.
+    std::vector<Common::WebResult> PostJsonBatch(
+        const std::vector<std::pair<std::string, std::string>>& posts, bool allow_anonymous) {
+        std::lock_guard lock{request_mutex};
+
+        if (jwt.empty()) {
+            UpdateJWT();
+        }
+
+        if (jwt.empty() && !allow_anonymous) {
+            LOG_ERROR(WebService, "Credentials must be provided for authenticated requests");
+            return std::vector<Common::WebResult>(
+                posts.size(), Common::WebResult{Common::WebResult::Code::CredentialsMissing,
+                                                "Credentials needed", ""});
+        }
+
+        if (!EnsureClient()) {
+            LOG_ERROR(WebService, "Invalid URL {}", host);
+            return std::vector<Common::WebResult>(
+                posts.size(), Common::WebResult{Common::WebResult::Code::InvalidURL,
+                                                "Invalid URL", ""});
+        }
+
+        std::vector<httplib::Request> requests;
+        requests.reserve(posts.size());
+        for (const auto& [path, data] : posts) {
+            requests.emplace_back(MakeRequest("POST", path, data, jwt, "", ""));
+        }
+
+        std::vector<httplib::Response> responses;
+        if (!cli->send(requests, responses) || responses.size() != posts.size()) {
+            LOG_ERROR(WebService, "Batch POST of {} documents to {} failed", posts.size(), host);
+            return std::vector<Common::WebResult>(
+                posts.size(),
+                Common::WebResult{Common::WebResult::Code::LibError, "Null response", ""});
+        }
+
+        std::vector<Common::WebResult> results;
+        results.reserve(posts.size());
+        for (std::size_t i = 0; i < posts.size(); ++i) {
+            results.emplace_back(
+                TranslateResponse("POST", posts[i].first, "application/json", responses[i]));
+        }
+        return results;
+    }
+
     // Retrieve a new JWT from given username and token
     void UpdateJWT() {
         if (username.empty() || token.empty()) {
@@ -165,6 +235,8 @@ struct Client::Impl {
     std::string token;
     std::string jwt;
     std::unique_ptr<httplib::Client> cli;
+    std::chrono::seconds timeout{TIMEOUT_SECONDS};
+    std::mutex request_mutex;
 
     struct JWTCache {
         std::mutex mutex;
@@ -185,6 +257,15 @@ Common::WebResult Client::PostJson(const std::string& path, const std::string& d
     return impl->GenericRequest("POST", path, data, allow_anonymous, "application/json");
 }
 
+std::vector<Common::WebResult> Client::PostJsonBatch(
+    const std::vector<std::pair<std::string, std::string>>& requests, bool allow_anonymous) {
+    return impl->PostJsonBatch(requests, allow_anonymous);
+}
+
+void Client::SetTimeout(std::chrono::seconds timeout) {
+    impl->timeout = timeout;
+}
+
 Common::WebResult Client::GetJson(const std::string& path, bool allow_anonymous) {
     return impl->GenericRequest("GET", path, "", allow_anonymous, "application/json");
 }
@@ -207,4 +288,19 @@ Common::WebResult Client::GetExternalJWT(const std::string& audience) {
                                 "text/html");
 }
 
+std::shared_ptr<Client> GetSharedClient(const std::string& host, const std::string& username,
+                                        const std::string& token) {
+    static std::mutex clients_mutex;
+    static std::map<std::string, std::shared_ptr<Client>> clients;
+
+    const std::string key = fmt::format("{}|{}|{}", host, username, token);
+
+    std::lock_guard lock{clients_mutex};
+    auto& client = clients[key];
+    if (client == nullptr) {
+        client = std::make_shared<Client>(host, username, token);
+    }
+    return client;
+}
+
 } // namespace WebService
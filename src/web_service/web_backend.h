@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace Common {
 struct WebResult;
@@ -28,6 +31,19 @@ public:
     Common::WebResult PostJson(const std::string& path, const std::string& data,
                                bool allow_anonymous);
 
+    /**
+     * Posts several JSON documents in order over a single connection, instead of
+     * re-establishing it per document.
+     * @param requests Pairs of (path, JSON body) to post.
+     * @param allow_anonymous If true, allow anonymous unauthenticated requests.
+     * @return one result per request, in the same order.
+     */
+    std::vector<Common::WebResult> PostJsonBatch(
+        const std::vector<std::pair<std::string, std::string>>& requests, bool allow_anonymous);
+
+    /// Sets the hard deadline applied to every request issued through this client.
+    void SetTimeout(std::chrono::seconds timeout);
+
     /**
      * Gets JSON from the specified path.
      * @param path the URL segment after the host address.
@@ -74,4 +90,13 @@ private:
     std::unique_ptr<Impl> impl;
 };
 
+/**
+ * Returns the process-wide client for the given host and credentials, creating it on first use.
+ * Sharing the client keeps its connection and cached JWT alive across request batches instead
+ * of re-establishing both per call. The returned client may be used from several threads;
+ * requests through one client are serialized.
+ */
+std::shared_ptr<Client> GetSharedClient(const std::string& host, const std::string& username,
+                                        const std::string& token);
+
 } // namespace WebService
@@ -448,6 +448,8 @@ void Config::ReadCoreValues() {
     qt_config->beginGroup(QStringLiteral("Core"));
 
     Settings::values.use_multi_core = ReadSetting(QStringLiteral("use_multi_core"), false).toBool();
+    Settings::values.pin_host_threads =
+        ReadSetting(QStringLiteral("pin_host_threads"), false).toBool();
 
     qt_config->endGroup();
 }
@@ -531,6 +533,10 @@ void Config::ReadDebuggingValues() {
     Settings::values.dump_nso = ReadSetting(QStringLiteral("dump_nso"), false).toBool();
     Settings::values.reporting_services =
         ReadSetting(QStringLiteral("reporting_services"), false).toBool();
+    Settings::values.enable_ipc_trace =
+        ReadSetting(QStringLiteral("enable_ipc_trace"), false).toBool();
+    Settings::values.record_gpu_stream =
+        ReadSetting(QStringLiteral("record_gpu_stream"), false).toBool();
     Settings::values.quest_flag = ReadSetting(QStringLiteral("quest_flag"), false).toBool();
     Settings::values.disable_cpu_opt =
         ReadSetting(QStringLiteral("disable_cpu_opt"), false).toBool();
@@ -954,6 +960,7 @@ void Config::SaveCoreValues() {
     qt_config->beginGroup(QStringLiteral("Core"));
 
     WriteSetting(QStringLiteral("use_multi_core"), Settings::values.use_multi_core, false);
+    WriteSetting(QStringLiteral("pin_host_threads"), Settings::values.pin_host_threads, false);
 
     qt_config->endGroup();
 }
@@ -1008,6 +1015,8 @@ void Config::SaveDebuggingValues() {
                  QString::fromStdString(Settings::values.program_args), QStringLiteral(""));
     WriteSetting(QStringLiteral("dump_exefs"), Settings::values.dump_exefs, false);
     WriteSetting(QStringLiteral("dump_nso"), Settings::values.dump_nso, false);
+    WriteSetting(QStringLiteral("enable_ipc_trace"), Settings::values.enable_ipc_trace, false);
+    WriteSetting(QStringLiteral("record_gpu_stream"), Settings::values.record_gpu_stream, false);
     WriteSetting(QStringLiteral("quest_flag"), Settings::values.quest_flag, false);
     WriteSetting(QStringLiteral("disable_cpu_opt"), Settings::values.disable_cpu_opt, false);
     WriteSetting(QStringLiteral("disable_macro_jit"), Settings::values.disable_macro_jit, false);
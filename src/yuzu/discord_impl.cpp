@@ -13,40 +13,103 @@
 
 namespace DiscordRPC {
 
+namespace {
+// Presence updates are rate limited by Discord anyway; spacing them out also bounds how often the
+// worker performs RPC I/O when requests arrive in bursts (boot, stop, settings changes).
+constexpr auto UPDATE_INTERVAL = std::chrono::seconds{5};
+} // Anonymous namespace
+
 DiscordImpl::DiscordImpl() {
     DiscordEventHandlers handlers{};
 
     // The number is the client ID for yuzu, it's used for images and the
     // application name
     Discord_Initialize("712465656758665259", &handlers, 1, nullptr);
+
+    presence_thread = std::thread([this] { PresenceWorker(); });
 }
 
 DiscordImpl::~DiscordImpl() {
+    {
+        std::lock_guard lock{request_mutex};
+        stop_requested = true;
+    }
+    request_cv.notify_one();
+    presence_thread.join();
+
     Discord_ClearPresence();
     Discord_Shutdown();
 }
 
 void DiscordImpl::Pause() {
-    Discord_ClearPresence();
+    QueueRequest({true, false, {}});
 }
 
 void DiscordImpl::Update() {
-    s64 start_time = std::chrono::duration_cast<std::chrono::seconds>(
-                         std::chrono::system_clock::now().time_since_epoch())
-                         .count();
+    // The title is read here rather than on the worker so the worker never touches the core
+    // system instance, whose lifetime is tied to the UI thread.
     std::string title;
-    if (Core::System::GetInstance().IsPoweredOn())
+    const bool in_game = Core::System::GetInstance().IsPoweredOn();
+    if (in_game) {
         Core::System::GetInstance().GetAppLoader().ReadTitle(title);
-    DiscordRichPresence presence{};
-    presence.largeImageKey = "yuzu_logo";
-    presence.largeImageText = "yuzu is an emulator for the Nintendo Switch";
-    if (Core::System::GetInstance().IsPoweredOn()) {
-        presence.state = title.c_str();
-        presence.details = "Currently in game";
-    } else {
-        presence.details = "Not in game";
     }
-    presence.startTimestamp = start_time;
-    Discord_UpdatePresence(&presence);
+    QueueRequest({false, in_game, std::move(title)});
+}
+
+void DiscordImpl::QueueRequest(PresenceRequest request) {
+    {
+        std::lock_guard lock{request_mutex};
+        pending_request = std::move(request);
+    }
+    request_cv.notify_one();
+}
+
+void DiscordImpl::PresenceWorker() {
+    auto last_update = std::chrono::steady_clock::now() - UPDATE_INTERVAL;
+
+    std::unique_lock lock{request_mutex};
+    while (true) {
+        request_cv.wait(lock, [this] { return stop_requested || pending_request.has_value(); });
+        if (stop_requested) {
+            return;
+        }
+
+        // Newer requests overwrite the pending one while we wait, so after the rate limit window
+        // opens only the latest state is submitted.
+        const auto elapsed = std::chrono::steady_clock::now() - last_update;
+        if (elapsed < UPDATE_INTERVAL) {
+            request_cv.wait_for(lock, UPDATE_INTERVAL - elapsed,
+                                [this] { return stop_requested; });
+            if (stop_requested) {
+                return;
+            }
+        }
+
+        const PresenceRequest request = std::move(*pending_request);
+        pending_request.reset();
+        lock.unlock();
+
+        if (request.clear) {
+            Discord_ClearPresence();
+        } else {
+            const s64 start_time = std::chrono::duration_cast<std::chrono::seconds>(
+                                       std::chrono::system_clock::now().time_since_epoch())
+                                       .count();
+            DiscordRichPresence presence{};
+            presence.largeImageKey = "yuzu_logo";
+            presence.largeImageText = "yuzu is an emulator for the Nintendo Switch";
+            if (request.in_game) {
+                presence.state = request.title.c_str();
+                presence.details = "Currently in game";
+            } else {
+                presence.details = "Not in game";
+            }
+            presence.startTimestamp = start_time;
+            Discord_UpdatePresence(&presence);
+        }
+        last_update = std::chrono::steady_clock::now();
+
+        lock.lock();
+    }
 }
 } // namespace DiscordRPC
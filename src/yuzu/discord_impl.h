@@ -4,6 +4,11 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
 #include "yuzu/discord.h"
 
 namespace DiscordRPC {
@@ -15,6 +20,24 @@ public:
 
     void Pause() override;
     void Update() override;
+
+private:
+    /// Snapshot of the state a presence update should reflect. Requests are coalesced: only the
+    /// most recent snapshot is kept until the worker gets around to submitting it.
+    struct PresenceRequest {
+        bool clear;
+        bool in_game;
+        std::string title;
+    };
+
+    void QueueRequest(PresenceRequest request);
+    void PresenceWorker();
+
+    std::mutex request_mutex;
+    std::condition_variable request_cv;
+    std::optional<PresenceRequest> pending_request;
+    bool stop_requested = false;
+    std::thread presence_thread;
 };
 
 } // namespace DiscordRPC
@@ -72,22 +72,13 @@ public:
 
     GameListItemPath() = default;
     GameListItemPath(const QString& game_path, const std::vector<u8>& picture_data,
-                     const QString& game_name, const QString& game_type, u64 program_id) {
+                     const QString& game_name, const QString& game_type, u64 program_id)
+        : picture_data(picture_data) {
         setData(type(), TypeRole);
         setData(game_path, FullPathRole);
         setData(game_name, TitleRole);
         setData(qulonglong(program_id), ProgramIdRole);
         setData(game_type, FileTypeRole);
-
-        const u32 size = UISettings::values.icon_size;
-
-        QPixmap picture;
-        if (!picture.loadFromData(picture_data.data(), static_cast<u32>(picture_data.size()))) {
-            picture = GetDefaultIcon(size);
-        }
-        picture = picture.scaled(size, size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-
-        setData(picture, Qt::DecorationRole);
     }
 
     int type() const override {
@@ -95,6 +86,24 @@ public:
     }
 
     QVariant data(int role) const override {
+        if (role == Qt::DecorationRole) {
+            // Decode and scale the icon the first time the view actually paints this entry.
+            // Decoding every icon while the list is being built delays the first paint of the
+            // window, and most entries are never scrolled into view.
+            if (!icon_decoded) {
+                const u32 size = UISettings::values.icon_size;
+
+                if (!icon.loadFromData(picture_data.data(),
+                                       static_cast<u32>(picture_data.size()))) {
+                    icon = GetDefaultIcon(size);
+                }
+                icon = icon.scaled(size, size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
+                picture_data = {};
+                icon_decoded = true;
+            }
+            return icon;
+        }
         if (role == Qt::DisplayRole || role == SortRole) {
             std::string filename;
             Common::SplitPath(data(FullPathRole).toString().toStdString(), nullptr, &filename,
@@ -126,6 +135,13 @@ public:
 
         return GameListItem::data(role);
     }
+
+private:
+    /// Raw encoded icon, kept until the first paint requests the decoration and then released.
+    mutable std::vector<u8> picture_data;
+    /// Thumbnail decoded from picture_data, cached across paints.
+    mutable QPixmap icon;
+    mutable bool icon_decoded = false;
 };
 
 class GameListItemCompat : public GameListItem {
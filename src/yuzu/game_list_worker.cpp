@@ -2,11 +2,15 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <QDateTime>
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
@@ -14,6 +18,7 @@
 
 #include "common/common_paths.h"
 #include "common/file_util.h"
+#include "common/thread_pool.h"
 #include "core/core.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/content_archive.h"
@@ -33,6 +38,19 @@
 
 namespace {
 
+// Bump on any change to the scan index format below.
+constexpr u32 ScanIndexVersion = 1;
+
+std::string GetScanIndexPath() {
+    return FileUtil::GetUserPath(FileUtil::UserPath::CacheDir) + DIR_SEP + "game_list" + DIR_SEP +
+           "scan_index.bin";
+}
+
+u64 GetFileModificationTime(const std::string& path) {
+    return static_cast<u64>(
+        QFileInfo(QString::fromStdString(path)).lastModified().toSecsSinceEpoch());
+}
+
 QString GetGameListCachedObject(const std::string& filename, const std::string& ext,
                                 const std::function<QString()>& generator) {
     if (!UISettings::values.cache_game_list || filename == "0000000000000000") {
@@ -128,6 +146,39 @@ std::pair<std::vector<u8>, std::string> GetGameListCachedObject(
     return std::make_pair(vec, data.toStdString());
 }
 
+/// Reads a title's icon and name from the metadata cache without a generator fallback, so a
+/// cached scan can tell whether it has to open the file after all.
+std::optional<std::pair<std::vector<u8>, std::string>> ReadCachedIconName(u64 title_id) {
+    const auto prefix = FileUtil::GetUserPath(FileUtil::UserPath::CacheDir) + DIR_SEP +
+                        "game_list" + DIR_SEP + fmt::format("{:016X}", title_id);
+
+    QFile file1{QString::fromStdString(prefix + ".jpeg")};
+    QFile file2{QString::fromStdString(prefix + ".appname.txt")};
+    if (!file1.open(QFile::ReadOnly) || !file2.open(QFile::ReadOnly)) {
+        return std::nullopt;
+    }
+
+    std::vector<u8> icon(file1.size());
+    if (file1.read(reinterpret_cast<char*>(icon.data()), icon.size()) !=
+        static_cast<s64>(icon.size())) {
+        return std::nullopt;
+    }
+
+    return std::make_pair(std::move(icon), file2.readAll().toStdString());
+}
+
+/// Reads a title's cached patch version list, if present.
+std::optional<QString> ReadCachedPatchVersions(u64 title_id) {
+    const auto path = FileUtil::GetUserPath(FileUtil::UserPath::CacheDir) + DIR_SEP + "game_list" +
+                      DIR_SEP + fmt::format("{:016X}", title_id) + ".pv.txt";
+
+    QFile file{QString::fromStdString(path)};
+    if (!file.open(QFile::ReadOnly)) {
+        return std::nullopt;
+    }
+    return QString::fromUtf8(file.readAll());
+}
+
 void GetMetadataFromControlNCA(const FileSys::PatchManager& patch_manager, const FileSys::NCA& nca,
                                std::vector<u8>& icon, std::string& name) {
     std::tie(icon, name) = GetGameListCachedObject(
@@ -189,9 +240,10 @@ QString FormatPatchNameVersions(const FileSys::PatchManager& patch_manager,
 }
 
 QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::string& name,
-                                        const std::vector<u8>& icon, Loader::AppLoader& loader,
-                                        u64 program_id, const CompatibilityList& compatibility_list,
-                                        const FileSys::PatchManager& patch) {
+                                        const std::vector<u8>& icon,
+                                        const QString& file_type_string, u64 program_id,
+                                        const CompatibilityList& compatibility_list,
+                                        const std::optional<QString>& patch_versions) {
     const auto it = FindMatchingCompatibilityEntry(compatibility_list, program_id);
 
     // The game list uses this as compatibility number for untested games
@@ -200,9 +252,6 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::stri
         compatibility = it->second.first;
     }
 
-    const auto file_type = loader.GetFileType();
-    const auto file_type_string = QString::fromStdString(Loader::GetFileTypeString(file_type));
-
     QList<QStandardItem*> list{
         new GameListItemPath(FormatGameName(path), icon, QString::fromStdString(name),
                              file_type_string, program_id),
@@ -211,12 +260,8 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::stri
         new GameListItemSize(FileUtil::GetSize(path)),
     };
 
-    if (UISettings::values.show_add_ons) {
-        const auto patch_versions = GetGameListCachedObject(
-            fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &loader] {
-                return FormatPatchNameVersions(patch, loader, loader.IsRomFSUpdatable());
-            });
-        list.insert(2, new GameListItem(patch_versions));
+    if (UISettings::values.show_add_ons && patch_versions) {
+        list.insert(2, new GameListItem(*patch_versions));
     }
 
     return list;
@@ -272,8 +317,19 @@ void GameListWorker::AddTitlesToGameList(GameListDir* parent_dir) {
         if (control != nullptr)
             GetMetadataFromControlNCA(patch, *control, icon, name);
 
-        emit EntryReady(MakeGameListEntry(file->GetFullPath(), name, icon, *loader, program_id,
-                                          compatibility_list, patch),
+        const auto file_type_string =
+            QString::fromStdString(Loader::GetFileTypeString(loader->GetFileType()));
+
+        std::optional<QString> patch_versions;
+        if (UISettings::values.show_add_ons) {
+            patch_versions = GetGameListCachedObject(
+                fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &loader] {
+                    return FormatPatchNameVersions(patch, *loader, loader->IsRomFSUpdatable());
+                });
+        }
+
+        emit EntryReady(MakeGameListEntry(file->GetFullPath(), name, icon, file_type_string,
+                                          program_id, compatibility_list, patch_versions),
                         parent_dir);
     }
 }
@@ -292,6 +348,18 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
         const bool is_dir = FileUtil::IsDirectory(physical_name);
         if (!is_dir &&
             (HasSupportedFileExtension(physical_name) || IsExtractedNCAMain(physical_name))) {
+            if (target == ScanTarget::PopulateGameList) {
+                const auto it = scan_index.find(physical_name);
+                if (it != scan_index.end() &&
+                    it->second.mtime == GetFileModificationTime(physical_name) &&
+                    AddCachedEntry(it->second, physical_name, parent_dir)) {
+                    return true;
+                }
+                // New or changed file; queue it for the parser pool.
+                pending_games.emplace_back(physical_name, parent_dir);
+                return true;
+            }
+
             const auto file = vfs->OpenFile(physical_name, FileSys::Mode::Read);
             auto loader = Loader::GetLoader(file);
             if (!loader) {
@@ -306,36 +374,22 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
             u64 program_id = 0;
             const auto res2 = loader->ReadProgramId(program_id);
 
-            if (target == ScanTarget::FillManualContentProvider) {
-                if (res2 == Loader::ResultStatus::Success && file_type == Loader::FileType::NCA) {
-                    provider->AddEntry(FileSys::TitleType::Application,
-                                       FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()),
-                                       program_id, file);
-                } else if (res2 == Loader::ResultStatus::Success &&
-                           (file_type == Loader::FileType::XCI ||
-                            file_type == Loader::FileType::NSP)) {
-                    const auto nsp = file_type == Loader::FileType::NSP
-                                         ? std::make_shared<FileSys::NSP>(file)
-                                         : FileSys::XCI{file}.GetSecurePartitionNSP();
-                    for (const auto& title : nsp->GetNCAs()) {
-                        for (const auto& entry : title.second) {
-                            provider->AddEntry(entry.first.first, entry.first.second, title.first,
-                                               entry.second->GetBaseFile());
-                        }
+            if (res2 == Loader::ResultStatus::Success && file_type == Loader::FileType::NCA) {
+                provider->AddEntry(FileSys::TitleType::Application,
+                                   FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()),
+                                   program_id, file);
+            } else if (res2 == Loader::ResultStatus::Success &&
+                       (file_type == Loader::FileType::XCI ||
+                        file_type == Loader::FileType::NSP)) {
+                const auto nsp = file_type == Loader::FileType::NSP
+                                     ? std::make_shared<FileSys::NSP>(file)
+                                     : FileSys::XCI{file}.GetSecurePartitionNSP();
+                for (const auto& title : nsp->GetNCAs()) {
+                    for (const auto& entry : title.second) {
+                        provider->AddEntry(entry.first.first, entry.first.second, title.first,
+                                           entry.second->GetBaseFile());
                     }
                 }
-            } else {
-                std::vector<u8> icon;
-                [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
-
-                std::string name = " ";
-                [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
-
-                const FileSys::PatchManager patch{program_id};
-
-                emit EntryReady(MakeGameListEntry(physical_name, name, icon, *loader, program_id,
-                                                  compatibility_list, patch),
-                                parent_dir);
             }
         } else if (is_dir && recursion > 0) {
             watch_list.append(QString::fromStdString(physical_name));
@@ -348,8 +402,148 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
     FileUtil::ForeachDirectoryEntry(nullptr, dir_path, callback);
 }
 
+void GameListWorker::ProcessGameFile(const std::string& physical_name, GameListDir* parent_dir) {
+    FileSys::VirtualFile file;
+    {
+        std::lock_guard lock{vfs_mutex};
+        file = vfs->OpenFile(physical_name, FileSys::Mode::Read);
+    }
+    const auto loader = Loader::GetLoader(file);
+    if (!loader) {
+        return;
+    }
+
+    const auto file_type = loader->GetFileType();
+    if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
+        return;
+    }
+
+    u64 program_id = 0;
+    loader->ReadProgramId(program_id);
+
+    std::vector<u8> icon;
+    [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
+
+    std::string name = " ";
+    [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
+
+    const FileSys::PatchManager patch{program_id};
+    const auto file_type_string = QString::fromStdString(Loader::GetFileTypeString(file_type));
+
+    std::optional<QString> patch_versions;
+    if (UISettings::values.show_add_ons) {
+        patch_versions = GetGameListCachedObject(
+            fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &loader] {
+                return FormatPatchNameVersions(patch, *loader, loader->IsRomFSUpdatable());
+            });
+    }
+
+    emit EntryReady(MakeGameListEntry(physical_name, name, icon, file_type_string, program_id,
+                                      compatibility_list, patch_versions),
+                    parent_dir);
+
+    std::lock_guard lock{scan_index_mutex};
+    scan_index.insert_or_assign(physical_name,
+                                ScanIndexEntry{GetFileModificationTime(physical_name), program_id,
+                                               Loader::GetFileTypeString(file_type)});
+}
+
+bool GameListWorker::AddCachedEntry(const ScanIndexEntry& entry, const std::string& physical_name,
+                                    GameListDir* parent_dir) {
+    const auto cached = ReadCachedIconName(entry.program_id);
+    if (!cached) {
+        return false;
+    }
+
+    std::optional<QString> patch_versions;
+    if (UISettings::values.show_add_ons) {
+        patch_versions = ReadCachedPatchVersions(entry.program_id);
+        if (!patch_versions) {
+            return false;
+        }
+    }
+
+    emit EntryReady(MakeGameListEntry(physical_name, cached->second, cached->first,
+                                      QString::fromStdString(entry.file_type), entry.program_id,
+                                      compatibility_list, patch_versions),
+                    parent_dir);
+    return true;
+}
+
+void GameListWorker::LoadScanIndex() {
+    scan_index.clear();
+    if (!UISettings::values.cache_game_list) {
+        return;
+    }
+
+    FileUtil::IOFile file(GetScanIndexPath(), "rb");
+    if (!file.IsOpen()) {
+        return;
+    }
+
+    u32 version{};
+    u64 count{};
+    if (file.ReadBytes(&version, sizeof(version)) != sizeof(version) ||
+        version != ScanIndexVersion || file.ReadBytes(&count, sizeof(count)) != sizeof(count)) {
+        return;
+    }
+
+    const auto read_string = [&file](std::string& str) {
+        u32 length{};
+        if (file.ReadBytes(&length, sizeof(length)) != sizeof(length)) {
+            return false;
+        }
+        str.resize(length);
+        return file.ReadBytes(str.data(), length) == length;
+    };
+
+    for (u64 i = 0; i < count; ++i) {
+        std::string path;
+        ScanIndexEntry entry{};
+        if (!read_string(path) ||
+            file.ReadBytes(&entry.mtime, sizeof(entry.mtime)) != sizeof(u64) ||
+            file.ReadBytes(&entry.program_id, sizeof(entry.program_id)) != sizeof(u64) ||
+            !read_string(entry.file_type)) {
+            // Truncated index; drop whatever was read and rescan from scratch.
+            scan_index.clear();
+            return;
+        }
+        scan_index.emplace(std::move(path), std::move(entry));
+    }
+}
+
+void GameListWorker::SaveScanIndex() {
+    if (!UISettings::values.cache_game_list) {
+        return;
+    }
+
+    const auto path = GetScanIndexPath();
+    FileUtil::CreateFullPath(path);
+    FileUtil::IOFile file(path, "wb");
+    if (!file.IsOpen()) {
+        return;
+    }
+
+    const auto write_string = [&file](const std::string& str) {
+        const u32 length = static_cast<u32>(str.size());
+        file.WriteBytes(&length, sizeof(length));
+        file.WriteBytes(str.data(), length);
+    };
+
+    file.WriteBytes(&ScanIndexVersion, sizeof(ScanIndexVersion));
+    const u64 count = scan_index.size();
+    file.WriteBytes(&count, sizeof(count));
+    for (const auto& [game_path, entry] : scan_index) {
+        write_string(game_path);
+        file.WriteBytes(&entry.mtime, sizeof(entry.mtime));
+        file.WriteBytes(&entry.program_id, sizeof(entry.program_id));
+        write_string(entry.file_type);
+    }
+}
+
 void GameListWorker::run() {
     stop_processing = false;
+    LoadScanIndex();
 
     for (UISettings::GameDir& game_dir : game_dirs) {
         if (game_dir.path == QStringLiteral("SDMC")) {
@@ -376,6 +570,29 @@ void GameListWorker::run() {
         }
     };
 
+    // Parse new and changed files on the shared thread pool; everything else was served straight
+    // from the scan index during the directory walk.
+    if (!pending_games.empty()) {
+        auto& pool = Common::ThreadPool::GetPool();
+        const auto num_workers =
+            std::min<std::size_t>({std::size_t{4}, pool.NumWorkers(), pending_games.size()});
+        std::atomic_size_t next_game{0};
+        std::vector<std::future<void>> workers;
+        for (std::size_t i = 0; i < num_workers; ++i) {
+            workers.emplace_back(pool.Push([this, &next_game] {
+                for (std::size_t game = next_game++;
+                     game < pending_games.size() && !stop_processing; game = next_game++) {
+                    ProcessGameFile(pending_games[game].first, pending_games[game].second);
+                }
+            }));
+        }
+        for (auto& worker : workers) {
+            worker.wait();
+        }
+        pending_games.clear();
+    }
+
+    SaveScanIndex();
     emit Finished(watch_list);
 }
 
@@ -7,8 +7,11 @@
 #include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <QList>
 #include <QObject>
@@ -63,6 +66,13 @@ signals:
     void Finished(QStringList watch_list);
 
 private:
+    /// A record of a previously scanned game file, validated against the file's mtime.
+    struct ScanIndexEntry {
+        u64 mtime;
+        u64 program_id;
+        std::string file_type;
+    };
+
     void AddTitlesToGameList(GameListDir* parent_dir);
 
     enum class ScanTarget {
@@ -73,11 +83,33 @@ private:
     void ScanFileSystem(ScanTarget target, const std::string& dir_path, unsigned int recursion,
                         GameListDir* parent_dir);
 
+    /// Opens and parses a game file to produce its game list entry, updating the scan index.
+    /// Called concurrently from the parser pool.
+    void ProcessGameFile(const std::string& physical_name, GameListDir* parent_dir);
+
+    /// Attempts to build a game list entry purely from the on-disk metadata caches. Returns false
+    /// if anything is missing, in which case the file has to be parsed the slow way.
+    bool AddCachedEntry(const ScanIndexEntry& entry, const std::string& physical_name,
+                        GameListDir* parent_dir);
+
+    void LoadScanIndex();
+    void SaveScanIndex();
+
     std::shared_ptr<FileSys::VfsFilesystem> vfs;
     FileSys::ManualContentProvider* provider;
     QVector<UISettings::GameDir>& game_dirs;
     const CompatibilityList& compatibility_list;
 
+    /// Scan index persisted across runs so unchanged files never have to be reopened.
+    std::map<std::string, ScanIndexEntry> scan_index;
+    std::mutex scan_index_mutex;
+
+    /// New or changed files queued during the directory walk for the parser pool.
+    std::vector<std::pair<std::string, GameListDir*>> pending_games;
+
+    /// The virtual filesystem caches open files and is not thread-safe.
+    std::mutex vfs_mutex;
+
     QStringList watch_list;
     std::atomic_bool stop_processing;
 };
@@ -70,6 +70,7 @@ static FileSys::VirtualFile VfsDirectoryCreateFileWrapper(const FileSys::Virtual
 #include "common/microprofile.h"
 #include "common/scm_rev.h"
 #include "common/scope_exit.h"
+#include "common/timer.h"
 #ifdef ARCHITECTURE_x86_64
 #include "common/x64/cpu_detect.h"
 #endif
@@ -188,12 +189,21 @@ GMainWindow::GMainWindow()
       provider(std::make_unique<FileSys::ManualContentProvider>()) {
     InitializeLogging();
 
+    // Trace how long each phase of startup takes so boot latency regressions are visible in the
+    // log instead of needing a profiler to find.
+    const auto startup_begin = Common::Timer::GetTimeMs();
+    const auto log_startup_phase = [startup_begin](const char* phase) {
+        LOG_INFO(Frontend, "Startup: {} at {} ms", phase,
+                 (Common::Timer::GetTimeMs() - startup_begin).count());
+    };
+
     setAcceptDrops(true);
     ui.setupUi(this);
     statusBar()->hide();
 
     default_theme_paths = QIcon::themeSearchPaths();
     UpdateUITheme();
+    log_startup_phase("theme loaded");
 
     SetDiscordEnabled(UISettings::values.enable_discord_presence);
     discord_rpc->Update();
@@ -202,6 +212,7 @@ GMainWindow::GMainWindow()
     InitializeDebugWidgets();
     InitializeRecentFileMenuActions();
     InitializeHotkeys();
+    log_startup_phase("widgets initialized");
 
     SetDefaultUIGeometry();
     RestoreUIState();
@@ -241,6 +252,7 @@ GMainWindow::GMainWindow()
     UpdateWindowTitle();
 
     show();
+    log_startup_phase("window shown");
 
     Core::System::GetInstance().SetContentProvider(
         std::make_unique<FileSys::ContentProviderUnion>());
@@ -250,9 +262,15 @@ GMainWindow::GMainWindow()
 
     // Gen keys if necessary
     OnReinitializeKeys(ReinitializeKeyBehavior::NoWarning);
+    log_startup_phase("keys initialized");
 
-    game_list->LoadCompatibilityList();
-    game_list->PopulateAsync(UISettings::values.game_dirs);
+    // Defer the compatibility list parse and the game list scan until after the first frame has
+    // been painted, so the window is interactive while they run.
+    QTimer::singleShot(0, this, [this, log_startup_phase] {
+        game_list->LoadCompatibilityList();
+        game_list->PopulateAsync(UISettings::values.game_dirs);
+        log_startup_phase("game list population started");
+    });
 
     // Show one-time "callout" messages to the user
     ShowTelemetryCallout();
@@ -503,7 +521,8 @@ void GMainWindow::InitializeWidgets() {
     emu_frametime_label = new QLabel();
     emu_frametime_label->setToolTip(
         tr("Time taken to emulate a Switch frame, not counting framelimiting or v-sync. For "
-           "full-speed emulation this should be at most 16.67 ms."));
+           "full-speed emulation this should be at most 16.67 ms. The second value is the 99th "
+           "percentile, where stutters show up first."));
 
     for (auto& label : {emu_speed_label, game_fps_label, emu_frametime_label}) {
         label->setVisible(false);
@@ -1046,6 +1065,8 @@ void GMainWindow::BootGame(const QString& filename) {
     if (!LoadROM(filename))
         return;
 
+    PrewarmAppletDialogs();
+
     // Create and start the emulation thread
     emu_thread = std::make_unique<EmuThread>();
     emit EmulationStarting(emu_thread.get());
@@ -1105,6 +1126,18 @@ void GMainWindow::BootGame(const QString& filename) {
     OnStartGame();
 }
 
+void GMainWindow::PrewarmAppletDialogs() {
+    // Constructing and polishing the applet dialogs once at boot pulls Qt's widget, style and
+    // font machinery into memory, so the first in-game keyboard or profile selector open does
+    // not pay for it with a visible hitch. The instances are thrown away; applet requests still
+    // build their dialogs with the parameters the game provides.
+    QtProfileSelectionDialog profile_dialog(this);
+    profile_dialog.ensurePolished();
+
+    QtSoftwareKeyboardDialog keyboard_dialog(this, {});
+    keyboard_dialog.ensurePolished();
+}
+
 void GMainWindow::ShutdownGame() {
     if (!emulation_running) {
         return;
@@ -2097,15 +2130,27 @@ void GMainWindow::UpdateStatusBar() {
 
     auto results = Core::System::GetInstance().GetAndResetPerfStats();
 
+    // QLabel::setText invalidates the label and re-lays out the status bar even when the text is
+    // unchanged, so compose the strings first and only push the ones that actually changed.
+    const auto set_label_text = [](QLabel* label, const QString& text) {
+        if (label->text() != text) {
+            label->setText(text);
+        }
+    };
+
+    QString emu_speed_text;
     if (Settings::values.use_frame_limit) {
-        emu_speed_label->setText(tr("Speed: %1% / %2%")
-                                     .arg(results.emulation_speed * 100.0, 0, 'f', 0)
-                                     .arg(Settings::values.frame_limit));
+        emu_speed_text = tr("Speed: %1% / %2%")
+                             .arg(results.emulation_speed * 100.0, 0, 'f', 0)
+                             .arg(Settings::values.frame_limit);
     } else {
-        emu_speed_label->setText(tr("Speed: %1%").arg(results.emulation_speed * 100.0, 0, 'f', 0));
+        emu_speed_text = tr("Speed: %1%").arg(results.emulation_speed * 100.0, 0, 'f', 0);
     }
-    game_fps_label->setText(tr("Game: %1 FPS").arg(results.game_fps, 0, 'f', 0));
-    emu_frametime_label->setText(tr("Frame: %1 ms").arg(results.frametime * 1000.0, 0, 'f', 2));
+    set_label_text(emu_speed_label, emu_speed_text);
+    set_label_text(game_fps_label, tr("Game: %1 FPS").arg(results.game_fps, 0, 'f', 0));
+    set_label_text(emu_frametime_label, tr("Frame: %1 ms (99%: %2 ms)")
+                                            .arg(results.frametime * 1000.0, 0, 'f', 2)
+                                            .arg(results.frametime_p99 * 1000.0, 0, 'f', 1));
 
     emu_speed_label->setVisible(!Settings::values.use_multi_core);
     game_fps_label->setVisible(true);
@@ -136,6 +136,7 @@ private:
 
     bool LoadROM(const QString& filename);
     void BootGame(const QString& filename);
+    void PrewarmAppletDialogs();
     void ShutdownGame();
 
     void ShowTelemetryCallout();
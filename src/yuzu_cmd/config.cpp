@@ -372,6 +372,8 @@ void Config::ReadValues() {
 
     // Core
     Settings::values.use_multi_core = sdl2_config->GetBoolean("Core", "use_multi_core", false);
+    Settings::values.pin_host_threads =
+        sdl2_config->GetBoolean("Core", "pin_host_threads", false);
 
     // Renderer
     const int renderer_backend = sdl2_config->GetInteger(
@@ -427,6 +429,10 @@ void Config::ReadValues() {
     Settings::values.dump_nso = sdl2_config->GetBoolean("Debugging", "dump_nso", false);
     Settings::values.reporting_services =
         sdl2_config->GetBoolean("Debugging", "reporting_services", false);
+    Settings::values.enable_ipc_trace =
+        sdl2_config->GetBoolean("Debugging", "enable_ipc_trace", false);
+    Settings::values.record_gpu_stream =
+        sdl2_config->GetBoolean("Debugging", "record_gpu_stream", false);
     Settings::values.quest_flag = sdl2_config->GetBoolean("Debugging", "quest_flag", false);
     Settings::values.disable_cpu_opt =
         sdl2_config->GetBoolean("Debugging", "disable_cpu_opt", false);
@@ -97,6 +97,11 @@ udp_pad_index=
 # 0 (default): Disabled, 1: Enabled
 use_multi_core=
 
+# Pin subsystem host threads (GPU, renderer, audio) to cores disjoint from the emulated cores.
+# Only effective on hosts with at least six cores.
+# 0 (default): Disabled, 1: Enabled
+pin_host_threads=
+
 [Renderer]
 # Which backend API to use.
 # 0 (default): OpenGL, 1: Vulkan
@@ -280,6 +285,10 @@ gdbstub_port=24689
 dump_exefs=false
 # Determines whether or not yuzu will dump all NSOs it attempts to load while loading them
 dump_nso=false
+# Records per (service, command) IPC call counts and latencies, summarized in the log at shutdown
+enable_ipc_trace=false
+# Records the GPU command stream to gpu_stream.ygc in the log directory for offline replay
+record_gpu_stream=false
 # Determines whether or not yuzu will report to the game that the emulated console is in Kiosk Mode
 # false: Retail/Normal Mode (default), true: Kiosk Mode
 quest_flag =
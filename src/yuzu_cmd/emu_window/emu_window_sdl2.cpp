@@ -93,6 +93,14 @@ bool EmuWindow_SDL2::IsShown() const {
     return is_shown;
 }
 
+void EmuWindow_SDL2::HideWindow() {
+    SDL_HideWindow(render_window);
+}
+
+void EmuWindow_SDL2::RequestClose() {
+    is_open = false;
+}
+
 void EmuWindow_SDL2::OnResize() {
     int width, height;
     SDL_GetWindowSize(render_window, &width, &height);
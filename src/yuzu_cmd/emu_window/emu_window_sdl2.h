@@ -25,6 +25,12 @@ public:
     /// Whether the window is still open, and a close request hasn't yet been sent
     bool IsOpen() const;
 
+    /// Hides the render window; used by headless runs that only need its GL context
+    void HideWindow();
+
+    /// Requests the emulation loop to stop, as if the window had been closed
+    void RequestClose();
+
     /// Returns if window is shown (not minimized)
     bool IsShown() const override;
 
@@ -2,11 +2,15 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <chrono>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <fmt/ostream.h>
 
@@ -27,8 +31,11 @@
 #include "core/gdbstub/gdbstub.h"
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/loader/loader.h"
+#include "core/perf_stats.h"
 #include "core/settings.h"
 #include "core/telemetry_session.h"
+#include "input_common/keyboard.h"
+#include "input_common/main.h"
 #include "video_core/renderer_base.h"
 #include "yuzu_cmd/config.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2.h"
@@ -66,11 +73,60 @@ static void PrintHelp(const char* argv0) {
               << " [options] <filename>\n"
                  "-g, --gdbport=NUMBER  Enable gdb stub on port NUMBER\n"
                  "-f, --fullscreen      Start in fullscreen mode\n"
+                 "-l, --headless        Hide the window and run uncapped; reports emulated\n"
+                 "                      frames per host second on exit\n"
+                 "-i, --input-script=FILE Play back scripted keyboard input from FILE. Each\n"
+                 "                      line is '<frame> press|release <key code>'\n"
+                 "-n, --frames=NUMBER   Stop after NUMBER emulated frames\n"
                  "-h, --help            Display this help and exit\n"
                  "-v, --version         Output version information and exit\n"
                  "-p, --program         Pass following string as arguments to executable\n";
 }
 
+/// A single scripted keyboard transition, applied once the given frame has been emulated
+struct InputScriptEvent {
+    u64 frame;
+    bool press;
+    int key_code;
+};
+
+/**
+ * Parses an input script into a frame-ordered event list. Lines are of the form
+ * '<frame> press|release <key code>'; blank lines and lines starting with '#' are skipped.
+ */
+static std::vector<InputScriptEvent> LoadInputScript(const std::string& path) {
+    std::vector<InputScriptEvent> events;
+    std::ifstream file;
+    OpenFStream(file, path, std::ios_base::in);
+    if (!file) {
+        LOG_CRITICAL(Frontend, "Failed to open input script {}", path);
+        return events;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        u64 frame;
+        std::string action;
+        int key_code;
+        std::istringstream stream(line);
+        if (!(stream >> frame >> action >> key_code) ||
+            (action != "press" && action != "release")) {
+            LOG_ERROR(Frontend, "Malformed input script line ignored: {}", line);
+            continue;
+        }
+        events.push_back({frame, action == "press", key_code});
+    }
+
+    std::stable_sort(events.begin(), events.end(),
+                     [](const InputScriptEvent& lhs, const InputScriptEvent& rhs) {
+                         return lhs.frame < rhs.frame;
+                     });
+    return events;
+}
+
 static void PrintVersion() {
     std::cout << "yuzu " << Common::g_scm_branch << " " << Common::g_scm_desc << std::endl;
 }
@@ -114,15 +170,24 @@ int main(int argc, char** argv) {
     std::string filepath;
 
     bool fullscreen = false;
+    bool headless = false;
+    std::string input_script_path;
+    u64 frame_count = 0;
 
     static struct option long_options[] = {
-        {"gdbport", required_argument, 0, 'g'}, {"fullscreen", no_argument, 0, 'f'},
-        {"help", no_argument, 0, 'h'},          {"version", no_argument, 0, 'v'},
-        {"program", optional_argument, 0, 'p'}, {0, 0, 0, 0},
+        {"gdbport", required_argument, 0, 'g'},
+        {"fullscreen", no_argument, 0, 'f'},
+        {"headless", no_argument, 0, 'l'},
+        {"input-script", required_argument, 0, 'i'},
+        {"frames", required_argument, 0, 'n'},
+        {"help", no_argument, 0, 'h'},
+        {"version", no_argument, 0, 'v'},
+        {"program", optional_argument, 0, 'p'},
+        {0, 0, 0, 0},
     };
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "g:fhvp::", long_options, &option_index);
+        int arg = getopt_long(argc, argv, "g:fli:n:hvp::", long_options, &option_index);
         if (arg != -1) {
             switch (static_cast<char>(arg)) {
             case 'g':
@@ -140,6 +205,23 @@ int main(int argc, char** argv) {
                 fullscreen = true;
                 LOG_INFO(Frontend, "Starting in fullscreen mode...");
                 break;
+            case 'l':
+                headless = true;
+                LOG_INFO(Frontend, "Starting in headless mode...");
+                break;
+            case 'i':
+                input_script_path = optarg;
+                break;
+            case 'n':
+                errno = 0;
+                frame_count = strtoull(optarg, &endarg, 0);
+                if (endarg == optarg)
+                    errno = EINVAL;
+                if (errno != 0) {
+                    perror("--frames");
+                    exit(1);
+                }
+                break;
             case 'h':
                 PrintHelp(argv[0]);
                 return 0;
@@ -176,6 +258,11 @@ int main(int argc, char** argv) {
     // Apply the command line arguments
     Settings::values.gdbstub_port = gdb_port;
     Settings::values.use_gdbstub = use_gdbstub;
+    if (headless) {
+        // Headless runs exist to measure emulation throughput, so run uncapped
+        Settings::values.use_frame_limit = false;
+        Settings::values.use_vsync = false;
+    }
     Settings::Apply();
 
     Core::System& system{Core::System::GetInstance()};
@@ -236,14 +323,56 @@ int main(int argc, char** argv) {
 
     system.Renderer().Rasterizer().LoadDiskResources();
 
+    if (headless) {
+        // There is no null video backend: the renderer always draws into the window's GL
+        // context, so headless mode keeps the window but never shows it.
+        emu_window->HideWindow();
+    }
+
+    const std::vector<InputScriptEvent> input_script =
+        input_script_path.empty() ? std::vector<InputScriptEvent>{}
+                                  : LoadInputScript(input_script_path);
+    std::size_t next_input_event = 0;
+
+    const auto start_time = std::chrono::steady_clock::now();
+
     std::thread render_thread([&emu_window] { emu_window->Present(); });
     system.Run();
     while (emu_window->IsOpen()) {
+        // Input playback and the frame bound are keyed on the emulated frame count, so a
+        // given script replays identically regardless of how fast the host runs.
+        const u64 frame = static_cast<u64>(system.GetPerfStats().GetFrameCount());
+        while (next_input_event < input_script.size() &&
+               input_script[next_input_event].frame <= frame) {
+            const InputScriptEvent& event = input_script[next_input_event++];
+            if (event.press) {
+                InputCommon::GetKeyboard()->PressKey(event.key_code);
+            } else {
+                InputCommon::GetKeyboard()->ReleaseKey(event.key_code);
+            }
+        }
+        if (frame_count != 0 && frame >= frame_count) {
+            emu_window->RequestClose();
+            break;
+        }
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
     system.Pause();
     render_thread.join();
 
+    const auto run_seconds =
+        std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() -
+                                                                  start_time)
+            .count();
+    const u64 emulated_frames = static_cast<u64>(system.GetPerfStats().GetFrameCount());
+    if (run_seconds > 0.0) {
+        LOG_INFO(Frontend, "Emulated {} frames in {:.2f}s ({:.2f} frames per host second)",
+                 emulated_frames, run_seconds, emulated_frames / run_seconds);
+        std::cout << fmt::format("Emulated {} frames in {:.2f}s ({:.2f} frames per host second)",
+                                 emulated_frames, run_seconds, emulated_frames / run_seconds)
+                  << std::endl;
+    }
+
     system.Shutdown();
 
     detached_tasks.WaitForAllTasks();
@@ -2,11 +2,14 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <fmt/ostream.h>
 
@@ -27,8 +30,11 @@
 #include "core/file_sys/vfs_real.h"
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/loader/loader.h"
+#include "core/perf_stats.h"
 #include "core/settings.h"
 #include "core/telemetry_session.h"
+#include "video_core/command_stream_capture.h"
+#include "video_core/gpu.h"
 #include "video_core/renderer_base.h"
 #include "yuzu_tester/config.h"
 #include "yuzu_tester/emu_window/emu_window_sdl2_hide.h"
@@ -63,7 +69,18 @@ static void PrintHelp(const char* argv0) {
                  "-v, --version         Output version information and exit\n"
                  "-d, --datastring      Pass following string as data to test service command #2\n"
                  "-l, --log             Log to console in addition to file (will log to file only "
-                 "by default)\n";
+                 "by default)\n"
+                 "-b, --benchmark       Run the title unthrottled for the specified number of "
+                 "frames and print performance results as JSON\n"
+                 "-g, --gpu-replay      Replay the given GPU command stream capture through the "
+                 "loaded title's GPU and print timing results as JSON\n";
+}
+
+/// Returns the frametime at the given fraction of an already sorted frametime history.
+static double Percentile(const std::vector<double>& sorted_frametimes, double fraction) {
+    const auto index =
+        static_cast<std::size_t>(fraction * static_cast<double>(sorted_frametimes.size() - 1));
+    return sorted_frametimes[index];
 }
 
 static void PrintVersion() {
@@ -110,14 +127,18 @@ int main(int argc, char** argv) {
         {"version", no_argument, 0, 'v'},
         {"datastring", optional_argument, 0, 'd'},
         {"log", no_argument, 0, 'l'},
+        {"benchmark", required_argument, 0, 'b'},
+        {"gpu-replay", required_argument, 0, 'g'},
         {0, 0, 0, 0},
     };
 
     bool console_log = false;
     std::string datastring;
+    std::size_t benchmark_frames = 0;
+    std::string gpu_replay_path;
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "hvdl::", long_options, &option_index);
+        int arg = getopt_long(argc, argv, "hvdl::b:g:", long_options, &option_index);
         if (arg != -1) {
             switch (static_cast<char>(arg)) {
             case 'h':
@@ -133,6 +154,16 @@ int main(int argc, char** argv) {
             case 'l':
                 console_log = true;
                 break;
+            case 'b':
+                benchmark_frames = std::strtoull(optarg, nullptr, 0);
+                if (benchmark_frames == 0) {
+                    std::cout << "Invalid benchmark frame count" << std::endl;
+                    return -1;
+                }
+                break;
+            case 'g':
+                gpu_replay_path = optarg;
+                break;
             }
         } else {
 #ifdef _WIN32
@@ -161,6 +192,14 @@ int main(int argc, char** argv) {
     }
 
     Settings::values.use_gdbstub = false;
+    if (benchmark_frames > 0) {
+        // Benchmarks measure how fast the host can go, so never throttle to title speed.
+        Settings::values.use_frame_limit = false;
+    }
+    if (!gpu_replay_path.empty()) {
+        // Replay feeds the DMA pusher from this thread, so the GPU must process synchronously.
+        Settings::values.use_asynchronous_gpu_emulation = false;
+    }
     Settings::Apply();
 
     std::unique_ptr<EmuWindow_SDL2_Hide> emu_window{std::make_unique<EmuWindow_SDL2_Hide>()};
@@ -256,11 +295,92 @@ int main(int argc, char** argv) {
     system.GPU().Start();
     system.Renderer().Rasterizer().LoadDiskResources();
 
+    if (!gpu_replay_path.empty()) {
+        // Feed the captured command stream straight through the GPU without running the CPU, so
+        // the measurement only covers GPU-side emulation. The capture stores resolved command
+        // words, so no guest address space is required.
+        auto& gpu = system.GPU();
+        gpu.ObtainContext();
+
+        const auto start_time = std::chrono::steady_clock::now();
+        const auto replayed_words = Tegra::ReplayCommandStream(gpu, gpu_replay_path);
+        gpu.FlushCommands();
+        const auto end_time = std::chrono::steady_clock::now();
+
+        gpu.ReleaseContext();
+
+        if (!replayed_words) {
+            std::cout << "Failed to replay GPU command stream from " << gpu_replay_path
+                      << std::endl;
+            return -1;
+        }
+
+        const double elapsed_ms =
+            std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(end_time -
+                                                                                  start_time)
+                .count();
+        std::cout << fmt::format("{{\n"
+                                 "  \"capture\": \"{}\",\n"
+                                 "  \"command_words\": {},\n"
+                                 "  \"elapsed_ms\": {:.4f},\n"
+                                 "  \"words_per_second\": {:.0f}\n"
+                                 "}}",
+                                 gpu_replay_path, *replayed_words,
+                                 elapsed_ms, *replayed_words / (elapsed_ms / 1000.0))
+                  << std::endl;
+
+        detached_tasks.WaitForAllTasks();
+        return 0;
+    }
+
     system.Run();
-    while (!finished) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (benchmark_frames > 0) {
+        // Run until the requested number of frames has been presented instead of waiting for the
+        // test service. The hidden window takes no input, so runs are reproducible.
+        auto& perf_stats = system.GetPerfStats();
+        while (perf_stats.GetFrameCount() < benchmark_frames) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        system.Pause();
+
+        const double mean_frametime = perf_stats.GetMeanFrametime();
+        std::vector<double> frametimes = perf_stats.GetFrameTimeHistory();
+        std::sort(frametimes.begin(), frametimes.end());
+        const auto results = system.GetAndResetPerfStats();
+
+        u64 title_id{};
+        system.GetAppLoader().ReadProgramId(title_id);
+
+        if (frametimes.empty()) {
+            std::cout << "Benchmark ended before any frames were recorded" << std::endl;
+            return -1;
+        }
+
+        std::cout << fmt::format("{{\n"
+                                 "  \"title_id\": \"{:016X}\",\n"
+                                 "  \"frames\": {},\n"
+                                 "  \"speed\": {:.4f},\n"
+                                 "  \"game_fps\": {:.3f},\n"
+                                 "  \"frametime_mean_ms\": {:.4f},\n"
+                                 "  \"frametime_min_ms\": {:.4f},\n"
+                                 "  \"frametime_p50_ms\": {:.4f},\n"
+                                 "  \"frametime_p90_ms\": {:.4f},\n"
+                                 "  \"frametime_p95_ms\": {:.4f},\n"
+                                 "  \"frametime_p99_ms\": {:.4f},\n"
+                                 "  \"frametime_max_ms\": {:.4f}\n"
+                                 "}}",
+                                 title_id, frametimes.size(), results.emulation_speed,
+                                 results.game_fps, mean_frametime, frametimes.front(),
+                                 Percentile(frametimes, 0.50), Percentile(frametimes, 0.90),
+                                 Percentile(frametimes, 0.95), Percentile(frametimes, 0.99),
+                                 frametimes.back())
+                  << std::endl;
+    } else {
+        while (!finished) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        system.Pause();
     }
-    system.Pause();
 
     detached_tasks.WaitForAllTasks();
     return return_value;